@@ -12,6 +12,52 @@ static char    *a_internal_to_prev(const char **s);
 static a_cp     a_internal_to_prev_cp(const char **s);
 static size_t   a_internal_index_to_offset(const char *s, size_t index);
 static size_t   a_internal_gindex_to_offset(const char *s, size_t index);
+static size_t   a_internal_index_to_offset_rev(const char *str, size_t index);
+static size_t   a_internal_index_to_offset_rev_end(const char *str, const char *end, size_t index);
+static size_t   a_internal_count_cp(const char *s, size_t size);
+static size_t   a_internal_valid_utf8_size(const char *s, size_t size);
+static void     a_internal_fill(char *dst, const char *chr, size_t size, size_t count);
+static size_t   a_internal_count_nl(const char *s, size_t size);
+static size_t   a_internal_threads(size_t size, size_t min_size);
+static void     a_internal_split(const char *s, size_t size, size_t n, size_t *at);
+static void     a_internal_parallel(size_t n, void (*fn)(void *ctx, size_t i), void *ctx);
+
+/*
+ * Word-at-a-time (SWAR) helpers. A_SWAR_ONES has the low bit of every
+ * byte set, A_SWAR_HIGHS the high bit of every byte.
+ */
+#define A_SWAR_ONES ((size_t)-1 / 0xFF)
+#define A_SWAR_HIGHS (A_SWAR_ONES * 0x80)
+
+/* the most jobs a_internal_parallel() will run at once */
+#define A_MAX_THREADS 32
+
+/* lock-free code needs the GCC/Clang __atomic builtins, it takes a lock otherwise */
+#if A_INCLUDE_THREADS == 1 && defined(__GNUC__) \
+    && (defined(__clang__) || __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7))
+#   define A_ATOMICS 1
+#else
+#   define A_ATOMICS 0
+#endif
+
+/* FNV-1a, as wide as an unsigned long */
+#if ULONG_MAX > 0xFFFFFFFFUL
+#   define A_HASH_BASIS 14695981039346656037UL
+#   define A_HASH_PRIME 1099511628211UL
+#else
+#   define A_HASH_BASIS 2166136261UL
+#   define A_HASH_PRIME 16777619UL
+#endif
+
+static unsigned long a_hash_internal(const char *s, size_t size)
+{
+    const unsigned char *p = (const unsigned char*)s, *end = p + size;
+    unsigned long h = A_HASH_BASIS;
+
+    for (; p < end; ++p)
+        h = (h ^ *p) * A_HASH_PRIME;
+    return h;
+}
 
 
 static size_t a_internal_index_to_offset(const char *s, size_t index)
@@ -35,10 +81,82 @@ static size_t a_internal_gindex_to_offset(const char *s, size_t index)
 
 static size_t a_internal_index_to_offset_rev(const char *str, size_t index)
 {
-    const char *s = a_end_cstr(str);
+    return a_internal_index_to_offset_rev_end(str, a_end_cstr(str), index);
+}
+static size_t a_internal_index_to_offset_rev_end(const char *str, const char *end, size_t index)
+{
+    const char *s = end;
     
     while (s > str && index--)
         a_prev_cstr(&s);
     
     return s - str;
-}
\ No newline at end of file
+}
+
+/*
+ * Counts the code points in the first size bytes of s by counting
+ * everything that isn't a continuation byte, a word at a time.
+ */
+static size_t a_internal_count_cp_seq(const char *s, size_t size)
+{
+    const unsigned char *p = (const unsigned char*)s, *end = p + size;
+    size_t cont = 0;
+    
+    for (; (size_t)(end - p) >= sizeof (size_t); p += sizeof (size_t))
+    {
+        size_t w;
+        
+        memcpy(&w, p, sizeof w);
+        w = (w >> 7) & ~(w >> 6) & A_SWAR_ONES; /* 10xxxxxx -> 1 */
+        cont += (w * A_SWAR_ONES) >> ((sizeof (size_t) - 1) * CHAR_BIT);
+    }
+    for (; p < end; ++p)
+        cont += ((*p & 0xC0) == 0x80);
+    
+    return size - cont;
+}
+
+struct a_internal_count_cp_job
+{
+    const char *s;
+    size_t at[A_MAX_THREADS + 1];
+    size_t counts[A_MAX_THREADS];
+};
+
+static void a_internal_count_cp_job(void *ctx, size_t i)
+{
+    struct a_internal_count_cp_job *job = ctx;
+    job->counts[i] = a_internal_count_cp_seq(job->s + job->at[i], job->at[i+1] - job->at[i]);
+}
+
+/* same as above, large strings are counted a chunk per thread */
+static size_t a_internal_count_cp(const char *s, size_t size)
+{
+    struct a_internal_count_cp_job job;
+    size_t n = a_internal_threads(size, 0), i, count = 0;
+    
+    if (n == 1)
+        return a_internal_count_cp_seq(s, size);
+    
+    job.s = s;
+    a_internal_split(s, size, n, job.at);
+    a_internal_parallel(n, a_internal_count_cp_job, &job);
+    for (i = 0; i < n; ++i)
+        count += job.counts[i];
+    return count;
+}
+
+/*
+ * Writes count copies of the size bytes at chr into dst, doubling the
+ * already written part each time instead of copying one at a time.
+ */
+static void a_internal_fill(char *dst, const char *chr, size_t size, size_t count)
+{
+    size_t total = size * count, n;
+    
+    if (!total)
+        return;
+    memcpy(dst, chr, size);
+    for (n = size; n < total; n <<= 1)
+        memcpy(dst + n, dst, n < total - n ? n : total - n);
+}
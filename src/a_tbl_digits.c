@@ -0,0 +1,29 @@
+/*                                                                     
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC  
+ *                                                                     
+ * License: MIT                                                        
+ */                                                                    
+
+/**************************************************************************
+ *     WARNING                                                WARNING     *
+ *                                                                        *
+ *       THIS FILE WAS GENERATED. DO NOT MODIFY THIS CODE MANUALLY!       *
+ *                                                                        *
+ *       Generated from: ucd.all.flat.xml (Unicode 7.0.0)                 *
+ *                                                                        *
+ *       Every General_Category=Nd character belongs to a run of ten      *
+ *       consecutive code points with values 0-9; this lists the first    *
+ *       code point (the zero) of every run, sorted.                      *
+ *                                                                        *
+ **************************************************************************/
+#define A_MAX_DIGIT_ZEROS 54
+static const a_cp a_digit_zeros[A_MAX_DIGIT_ZEROS] = 
+{
+	0x00030, 0x00660, 0x006F0, 0x007C0, 0x00966, 0x009E6, 0x00A66, 0x00AE6,
+	0x00B66, 0x00BE6, 0x00C66, 0x00CE6, 0x00D66, 0x00DE6, 0x00E50, 0x00ED0,
+	0x00F20, 0x01040, 0x01090, 0x017E0, 0x01810, 0x01946, 0x019D0, 0x01A80,
+	0x01A90, 0x01B50, 0x01BB0, 0x01C40, 0x01C50, 0x0A620, 0x0A8D0, 0x0A900,
+	0x0A9D0, 0x0A9F0, 0x0AA50, 0x0ABF0, 0x0FF10, 0x104A0, 0x11066, 0x110F0,
+	0x11136, 0x111D0, 0x112F0, 0x114D0, 0x11650, 0x116C0, 0x118E0, 0x16A60,
+	0x16B50, 0x1D7CE, 0x1D7D8, 0x1D7E2, 0x1D7EC, 0x1D7F6
+};
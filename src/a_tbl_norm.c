@@ -0,0 +1,2980 @@
+/*                                                                     
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC  
+ *                                                                     
+ * License: MIT                                                        
+ */                                                                    
+
+/**************************************************************************
+ *     WARNING                                                WARNING     *
+ *                                                                        *
+ *       THIS FILE WAS GENERATED. DO NOT MODIFY THIS CODE MANUALLY!       *
+ *                                                                        *
+ *       Generated from: ucd.all.flat.xml (Unicode 7.0.0)                 *
+ *                                                                        *
+ *       Normalization data: the combining class and the full canonical   *
+ *       and compatibility decompositions of every code point (Hangul     *
+ *       syllables excluded, they are computed), and the pairs that       *
+ *       compose canonically (composition exclusions left out), sorted.   *
+ *                                                                        *
+ **************************************************************************/
+#define A_NORM_RECORD(cp) \
+(a_norm_record[a_norm_stage2[(a_norm_stage1[(cp) / 256] * 256) + ((cp) % 256)]])
+#define A_CCC(cp) (A_NORM_RECORD(cp).ccc)
+#define A_MAX_DECOMPOSITION_SIZE 18
+#define A_MAX_COMPOSITIONS 940
+struct a_norm_rec
+{
+    unsigned char ccc;
+    unsigned char len;              /* canonical decomposition     */
+    unsigned short at;
+    unsigned char klen;             /* compatibility decomposition */
+    unsigned short kat;
+};
+static const unsigned char a_norm_stage1[4352] = 
+{
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 17, 18, 17, 17, 17, 19, 20, 21, 22, 23, 24, 25,
+	26, 27, 28, 29, 30, 31, 32, 17, 17, 17, 17, 17, 33, 17, 34, 35, 36, 37, 38, 39, 40, 41, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 42, 43, 44, 45, 46, 47, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 48, 49, 50, 51, 52, 53, 54, 17, 55, 56, 57, 17, 17, 17, 17, 17, 17, 58, 17, 17, 17,
+	17, 17, 59, 60, 61, 62, 63, 64, 65, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 66, 67, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 68, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 69, 70, 17, 71, 72, 73, 74, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 75, 17, 17, 17, 17, 17, 76, 17, 17, 77, 78, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 79, 80, 81, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+	17, 17
+};
+static const unsigned short a_norm_stage2[20992] = 
+{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+	2, 0, 3, 0, 0, 0, 0, 4, 0, 0, 5, 6, 7, 8, 0, 0, 9, 10, 11, 0, 12, 13, 14, 0,
+	15, 16, 17, 18, 19, 20, 0, 21, 22, 23, 24, 25, 26, 27, 28, 29, 0, 30, 31, 32, 33, 34, 35, 0,
+	0, 36, 37, 38, 39, 40, 0, 0, 41, 42, 43, 44, 45, 46, 0, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+	0, 56, 57, 58, 59, 60, 61, 0, 0, 62, 63, 64, 65, 66, 0, 67, 68, 69, 70, 71, 72, 73, 74, 75,
+	76, 77, 78, 79, 80, 81, 82, 83, 0, 0, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97,
+	98, 99, 100, 101, 102, 103, 0, 0, 104, 105, 106, 107, 108, 109, 110, 111, 112, 0, 113, 114, 115, 116, 117, 118,
+	0, 119, 120, 121, 122, 123, 124, 125, 126, 0, 0, 127, 128, 129, 130, 131, 132, 133, 0, 0, 134, 135, 136, 137,
+	138, 139, 0, 0, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 0, 0,
+	158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 182, 183, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 184,
+	185, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 186, 187, 188, 189,
+	190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 0, 211, 212,
+	213, 214, 215, 216, 0, 0, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 0, 0,
+	233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255, 256,
+	257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 0, 0, 269, 270, 0, 0, 0, 0, 0, 0, 271, 272,
+	273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 285, 286, 287, 288, 289, 290, 291, 292,
+	293, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 294, 295, 296, 297, 298, 299, 0, 0, 300, 301, 181, 302, 303, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 305, 306, 306,
+	306, 306, 305, 307, 306, 306, 306, 306, 306, 308, 308, 306, 306, 306, 306, 308, 308, 306, 306, 306, 306, 306, 306, 306,
+	306, 306, 306, 306, 309, 309, 309, 309, 309, 306, 306, 306, 306, 304, 304, 304, 310, 311, 304, 312, 313, 314, 304, 306,
+	306, 306, 304, 304, 304, 306, 306, 0, 304, 304, 304, 306, 306, 306, 306, 304, 305, 306, 306, 304, 315, 316, 316, 315,
+	316, 316, 315, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 0, 0, 0, 0, 317, 0, 0, 0,
+	0, 0, 318, 0, 0, 0, 319, 0, 0, 0, 0, 0, 7, 320, 321, 322, 323, 324, 325, 0, 326, 0, 327, 328,
+	329, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 330, 331, 332, 333, 334, 335, 336, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 337, 338, 339, 340, 341, 0, 342, 343, 344, 345, 346, 347, 348, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	349, 350, 351, 0, 352, 353, 0, 0, 0, 354, 0, 0, 0, 0, 0, 0, 355, 356, 0, 357, 0, 0, 0, 358,
+	0, 0, 0, 0, 359, 360, 361, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 362, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 363, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	364, 365, 0, 366, 0, 0, 0, 367, 0, 0, 0, 0, 368, 369, 370, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 371, 372, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 304, 304, 304, 304, 304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 373, 374, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 375, 376, 377, 378, 0, 0, 379, 380, 0, 0, 381, 382, 383, 384, 385, 386,
+	0, 0, 387, 388, 389, 390, 391, 392, 0, 0, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404, 0, 0,
+	405, 406, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 407,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 306, 304, 304, 304, 304, 306, 304, 304, 304, 408, 306, 304, 304, 304, 304,
+	304, 304, 306, 306, 306, 306, 306, 306, 304, 304, 306, 304, 304, 408, 409, 304, 410, 411, 412, 413, 414, 415, 416, 417,
+	418, 419, 419, 420, 421, 422, 0, 423, 0, 424, 425, 0, 304, 306, 0, 418, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 304, 304, 304, 304, 304, 304, 304,
+	426, 427, 428, 0, 0, 0, 0, 0, 0, 0, 429, 430, 431, 432, 433, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 434, 435, 436, 426, 427, 428, 437, 438, 304, 304, 306, 306, 304, 304, 304, 304, 304, 306, 304, 304, 306,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 439, 0, 0, 0, 0, 440, 441, 442,
+	443, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	444, 0, 445, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 0, 0, 304, 304,
+	304, 304, 304, 304, 304, 0, 0, 304, 304, 304, 304, 306, 304, 0, 0, 304, 304, 0, 306, 304, 304, 306, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 447, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 306, 304, 304, 306, 304, 304, 306,
+	306, 306, 304, 306, 306, 304, 306, 304, 304, 304, 306, 304, 306, 304, 306, 304, 306, 304, 304, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 304, 304, 304, 304, 304, 304, 306, 304, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 304, 304, 304, 304, 0, 304, 304, 304, 304, 304, 304, 304, 304, 304, 0, 304, 304, 304,
+	0, 304, 304, 304, 304, 304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 306, 306, 306, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 304, 306, 304,
+	304, 306, 304, 304, 304, 306, 306, 306, 434, 435, 436, 304, 304, 304, 306, 304, 304, 306, 306, 304, 304, 304, 304, 304,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 448, 0, 0, 0, 0, 0, 0,
+	0, 449, 0, 0, 450, 0, 0, 0, 0, 0, 0, 0, 451, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 452, 0, 0, 0, 304, 306, 304, 304, 0, 0, 0, 453, 454, 455, 456, 457, 458, 459, 460,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 451, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 461, 462, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 463, 464, 0, 465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 466, 0, 0, 467, 0,
+	0, 0, 0, 0, 451, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 452, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 468, 469, 470, 0, 0, 471, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 451, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 451, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 472, 0, 0, 473, 474, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 475, 476, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 477, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 478, 479, 480, 452, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	481, 0, 0, 0, 0, 452, 0, 0, 0, 0, 0, 0, 0, 482, 483, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 451, 0, 0, 0,
+	484, 0, 0, 0, 0, 0, 0, 485, 486, 0, 487, 488, 0, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 489, 490, 491, 452, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 492, 0, 493, 494, 495, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 496, 0, 0, 0, 0, 497, 497, 452, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 498, 498, 498, 498, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 499, 0, 0, 0, 0,
+	500, 500, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 501, 501, 501, 501, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 502, 503, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 504, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	306, 306, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 306, 0, 306, 0, 307, 0, 0, 0, 0, 0, 0, 0, 0, 0, 505, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 506, 0, 0, 0, 0, 507, 0, 0, 0, 0, 508, 0, 0, 0, 0, 509, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 510, 0, 0, 0, 0, 0, 0, 0, 511, 512, 513, 514, 515, 516, 517,
+	518, 519, 512, 512, 512, 512, 0, 0, 512, 520, 304, 304, 452, 0, 304, 304, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 521, 0, 0, 0, 0, 0, 0, 0, 0, 0, 522, 0, 0, 0, 0, 523, 0, 0, 0, 0, 524,
+	0, 0, 0, 0, 525, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 526, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 306, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 527, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 451,
+	0, 452, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 306, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 528, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 304, 304,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 452, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 409, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 408, 304, 306, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 306, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 452, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 304, 304, 304, 304, 304, 304, 304, 0, 0, 306,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	304, 304, 304, 304, 304, 306, 306, 306, 306, 306, 306, 304, 304, 306, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 529, 0, 530, 0, 531, 0, 532, 0, 533, 0,
+	0, 0, 534, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 451, 0, 0, 0, 0, 0, 0, 535, 0, 536, 0, 0,
+	537, 538, 0, 539, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 306, 304, 304, 304,
+	304, 304, 304, 304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 452, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 451, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 452, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 451, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 304, 304, 0, 309, 306, 306, 306,
+	306, 306, 304, 304, 306, 306, 306, 306, 304, 0, 309, 309, 309, 309, 309, 309, 309, 0, 0, 0, 0, 306, 0, 0,
+	0, 0, 0, 0, 304, 0, 0, 0, 304, 304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 540, 541, 542, 0, 543, 544, 545, 546, 547, 548, 549, 550,
+	551, 552, 553, 0, 554, 555, 556, 557, 558, 559, 560, 3, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 0, 571,
+	572, 573, 11, 574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 342, 584, 585, 347, 586, 587, 288, 579, 582, 342, 584,
+	350, 347, 586, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 588, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 589, 590, 591, 592, 569, 593, 594, 595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606, 607, 608,
+	609, 610, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 343, 304, 304, 306, 304, 304, 304, 304, 304,
+	304, 304, 306, 304, 304, 316, 624, 306, 308, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304,
+	304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 0, 0,
+	0, 0, 0, 0, 315, 306, 304, 306, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640,
+	641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654, 655, 656, 657, 658, 659, 660, 661, 662, 663, 664,
+	665, 666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686, 687, 688,
+	689, 690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 711, 712,
+	713, 714, 715, 716, 717, 718, 719, 720, 721, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734, 735, 736,
+	737, 738, 739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753, 754, 755, 756, 757, 758, 759, 760,
+	761, 762, 763, 764, 765, 766, 767, 768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 0, 0, 0, 0,
+	781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800, 801, 802, 803, 804,
+	805, 806, 807, 808, 809, 810, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828,
+	829, 830, 831, 832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844, 845, 846, 847, 848, 849, 850, 851, 852,
+	853, 854, 855, 856, 857, 858, 859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869, 870, 0, 0, 0, 0, 0, 0,
+	871, 872, 873, 874, 875, 876, 877, 878, 879, 880, 881, 882, 883, 884, 885, 886, 887, 888, 889, 890, 891, 892, 0, 0,
+	893, 894, 895, 896, 897, 898, 0, 0, 899, 900, 901, 902, 903, 904, 905, 906, 907, 908, 909, 910, 911, 912, 913, 914,
+	915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 0, 0,
+	937, 938, 939, 940, 941, 942, 0, 0, 943, 944, 945, 946, 947, 948, 949, 950, 0, 951, 0, 952, 0, 953, 0, 954,
+	955, 956, 957, 958, 959, 960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 970, 971, 332, 972, 333, 973, 334, 974, 335,
+	975, 339, 976, 340, 977, 341, 0, 0, 978, 979, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990, 991, 992, 993,
+	994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017,
+	1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 0, 1031, 1032, 1033, 1034, 1035, 321, 1036, 1037, 1038, 1037,
+	1039, 1040, 1041, 1042, 1043, 0, 1044, 1045, 1046, 323, 1047, 324, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 329, 0, 0, 1055, 1056,
+	1057, 1058, 1059, 325, 0, 1060, 1061, 1062, 1063, 1064, 1065, 336, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 327, 1073, 1074, 320, 1075,
+	0, 0, 1076, 1077, 1078, 0, 1079, 1080, 1081, 326, 1082, 328, 1083, 1084, 1085, 0, 1086, 1087, 1, 1, 1, 1, 1, 1,
+	1, 1, 1, 0, 0, 0, 0, 0, 0, 1088, 0, 0, 0, 0, 0, 1089, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1090, 1091, 1092, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1093, 1094, 0, 1095, 1096,
+	0, 0, 0, 0, 1097, 0, 1098, 0, 0, 0, 0, 0, 0, 0, 0, 1099, 1100, 1101, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1102, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1103, 587, 0, 0, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115,
+	1103, 10, 5, 6, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 0, 3, 566, 11, 302, 567, 285, 571, 301,
+	572, 1115, 577, 181, 578, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1116, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 304, 304, 309, 309, 304, 304, 304, 304, 309, 309, 309, 304, 304, 0, 0, 0,
+	0, 304, 0, 0, 0, 309, 309, 304, 306, 304, 309, 309, 306, 306, 306, 306, 304, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1117, 1118, 1119, 1120, 0, 1121, 1122, 1123, 0, 1124, 570, 547, 547, 547, 285, 1125,
+	548, 548, 551, 301, 0, 553, 1126, 0, 0, 556, 1127, 557, 557, 557, 0, 0, 1128, 1129, 1130, 0, 1131, 0, 1132, 0,
+	1131, 0, 1133, 20, 542, 1119, 0, 566, 544, 1134, 0, 552, 11, 1135, 1136, 1137, 1138, 587, 0, 1139, 348, 584, 1140, 1141,
+	1142, 0, 0, 0, 0, 543, 565, 566, 587, 287, 0, 0, 0, 0, 0, 0, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150,
+	1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 548, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 551, 1119, 543, 552,
+	587, 1170, 1171, 1172, 582, 1173, 1174, 1175, 1176, 302, 1177, 1178, 301, 590, 565, 572, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1179, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1180, 1181, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1182, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1183, 1184, 1185,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1186, 0, 0, 0, 0, 1187, 0, 0, 1188, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1189, 0, 1190, 0, 0, 0, 0, 0, 1191, 1192, 0, 1193,
+	1194, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1195, 0, 0, 1196, 0, 0, 1197,
+	0, 1198, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1199, 0, 1200, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1201, 1202, 1203, 1204, 1205, 0, 0, 1206, 1207, 0, 0,
+	1208, 1209, 0, 0, 0, 0, 0, 0, 1210, 1211, 0, 0, 1212, 1213, 0, 0, 1214, 1215, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1216, 1217, 1218, 1219, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1220, 1221, 1222, 1223, 0, 0, 0, 0, 0, 0, 1224, 1225, 1226, 1227, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1228, 1229, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 10, 5, 6, 1104, 1105, 1106, 1107, 1108, 1109, 1230, 1231, 1232, 1233, 1234, 1235, 1236,
+	1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260,
+	1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283, 1284,
+	1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 540, 542,
+	1119, 543, 544, 1134, 546, 547, 548, 549, 550, 551, 552, 553, 554, 556, 1127, 557, 1307, 558, 559, 1162, 560, 1167, 1308, 1131,
+	3, 564, 590, 565, 566, 593, 570, 285, 587, 287, 571, 301, 572, 1115, 11, 577, 1309, 288, 181, 578, 579, 582, 292, 302,
+	293, 620, 1103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1310, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1311, 1312, 1313, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1314, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 287, 1162, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 304, 304, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1315,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 452, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 304, 304, 304, 304, 304, 304, 304,
+	304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 304,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1316, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1317, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325,
+	1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349,
+	1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373,
+	1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397,
+	1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421,
+	1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445,
+	1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469,
+	1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493,
+	1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517,
+	1518, 1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1532, 409, 305, 408, 1533, 1533, 0, 0, 0, 0, 0, 0, 1534, 0, 1341, 1535, 1536, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1537, 0, 1538, 0, 1539, 0, 1540, 0, 1541, 0, 1542, 0,
+	1543, 0, 1544, 0, 1545, 0, 1546, 0, 1547, 0, 1548, 0, 0, 1549, 0, 1550, 0, 1551, 0, 0, 0, 0, 0, 0,
+	1552, 1553, 0, 1554, 1555, 0, 1556, 1557, 0, 1558, 1559, 0, 1560, 1561, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1562, 0, 0, 0, 0, 1563, 1563, 1564, 1565, 0, 1566, 1567,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1568, 0, 1569, 0, 1570, 0, 1571, 0, 1572, 0, 1573, 0,
+	1574, 0, 1575, 0, 1576, 0, 1577, 0, 1578, 0, 1579, 0, 0, 1580, 0, 1581, 0, 1582, 0, 0, 0, 0, 0, 0,
+	1583, 1584, 0, 1585, 1586, 0, 1587, 1588, 0, 1589, 1590, 0, 1591, 1592, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1593, 0, 0, 1594, 1595, 1596, 1597, 0, 0, 0, 1598, 1599,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1600, 1601, 1602, 1603, 1604, 1605, 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622,
+	1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646,
+	1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669, 1670,
+	1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 0,
+	0, 0, 1318, 1324, 1694, 1695, 1696, 1697, 1698, 1699, 1322, 1700, 1701, 1702, 1703, 1326, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711,
+	1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 0,
+	1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758,
+	1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1384, 1773, 0, 0, 0, 0, 0, 0, 0, 0,
+	1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789, 1600, 1603, 1606, 1608, 1616, 1617, 1620, 1622,
+	1623, 1625, 1626, 1627, 1628, 1629, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 0,
+	1318, 1324, 1694, 1695, 1807, 1808, 1809, 1329, 1810, 1341, 1391, 1403, 1402, 1392, 1484, 1349, 1389, 1811, 1812, 1813, 1814, 1815, 1816, 1817,
+	1818, 1819, 1820, 1355, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1696, 1697, 1698, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837,
+	1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861,
+	1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885,
+	1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909,
+	1910, 1911, 1912, 1913, 1914, 1915, 1916, 0, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932,
+	1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956,
+	1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980,
+	1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004,
+	2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028,
+	2029, 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052,
+	2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076,
+	2077, 2078, 2079, 2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097, 2098, 2099, 2100,
+	2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124,
+	2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144, 2145, 2146, 2147, 2148,
+	2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 0, 0, 0, 0, 304, 304, 304, 304,
+	304, 304, 304, 304, 304, 304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2173, 2174, 0, 304, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	304, 304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2175, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2176, 2177, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 304, 304, 304, 304, 304, 304, 304,
+	304, 304, 304, 304, 304, 304, 304, 304, 304, 304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 306, 306, 306, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 451, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	304, 0, 304, 304, 306, 0, 0, 304, 304, 0, 0, 0, 0, 0, 304, 304, 0, 304, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 452, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2178, 2179, 2180, 2181, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2182, 2183, 2184, 2185, 2186, 2187, 2188, 2189, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203, 2204,
+	2205, 2206, 2207, 2208, 2209, 2210, 2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220, 2221, 2222, 2223, 2224, 2225, 2226, 2227, 2228,
+	2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236, 2237, 2238, 2239, 2240, 2241, 2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252,
+	2253, 2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271, 2272, 2201, 2273, 2274, 2275,
+	2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283, 2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299,
+	2300, 2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319, 2320, 2321, 2322, 2323,
+	2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2291, 2341, 2342, 2343, 2344, 2345, 2346,
+	2347, 2348, 2275, 2349, 2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363, 2364, 2365, 2366, 2367, 2368, 2201,
+	2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382, 2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392,
+	2393, 2394, 2395, 2277, 2396, 2397, 2398, 2399, 2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413, 2414, 2415,
+	2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2424, 2425, 2426, 2427, 2428, 2429, 2430, 2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438, 2439,
+	2440, 2441, 2442, 2443, 2444, 2445, 0, 0, 2446, 0, 2447, 0, 0, 2448, 2449, 2450, 2451, 2452, 2453, 2454, 2455, 2456, 2457, 0,
+	2458, 0, 2459, 0, 0, 2460, 2461, 0, 0, 0, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473, 2474, 2475,
+	2476, 2477, 2478, 2479, 2480, 2481, 2482, 2483, 2484, 2485, 2486, 2487, 2488, 2489, 2490, 2491, 2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499,
+	2500, 2501, 2502, 2503, 2504, 2505, 2506, 2330, 2507, 2508, 2509, 2510, 2511, 2512, 2512, 2513, 2514, 2515, 2516, 2517, 2518, 2519, 2520, 2460,
+	2521, 2522, 2523, 2524, 2525, 2526, 0, 0, 2527, 2528, 2529, 2530, 2531, 2532, 2533, 2534, 2474, 2535, 2536, 2537, 2446, 2538, 2539, 2540,
+	2541, 2542, 2543, 2544, 2545, 2546, 2547, 2548, 2549, 2483, 2550, 2484, 2551, 2552, 2553, 2554, 2555, 2447, 2222, 2556, 2557, 2558, 2292, 2379,
+	2559, 2560, 2491, 2561, 2492, 2562, 2563, 2564, 2449, 2565, 2566, 2567, 2568, 2569, 2450, 2570, 2571, 2572, 2573, 2574, 2575, 2506, 2576, 2577,
+	2330, 2578, 2510, 2579, 2580, 2581, 2582, 2583, 2515, 2584, 2459, 2585, 2516, 2273, 2586, 2517, 2587, 2519, 2588, 2589, 2590, 2591, 2592, 2521,
+	2455, 2593, 2522, 2594, 2523, 2595, 2189, 2596, 2597, 2598, 2599, 2600, 2601, 2602, 2603, 2604, 2605, 2606, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2607, 2608, 2609, 2610, 2611, 2612, 2612, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2613, 2614, 2615, 2616, 2617, 0, 0, 0, 0, 0, 2618, 2619, 2620, 2621, 1135, 1138, 2622, 2623, 2624, 2625, 2626,
+	2627, 1110, 2628, 2629, 2630, 2631, 2632, 2633, 2634, 2635, 2636, 2637, 2638, 2639, 2640, 0, 2641, 2642, 2643, 2644, 2645, 0, 2646, 0,
+	2647, 2648, 0, 2649, 2650, 0, 2651, 2652, 2653, 2654, 2655, 2656, 2657, 2658, 2659, 2660, 2661, 2661, 2662, 2662, 2662, 2662, 2663, 2663,
+	2663, 2663, 2664, 2664, 2664, 2664, 2665, 2665, 2665, 2665, 2666, 2666, 2666, 2666, 2667, 2667, 2667, 2667, 2668, 2668, 2668, 2668, 2669, 2669,
+	2669, 2669, 2670, 2670, 2670, 2670, 2671, 2671, 2671, 2671, 2672, 2672, 2672, 2672, 2673, 2673, 2673, 2673, 2674, 2674, 2675, 2675, 2676, 2676,
+	2677, 2677, 2678, 2678, 2679, 2679, 2680, 2680, 2680, 2680, 2681, 2681, 2681, 2681, 2682, 2682, 2682, 2682, 2683, 2683, 2683, 2683, 2684, 2684,
+	2685, 2685, 2685, 2685, 2686, 2686, 2687, 2687, 2687, 2687, 2688, 2688, 2688, 2688, 2689, 2689, 2690, 2690, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2691, 2691, 2691, 2691, 2692, 2692, 2693, 2693, 2694, 2694, 442, 2695, 2695, 2696, 2696, 2697, 2697, 2698, 2698, 2698, 2698,
+	2699, 2699, 2700, 2700, 2701, 2701, 2702, 2702, 2703, 2703, 2704, 2704, 2705, 2705, 2706, 2706, 2706, 2707, 2707, 2707, 2708, 2708, 2708, 2708,
+	2709, 2710, 2711, 2707, 2712, 2713, 2714, 2715, 2716, 2717, 2718, 2719, 2720, 2721, 2722, 2723, 2724, 2725, 2726, 2727, 2728, 2729, 2730, 2731,
+	2732, 2733, 2734, 2735, 2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743, 2744, 2745, 2746, 2747, 2748, 2749, 2750, 2751, 2752, 2753, 2754, 2755,
+	2756, 2757, 2758, 2759, 2760, 2761, 2762, 2763, 2764, 2765, 2766, 2767, 2768, 2769, 2770, 2771, 2772, 2773, 2774, 2775, 2776, 2777, 2778, 2779,
+	2780, 2781, 2782, 2783, 2784, 2785, 2786, 2787, 2788, 2789, 2790, 2791, 2792, 2793, 2794, 2795, 2796, 2797, 2798, 2799, 2800, 2801, 2802, 2803,
+	2804, 2805, 2806, 2807, 2808, 2809, 2711, 2810, 2707, 2712, 2811, 2812, 2716, 2813, 2717, 2718, 2814, 2815, 2722, 2816, 2723, 2724, 2817, 2818,
+	2726, 2819, 2727, 2728, 2757, 2758, 2761, 2762, 2763, 2767, 2768, 2769, 2770, 2774, 2775, 2776, 2820, 2780, 2821, 2822, 2786, 2823, 2787, 2788,
+	2801, 2824, 2825, 2796, 2826, 2797, 2798, 2709, 2710, 2827, 2711, 2828, 2713, 2714, 2715, 2716, 2829, 2719, 2720, 2721, 2722, 2830, 2726, 2729,
+	2730, 2731, 2732, 2733, 2735, 2736, 2737, 2738, 2739, 2740, 2831, 2741, 2742, 2743, 2744, 2745, 2746, 2748, 2749, 2750, 2751, 2752, 2753, 2754,
+	2755, 2756, 2759, 2760, 2764, 2765, 2766, 2767, 2768, 2771, 2772, 2773, 2774, 2832, 2777, 2778, 2779, 2780, 2783, 2784, 2785, 2786, 2833, 2789,
+	2790, 2834, 2793, 2794, 2795, 2796, 2835, 2711, 2828, 2716, 2829, 2722, 2830, 2726, 2836, 2739, 2837, 2838, 2839, 2767, 2768, 2774, 2786, 2833,
+	2796, 2835, 2840, 2841, 2842, 2843, 2844, 2845, 2846, 2847, 2848, 2849, 2850, 2851, 2852, 2853, 2854, 2855, 2856, 2857, 2858, 2859, 2860, 2861,
+	2862, 2863, 2864, 2865, 2838, 2866, 2867, 2868, 2869, 2843, 2844, 2845, 2846, 2847, 2848, 2849, 2850, 2851, 2852, 2853, 2854, 2855, 2856, 2857,
+	2858, 2859, 2860, 2861, 2862, 2863, 2864, 2865, 2838, 2866, 2867, 2868, 2869, 2863, 2864, 2865, 2838, 2837, 2839, 2747, 2736, 2737, 2738, 2863,
+	2864, 2865, 2747, 2748, 2870, 2870, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2871, 2872, 2872, 2873, 2874, 2875, 2876, 2877, 2878, 2878, 2879, 2880, 2881, 2882, 2883, 2884, 2884, 2885, 2886, 2886, 2887, 2887, 2888, 2889,
+	2889, 2890, 2891, 2891, 2892, 2892, 2893, 2894, 2894, 2895, 2895, 2896, 2897, 2898, 2899, 2899, 2900, 2901, 2902, 2903, 2904, 2904, 2905, 2906,
+	2907, 2908, 2909, 2910, 2910, 2911, 2911, 2912, 2912, 2913, 2914, 2915, 2916, 2917, 2918, 2919, 0, 0, 2920, 2921, 2922, 2923, 2924, 2925,
+	2925, 2926, 2927, 2928, 2929, 2929, 2930, 2931, 2932, 2933, 2934, 2935, 2936, 2937, 2938, 2939, 2940, 2941, 2942, 2943, 2944, 2945, 2946, 2947,
+	2948, 2949, 2950, 2951, 2905, 2907, 2952, 2953, 2954, 2955, 2956, 2957, 2956, 2954, 2958, 2959, 2960, 2961, 2962, 2957, 2898, 2888, 2963, 2964,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2965, 2966, 2967, 2968, 2969, 2970, 2971, 2972,
+	2973, 2974, 2975, 2976, 2977, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2978, 2979, 2980, 2981, 2982, 2983, 2984, 2985, 2986, 1092, 0, 0, 0, 0, 0, 0, 304, 304, 304, 304, 304, 304, 304, 306,
+	306, 306, 306, 306, 306, 306, 0, 0, 1091, 2987, 2988, 2989, 2989, 1113, 1114, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997, 2998,
+	2999, 3000, 3001, 3002, 3003, 0, 0, 3004, 3005, 1098, 1098, 1098, 1098, 2989, 2989, 2989, 2978, 2979, 1090, 0, 2982, 2981, 2984, 2983,
+	2987, 1113, 1114, 2990, 2991, 2992, 2993, 3006, 3007, 3008, 1110, 3009, 3010, 3011, 1112, 0, 3012, 3013, 3014, 3015, 0, 0, 0, 0,
+	3016, 3017, 3018, 0, 3019, 0, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031, 3031, 3032, 3032, 3033, 3033, 3034,
+	3034, 3035, 3035, 3035, 3035, 3036, 3036, 3037, 3037, 3037, 3037, 3038, 3038, 3039, 3039, 3039, 3039, 3040, 3040, 3040, 3040, 3041, 3041, 3041,
+	3041, 3042, 3042, 3042, 3042, 3043, 3043, 3043, 3043, 3044, 3044, 3045, 3045, 3046, 3046, 3047, 3047, 3048, 3048, 3048, 3048, 3049, 3049, 3049,
+	3049, 3050, 3050, 3050, 3050, 3051, 3051, 3051, 3051, 3052, 3052, 3052, 3052, 3053, 3053, 3053, 3053, 3054, 3054, 3054, 3054, 3055, 3055, 3055,
+	3055, 3056, 3056, 3056, 3056, 3057, 3057, 3057, 3057, 3058, 3058, 3058, 3058, 3059, 3059, 3059, 3059, 3060, 3060, 3060, 3060, 3061, 3061, 3061,
+	3061, 3062, 3062, 3062, 3062, 3063, 3063, 2699, 2699, 3064, 3064, 3064, 3064, 3065, 3065, 3066, 3066, 3067, 3067, 3068, 3068, 0, 0, 0,
+	0, 2983, 3069, 3006, 3013, 3014, 3007, 3070, 1113, 1114, 3008, 1110, 2978, 3009, 1090, 3071, 1103, 10, 5, 6, 1104, 1105, 1106, 1107,
+	1108, 1109, 2981, 2982, 3010, 1112, 3011, 2984, 3015, 540, 542, 1119, 543, 544, 1134, 546, 547, 548, 549, 550, 551, 552, 553, 554,
+	556, 1127, 557, 1307, 558, 559, 1162, 560, 1167, 1308, 1131, 3004, 3012, 3005, 3072, 2989, 3073, 3, 564, 590, 565, 566, 593, 570,
+	285, 587, 287, 571, 301, 572, 1115, 11, 577, 1309, 288, 181, 578, 579, 582, 292, 302, 293, 620, 2990, 3074, 2991, 3075, 3076,
+	3077, 2980, 3000, 3001, 2979, 3078, 1916, 3079, 3080, 3081, 3082, 3083, 3084, 3085, 3086, 3087, 3088, 1870, 1871, 1872, 1873, 1874, 1875, 1876,
+	1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900,
+	1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 3089, 3090, 3091, 1651, 1600, 1601, 1602, 1603, 1604, 1605, 1606,
+	1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629, 0,
+	0, 0, 1630, 1631, 1632, 1633, 1634, 1635, 0, 0, 1636, 1637, 1638, 1639, 1640, 1641, 0, 0, 1642, 1643, 1644, 1645, 1646, 1647,
+	0, 0, 1648, 1649, 1650, 0, 0, 0, 3092, 3093, 3094, 4, 3095, 3096, 3097, 0, 3098, 3099, 3100, 3101, 3102, 3103, 3104, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 306, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 306, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 304,
+	304, 304, 304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 306, 0, 304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	304, 309, 306, 0, 0, 0, 0, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 304, 306, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 452, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3105, 0, 3106, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 452, 451, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	304, 304, 304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3108, 3109,
+	0, 0, 0, 452, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 451, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 452, 451, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 451, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 451, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3110, 3111, 452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 304, 304, 304, 304, 304, 304, 0, 0, 0,
+	304, 304, 304, 304, 304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3112, 3113, 0, 3114, 0,
+	0, 0, 452, 451, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3115, 3116, 0, 0, 0, 452, 451, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 452,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 452, 451,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	309, 309, 309, 309, 309, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 304, 304, 304, 304, 304, 304, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 309, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3117, 3118,
+	3119, 3120, 3121, 3122, 3123, 307, 307, 309, 309, 309, 0, 0, 0, 3124, 307, 307, 307, 307, 307, 0, 0, 0, 0, 0,
+	0, 0, 0, 306, 306, 306, 306, 306, 306, 306, 306, 0, 0, 304, 304, 304, 304, 304, 306, 306, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 304, 304, 304, 304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3125, 3126, 3127, 3128, 3129,
+	3130, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 304, 304, 304, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 540, 542, 1119, 543, 544, 1134, 546, 547, 548, 549, 550, 551, 552, 553, 554, 556,
+	1127, 557, 1307, 558, 559, 1162, 560, 1167, 1308, 1131, 3, 564, 590, 565, 566, 593, 570, 285, 587, 287, 571, 301, 572, 1115,
+	11, 577, 1309, 288, 181, 578, 579, 582, 292, 302, 293, 620, 540, 542, 1119, 543, 544, 1134, 546, 547, 548, 549, 550, 551,
+	552, 553, 554, 556, 1127, 557, 1307, 558, 559, 1162, 560, 1167, 1308, 1131, 3, 564, 590, 565, 566, 593, 570, 0, 587, 287,
+	571, 301, 572, 1115, 11, 577, 1309, 288, 181, 578, 579, 582, 292, 302, 293, 620, 540, 542, 1119, 543, 544, 1134, 546, 547,
+	548, 549, 550, 551, 552, 553, 554, 556, 1127, 557, 1307, 558, 559, 1162, 560, 1167, 1308, 1131, 3, 564, 590, 565, 566, 593,
+	570, 285, 587, 287, 571, 301, 572, 1115, 11, 577, 1309, 288, 181, 578, 579, 582, 292, 302, 293, 620, 540, 0, 1119, 543,
+	0, 0, 546, 0, 0, 549, 550, 0, 0, 553, 554, 556, 1127, 0, 1307, 558, 559, 1162, 560, 1167, 1308, 1131, 3, 564,
+	590, 565, 0, 593, 0, 285, 587, 287, 571, 301, 572, 1115, 0, 577, 1309, 288, 181, 578, 579, 582, 292, 302, 293, 620,
+	540, 542, 1119, 543, 544, 1134, 546, 547, 548, 549, 550, 551, 552, 553, 554, 556, 1127, 557, 1307, 558, 559, 1162, 560, 1167,
+	1308, 1131, 3, 564, 590, 565, 566, 593, 570, 285, 587, 287, 571, 301, 572, 1115, 11, 577, 1309, 288, 181, 578, 579, 582,
+	292, 302, 293, 620, 540, 542, 0, 543, 544, 1134, 546, 0, 0, 549, 550, 551, 552, 553, 554, 556, 1127, 0, 1307, 558,
+	559, 1162, 560, 1167, 1308, 0, 3, 564, 590, 565, 566, 593, 570, 285, 587, 287, 571, 301, 572, 1115, 11, 577, 1309, 288,
+	181, 578, 579, 582, 292, 302, 293, 620, 540, 542, 0, 543, 544, 1134, 546, 0, 548, 549, 550, 551, 552, 0, 554, 0,
+	0, 0, 1307, 558, 559, 1162, 560, 1167, 1308, 0, 3, 564, 590, 565, 566, 593, 570, 285, 587, 287, 571, 301, 572, 1115,
+	11, 577, 1309, 288, 181, 578, 579, 582, 292, 302, 293, 620, 540, 542, 1119, 543, 544, 1134, 546, 547, 548, 549, 550, 551,
+	552, 553, 554, 556, 1127, 557, 1307, 558, 559, 1162, 560, 1167, 1308, 1131, 3, 564, 590, 565, 566, 593, 570, 285, 587, 287,
+	571, 301, 572, 1115, 11, 577, 1309, 288, 181, 578, 579, 582, 292, 302, 293, 620, 540, 542, 1119, 543, 544, 1134, 546, 547,
+	548, 549, 550, 551, 552, 553, 554, 556, 1127, 557, 1307, 558, 559, 1162, 560, 1167, 1308, 1131, 3, 564, 590, 565, 566, 593,
+	570, 285, 587, 287, 571, 301, 572, 1115, 11, 577, 1309, 288, 181, 578, 579, 582, 292, 302, 293, 620, 540, 542, 1119, 543,
+	544, 1134, 546, 547, 548, 549, 550, 551, 552, 553, 554, 556, 1127, 557, 1307, 558, 559, 1162, 560, 1167, 1308, 1131, 3, 564,
+	590, 565, 566, 593, 570, 285, 587, 287, 571, 301, 572, 1115, 11, 577, 1309, 288, 181, 578, 579, 582, 292, 302, 293, 620,
+	540, 542, 1119, 543, 544, 1134, 546, 547, 548, 549, 550, 551, 552, 553, 554, 556, 1127, 557, 1307, 558, 559, 1162, 560, 1167,
+	1308, 1131, 3, 564, 590, 565, 566, 593, 570, 285, 587, 287, 571, 301, 572, 1115, 11, 577, 1309, 288, 181, 578, 579, 582,
+	292, 302, 293, 620, 540, 542, 1119, 543, 544, 1134, 546, 547, 548, 549, 550, 551, 552, 553, 554, 556, 1127, 557, 1307, 558,
+	559, 1162, 560, 1167, 1308, 1131, 3, 564, 590, 565, 566, 593, 570, 285, 587, 287, 571, 301, 572, 1115, 11, 577, 1309, 288,
+	181, 578, 579, 582, 292, 302, 293, 620, 540, 542, 1119, 543, 544, 1134, 546, 547, 548, 549, 550, 551, 552, 553, 554, 556,
+	1127, 557, 1307, 558, 559, 1162, 560, 1167, 1308, 1131, 3, 564, 590, 565, 566, 593, 570, 285, 587, 287, 571, 301, 572, 1115,
+	11, 577, 1309, 288, 181, 578, 579, 582, 292, 302, 293, 620, 3131, 3132, 0, 0, 3133, 3134, 1140, 3135, 3136, 3137, 3138, 352,
+	3139, 3140, 3141, 3142, 3143, 3144, 3145, 1141, 3146, 352, 354, 3147, 344, 3148, 3149, 3150, 3151, 3152, 3153, 342, 584, 585, 353, 3154,
+	3155, 343, 3156, 349, 3157, 8, 3158, 3159, 3160, 348, 350, 351, 3161, 3162, 3163, 347, 586, 3164, 3165, 3166, 353, 343, 349, 347,
+	350, 348, 3133, 3134, 1140, 3135, 3136, 3137, 3138, 352, 3139, 3140, 3141, 3142, 3143, 3144, 3145, 1141, 3146, 352, 354, 3147, 344, 3148,
+	3149, 3150, 3151, 3152, 3153, 342, 584, 585, 353, 3154, 3155, 343, 3156, 349, 3157, 8, 3158, 3159, 3160, 348, 350, 351, 3161, 3162,
+	3163, 347, 586, 3164, 3165, 3166, 353, 343, 349, 347, 350, 348, 3133, 3134, 1140, 3135, 3136, 3137, 3138, 352, 3139, 3140, 3141, 3142,
+	3143, 3144, 3145, 1141, 3146, 352, 354, 3147, 344, 3148, 3149, 3150, 3151, 3152, 3153, 342, 584, 585, 353, 3154, 3155, 343, 3156, 349,
+	3157, 8, 3158, 3159, 3160, 348, 350, 351, 3161, 3162, 3163, 347, 586, 3164, 3165, 3166, 353, 343, 349, 347, 350, 348, 3133, 3134,
+	1140, 3135, 3136, 3137, 3138, 352, 3139, 3140, 3141, 3142, 3143, 3144, 3145, 1141, 3146, 352, 354, 3147, 344, 3148, 3149, 3150, 3151, 3152,
+	3153, 342, 584, 585, 353, 3154, 3155, 343, 3156, 349, 3157, 8, 3158, 3159, 3160, 348, 350, 351, 3161, 3162, 3163, 347, 586, 3164,
+	3165, 3166, 353, 343, 349, 347, 350, 348, 3133, 3134, 1140, 3135, 3136, 3137, 3138, 352, 3139, 3140, 3141, 3142, 3143, 3144, 3145, 1141,
+	3146, 352, 354, 3147, 344, 3148, 3149, 3150, 3151, 3152, 3153, 342, 584, 585, 353, 3154, 3155, 343, 3156, 349, 3157, 8, 3158, 3159,
+	3160, 348, 350, 351, 3161, 3162, 3163, 347, 586, 3164, 3165, 3166, 353, 343, 349, 347, 350, 348, 3167, 3168, 0, 0, 1103, 10,
+	5, 6, 1104, 1105, 1106, 1107, 1108, 1109, 1103, 10, 5, 6, 1104, 1105, 1106, 1107, 1108, 1109, 1103, 10, 5, 6, 1104, 1105,
+	1106, 1107, 1108, 1109, 1103, 10, 5, 6, 1104, 1105, 1106, 1107, 1108, 1109, 1103, 10, 5, 6, 1104, 1105, 1106, 1107, 1108, 1109,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 306, 306, 306, 306, 306, 306, 306, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3036, 3037, 3041, 3044, 0, 3063, 3047, 3042,
+	3052, 3064, 3058, 3059, 3060, 3061, 3048, 3054, 3056, 3050, 3057, 3046, 3049, 3039, 3040, 3043, 3045, 3051, 3053, 3055, 3169, 2684, 3170, 3171,
+	0, 3037, 3041, 0, 3062, 0, 0, 3042, 0, 3064, 3058, 3059, 3060, 3061, 3048, 3054, 3056, 3050, 3057, 0, 3049, 3039, 3040, 3043,
+	0, 3051, 0, 3055, 0, 0, 0, 0, 0, 0, 3041, 0, 0, 0, 0, 3042, 0, 3064, 0, 3059, 0, 3061, 3048, 3054,
+	0, 3050, 3057, 0, 3049, 0, 0, 3043, 0, 3051, 0, 3055, 0, 2684, 0, 3171, 0, 3037, 3041, 0, 3062, 0, 0, 3042,
+	3052, 3064, 3058, 0, 3060, 3061, 3048, 3054, 3056, 3050, 3057, 0, 3049, 3039, 3040, 3043, 0, 3051, 3053, 3055, 3169, 0, 3170, 0,
+	3036, 3037, 3041, 3044, 3062, 3063, 3047, 3042, 3052, 3064, 0, 3059, 3060, 3061, 3048, 3054, 3056, 3050, 3057, 3046, 3049, 3039, 3040, 3043,
+	3045, 3051, 3053, 3055, 0, 0, 0, 0, 0, 3037, 3041, 3044, 0, 3063, 3047, 3042, 3052, 3064, 0, 3059, 3060, 3061, 3048, 3054,
+	3056, 3050, 3057, 3046, 3049, 3039, 3040, 3043, 3045, 3051, 3053, 3055, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3172, 3173, 3174, 3175, 3176, 3177, 3178, 3179, 3180, 3181, 3182, 0, 0, 0, 0, 0,
+	3183, 3184, 3185, 3186, 3187, 3188, 3189, 3190, 3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 3201, 3202, 3203, 3204, 3205, 3206,
+	3207, 3208, 3209, 1119, 557, 3210, 3211, 0, 540, 542, 1119, 543, 544, 1134, 546, 547, 548, 549, 550, 551, 552, 553, 554, 556,
+	1127, 557, 1307, 558, 559, 1162, 560, 1167, 1308, 1131, 3212, 2102, 3213, 3214, 3215, 3216, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3217, 3218, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3219, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3220, 3221, 1880, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1381, 3222, 3223, 3224, 1324, 3225, 3226, 1702,
+	3227, 3228, 3229, 3230, 3231, 3232, 3233, 3234, 3235, 3236, 1417, 3237, 3238, 3239, 3240, 3241, 3242, 1318, 1694, 3243, 1829, 1697, 1830, 3244,
+	1473, 3245, 3246, 3247, 3248, 3249, 1812, 1391, 3250, 3251, 3252, 0, 0, 0, 0, 0, 3253, 3254, 3255, 3256, 3257, 3258, 3259, 3260,
+	3261, 0, 0, 0, 0, 0, 0, 0, 3262, 3263, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3264, 3265, 3266, 3267, 3268, 2468, 3269, 3270,
+	3271, 3272, 2469, 3273, 3274, 3275, 2470, 3276, 3277, 3278, 3279, 3280, 3281, 3282, 3283, 3284, 3285, 3286, 3287, 2528, 3288, 3289, 3290, 3291,
+	3292, 3293, 3294, 3295, 3296, 2533, 2471, 2472, 2534, 3297, 3298, 2279, 3299, 2473, 3300, 3301, 3302, 3303, 3303, 3303, 3304, 3305, 3306, 3307,
+	3308, 3309, 3310, 3311, 3312, 3313, 3314, 3315, 3316, 3317, 3318, 3319, 3320, 3321, 3321, 2536, 3322, 3323, 3324, 3325, 2475, 3326, 3327, 3328,
+	2432, 3329, 3330, 3331, 3332, 3333, 3334, 3335, 3336, 3337, 3338, 3339, 3340, 3341, 3342, 3343, 3344, 3345, 3346, 3347, 3348, 3349, 3350, 3351,
+	3352, 3353, 3354, 3354, 3355, 3356, 3357, 2275, 3358, 3359, 3360, 3361, 3362, 3363, 3364, 3365, 2480, 3366, 3367, 3368, 3369, 3370, 3371, 3372,
+	3373, 3374, 3375, 3376, 3377, 3378, 3379, 3380, 3381, 3382, 3383, 3384, 3385, 3386, 2221, 3387, 3388, 3389, 3389, 3390, 3391, 3391, 3392, 3393,
+	3394, 3395, 3396, 3397, 3398, 3399, 3400, 3401, 3402, 3403, 3404, 2481, 3405, 3406, 3407, 3408, 2548, 3408, 3409, 2483, 3410, 3411, 3412, 3413,
+	2484, 2194, 3414, 3415, 3416, 3417, 3418, 3419, 3420, 3421, 3422, 3423, 3424, 3425, 3426, 3427, 3428, 3429, 3430, 3431, 3432, 3433, 3434, 3435,
+	2485, 3436, 3437, 3438, 3439, 3440, 3441, 2487, 3442, 3443, 3444, 3445, 3446, 3447, 3448, 3449, 2222, 2556, 3450, 3451, 3452, 3453, 3454, 3455,
+	3456, 3457, 2488, 3458, 3459, 3460, 3461, 2599, 3462, 3463, 3464, 3465, 3466, 3467, 3468, 3469, 3470, 3471, 3472, 3473, 3474, 2292, 3475, 3476,
+	3477, 3478, 3479, 3480, 3481, 3482, 3483, 3484, 3485, 2489, 2379, 3486, 3487, 3488, 3489, 3490, 3491, 3492, 3493, 2560, 3494, 3495, 3496, 3497,
+	3498, 3499, 3500, 3501, 2561, 3502, 3503, 3504, 3505, 3506, 3507, 3508, 3509, 3510, 3511, 3512, 3513, 2563, 3514, 3515, 3516, 3517, 3518, 3519,
+	3520, 3521, 3522, 3523, 3524, 3524, 3525, 3526, 2565, 3527, 3528, 3529, 3530, 3531, 3532, 3533, 2278, 3534, 3535, 3536, 3537, 3538, 3539, 3540,
+	2571, 3541, 3542, 3543, 3544, 3545, 3546, 3546, 2572, 2601, 3547, 3548, 3549, 3550, 3551, 2240, 2574, 3552, 3553, 2500, 3554, 3555, 2454, 3556,
+	3557, 2504, 3558, 3559, 3560, 3561, 3561, 3562, 3563, 3564, 3565, 3566, 3567, 3568, 3569, 3570, 3571, 3572, 3573, 3574, 3575, 3576, 3577, 3578,
+	3579, 3580, 3581, 3582, 3583, 3584, 3585, 3586, 3587, 3588, 2510, 3589, 3590, 3591, 3592, 3593, 3594, 3595, 3596, 3597, 3598, 3599, 3600, 3601,
+	3602, 3603, 3604, 3390, 3605, 3606, 3607, 3608, 3609, 3610, 3611, 3612, 3613, 3614, 3615, 3616, 2296, 3617, 3618, 3619, 3620, 3621, 3622, 2513,
+	3623, 3624, 3625, 3626, 3627, 3628, 3629, 3630, 3631, 3632, 3633, 3634, 3635, 3636, 3637, 3638, 3639, 3640, 3641, 3642, 2235, 3643, 3644, 3645,
+	3646, 3647, 3648, 2581, 3649, 3650, 3651, 3652, 3653, 3654, 3655, 3656, 3657, 3658, 3659, 3660, 3661, 3662, 3663, 3664, 3665, 3666, 3667, 3668,
+	2586, 2587, 3669, 3670, 3671, 3672, 3673, 3674, 3675, 3676, 3677, 3678, 3679, 3680, 3681, 2588, 3682, 3683, 3684, 3685, 3686, 3687, 3688, 3689,
+	3690, 3691, 3692, 3693, 3694, 3695, 3696, 3697, 3698, 3699, 3700, 3701, 3702, 3703, 3704, 3705, 3706, 3707, 3708, 3709, 3710, 3711, 2594, 2594,
+	3712, 3713, 3714, 3715, 3716, 3717, 3718, 3719, 3720, 3721, 2595, 3722, 3723, 3724, 3725, 3726, 3727, 3728, 3729, 3730, 3731, 3732, 3733, 3734,
+	3735, 3736, 3737, 3738, 3739, 3740, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+static const struct a_norm_rec a_norm_record[3741] = 
+{
+	{0,0,0,0,0}, {0,0,0,1,0}, {0,0,0,2,1}, {0,0,0,1,3},
+	{0,0,0,2,4}, {0,0,0,1,6}, {0,0,0,1,7}, {0,0,0,2,8},
+	{0,0,0,1,10}, {0,0,0,2,11}, {0,0,0,1,13}, {0,0,0,1,14},
+	{0,0,0,3,15}, {0,0,0,3,18}, {0,0,0,3,21}, {0,2,24,2,24},
+	{0,2,26,2,26}, {0,2,28,2,28}, {0,2,30,2,30}, {0,2,32,2,32},
+	{0,2,34,2,34}, {0,2,36,2,36}, {0,2,38,2,38}, {0,2,40,2,40},
+	{0,2,42,2,42}, {0,2,44,2,44}, {0,2,46,2,46}, {0,2,48,2,48},
+	{0,2,50,2,50}, {0,2,52,2,52}, {0,2,54,2,54}, {0,2,56,2,56},
+	{0,2,58,2,58}, {0,2,60,2,60}, {0,2,62,2,62}, {0,2,64,2,64},
+	{0,2,66,2,66}, {0,2,68,2,68}, {0,2,70,2,70}, {0,2,72,2,72},
+	{0,2,74,2,74}, {0,2,76,2,76}, {0,2,78,2,78}, {0,2,80,2,80},
+	{0,2,82,2,82}, {0,2,84,2,84}, {0,2,86,2,86}, {0,2,88,2,88},
+	{0,2,90,2,90}, {0,2,92,2,92}, {0,2,94,2,94}, {0,2,96,2,96},
+	{0,2,98,2,98}, {0,2,100,2,100}, {0,2,102,2,102}, {0,2,104,2,104},
+	{0,2,106,2,106}, {0,2,108,2,108}, {0,2,110,2,110}, {0,2,112,2,112},
+	{0,2,114,2,114}, {0,2,116,2,116}, {0,2,118,2,118}, {0,2,120,2,120},
+	{0,2,122,2,122}, {0,2,124,2,124}, {0,2,126,2,126}, {0,2,128,2,128},
+	{0,2,130,2,130}, {0,2,132,2,132}, {0,2,134,2,134}, {0,2,136,2,136},
+	{0,2,138,2,138}, {0,2,140,2,140}, {0,2,142,2,142}, {0,2,144,2,144},
+	{0,2,146,2,146}, {0,2,148,2,148}, {0,2,150,2,150}, {0,2,152,2,152},
+	{0,2,154,2,154}, {0,2,156,2,156}, {0,2,158,2,158}, {0,2,160,2,160},
+	{0,2,162,2,162}, {0,2,164,2,164}, {0,2,166,2,166}, {0,2,168,2,168},
+	{0,2,170,2,170}, {0,2,172,2,172}, {0,2,174,2,174}, {0,2,176,2,176},
+	{0,2,178,2,178}, {0,2,180,2,180}, {0,2,182,2,182}, {0,2,184,2,184},
+	{0,2,186,2,186}, {0,2,188,2,188}, {0,2,190,2,190}, {0,2,192,2,192},
+	{0,2,194,2,194}, {0,2,196,2,196}, {0,2,198,2,198}, {0,2,200,2,200},
+	{0,2,202,2,202}, {0,2,204,2,204}, {0,2,206,2,206}, {0,2,208,2,208},
+	{0,2,210,2,210}, {0,2,212,2,212}, {0,2,214,2,214}, {0,2,216,2,216},
+	{0,2,218,2,218}, {0,0,0,2,220}, {0,0,0,2,222}, {0,2,224,2,224},
+	{0,2,226,2,226}, {0,2,228,2,228}, {0,2,230,2,230}, {0,2,232,2,232},
+	{0,2,234,2,234}, {0,2,236,2,236}, {0,2,238,2,238}, {0,2,240,2,240},
+	{0,2,242,2,242}, {0,0,0,2,244}, {0,0,0,2,246}, {0,2,248,2,248},
+	{0,2,250,2,250}, {0,2,252,2,252}, {0,2,254,2,254}, {0,2,256,2,256},
+	{0,2,258,2,258}, {0,0,0,2,260}, {0,2,262,2,262}, {0,2,264,2,264},
+	{0,2,266,2,266}, {0,2,268,2,268}, {0,2,270,2,270}, {0,2,272,2,272},
+	{0,2,274,2,274}, {0,2,276,2,276}, {0,2,278,2,278}, {0,2,280,2,280},
+	{0,2,282,2,282}, {0,2,284,2,284}, {0,2,286,2,286}, {0,2,288,2,288},
+	{0,2,290,2,290}, {0,2,292,2,292}, {0,2,294,2,294}, {0,2,296,2,296},
+	{0,2,298,2,298}, {0,2,300,2,300}, {0,2,302,2,302}, {0,2,304,2,304},
+	{0,2,306,2,306}, {0,2,308,2,308}, {0,2,310,2,310}, {0,2,312,2,312},
+	{0,2,314,2,314}, {0,2,316,2,316}, {0,2,318,2,318}, {0,2,320,2,320},
+	{0,2,322,2,322}, {0,2,324,2,324}, {0,2,326,2,326}, {0,2,328,2,328},
+	{0,2,330,2,330}, {0,2,332,2,332}, {0,2,334,2,334}, {0,2,336,2,336},
+	{0,2,338,2,338}, {0,2,340,2,340}, {0,2,342,2,342}, {0,2,344,2,344},
+	{0,2,346,2,346}, {0,2,348,2,348}, {0,2,350,2,350}, {0,2,352,2,352},
+	{0,2,354,2,354}, {0,0,0,1,356}, {0,2,357,2,357}, {0,2,359,2,359},
+	{0,2,361,2,361}, {0,2,363,2,363}, {0,0,0,3,365}, {0,0,0,3,368},
+	{0,0,0,3,371}, {0,0,0,2,374}, {0,0,0,2,376}, {0,0,0,2,378},
+	{0,0,0,2,380}, {0,0,0,2,382}, {0,0,0,2,384}, {0,2,386,2,386},
+	{0,2,388,2,388}, {0,2,390,2,390}, {0,2,392,2,392}, {0,2,394,2,394},
+	{0,2,396,2,396}, {0,2,398,2,398}, {0,2,400,2,400}, {0,3,402,3,402},
+	{0,3,405,3,405}, {0,3,408,3,408}, {0,3,411,3,411}, {0,3,414,3,414},
+	{0,3,417,3,417}, {0,3,420,3,420}, {0,3,423,3,423}, {0,3,426,3,426},
+	{0,3,429,3,429}, {0,3,432,3,432}, {0,3,435,3,435}, {0,2,438,2,438},
+	{0,2,440,2,440}, {0,2,442,2,442}, {0,2,444,2,444}, {0,2,446,2,446},
+	{0,2,448,2,448}, {0,2,450,2,450}, {0,2,452,2,452}, {0,3,454,3,454},
+	{0,3,457,3,457}, {0,2,460,2,460}, {0,2,462,2,462}, {0,2,464,2,464},
+	{0,0,0,2,466}, {0,0,0,2,468}, {0,0,0,2,470}, {0,2,472,2,472},
+	{0,2,474,2,474}, {0,2,476,2,476}, {0,2,478,2,478}, {0,3,480,3,480},
+	{0,3,483,3,483}, {0,2,486,2,486}, {0,2,488,2,488}, {0,2,490,2,490},
+	{0,2,492,2,492}, {0,2,494,2,494}, {0,2,496,2,496}, {0,2,498,2,498},
+	{0,2,500,2,500}, {0,2,502,2,502}, {0,2,504,2,504}, {0,2,506,2,506},
+	{0,2,508,2,508}, {0,2,510,2,510}, {0,2,512,2,512}, {0,2,514,2,514},
+	{0,2,516,2,516}, {0,2,518,2,518}, {0,2,520,2,520}, {0,2,522,2,522},
+	{0,2,524,2,524}, {0,2,526,2,526}, {0,2,528,2,528}, {0,2,530,2,530},
+	{0,2,532,2,532}, {0,2,534,2,534}, {0,2,536,2,536}, {0,2,538,2,538},
+	{0,2,540,2,540}, {0,2,542,2,542}, {0,2,544,2,544}, {0,2,546,2,546},
+	{0,2,548,2,548}, {0,2,550,2,550}, {0,2,552,2,552}, {0,2,554,2,554},
+	{0,2,556,2,556}, {0,2,558,2,558}, {0,2,560,2,560}, {0,3,562,3,562},
+	{0,3,565,3,565}, {0,3,568,3,568}, {0,3,571,3,571}, {0,2,574,2,574},
+	{0,2,576,2,576}, {0,3,578,3,578}, {0,3,581,3,581}, {0,2,584,2,584},
+	{0,2,586,2,586}, {0,0,0,1,588}, {0,0,0,1,589}, {0,0,0,1,590},
+	{0,0,0,1,591}, {0,0,0,1,592}, {0,0,0,1,593}, {0,0,0,1,594},
+	{0,0,0,1,595}, {0,0,0,1,596}, {0,0,0,2,597}, {0,0,0,2,599},
+	{0,0,0,2,601}, {0,0,0,2,603}, {0,0,0,2,605}, {0,0,0,2,607},
+	{0,0,0,1,609}, {0,0,0,1,610}, {0,0,0,1,611}, {0,0,0,1,612},
+	{230,0,0,0,0}, {232,0,0,0,0}, {220,0,0,0,0}, {216,0,0,0,0},
+	{202,0,0,0,0}, {1,0,0,0,0}, {230,1,613,1,613}, {230,1,614,1,614},
+	{230,1,615,1,615}, {230,2,616,2,616}, {240,0,0,0,0}, {233,0,0,0,0},
+	{234,0,0,0,0}, {0,1,618,1,618}, {0,0,0,2,619}, {0,1,621,1,621},
+	{0,2,622,3,624}, {0,2,627,2,627}, {0,1,629,1,629}, {0,2,630,2,630},
+	{0,2,632,2,632}, {0,2,634,2,634}, {0,2,636,2,636}, {0,2,638,2,638},
+	{0,2,640,2,640}, {0,3,642,3,642}, {0,2,645,2,645}, {0,2,647,2,647},
+	{0,2,649,2,649}, {0,2,651,2,651}, {0,2,653,2,653}, {0,2,655,2,655},
+	{0,3,657,3,657}, {0,2,660,2,660}, {0,2,662,2,662}, {0,2,664,2,664},
+	{0,2,666,2,666}, {0,2,668,2,668}, {0,0,0,1,670}, {0,0,0,1,671},
+	{0,0,0,1,672}, {0,2,673,2,638}, {0,2,675,2,647}, {0,0,0,1,677},
+	{0,0,0,1,678}, {0,0,0,1,679}, {0,0,0,1,680}, {0,0,0,1,681},
+	{0,0,0,1,682}, {0,0,0,1,683}, {0,0,0,1,684}, {0,2,685,2,685},
+	{0,2,687,2,687}, {0,2,689,2,689}, {0,2,691,2,691}, {0,2,693,2,693},
+	{0,2,695,2,695}, {0,2,697,2,697}, {0,2,699,2,699}, {0,2,701,2,701},
+	{0,2,703,2,703}, {0,2,705,2,705}, {0,2,707,2,707}, {0,2,709,2,709},
+	{0,2,711,2,711}, {0,2,713,2,713}, {0,2,715,2,715}, {0,2,717,2,717},
+	{0,2,719,2,719}, {0,2,721,2,721}, {0,2,723,2,723}, {0,2,725,2,725},
+	{0,2,727,2,727}, {0,2,729,2,729}, {0,2,731,2,731}, {0,2,733,2,733},
+	{0,2,735,2,735}, {0,2,737,2,737}, {0,2,739,2,739}, {0,2,741,2,741},
+	{0,2,743,2,743}, {0,2,745,2,745}, {0,2,747,2,747}, {0,2,749,2,749},
+	{0,2,751,2,751}, {0,2,753,2,753}, {0,2,755,2,755}, {0,2,757,2,757},
+	{0,2,759,2,759}, {0,2,761,2,761}, {0,2,763,2,763}, {0,2,765,2,765},
+	{0,2,767,2,767}, {0,2,769,2,769}, {0,2,771,2,771}, {0,2,773,2,773},
+	{0,2,775,2,775}, {0,2,777,2,777}, {0,2,779,2,779}, {0,2,781,2,781},
+	{0,2,783,2,783}, {0,2,785,2,785}, {0,2,787,2,787}, {0,0,0,2,789},
+	{222,0,0,0,0}, {228,0,0,0,0}, {10,0,0,0,0}, {11,0,0,0,0},
+	{12,0,0,0,0}, {13,0,0,0,0}, {14,0,0,0,0}, {15,0,0,0,0},
+	{16,0,0,0,0}, {17,0,0,0,0}, {18,0,0,0,0}, {19,0,0,0,0},
+	{20,0,0,0,0}, {21,0,0,0,0}, {22,0,0,0,0}, {23,0,0,0,0},
+	{24,0,0,0,0}, {25,0,0,0,0}, {30,0,0,0,0}, {31,0,0,0,0},
+	{32,0,0,0,0}, {0,2,791,2,791}, {0,2,793,2,793}, {0,2,795,2,795},
+	{0,2,797,2,797}, {0,2,799,2,799}, {27,0,0,0,0}, {28,0,0,0,0},
+	{29,0,0,0,0}, {33,0,0,0,0}, {34,0,0,0,0}, {35,0,0,0,0},
+	{0,0,0,2,801}, {0,0,0,2,803}, {0,0,0,2,805}, {0,0,0,2,807},
+	{0,2,809,2,809}, {0,2,811,2,811}, {0,2,813,2,813}, {36,0,0,0,0},
+	{0,2,815,2,815}, {0,2,817,2,817}, {0,2,819,2,819}, {7,0,0,0,0},
+	{9,0,0,0,0}, {0,2,821,2,821}, {0,2,823,2,823}, {0,2,825,2,825},
+	{0,2,827,2,827}, {0,2,829,2,829}, {0,2,831,2,831}, {0,2,833,2,833},
+	{0,2,835,2,835}, {0,2,837,2,837}, {0,2,839,2,839}, {0,2,841,2,841},
+	{0,2,843,2,843}, {0,2,845,2,845}, {0,2,847,2,847}, {0,2,849,2,849},
+	{0,2,851,2,851}, {0,2,853,2,853}, {0,2,855,2,855}, {0,2,857,2,857},
+	{0,2,859,2,859}, {0,2,861,2,861}, {0,2,863,2,863}, {0,2,865,2,865},
+	{0,2,867,2,867}, {0,2,869,2,869}, {0,2,871,2,871}, {0,2,873,2,873},
+	{0,2,875,2,875}, {0,2,877,2,877}, {84,0,0,0,0}, {91,0,0,0,0},
+	{0,2,879,2,879}, {0,2,881,2,881}, {0,2,883,2,883}, {0,2,885,2,885},
+	{0,3,887,3,887}, {0,2,890,2,890}, {0,2,892,2,892}, {0,2,894,2,894},
+	{0,2,896,2,896}, {0,2,898,2,898}, {0,3,900,3,900}, {0,2,903,2,903},
+	{0,0,0,2,905}, {103,0,0,0,0}, {107,0,0,0,0}, {0,0,0,2,907},
+	{118,0,0,0,0}, {122,0,0,0,0}, {0,0,0,2,909}, {0,0,0,2,911},
+	{0,0,0,1,913}, {0,2,914,2,914}, {0,2,916,2,916}, {0,2,918,2,918},
+	{0,2,920,2,920}, {0,2,922,2,922}, {0,2,924,2,924}, {129,0,0,0,0},
+	{130,0,0,0,0}, {0,2,926,2,926}, {132,0,0,0,0}, {0,2,928,2,928},
+	{0,2,930,2,930}, {0,0,0,3,932}, {0,2,935,2,935}, {0,0,0,3,937},
+	{0,2,940,2,940}, {0,2,942,2,942}, {0,2,944,2,944}, {0,2,946,2,946},
+	{0,2,948,2,948}, {0,2,950,2,950}, {0,2,952,2,952}, {0,2,954,2,954},
+	{0,0,0,1,956}, {0,2,957,2,957}, {0,2,959,2,959}, {0,2,961,2,961},
+	{0,2,963,2,963}, {0,2,965,2,965}, {0,2,967,2,967}, {0,2,969,2,969},
+	{0,2,971,2,971}, {0,2,973,2,973}, {0,2,975,2,975}, {0,2,977,2,977},
+	{0,0,0,1,979}, {0,0,0,1,980}, {0,0,0,1,981}, {0,0,0,1,982},
+	{0,0,0,1,983}, {0,0,0,1,984}, {0,0,0,1,985}, {0,0,0,1,986},
+	{0,0,0,1,987}, {0,0,0,1,988}, {0,0,0,1,989}, {0,0,0,1,990},
+	{0,0,0,1,991}, {0,0,0,1,992}, {0,0,0,1,993}, {0,0,0,1,994},
+	{0,0,0,1,995}, {0,0,0,1,996}, {0,0,0,1,997}, {0,0,0,1,998},
+	{0,0,0,1,999}, {0,0,0,1,1000}, {0,0,0,1,1001}, {0,0,0,1,1002},
+	{0,0,0,1,1003}, {0,0,0,1,1004}, {0,0,0,1,1005}, {0,0,0,1,1006},
+	{0,0,0,1,1007}, {0,0,0,1,1008}, {0,0,0,1,1009}, {0,0,0,1,1010},
+	{0,0,0,1,1011}, {0,0,0,1,1012}, {0,0,0,1,1013}, {0,0,0,1,1014},
+	{0,0,0,1,1015}, {0,0,0,1,1016}, {0,0,0,1,1017}, {0,0,0,1,1018},
+	{0,0,0,1,1019}, {0,0,0,1,1020}, {0,0,0,1,1021}, {0,0,0,1,1022},
+	{0,0,0,1,1023}, {0,0,0,1,1024}, {0,0,0,1,1025}, {0,0,0,1,1026},
+	{0,0,0,1,1027}, {0,0,0,1,1028}, {0,0,0,1,1029}, {0,0,0,1,1030},
+	{0,0,0,1,1031}, {0,0,0,1,1032}, {0,0,0,1,1033}, {0,0,0,1,1034},
+	{0,0,0,1,1035}, {0,0,0,1,1036}, {0,0,0,1,1037}, {0,0,0,1,1038},
+	{0,0,0,1,1039}, {0,0,0,1,1040}, {0,0,0,1,1041}, {0,0,0,1,1042},
+	{0,0,0,1,1043}, {0,0,0,1,1044}, {0,0,0,1,1045}, {0,0,0,1,1046},
+	{0,0,0,1,1047}, {0,0,0,1,1048}, {0,0,0,1,1049}, {0,0,0,1,1050},
+	{0,0,0,1,1051}, {0,0,0,1,1052}, {0,0,0,1,1053}, {0,0,0,1,1054},
+	{0,0,0,1,1055}, {0,0,0,1,1056}, {0,0,0,1,1057}, {0,0,0,1,1058},
+	{0,0,0,1,1059}, {0,0,0,1,1060}, {0,0,0,1,1061}, {0,0,0,1,1062},
+	{214,0,0,0,0}, {0,2,1063,2,1063}, {0,2,1065,2,1065}, {0,2,1067,2,1067},
+	{0,2,1069,2,1069}, {0,2,1071,2,1071}, {0,2,1073,2,1073}, {0,2,1075,2,1075},
+	{0,2,1077,2,1077}, {0,3,1079,3,1079}, {0,3,1082,3,1082}, {0,2,1085,2,1085},
+	{0,2,1087,2,1087}, {0,2,1089,2,1089}, {0,2,1091,2,1091}, {0,2,1093,2,1093},
+	{0,2,1095,2,1095}, {0,2,1097,2,1097}, {0,2,1099,2,1099}, {0,2,1101,2,1101},
+	{0,2,1103,2,1103}, {0,3,1105,3,1105}, {0,3,1108,3,1108}, {0,3,1111,3,1111},
+	{0,3,1114,3,1114}, {0,2,1117,2,1117}, {0,2,1119,2,1119}, {0,2,1121,2,1121},
+	{0,2,1123,2,1123}, {0,3,1125,3,1125}, {0,3,1128,3,1128}, {0,2,1131,2,1131},
+	{0,2,1133,2,1133}, {0,2,1135,2,1135}, {0,2,1137,2,1137}, {0,2,1139,2,1139},
+	{0,2,1141,2,1141}, {0,2,1143,2,1143}, {0,2,1145,2,1145}, {0,2,1147,2,1147},
+	{0,2,1149,2,1149}, {0,2,1151,2,1151}, {0,2,1153,2,1153}, {0,2,1155,2,1155},
+	{0,2,1157,2,1157}, {0,2,1159,2,1159}, {0,2,1161,2,1161}, {0,3,1163,3,1163},
+	{0,3,1166,3,1166}, {0,2,1169,2,1169}, {0,2,1171,2,1171}, {0,2,1173,2,1173},
+	{0,2,1175,2,1175}, {0,2,1177,2,1177}, {0,2,1179,2,1179}, {0,2,1181,2,1181},
+	{0,2,1183,2,1183}, {0,3,1185,3,1185}, {0,3,1188,3,1188}, {0,2,1191,2,1191},
+	{0,2,1193,2,1193}, {0,2,1195,2,1195}, {0,2,1197,2,1197}, {0,2,1199,2,1199},
+	{0,2,1201,2,1201}, {0,2,1203,2,1203}, {0,2,1205,2,1205}, {0,2,1207,2,1207},
+	{0,2,1209,2,1209}, {0,2,1211,2,1211}, {0,2,1213,2,1213}, {0,2,1215,2,1215},
+	{0,2,1217,2,1217}, {0,2,1219,2,1219}, {0,2,1221,2,1221}, {0,2,1223,2,1223},
+	{0,2,1225,2,1225}, {0,3,1227,3,1227}, {0,3,1230,3,1230}, {0,3,1233,3,1233},
+	{0,3,1236,3,1236}, {0,3,1239,3,1239}, {0,3,1242,3,1242}, {0,3,1245,3,1245},
+	{0,3,1248,3,1248}, {0,2,1251,2,1251}, {0,2,1253,2,1253}, {0,2,1255,2,1255},
+	{0,2,1257,2,1257}, {0,2,1259,2,1259}, {0,2,1261,2,1261}, {0,2,1263,2,1263},
+	{0,2,1265,2,1265}, {0,3,1267,3,1267}, {0,3,1270,3,1270}, {0,2,1273,2,1273},
+	{0,2,1275,2,1275}, {0,2,1277,2,1277}, {0,2,1279,2,1279}, {0,2,1281,2,1281},
+	{0,2,1283,2,1283}, {0,3,1285,3,1285}, {0,3,1288,3,1288}, {0,3,1291,3,1291},
+	{0,3,1294,3,1294}, {0,3,1297,3,1297}, {0,3,1300,3,1300}, {0,2,1303,2,1303},
+	{0,2,1305,2,1305}, {0,2,1307,2,1307}, {0,2,1309,2,1309}, {0,2,1311,2,1311},
+	{0,2,1313,2,1313}, {0,2,1315,2,1315}, {0,2,1317,2,1317}, {0,2,1319,2,1319},
+	{0,2,1321,2,1321}, {0,2,1323,2,1323}, {0,2,1325,2,1325}, {0,2,1327,2,1327},
+	{0,2,1329,2,1329}, {0,3,1331,3,1331}, {0,3,1334,3,1334}, {0,3,1337,3,1337},
+	{0,3,1340,3,1340}, {0,2,1343,2,1343}, {0,2,1345,2,1345}, {0,2,1347,2,1347},
+	{0,2,1349,2,1349}, {0,2,1351,2,1351}, {0,2,1353,2,1353}, {0,2,1355,2,1355},
+	{0,2,1357,2,1357}, {0,2,1359,2,1359}, {0,2,1361,2,1361}, {0,2,1363,2,1363},
+	{0,2,1365,2,1365}, {0,2,1367,2,1367}, {0,2,1369,2,1369}, {0,2,1371,2,1371},
+	{0,2,1373,2,1373}, {0,2,1375,2,1375}, {0,2,1377,2,1377}, {0,2,1379,2,1379},
+	{0,2,1381,2,1381}, {0,2,1383,2,1383}, {0,2,1385,2,1385}, {0,2,1387,2,1387},
+	{0,2,1389,2,1389}, {0,2,1391,2,1391}, {0,2,1393,2,1393}, {0,2,1395,2,1395},
+	{0,2,1397,2,1397}, {0,2,1399,2,1399}, {0,2,1401,2,1401}, {0,0,0,2,1403},
+	{0,2,1405,2,1279}, {0,2,1407,2,1407}, {0,2,1409,2,1409}, {0,2,1411,2,1411},
+	{0,2,1413,2,1413}, {0,3,1415,3,1415}, {0,3,1418,3,1418}, {0,3,1421,3,1421},
+	{0,3,1424,3,1424}, {0,3,1427,3,1427}, {0,3,1430,3,1430}, {0,3,1433,3,1433},
+	{0,3,1436,3,1436}, {0,3,1439,3,1439}, {0,3,1442,3,1442}, {0,3,1445,3,1445},
+	{0,3,1448,3,1448}, {0,3,1451,3,1451}, {0,3,1454,3,1454}, {0,3,1457,3,1457},
+	{0,3,1460,3,1460}, {0,3,1463,3,1463}, {0,3,1466,3,1466}, {0,3,1469,3,1469},
+	{0,3,1472,3,1472}, {0,2,1475,2,1475}, {0,2,1477,2,1477}, {0,2,1479,2,1479},
+	{0,2,1481,2,1481}, {0,2,1483,2,1483}, {0,2,1485,2,1485}, {0,3,1487,3,1487},
+	{0,3,1490,3,1490}, {0,3,1493,3,1493}, {0,3,1496,3,1496}, {0,3,1499,3,1499},
+	{0,3,1502,3,1502}, {0,3,1505,3,1505}, {0,3,1508,3,1508}, {0,3,1511,3,1511},
+	{0,3,1514,3,1514}, {0,2,1517,2,1517}, {0,2,1519,2,1519}, {0,2,1521,2,1521},
+	{0,2,1523,2,1523}, {0,2,1525,2,1525}, {0,2,1527,2,1527}, {0,2,1529,2,1529},
+	{0,2,1531,2,1531}, {0,3,1533,3,1533}, {0,3,1536,3,1536}, {0,3,1539,3,1539},
+	{0,3,1542,3,1542}, {0,3,1545,3,1545}, {0,3,1548,3,1548}, {0,3,1551,3,1551},
+	{0,3,1554,3,1554}, {0,3,1557,3,1557}, {0,3,1560,3,1560}, {0,3,1563,3,1563},
+	{0,3,1566,3,1566}, {0,3,1569,3,1569}, {0,3,1572,3,1572}, {0,3,1575,3,1575},
+	{0,3,1578,3,1578}, {0,3,1581,3,1581}, {0,3,1584,3,1584}, {0,3,1587,3,1587},
+	{0,3,1590,3,1590}, {0,2,1593,2,1593}, {0,2,1595,2,1595}, {0,2,1597,2,1597},
+	{0,2,1599,2,1599}, {0,3,1601,3,1601}, {0,3,1604,3,1604}, {0,3,1607,3,1607},
+	{0,3,1610,3,1610}, {0,3,1613,3,1613}, {0,3,1616,3,1616}, {0,3,1619,3,1619},
+	{0,3,1622,3,1622}, {0,3,1625,3,1625}, {0,3,1628,3,1628}, {0,2,1631,2,1631},
+	{0,2,1633,2,1633}, {0,2,1635,2,1635}, {0,2,1637,2,1637}, {0,2,1639,2,1639},
+	{0,2,1641,2,1641}, {0,2,1643,2,1643}, {0,2,1645,2,1645}, {0,2,1647,2,1647},
+	{0,2,1649,2,1649}, {0,3,1651,3,1651}, {0,3,1654,3,1654}, {0,3,1657,3,1657},
+	{0,3,1660,3,1660}, {0,3,1663,3,1663}, {0,3,1666,3,1666}, {0,2,1669,2,1669},
+	{0,2,1671,2,1671}, {0,3,1673,3,1673}, {0,3,1676,3,1676}, {0,3,1679,3,1679},
+	{0,3,1682,3,1682}, {0,3,1685,3,1685}, {0,3,1688,3,1688}, {0,2,1691,2,1691},
+	{0,2,1693,2,1693}, {0,3,1695,3,1695}, {0,3,1698,3,1698}, {0,3,1701,3,1701},
+	{0,3,1704,3,1704}, {0,2,1707,2,1707}, {0,2,1709,2,1709}, {0,3,1711,3,1711},
+	{0,3,1714,3,1714}, {0,3,1717,3,1717}, {0,3,1720,3,1720}, {0,2,1723,2,1723},
+	{0,2,1725,2,1725}, {0,3,1727,3,1727}, {0,3,1730,3,1730}, {0,3,1733,3,1733},
+	{0,3,1736,3,1736}, {0,3,1739,3,1739}, {0,3,1742,3,1742}, {0,2,1745,2,1745},
+	{0,2,1747,2,1747}, {0,3,1749,3,1749}, {0,3,1752,3,1752}, {0,3,1755,3,1755},
+	{0,3,1758,3,1758}, {0,3,1761,3,1761}, {0,3,1764,3,1764}, {0,2,1767,2,1767},
+	{0,2,1769,2,1769}, {0,3,1771,3,1771}, {0,3,1774,3,1774}, {0,3,1777,3,1777},
+	{0,3,1780,3,1780}, {0,3,1783,3,1783}, {0,3,1786,3,1786}, {0,2,1789,2,1789},
+	{0,2,1791,2,1791}, {0,3,1793,3,1793}, {0,3,1796,3,1796}, {0,3,1799,3,1799},
+	{0,3,1802,3,1802}, {0,3,1805,3,1805}, {0,3,1808,3,1808}, {0,2,1811,2,1811},
+	{0,2,1813,2,1813}, {0,3,1815,3,1815}, {0,3,1818,3,1818}, {0,3,1821,3,1821},
+	{0,3,1824,3,1824}, {0,2,1827,2,1827}, {0,2,1829,2,1829}, {0,3,1831,3,1831},
+	{0,3,1834,3,1834}, {0,3,1837,3,1837}, {0,3,1840,3,1840}, {0,2,1843,2,1843},
+	{0,2,1845,2,1845}, {0,3,1847,3,1847}, {0,3,1850,3,1850}, {0,3,1853,3,1853},
+	{0,3,1856,3,1856}, {0,3,1859,3,1859}, {0,3,1862,3,1862}, {0,2,1865,2,1865},
+	{0,3,1867,3,1867}, {0,3,1870,3,1870}, {0,3,1873,3,1873}, {0,2,1876,2,1876},
+	{0,2,1878,2,1878}, {0,3,1880,3,1880}, {0,3,1883,3,1883}, {0,3,1886,3,1886},
+	{0,3,1889,3,1889}, {0,3,1892,3,1892}, {0,3,1895,3,1895}, {0,2,1898,2,1898},
+	{0,2,1900,2,1900}, {0,3,1902,3,1902}, {0,3,1905,3,1905}, {0,3,1908,3,1908},
+	{0,3,1911,3,1911}, {0,3,1914,3,1914}, {0,3,1917,3,1917}, {0,2,1920,2,1920},
+	{0,2,1922,2,1922}, {0,2,1924,2,1924}, {0,2,1926,2,1926}, {0,2,1928,2,1928},
+	{0,2,1930,2,1930}, {0,2,1932,2,1932}, {0,3,1934,3,1934}, {0,3,1937,3,1937},
+	{0,4,1940,4,1940}, {0,4,1944,4,1944}, {0,4,1948,4,1948}, {0,4,1952,4,1952},
+	{0,4,1956,4,1956}, {0,4,1960,4,1960}, {0,3,1964,3,1964}, {0,3,1967,3,1967},
+	{0,4,1970,4,1970}, {0,4,1974,4,1974}, {0,4,1978,4,1978}, {0,4,1982,4,1982},
+	{0,4,1986,4,1986}, {0,4,1990,4,1990}, {0,3,1994,3,1994}, {0,3,1997,3,1997},
+	{0,4,2000,4,2000}, {0,4,2004,4,2004}, {0,4,2008,4,2008}, {0,4,2012,4,2012},
+	{0,4,2016,4,2016}, {0,4,2020,4,2020}, {0,3,2024,3,2024}, {0,3,2027,3,2027},
+	{0,4,2030,4,2030}, {0,4,2034,4,2034}, {0,4,2038,4,2038}, {0,4,2042,4,2042},
+	{0,4,2046,4,2046}, {0,4,2050,4,2050}, {0,3,2054,3,2054}, {0,3,2057,3,2057},
+	{0,4,2060,4,2060}, {0,4,2064,4,2064}, {0,4,2068,4,2068}, {0,4,2072,4,2072},
+	{0,4,2076,4,2076}, {0,4,2080,4,2080}, {0,3,2084,3,2084}, {0,3,2087,3,2087},
+	{0,4,2090,4,2090}, {0,4,2094,4,2094}, {0,4,2098,4,2098}, {0,4,2102,4,2102},
+	{0,4,2106,4,2106}, {0,4,2110,4,2110}, {0,2,2114,2,2114}, {0,2,2116,2,2116},
+	{0,3,2118,3,2118}, {0,2,2121,2,2121}, {0,3,2123,3,2123}, {0,2,2126,2,2126},
+	{0,3,2128,3,2128}, {0,2,2131,2,2131}, {0,2,2133,2,2133}, {0,2,2135,2,2135},
+	{0,2,2137,2,2137}, {0,0,0,2,2139}, {0,1,2141,1,2141}, {0,0,0,2,2142},
+	{0,2,2144,3,2146}, {0,3,2149,3,2149}, {0,2,2152,2,2152}, {0,3,2154,3,2154},
+	{0,2,2157,2,2157}, {0,3,2159,3,2159}, {0,2,2162,2,2162}, {0,2,2164,2,2164},
+	{0,2,2166,2,2166}, {0,2,2168,3,2170}, {0,2,2173,3,2175}, {0,2,2178,3,2180},
+	{0,2,2183,2,2183}, {0,2,2185,2,2185}, {0,3,2187,3,2187}, {0,2,2190,2,2190},
+	{0,3,2192,3,2192}, {0,2,2195,2,2195}, {0,2,2197,2,2197}, {0,2,2199,2,2199},
+	{0,2,2201,3,2203}, {0,2,2206,3,2208}, {0,2,2211,3,2213}, {0,2,2216,2,2216},
+	{0,2,2218,2,2218}, {0,3,2220,3,2220}, {0,2,2223,2,2223}, {0,2,2225,2,2225},
+	{0,2,2227,2,2227}, {0,3,2229,3,2229}, {0,2,2232,2,2232}, {0,2,2234,2,2234},
+	{0,2,2236,2,2236}, {0,2,2238,2,2238}, {0,2,2240,3,2242}, {0,1,2245,1,2245},
+	{0,3,2246,3,2246}, {0,2,2249,2,2249}, {0,3,2251,3,2251}, {0,2,2254,2,2254},
+	{0,3,2256,3,2256}, {0,2,2259,2,2259}, {0,2,2261,2,2261}, {0,2,2263,2,2263},
+	{0,1,2265,2,8}, {0,0,0,2,2266}, {0,1,2268,1,0}, {0,1,2269,1,0},
+	{0,0,0,1,2270}, {0,0,0,2,2271}, {0,0,0,1,2273}, {0,0,0,2,2274},
+	{0,0,0,3,2276}, {0,0,0,2,2279}, {0,0,0,3,2281}, {0,0,0,2,2284},
+	{0,0,0,3,2286}, {0,0,0,2,2289}, {0,0,0,2,2291}, {0,0,0,2,2293},
+	{0,0,0,2,2295}, {0,0,0,2,2297}, {0,0,0,4,2299}, {0,0,0,1,2303},
+	{0,0,0,1,2304}, {0,0,0,1,2305}, {0,0,0,1,2306}, {0,0,0,1,2307},
+	{0,0,0,1,2308}, {0,0,0,1,2309}, {0,0,0,1,2310}, {0,0,0,1,2311},
+	{0,0,0,1,2312}, {0,0,0,1,2313}, {0,0,0,1,2314}, {0,0,0,1,2315},
+	{0,0,0,2,2316}, {0,0,0,3,2318}, {0,0,0,3,2321}, {0,0,0,1,2324},
+	{0,0,0,2,2325}, {0,0,0,3,2327}, {0,0,0,3,2330}, {0,0,0,1,2333},
+	{0,0,0,2,2334}, {0,0,0,1,2336}, {0,0,0,2,2337}, {0,0,0,1,2339},
+	{0,0,0,2,2340}, {0,0,0,3,2342}, {0,0,0,2,2345}, {0,0,0,1,2347},
+	{0,1,2348,1,2348}, {0,1,989,1,989}, {0,0,0,1,2349}, {0,0,0,1,2350},
+	{0,0,0,1,2351}, {0,0,0,1,2352}, {0,0,0,1,2353}, {0,0,0,3,2354},
+	{0,0,0,1,2357}, {0,0,0,1,2358}, {0,0,0,1,2359}, {0,0,0,3,2360},
+	{0,0,0,3,2363}, {0,0,0,4,2366}, {0,0,0,3,2370}, {0,0,0,3,2373},
+	{0,0,0,3,2376}, {0,0,0,3,2379}, {0,0,0,3,2382}, {0,0,0,3,2385},
+	{0,0,0,3,2388}, {0,0,0,3,2391}, {0,0,0,3,2394}, {0,0,0,3,2397},
+	{0,0,0,3,2400}, {0,0,0,3,2403}, {0,0,0,2,2406}, {0,0,0,2,2408},
+	{0,0,0,3,2410}, {0,0,0,2,2413}, {0,0,0,1,2415}, {0,0,0,2,2416},
+	{0,0,0,3,2418}, {0,0,0,4,2421}, {0,0,0,2,2425}, {0,0,0,1,2427},
+	{0,0,0,2,2428}, {0,0,0,3,2430}, {0,0,0,2,2433}, {0,0,0,3,2435},
+	{0,0,0,2,2438}, {0,0,0,2,2440}, {0,0,0,3,2442}, {0,0,0,4,2445},
+	{0,0,0,2,2449}, {0,0,0,2,2451}, {0,0,0,3,2453}, {0,0,0,3,2456},
+	{0,2,2459,2,2459}, {0,2,2461,2,2461}, {0,2,2463,2,2463}, {0,2,2465,2,2465},
+	{0,2,2467,2,2467}, {0,2,2469,2,2469}, {0,2,2471,2,2471}, {0,2,2473,2,2473},
+	{0,2,2475,2,2475}, {0,2,2477,2,2477}, {0,2,2479,2,2479}, {0,0,0,2,2481},
+	{0,0,0,3,2483}, {0,0,0,2,2486}, {0,0,0,3,2488}, {0,2,2491,2,2491},
+	{0,2,2493,2,2493}, {0,2,2495,2,2495}, {0,2,2497,2,2497}, {0,2,2499,2,2499},
+	{0,2,2501,2,2501}, {0,2,2503,2,2503}, {0,2,2505,2,2505}, {0,2,2507,2,2507},
+	{0,2,2509,2,2509}, {0,2,2511,2,2511}, {0,2,2513,2,2513}, {0,2,2515,2,2515},
+	{0,2,2517,2,2517}, {0,2,2519,2,2519}, {0,2,2521,2,2521}, {0,2,2523,2,2523},
+	{0,2,2525,2,2525}, {0,2,2527,2,2527}, {0,2,2529,2,2529}, {0,2,2531,2,2531},
+	{0,2,2533,2,2533}, {0,2,2535,2,2535}, {0,2,2537,2,2537}, {0,2,2539,2,2539},
+	{0,2,2541,2,2541}, {0,2,2543,2,2543}, {0,2,2545,2,2545}, {0,2,2547,2,2547},
+	{0,2,2549,2,2549}, {0,2,2551,2,2551}, {0,2,2553,2,2553}, {0,2,2555,2,2555},
+	{0,1,2557,1,2557}, {0,1,2558,1,2558}, {0,0,0,2,2559}, {0,0,0,2,2561},
+	{0,0,0,2,2563}, {0,0,0,2,2565}, {0,0,0,2,2567}, {0,0,0,2,2569},
+	{0,0,0,2,2571}, {0,0,0,2,2573}, {0,0,0,2,2575}, {0,0,0,2,2577},
+	{0,0,0,2,2579}, {0,0,0,3,2581}, {0,0,0,3,2584}, {0,0,0,3,2587},
+	{0,0,0,3,2590}, {0,0,0,3,2593}, {0,0,0,3,2596}, {0,0,0,3,2599},
+	{0,0,0,3,2602}, {0,0,0,3,2605}, {0,0,0,4,2608}, {0,0,0,4,2612},
+	{0,0,0,4,2616}, {0,0,0,4,2620}, {0,0,0,4,2624}, {0,0,0,4,2628},
+	{0,0,0,4,2632}, {0,0,0,4,2636}, {0,0,0,4,2640}, {0,0,0,4,2644},
+	{0,0,0,4,2648}, {0,0,0,2,2652}, {0,0,0,2,2654}, {0,0,0,2,2656},
+	{0,0,0,2,2658}, {0,0,0,2,2660}, {0,0,0,2,2662}, {0,0,0,2,2664},
+	{0,0,0,2,2666}, {0,0,0,2,2668}, {0,0,0,3,2670}, {0,0,0,3,2673},
+	{0,0,0,3,2676}, {0,0,0,3,2679}, {0,0,0,3,2682}, {0,0,0,3,2685},
+	{0,0,0,3,2688}, {0,0,0,3,2691}, {0,0,0,3,2694}, {0,0,0,3,2697},
+	{0,0,0,3,2700}, {0,0,0,3,2703}, {0,0,0,3,2706}, {0,0,0,3,2709},
+	{0,0,0,3,2712}, {0,0,0,3,2715}, {0,0,0,3,2718}, {0,0,0,3,2721},
+	{0,0,0,3,2724}, {0,0,0,3,2727}, {0,0,0,3,2730}, {0,0,0,3,2733},
+	{0,0,0,3,2736}, {0,0,0,3,2739}, {0,0,0,3,2742}, {0,0,0,3,2745},
+	{0,0,0,3,2748}, {0,0,0,3,2751}, {0,0,0,3,2754}, {0,0,0,3,2757},
+	{0,0,0,3,2760}, {0,0,0,3,2763}, {0,0,0,3,2766}, {0,0,0,3,2769},
+	{0,0,0,3,2772}, {0,0,0,3,2775}, {0,0,0,3,2778}, {0,0,0,1,2781},
+	{0,0,0,1,2782}, {0,0,0,1,2783}, {0,0,0,4,2784}, {0,0,0,3,2788},
+	{0,0,0,2,2791}, {0,0,0,3,2793}, {0,2,2796,2,2796}, {0,0,0,1,2798},
+	{0,0,0,1,2799}, {0,0,0,1,2800}, {0,0,0,1,2801}, {0,0,0,1,2802},
+	{0,0,0,1,2803}, {0,0,0,1,2804}, {0,0,0,1,2805}, {0,0,0,1,2806},
+	{0,0,0,1,2807}, {0,0,0,1,2808}, {0,0,0,1,2809}, {0,0,0,1,2810},
+	{0,0,0,1,2811}, {0,0,0,1,2812}, {0,0,0,1,2813}, {0,0,0,1,2814},
+	{0,0,0,1,2815}, {0,0,0,1,2816}, {0,0,0,1,2817}, {0,0,0,1,2818},
+	{0,0,0,1,2819}, {0,0,0,1,2820}, {0,0,0,1,2821}, {0,0,0,1,2822},
+	{0,0,0,1,2823}, {0,0,0,1,2824}, {0,0,0,1,2825}, {0,0,0,1,2826},
+	{0,0,0,1,2827}, {0,0,0,1,2828}, {0,0,0,1,2829}, {0,0,0,1,2830},
+	{0,0,0,1,2831}, {0,0,0,1,2832}, {0,0,0,1,2833}, {0,0,0,1,2834},
+	{0,0,0,1,2835}, {0,0,0,1,2836}, {0,0,0,1,2837}, {0,0,0,1,2838},
+	{0,0,0,1,2839}, {0,0,0,1,2840}, {0,0,0,1,2841}, {0,0,0,1,2842},
+	{0,0,0,1,2843}, {0,0,0,1,2844}, {0,0,0,1,2845}, {0,0,0,1,2846},
+	{0,0,0,1,2847}, {0,0,0,1,2848}, {0,0,0,1,2849}, {0,0,0,1,2850},
+	{0,0,0,1,2851}, {0,0,0,1,2852}, {0,0,0,1,2853}, {0,0,0,1,2854},
+	{0,0,0,1,2855}, {0,0,0,1,2856}, {0,0,0,1,2857}, {0,0,0,1,2858},
+	{0,0,0,1,2859}, {0,0,0,1,2860}, {0,0,0,1,2861}, {0,0,0,1,2862},
+	{0,0,0,1,2863}, {0,0,0,1,2864}, {0,0,0,1,2865}, {0,0,0,1,2866},
+	{0,0,0,1,2867}, {0,0,0,1,2868}, {0,0,0,1,2869}, {0,0,0,1,2870},
+	{0,0,0,1,2871}, {0,0,0,1,2872}, {0,0,0,1,2873}, {0,0,0,1,2874},
+	{0,0,0,1,2875}, {0,0,0,1,2876}, {0,0,0,1,2877}, {0,0,0,1,2878},
+	{0,0,0,1,2879}, {0,0,0,1,2880}, {0,0,0,1,2881}, {0,0,0,1,2882},
+	{0,0,0,1,2883}, {0,0,0,1,2884}, {0,0,0,1,2885}, {0,0,0,1,2886},
+	{0,0,0,1,2887}, {0,0,0,1,2888}, {0,0,0,1,2889}, {0,0,0,1,2890},
+	{0,0,0,1,2891}, {0,0,0,1,2892}, {0,0,0,1,2893}, {0,0,0,1,2894},
+	{0,0,0,1,2895}, {0,0,0,1,2896}, {0,0,0,1,2897}, {0,0,0,1,2898},
+	{0,0,0,1,2899}, {0,0,0,1,2900}, {0,0,0,1,2901}, {0,0,0,1,2902},
+	{0,0,0,1,2903}, {0,0,0,1,2904}, {0,0,0,1,2905}, {0,0,0,1,2906},
+	{0,0,0,1,2907}, {0,0,0,1,2908}, {0,0,0,1,2909}, {0,0,0,1,2910},
+	{0,0,0,1,2911}, {0,0,0,1,2912}, {0,0,0,1,2913}, {0,0,0,1,2914},
+	{0,0,0,1,2915}, {0,0,0,1,2916}, {0,0,0,1,2917}, {0,0,0,1,2918},
+	{0,0,0,1,2919}, {0,0,0,1,2920}, {0,0,0,1,2921}, {0,0,0,1,2922},
+	{0,0,0,1,2923}, {0,0,0,1,2924}, {0,0,0,1,2925}, {0,0,0,1,2926},
+	{0,0,0,1,2927}, {0,0,0,1,2928}, {0,0,0,1,2929}, {0,0,0,1,2930},
+	{0,0,0,1,2931}, {0,0,0,1,2932}, {0,0,0,1,2933}, {0,0,0,1,2934},
+	{0,0,0,1,2935}, {0,0,0,1,2936}, {0,0,0,1,2937}, {0,0,0,1,2938},
+	{0,0,0,1,2939}, {0,0,0,1,2940}, {0,0,0,1,2941}, {0,0,0,1,2942},
+	{0,0,0,1,2943}, {0,0,0,1,2944}, {0,0,0,1,2945}, {0,0,0,1,2946},
+	{0,0,0,1,2947}, {0,0,0,1,2948}, {0,0,0,1,2949}, {0,0,0,1,2950},
+	{0,0,0,1,2951}, {0,0,0,1,2952}, {0,0,0,1,2953}, {0,0,0,1,2954},
+	{0,0,0,1,2955}, {0,0,0,1,2956}, {0,0,0,1,2957}, {0,0,0,1,2958},
+	{0,0,0,1,2959}, {0,0,0,1,2960}, {0,0,0,1,2961}, {0,0,0,1,2962},
+	{0,0,0,1,2963}, {0,0,0,1,2964}, {0,0,0,1,2965}, {0,0,0,1,2966},
+	{0,0,0,1,2967}, {0,0,0,1,2968}, {0,0,0,1,2969}, {0,0,0,1,2970},
+	{0,0,0,1,2971}, {0,0,0,1,2972}, {0,0,0,1,2973}, {0,0,0,1,2974},
+	{0,0,0,1,2975}, {0,0,0,1,2976}, {0,0,0,1,2977}, {0,0,0,1,2978},
+	{0,0,0,1,2979}, {0,0,0,1,2980}, {0,0,0,1,2981}, {0,0,0,1,2982},
+	{0,0,0,1,2983}, {0,0,0,1,2984}, {0,0,0,1,2985}, {0,0,0,1,2986},
+	{0,0,0,1,2987}, {0,0,0,1,2988}, {0,0,0,1,2989}, {0,0,0,1,2990},
+	{0,0,0,1,2991}, {0,0,0,1,2992}, {0,0,0,1,2993}, {0,0,0,1,2994},
+	{0,0,0,1,2995}, {0,0,0,1,2996}, {0,0,0,1,2997}, {0,0,0,1,2998},
+	{0,0,0,1,2999}, {0,0,0,1,3000}, {0,0,0,1,3001}, {0,0,0,1,3002},
+	{0,0,0,1,3003}, {0,0,0,1,3004}, {0,0,0,1,3005}, {0,0,0,1,3006},
+	{0,0,0,1,3007}, {0,0,0,1,3008}, {0,0,0,1,3009}, {0,0,0,1,3010},
+	{0,0,0,1,3011}, {0,0,0,1,3012}, {0,0,0,1,3013}, {0,0,0,1,3014},
+	{218,0,0,0,0}, {224,0,0,0,0}, {0,0,0,1,3015}, {0,0,0,1,3016},
+	{0,0,0,1,3017}, {0,2,3018,2,3018}, {0,2,3020,2,3020}, {0,2,3022,2,3022},
+	{0,2,3024,2,3024}, {0,2,3026,2,3026}, {0,2,3028,2,3028}, {0,2,3030,2,3030},
+	{0,2,3032,2,3032}, {0,2,3034,2,3034}, {0,2,3036,2,3036}, {0,2,3038,2,3038},
+	{0,2,3040,2,3040}, {0,2,3042,2,3042}, {0,2,3044,2,3044}, {0,2,3046,2,3046},
+	{0,2,3048,2,3048}, {0,2,3050,2,3050}, {0,2,3052,2,3052}, {0,2,3054,2,3054},
+	{0,2,3056,2,3056}, {0,2,3058,2,3058}, {0,2,3060,2,3060}, {0,2,3062,2,3062},
+	{0,2,3064,2,3064}, {0,2,3066,2,3066}, {0,2,3068,2,3068}, {8,0,0,0,0},
+	{0,0,0,2,3070}, {0,0,0,2,3072}, {0,2,3074,2,3074}, {0,0,0,2,3076},
+	{0,2,3078,2,3078}, {0,2,3080,2,3080}, {0,2,3082,2,3082}, {0,2,3084,2,3084},
+	{0,2,3086,2,3086}, {0,2,3088,2,3088}, {0,2,3090,2,3090}, {0,2,3092,2,3092},
+	{0,2,3094,2,3094}, {0,2,3096,2,3096}, {0,2,3098,2,3098}, {0,2,3100,2,3100},
+	{0,2,3102,2,3102}, {0,2,3104,2,3104}, {0,2,3106,2,3106}, {0,2,3108,2,3108},
+	{0,2,3110,2,3110}, {0,2,3112,2,3112}, {0,2,3114,2,3114}, {0,2,3116,2,3116},
+	{0,2,3118,2,3118}, {0,2,3120,2,3120}, {0,2,3122,2,3122}, {0,2,3124,2,3124},
+	{0,2,3126,2,3126}, {0,2,3128,2,3128}, {0,2,3130,2,3130}, {0,2,3132,2,3132},
+	{0,2,3134,2,3134}, {0,2,3136,2,3136}, {0,2,3138,2,3138}, {0,0,0,2,3140},
+	{0,0,0,1,3142}, {0,0,0,1,3143}, {0,0,0,1,3144}, {0,0,0,1,3145},
+	{0,0,0,1,3146}, {0,0,0,1,3147}, {0,0,0,1,3148}, {0,0,0,1,3149},
+	{0,0,0,1,3150}, {0,0,0,1,3151}, {0,0,0,1,3152}, {0,0,0,1,3153},
+	{0,0,0,1,3154}, {0,0,0,1,3155}, {0,0,0,1,3156}, {0,0,0,1,3157},
+	{0,0,0,1,3158}, {0,0,0,1,3159}, {0,0,0,1,3160}, {0,0,0,1,3161},
+	{0,0,0,1,3162}, {0,0,0,1,3163}, {0,0,0,1,3164}, {0,0,0,1,3165},
+	{0,0,0,1,3166}, {0,0,0,1,3167}, {0,0,0,1,3168}, {0,0,0,1,3169},
+	{0,0,0,1,3170}, {0,0,0,1,3171}, {0,0,0,1,3172}, {0,0,0,1,3173},
+	{0,0,0,1,3174}, {0,0,0,1,3175}, {0,0,0,1,3176}, {0,0,0,1,3177},
+	{0,0,0,1,3178}, {0,0,0,1,3179}, {0,0,0,1,3180}, {0,0,0,1,3181},
+	{0,0,0,1,3182}, {0,0,0,1,3183}, {0,0,0,1,3184}, {0,0,0,1,3185},
+	{0,0,0,1,3186}, {0,0,0,1,3187}, {0,0,0,1,3188}, {0,0,0,1,3189},
+	{0,0,0,1,3190}, {0,0,0,1,3191}, {0,0,0,1,3192}, {0,0,0,1,3193},
+	{0,0,0,1,3194}, {0,0,0,1,3195}, {0,0,0,1,3196}, {0,0,0,1,3197},
+	{0,0,0,1,3198}, {0,0,0,1,3199}, {0,0,0,1,3200}, {0,0,0,1,3201},
+	{0,0,0,1,3202}, {0,0,0,1,3203}, {0,0,0,1,3204}, {0,0,0,1,3205},
+	{0,0,0,1,3206}, {0,0,0,1,3207}, {0,0,0,1,3208}, {0,0,0,1,3209},
+	{0,0,0,1,3210}, {0,0,0,1,3211}, {0,0,0,1,3212}, {0,0,0,1,3213},
+	{0,0,0,1,3214}, {0,0,0,1,3215}, {0,0,0,1,3216}, {0,0,0,1,3217},
+	{0,0,0,1,3218}, {0,0,0,1,3219}, {0,0,0,1,3220}, {0,0,0,1,3221},
+	{0,0,0,1,3222}, {0,0,0,1,3223}, {0,0,0,1,3224}, {0,0,0,1,3225},
+	{0,0,0,1,3226}, {0,0,0,1,3227}, {0,0,0,1,3228}, {0,0,0,1,3229},
+	{0,0,0,1,3230}, {0,0,0,1,3231}, {0,0,0,1,3232}, {0,0,0,1,3233},
+	{0,0,0,1,3234}, {0,0,0,1,3235}, {0,0,0,1,3236}, {0,0,0,1,3237},
+	{0,0,0,1,3238}, {0,0,0,1,3239}, {0,0,0,1,3240}, {0,0,0,1,3241},
+	{0,0,0,1,3242}, {0,0,0,1,3243}, {0,0,0,1,3244}, {0,0,0,1,3245},
+	{0,0,0,3,3246}, {0,0,0,3,3249}, {0,0,0,3,3252}, {0,0,0,3,3255},
+	{0,0,0,3,3258}, {0,0,0,3,3261}, {0,0,0,3,3264}, {0,0,0,3,3267},
+	{0,0,0,3,3270}, {0,0,0,3,3273}, {0,0,0,3,3276}, {0,0,0,3,3279},
+	{0,0,0,3,3282}, {0,0,0,3,3285}, {0,0,0,4,3288}, {0,0,0,4,3292},
+	{0,0,0,4,3296}, {0,0,0,4,3300}, {0,0,0,4,3304}, {0,0,0,4,3308},
+	{0,0,0,4,3312}, {0,0,0,4,3316}, {0,0,0,4,3320}, {0,0,0,4,3324},
+	{0,0,0,4,3328}, {0,0,0,4,3332}, {0,0,0,4,3336}, {0,0,0,4,3340},
+	{0,0,0,4,3344}, {0,0,0,7,3348}, {0,0,0,6,3355}, {0,0,0,3,3361},
+	{0,0,0,3,3364}, {0,0,0,3,3367}, {0,0,0,3,3370}, {0,0,0,3,3373},
+	{0,0,0,3,3376}, {0,0,0,3,3379}, {0,0,0,3,3382}, {0,0,0,3,3385},
+	{0,0,0,3,3388}, {0,0,0,3,3391}, {0,0,0,3,3394}, {0,0,0,3,3397},
+	{0,0,0,3,3400}, {0,0,0,3,3403}, {0,0,0,3,3406}, {0,0,0,3,3409},
+	{0,0,0,3,3412}, {0,0,0,3,3415}, {0,0,0,3,3418}, {0,0,0,3,3421},
+	{0,0,0,3,3424}, {0,0,0,3,3427}, {0,0,0,3,3430}, {0,0,0,3,3433},
+	{0,0,0,3,3436}, {0,0,0,3,3439}, {0,0,0,3,3442}, {0,0,0,3,3445},
+	{0,0,0,3,3448}, {0,0,0,3,3451}, {0,0,0,3,3454}, {0,0,0,3,3457},
+	{0,0,0,3,3460}, {0,0,0,3,3463}, {0,0,0,3,3466}, {0,0,0,1,3469},
+	{0,0,0,1,3470}, {0,0,0,1,3471}, {0,0,0,3,3472}, {0,0,0,2,3475},
+	{0,0,0,2,3477}, {0,0,0,2,3479}, {0,0,0,2,3481}, {0,0,0,2,3483},
+	{0,0,0,2,3485}, {0,0,0,2,3487}, {0,0,0,2,3489}, {0,0,0,2,3491},
+	{0,0,0,2,3493}, {0,0,0,2,3495}, {0,0,0,2,3497}, {0,0,0,2,3499},
+	{0,0,0,2,3501}, {0,0,0,2,3503}, {0,0,0,2,3505}, {0,0,0,2,3507},
+	{0,0,0,2,3509}, {0,0,0,2,3511}, {0,0,0,2,3513}, {0,0,0,2,3515},
+	{0,0,0,2,3517}, {0,0,0,2,3519}, {0,0,0,2,3521}, {0,0,0,2,3523},
+	{0,0,0,2,3525}, {0,0,0,2,3527}, {0,0,0,2,3529}, {0,0,0,2,3531},
+	{0,0,0,5,3533}, {0,0,0,4,3538}, {0,0,0,2,3542}, {0,0,0,1,3544},
+	{0,0,0,1,3545}, {0,0,0,1,3546}, {0,0,0,1,3547}, {0,0,0,1,3548},
+	{0,0,0,1,3549}, {0,0,0,1,3550}, {0,0,0,1,3551}, {0,0,0,1,3552},
+	{0,0,0,1,3553}, {0,0,0,1,3554}, {0,0,0,1,3555}, {0,0,0,1,3556},
+	{0,0,0,1,3557}, {0,0,0,1,3558}, {0,0,0,1,3559}, {0,0,0,1,3560},
+	{0,0,0,1,3561}, {0,0,0,1,3562}, {0,0,0,1,3563}, {0,0,0,1,3564},
+	{0,0,0,1,3565}, {0,0,0,1,3566}, {0,0,0,1,3567}, {0,0,0,1,3568},
+	{0,0,0,1,3569}, {0,0,0,1,3570}, {0,0,0,1,3571}, {0,0,0,1,3572},
+	{0,0,0,1,3573}, {0,0,0,1,3574}, {0,0,0,1,3575}, {0,0,0,2,3576},
+	{0,0,0,2,3578}, {0,0,0,2,3580}, {0,0,0,2,3582}, {0,0,0,2,3584},
+	{0,0,0,2,3586}, {0,0,0,2,3588}, {0,0,0,2,3590}, {0,0,0,2,3592},
+	{0,0,0,2,3594}, {0,0,0,2,3596}, {0,0,0,2,3598}, {0,0,0,2,3600},
+	{0,0,0,2,3602}, {0,0,0,2,3604}, {0,0,0,2,3606}, {0,0,0,2,3608},
+	{0,0,0,2,3610}, {0,0,0,2,3612}, {0,0,0,2,3614}, {0,0,0,2,3616},
+	{0,0,0,2,3618}, {0,0,0,2,3620}, {0,0,0,2,3622}, {0,0,0,3,3624},
+	{0,0,0,3,3627}, {0,0,0,3,3630}, {0,0,0,2,3633}, {0,0,0,3,3635},
+	{0,0,0,2,3638}, {0,0,0,3,3640}, {0,0,0,1,3643}, {0,0,0,1,3644},
+	{0,0,0,1,3645}, {0,0,0,1,3646}, {0,0,0,1,3647}, {0,0,0,1,3648},
+	{0,0,0,1,3649}, {0,0,0,1,3650}, {0,0,0,1,3651}, {0,0,0,1,3652},
+	{0,0,0,1,3653}, {0,0,0,1,3654}, {0,0,0,1,3655}, {0,0,0,1,3656},
+	{0,0,0,1,3657}, {0,0,0,1,3658}, {0,0,0,1,3659}, {0,0,0,1,3660},
+	{0,0,0,1,3661}, {0,0,0,1,3662}, {0,0,0,1,3663}, {0,0,0,1,3664},
+	{0,0,0,1,3665}, {0,0,0,1,3666}, {0,0,0,1,3667}, {0,0,0,1,3668},
+	{0,0,0,1,3669}, {0,0,0,1,3670}, {0,0,0,1,3671}, {0,0,0,1,3672},
+	{0,0,0,1,3673}, {0,0,0,1,3674}, {0,0,0,1,3675}, {0,0,0,1,3676},
+	{0,0,0,1,3677}, {0,0,0,1,3678}, {0,0,0,1,3679}, {0,0,0,1,3680},
+	{0,0,0,1,3681}, {0,0,0,1,3682}, {0,0,0,1,3683}, {0,0,0,1,3684},
+	{0,0,0,1,3685}, {0,0,0,1,3686}, {0,0,0,1,3687}, {0,0,0,1,3688},
+	{0,0,0,1,3689}, {0,0,0,5,3690}, {0,0,0,4,3695}, {0,0,0,5,3699},
+	{0,0,0,3,3704}, {0,0,0,5,3707}, {0,0,0,3,3712}, {0,0,0,3,3715},
+	{0,0,0,6,3718}, {0,0,0,4,3724}, {0,0,0,3,3728}, {0,0,0,3,3731},
+	{0,0,0,3,3734}, {0,0,0,4,3737}, {0,0,0,4,3741}, {0,0,0,4,3745},
+	{0,0,0,4,3749}, {0,0,0,4,3753}, {0,0,0,4,3757}, {0,0,0,4,3761},
+	{0,0,0,6,3765}, {0,0,0,2,3771}, {0,0,0,6,3773}, {0,0,0,6,3779},
+	{0,0,0,5,3785}, {0,0,0,4,3790}, {0,0,0,6,3794}, {0,0,0,6,3800},
+	{0,0,0,4,3806}, {0,0,0,3,3810}, {0,0,0,3,3813}, {0,0,0,4,3816},
+	{0,0,0,4,3820}, {0,0,0,5,3824}, {0,0,0,5,3829}, {0,0,0,3,3834},
+	{0,0,0,3,3837}, {0,0,0,4,3840}, {0,0,0,3,3844}, {0,0,0,3,3847},
+	{0,0,0,2,3850}, {0,0,0,2,3852}, {0,0,0,3,3854}, {0,0,0,3,3857},
+	{0,0,0,6,3860}, {0,0,0,4,3866}, {0,0,0,5,3870}, {0,0,0,6,3875},
+	{0,0,0,4,3881}, {0,0,0,3,3885}, {0,0,0,3,3888}, {0,0,0,6,3891},
+	{0,0,0,4,3897}, {0,0,0,6,3901}, {0,0,0,3,3907}, {0,0,0,5,3910},
+	{0,0,0,3,3915}, {0,0,0,4,3918}, {0,0,0,3,3922}, {0,0,0,4,3925},
+	{0,0,0,5,3929}, {0,0,0,4,3934}, {0,0,0,5,3938}, {0,0,0,4,3943},
+	{0,0,0,2,3947}, {0,0,0,5,3949}, {0,0,0,3,3954}, {0,0,0,3,3957},
+	{0,0,0,4,3960}, {0,0,0,3,3964}, {0,0,0,3,3967}, {0,0,0,3,3970},
+	{0,0,0,5,3973}, {0,0,0,4,3978}, {0,0,0,2,3982}, {0,0,0,6,3984},
+	{0,0,0,3,3990}, {0,0,0,5,3993}, {0,0,0,4,3998}, {0,0,0,4,4002},
+	{0,0,0,3,4006}, {0,0,0,3,4009}, {0,0,0,4,4012}, {0,0,0,2,4016},
+	{0,0,0,4,4018}, {0,0,0,5,4022}, {0,0,0,2,4027}, {0,0,0,6,4029},
+	{0,0,0,3,4035}, {0,0,0,2,4038}, {0,0,0,2,4040}, {0,0,0,2,4042},
+	{0,0,0,2,4044}, {0,0,0,2,4046}, {0,0,0,2,4048}, {0,0,0,2,4050},
+	{0,0,0,2,4052}, {0,0,0,2,4054}, {0,0,0,2,4056}, {0,0,0,3,4058},
+	{0,0,0,3,4061}, {0,0,0,3,4064}, {0,0,0,3,4067}, {0,0,0,3,4070},
+	{0,0,0,3,4073}, {0,0,0,3,4076}, {0,0,0,3,4079}, {0,0,0,3,4082},
+	{0,0,0,3,4085}, {0,0,0,3,4088}, {0,0,0,3,4091}, {0,0,0,3,4094},
+	{0,0,0,3,4097}, {0,0,0,3,4100}, {0,0,0,3,4103}, {0,0,0,2,4106},
+	{0,0,0,2,4108}, {0,0,0,3,4110}, {0,0,0,2,4113}, {0,0,0,2,4115},
+	{0,0,0,2,4117}, {0,0,0,3,4119}, {0,0,0,3,4122}, {0,0,0,2,4125},
+	{0,0,0,2,4127}, {0,0,0,2,4129}, {0,0,0,2,4131}, {0,0,0,2,4133},
+	{0,0,0,4,4135}, {0,0,0,2,4139}, {0,0,0,2,4141}, {0,0,0,2,4143},
+	{0,0,0,2,4145}, {0,0,0,2,4147}, {0,0,0,2,4149}, {0,0,0,2,4151},
+	{0,0,0,2,4153}, {0,0,0,3,4155}, {0,0,0,4,4158}, {0,0,0,2,4162},
+	{0,0,0,2,4164}, {0,0,0,2,4166}, {0,0,0,2,4168}, {0,0,0,2,4170},
+	{0,0,0,2,4172}, {0,0,0,2,4174}, {0,0,0,3,4176}, {0,0,0,3,4179},
+	{0,0,0,3,4182}, {0,0,0,3,4185}, {0,0,0,2,4188}, {0,0,0,2,4190},
+	{0,0,0,2,4192}, {0,0,0,2,4194}, {0,0,0,2,4196}, {0,0,0,2,4198},
+	{0,0,0,2,4200}, {0,0,0,2,4202}, {0,0,0,2,4204}, {0,0,0,2,4206},
+	{0,0,0,3,4208}, {0,0,0,3,4211}, {0,0,0,2,4214}, {0,0,0,3,4216},
+	{0,0,0,3,4219}, {0,0,0,3,4222}, {0,0,0,2,4225}, {0,0,0,3,4227},
+	{0,0,0,3,4230}, {0,0,0,4,4233}, {0,0,0,2,4237}, {0,0,0,3,4239},
+	{0,0,0,3,4242}, {0,0,0,3,4245}, {0,0,0,3,4248}, {0,0,0,5,4251},
+	{0,0,0,6,4256}, {0,0,0,2,4262}, {0,0,0,2,4264}, {0,0,0,2,4266},
+	{0,0,0,2,4268}, {0,0,0,2,4270}, {0,0,0,2,4272}, {0,0,0,2,4274},
+	{0,0,0,2,4276}, {0,0,0,2,4278}, {0,0,0,2,4280}, {0,0,0,2,4282},
+	{0,0,0,2,4284}, {0,0,0,2,4286}, {0,0,0,2,4288}, {0,0,0,2,4290},
+	{0,0,0,2,4292}, {0,0,0,2,4294}, {0,0,0,2,4296}, {0,0,0,4,4298},
+	{0,0,0,2,4302}, {0,0,0,2,4304}, {0,0,0,2,4306}, {0,0,0,4,4308},
+	{0,0,0,3,4312}, {0,0,0,2,4315}, {0,0,0,2,4317}, {0,0,0,2,4319},
+	{0,0,0,2,4321}, {0,0,0,2,4323}, {0,0,0,2,4325}, {0,0,0,2,4327},
+	{0,0,0,2,4329}, {0,0,0,2,4331}, {0,0,0,2,4333}, {0,0,0,3,4335},
+	{0,0,0,2,4338}, {0,0,0,2,4340}, {0,0,0,3,4342}, {0,0,0,3,4345},
+	{0,0,0,2,4348}, {0,0,0,4,4350}, {0,0,0,3,4354}, {0,0,0,2,4357},
+	{0,0,0,2,4359}, {0,0,0,2,4361}, {0,0,0,2,4363}, {0,0,0,3,4365},
+	{0,0,0,3,4368}, {0,0,0,2,4371}, {0,0,0,2,4373}, {0,0,0,2,4375},
+	{0,0,0,2,4377}, {0,0,0,2,4379}, {0,0,0,2,4381}, {0,0,0,2,4383},
+	{0,0,0,2,4385}, {0,0,0,2,4387}, {0,0,0,3,4389}, {0,0,0,3,4392},
+	{0,0,0,3,4395}, {0,0,0,3,4398}, {0,0,0,3,4401}, {0,0,0,3,4404},
+	{0,0,0,3,4407}, {0,0,0,3,4410}, {0,0,0,3,4413}, {0,0,0,3,4416},
+	{0,0,0,3,4419}, {0,0,0,3,4422}, {0,0,0,3,4425}, {0,0,0,3,4428},
+	{0,0,0,3,4431}, {0,0,0,3,4434}, {0,0,0,3,4437}, {0,0,0,3,4440},
+	{0,0,0,3,4443}, {0,0,0,3,4446}, {0,0,0,3,4449}, {0,0,0,3,4452},
+	{0,0,0,3,4455}, {0,0,0,1,4458}, {0,0,0,1,4459}, {0,0,0,1,4460},
+	{0,0,0,1,4461}, {0,0,0,1,4462}, {0,0,0,1,4463}, {0,0,0,1,4464},
+	{0,0,0,1,4465}, {0,0,0,1,4466}, {0,1,4467,1,4467}, {0,1,4468,1,4468},
+	{0,1,2959,1,2959}, {0,1,4469,1,4469}, {0,1,4470,1,4470}, {0,1,4471,1,4471},
+	{0,1,4472,1,4472}, {0,1,3013,1,3013}, {0,1,4473,1,4473}, {0,1,2967,1,2967},
+	{0,1,4474,1,4474}, {0,1,4475,1,4475}, {0,1,4476,1,4476}, {0,1,4477,1,4477},
+	{0,1,4478,1,4478}, {0,1,4479,1,4479}, {0,1,4480,1,4480}, {0,1,4481,1,4481},
+	{0,1,4482,1,4482}, {0,1,4483,1,4483}, {0,1,4484,1,4484}, {0,1,4485,1,4485},
+	{0,1,4486,1,4486}, {0,1,4487,1,4487}, {0,1,4488,1,4488}, {0,1,4489,1,4489},
+	{0,1,4490,1,4490}, {0,1,4491,1,4491}, {0,1,4492,1,4492}, {0,1,4493,1,4493},
+	{0,1,4494,1,4494}, {0,1,4495,1,4495}, {0,1,4496,1,4496}, {0,1,4497,1,4497},
+	{0,1,4498,1,4498}, {0,1,4499,1,4499}, {0,1,4500,1,4500}, {0,1,4501,1,4501},
+	{0,1,4502,1,4502}, {0,1,4503,1,4503}, {0,1,4504,1,4504}, {0,1,4505,1,4505},
+	{0,1,4506,1,4506}, {0,1,4507,1,4507}, {0,1,4508,1,4508}, {0,1,4509,1,4509},
+	{0,1,4510,1,4510}, {0,1,4511,1,4511}, {0,1,4512,1,4512}, {0,1,4513,1,4513},
+	{0,1,4514,1,4514}, {0,1,2925,1,2925}, {0,1,4515,1,4515}, {0,1,4516,1,4516},
+	{0,1,4517,1,4517}, {0,1,4518,1,4518}, {0,1,4519,1,4519}, {0,1,4520,1,4520},
+	{0,1,4521,1,4521}, {0,1,4522,1,4522}, {0,1,4523,1,4523}, {0,1,4524,1,4524},
+	{0,1,4525,1,4525}, {0,1,2998,1,2998}, {0,1,4526,1,4526}, {0,1,4527,1,4527},
+	{0,1,4528,1,4528}, {0,1,4529,1,4529}, {0,1,4530,1,4530}, {0,1,4531,1,4531},
+	{0,1,4532,1,4532}, {0,1,4533,1,4533}, {0,1,4534,1,4534}, {0,1,4535,1,4535},
+	{0,1,4536,1,4536}, {0,1,4537,1,4537}, {0,1,4538,1,4538}, {0,1,4539,1,4539},
+	{0,1,4540,1,4540}, {0,1,4541,1,4541}, {0,1,4542,1,4542}, {0,1,4543,1,4543},
+	{0,1,4544,1,4544}, {0,1,4545,1,4545}, {0,1,4546,1,4546}, {0,1,4547,1,4547},
+	{0,1,4548,1,4548}, {0,1,4549,1,4549}, {0,1,4550,1,4550}, {0,1,4551,1,4551},
+	{0,1,4552,1,4552}, {0,1,4553,1,4553}, {0,1,4554,1,4554}, {0,1,4555,1,4555},
+	{0,1,4556,1,4556}, {0,1,4557,1,4557}, {0,1,4558,1,4558}, {0,1,4559,1,4559},
+	{0,1,4560,1,4560}, {0,1,4561,1,4561}, {0,1,4562,1,4562}, {0,1,4563,1,4563},
+	{0,1,4564,1,4564}, {0,1,4565,1,4565}, {0,1,4566,1,4566}, {0,1,4567,1,4567},
+	{0,1,4568,1,4568}, {0,1,4569,1,4569}, {0,1,4570,1,4570}, {0,1,4571,1,4571},
+	{0,1,4572,1,4572}, {0,1,2961,1,2961}, {0,1,4573,1,4573}, {0,1,4574,1,4574},
+	{0,1,4575,1,4575}, {0,1,4576,1,4576}, {0,1,4577,1,4577}, {0,1,4578,1,4578},
+	{0,1,4579,1,4579}, {0,1,4580,1,4580}, {0,1,4581,1,4581}, {0,1,4582,1,4582},
+	{0,1,4583,1,4583}, {0,1,4584,1,4584}, {0,1,4585,1,4585}, {0,1,4586,1,4586},
+	{0,1,4587,1,4587}, {0,1,2838,1,2838}, {0,1,4588,1,4588}, {0,1,4589,1,4589},
+	{0,1,4590,1,4590}, {0,1,4591,1,4591}, {0,1,4592,1,4592}, {0,1,4593,1,4593},
+	{0,1,4594,1,4594}, {0,1,4595,1,4595}, {0,1,2819,1,2819}, {0,1,4596,1,4596},
+	{0,1,4597,1,4597}, {0,1,4598,1,4598}, {0,1,4599,1,4599}, {0,1,4600,1,4600},
+	{0,1,4601,1,4601}, {0,1,4602,1,4602}, {0,1,4603,1,4603}, {0,1,4604,1,4604},
+	{0,1,4605,1,4605}, {0,1,4606,1,4606}, {0,1,4607,1,4607}, {0,1,4608,1,4608},
+	{0,1,4609,1,4609}, {0,1,4610,1,4610}, {0,1,4611,1,4611}, {0,1,4612,1,4612},
+	{0,1,4613,1,4613}, {0,1,4614,1,4614}, {0,1,4615,1,4615}, {0,1,4616,1,4616},
+	{0,1,4617,1,4617}, {0,1,4618,1,4618}, {0,1,4619,1,4619}, {0,1,4620,1,4620},
+	{0,1,4621,1,4621}, {0,1,4622,1,4622}, {0,1,4623,1,4623}, {0,1,4624,1,4624},
+	{0,1,4625,1,4625}, {0,1,4626,1,4626}, {0,1,4627,1,4627}, {0,1,4628,1,4628},
+	{0,1,4629,1,4629}, {0,1,4630,1,4630}, {0,1,4631,1,4631}, {0,1,4632,1,4632},
+	{0,1,4633,1,4633}, {0,1,4634,1,4634}, {0,1,4635,1,4635}, {0,1,4636,1,4636},
+	{0,1,4637,1,4637}, {0,1,4638,1,4638}, {0,1,4639,1,4639}, {0,1,4640,1,4640},
+	{0,1,4641,1,4641}, {0,1,4642,1,4642}, {0,1,4643,1,4643}, {0,1,4644,1,4644},
+	{0,1,4645,1,4645}, {0,1,4646,1,4646}, {0,1,4647,1,4647}, {0,1,4648,1,4648},
+	{0,1,4649,1,4649}, {0,1,3012,1,3012}, {0,1,4650,1,4650}, {0,1,4651,1,4651},
+	{0,1,4652,1,4652}, {0,1,4653,1,4653}, {0,1,4654,1,4654}, {0,1,4655,1,4655},
+	{0,1,4656,1,4656}, {0,1,4657,1,4657}, {0,1,4658,1,4658}, {0,1,4659,1,4659},
+	{0,1,4660,1,4660}, {0,1,4661,1,4661}, {0,1,3545,1,3545}, {0,1,4662,1,4662},
+	{0,1,4663,1,4663}, {0,1,4664,1,4664}, {0,1,4665,1,4665}, {0,1,4666,1,4666},
+	{0,1,4667,1,4667}, {0,1,4668,1,4668}, {0,1,4669,1,4669}, {0,1,4670,1,4670},
+	{0,1,4671,1,4671}, {0,1,4672,1,4672}, {0,1,4673,1,4673}, {0,1,4674,1,4674},
+	{0,1,4675,1,4675}, {0,1,4676,1,4676}, {0,1,4677,1,4677}, {0,1,4678,1,4678},
+	{0,1,4679,1,4679}, {0,1,4680,1,4680}, {0,1,4681,1,4681}, {0,1,4682,1,4682},
+	{0,1,4683,1,4683}, {0,1,2966,1,2966}, {0,1,4684,1,4684}, {0,1,4685,1,4685},
+	{0,1,4686,1,4686}, {0,1,4687,1,4687}, {0,1,4688,1,4688}, {0,1,4689,1,4689},
+	{0,1,4690,1,4690}, {0,1,4691,1,4691}, {0,1,4692,1,4692}, {0,1,4693,1,4693},
+	{0,1,4694,1,4694}, {0,1,4695,1,4695}, {0,1,4696,1,4696}, {0,1,2917,1,2917},
+	{0,1,4697,1,4697}, {0,1,4698,1,4698}, {0,1,4699,1,4699}, {0,1,4700,1,4700},
+	{0,1,4701,1,4701}, {0,1,4702,1,4702}, {0,1,4703,1,4703}, {0,1,4704,1,4704},
+	{0,1,4705,1,4705}, {0,1,4706,1,4706}, {0,1,4707,1,4707}, {0,1,4708,1,4708},
+	{0,1,4709,1,4709}, {0,1,4710,1,4710}, {0,1,4711,1,4711}, {0,1,4712,1,4712},
+	{0,1,2944,1,2944}, {0,1,4713,1,4713}, {0,1,2947,1,2947}, {0,1,4714,1,4714},
+	{0,1,4715,1,4715}, {0,1,4716,1,4716}, {0,1,4717,1,4717}, {0,1,4718,1,4718},
+	{0,1,4719,1,4719}, {0,1,4720,1,4720}, {0,1,4721,1,4721}, {0,1,4722,1,4722},
+	{0,1,4723,1,4723}, {0,1,4724,1,4724}, {0,1,4725,1,4725}, {0,1,4726,1,4726},
+	{0,1,4727,1,4727}, {0,1,2924,1,2924}, {0,1,4728,1,4728}, {0,1,4729,1,4729},
+	{0,1,4730,1,4730}, {0,1,4731,1,4731}, {0,1,4732,1,4732}, {0,1,4733,1,4733},
+	{0,1,4734,1,4734}, {0,1,4735,1,4735}, {0,1,4736,1,4736}, {0,1,4737,1,4737},
+	{0,1,4738,1,4738}, {0,1,4739,1,4739}, {0,1,4740,1,4740}, {0,1,4741,1,4741},
+	{0,1,4742,1,4742}, {0,1,4743,1,4743}, {0,1,4744,1,4744}, {0,1,4745,1,4745},
+	{0,1,4746,1,4746}, {0,1,4747,1,4747}, {0,1,4748,1,4748}, {0,1,4749,1,4749},
+	{0,1,2845,1,2845}, {0,1,4750,1,4750}, {0,1,4751,1,4751}, {0,1,4752,1,4752},
+	{0,1,4753,1,4753}, {0,1,4754,1,4754}, {0,1,4755,1,4755}, {0,1,4756,1,4756},
+	{0,1,4757,1,4757}, {0,1,4758,1,4758}, {0,1,4759,1,4759}, {0,1,4760,1,4760},
+	{0,1,4761,1,4761}, {0,1,4762,1,4762}, {0,1,4763,1,4763}, {0,1,4764,1,4764},
+	{0,1,3550,1,3550}, {0,1,4765,1,4765}, {0,1,4766,1,4766}, {0,1,4767,1,4767},
+	{0,1,4768,1,4768}, {0,1,3554,1,3554}, {0,1,4769,1,4769}, {0,1,4770,1,4770},
+	{0,1,4771,1,4771}, {0,1,4772,1,4772}, {0,1,4773,1,4773}, {0,1,4774,1,4774},
+	{0,1,4775,1,4775}, {0,1,4776,1,4776}, {0,1,4777,1,4777}, {0,1,4778,1,4778},
+	{0,1,4779,1,4779}, {0,1,4780,1,4780}, {0,1,4781,1,4781}, {0,1,4782,1,4782},
+	{0,1,4783,1,4783}, {0,1,4784,1,4784}, {0,1,4785,1,4785}, {0,1,4786,1,4786},
+	{0,1,4787,1,4787}, {0,1,4788,1,4788}, {0,1,4789,1,4789}, {0,1,4790,1,4790},
+	{0,1,4791,1,4791}, {0,1,4792,1,4792}, {0,1,4793,1,4793}, {0,1,4794,1,4794},
+	{0,1,4795,1,4795}, {0,1,4796,1,4796}, {0,1,4797,1,4797}, {0,1,4798,1,4798},
+	{0,1,4799,1,4799}, {0,1,4800,1,4800}, {0,1,4801,1,4801}, {0,1,4802,1,4802},
+	{0,1,4803,1,4803}, {0,1,4804,1,4804}, {0,1,4805,1,4805}, {0,1,4806,1,4806},
+	{0,1,4807,1,4807}, {0,1,4808,1,4808}, {0,1,4809,1,4809}, {0,1,4810,1,4810},
+	{0,1,4811,1,4811}, {0,1,4812,1,4812}, {0,1,4813,1,4813}, {0,1,4814,1,4814},
+	{0,1,4815,1,4815}, {0,1,4816,1,4816}, {0,1,4817,1,4817}, {0,1,4818,1,4818},
+	{0,1,4819,1,4819}, {0,1,4820,1,4820}, {0,1,4821,1,4821}, {0,1,4822,1,4822},
+	{0,1,4823,1,4823}, {0,1,4824,1,4824}, {0,1,2878,1,2878}, {0,1,4825,1,4825},
+	{0,1,4826,1,4826}, {0,1,4827,1,4827}, {0,1,4828,1,4828}, {0,1,4829,1,4829},
+	{0,1,4830,1,4830}, {0,1,4831,1,4831}, {0,1,4832,1,4832}, {0,1,4833,1,4833},
+	{0,1,4834,1,4834}, {0,1,4835,1,4835}, {0,1,4836,1,4836}, {0,1,4837,1,4837},
+	{0,1,4838,1,4838}, {0,1,4839,1,4839}, {0,1,4840,1,4840}, {0,1,4841,1,4841},
+	{0,1,4842,1,4842}, {0,1,4843,1,4843}, {0,1,4844,1,4844}, {0,1,4845,1,4845},
+	{0,1,4846,1,4846}, {0,1,4847,1,4847}, {0,1,4848,1,4848}, {0,1,4849,1,4849},
+	{0,1,4850,1,4850}, {0,1,4851,1,4851}, {0,1,4852,1,4852}, {0,1,4853,1,4853},
+	{0,1,4854,1,4854}, {0,1,4855,1,4855}, {0,1,4856,1,4856}, {0,1,4857,1,4857},
+	{0,1,4858,1,4858}, {0,1,4859,1,4859}, {0,1,4860,1,4860}, {0,1,4861,1,4861},
+	{0,1,4862,1,4862}, {0,1,4863,1,4863}, {0,1,4864,1,4864}, {0,1,4865,1,4865},
+	{0,1,4866,1,4866}, {0,1,4867,1,4867}, {0,1,4868,1,4868}, {0,1,4869,1,4869},
+	{0,1,4870,1,4870}, {0,1,4871,1,4871}, {0,1,4872,1,4872}, {0,0,0,2,4873},
+	{0,0,0,2,4875}, {0,0,0,2,4877}, {0,0,0,3,4879}, {0,0,0,3,4882},
+	{0,0,0,2,4885}, {0,0,0,2,4887}, {0,0,0,2,4889}, {0,0,0,2,4891},
+	{0,0,0,2,4893}, {0,0,0,2,4895}, {0,2,4897,2,4897}, {26,0,0,0,0},
+	{0,2,4899,2,4899}, {0,0,0,1,4901}, {0,0,0,1,4902}, {0,0,0,1,4903},
+	{0,0,0,1,4904}, {0,0,0,1,4905}, {0,0,0,1,4906}, {0,0,0,1,4907},
+	{0,2,4908,2,4908}, {0,2,4910,2,4910}, {0,3,4912,3,4912}, {0,3,4915,3,4915},
+	{0,2,4918,2,4918}, {0,2,4920,2,4920}, {0,2,4922,2,4922}, {0,2,4924,2,4924},
+	{0,2,4926,2,4926}, {0,2,4928,2,4928}, {0,2,4930,2,4930}, {0,2,4932,2,4932},
+	{0,2,4934,2,4934}, {0,2,4936,2,4936}, {0,2,4938,2,4938}, {0,2,4940,2,4940},
+	{0,2,4942,2,4942}, {0,2,4944,2,4944}, {0,2,4946,2,4946}, {0,2,4948,2,4948},
+	{0,2,4950,2,4950}, {0,2,4952,2,4952}, {0,2,4954,2,4954}, {0,2,4956,2,4956},
+	{0,2,4958,2,4958}, {0,2,4960,2,4960}, {0,2,4962,2,4962}, {0,2,4964,2,4964},
+	{0,2,4966,2,4966}, {0,2,4968,2,4968}, {0,2,4970,2,4970}, {0,2,4972,2,4972},
+	{0,0,0,2,4974}, {0,0,0,1,4976}, {0,0,0,1,4977}, {0,0,0,1,4978},
+	{0,0,0,1,4979}, {0,0,0,1,4980}, {0,0,0,1,4981}, {0,0,0,1,4982},
+	{0,0,0,1,4983}, {0,0,0,1,4984}, {0,0,0,1,4985}, {0,0,0,1,4986},
+	{0,0,0,1,4987}, {0,0,0,1,4988}, {0,0,0,1,4989}, {0,0,0,1,4990},
+	{0,0,0,1,4991}, {0,0,0,1,4992}, {0,0,0,1,4993}, {0,0,0,1,4994},
+	{0,0,0,1,4995}, {0,0,0,1,4996}, {0,0,0,1,4997}, {0,0,0,1,4998},
+	{0,0,0,1,4999}, {0,0,0,1,5000}, {0,0,0,2,809}, {0,0,0,1,5001},
+	{0,0,0,1,5002}, {0,0,0,1,5003}, {0,0,0,2,813}, {0,0,0,1,5004},
+	{0,0,0,1,5005}, {0,0,0,1,5006}, {0,0,0,1,5007}, {0,0,0,1,5008},
+	{0,0,0,1,5009}, {0,0,0,1,5010}, {0,0,0,1,5011}, {0,0,0,1,5012},
+	{0,0,0,3,5013}, {0,0,0,3,5016}, {0,0,0,3,5019}, {0,0,0,3,5022},
+	{0,0,0,3,5025}, {0,0,0,3,5028}, {0,0,0,3,5031}, {0,0,0,3,5034},
+	{0,0,0,1,5037}, {0,0,0,3,5038}, {0,0,0,3,5041}, {0,0,0,3,5044},
+	{0,0,0,3,5047}, {0,0,0,2,5050}, {0,0,0,2,5052}, {0,0,0,2,5054},
+	{0,0,0,2,5056}, {0,0,0,2,5058}, {0,0,0,2,5060}, {0,0,0,2,5062},
+	{0,0,0,2,5064}, {0,0,0,2,5066}, {0,0,0,2,5068}, {0,0,0,2,5070},
+	{0,0,0,2,5072}, {0,0,0,2,5074}, {0,0,0,2,5076}, {0,0,0,2,5078},
+	{0,0,0,2,5080}, {0,0,0,2,5082}, {0,0,0,2,5084}, {0,0,0,2,5086},
+	{0,0,0,2,5088}, {0,0,0,2,5090}, {0,0,0,2,5092}, {0,0,0,2,5094},
+	{0,0,0,2,5096}, {0,0,0,2,5098}, {0,0,0,2,5100}, {0,0,0,2,5102},
+	{0,0,0,2,5104}, {0,0,0,2,5106}, {0,0,0,2,5108}, {0,0,0,2,5110},
+	{0,0,0,2,5112}, {0,0,0,2,5114}, {0,0,0,2,5116}, {0,0,0,2,5118},
+	{0,0,0,2,5120}, {0,0,0,2,5122}, {0,0,0,2,5124}, {0,0,0,2,5126},
+	{0,0,0,2,5128}, {0,0,0,2,5130}, {0,0,0,2,5132}, {0,0,0,2,5134},
+	{0,0,0,2,5136}, {0,0,0,2,5138}, {0,0,0,2,5140}, {0,0,0,2,5142},
+	{0,0,0,2,5144}, {0,0,0,2,5146}, {0,0,0,2,5148}, {0,0,0,2,5150},
+	{0,0,0,2,5152}, {0,0,0,2,5154}, {0,0,0,2,5156}, {0,0,0,2,5158},
+	{0,0,0,2,5160}, {0,0,0,2,5162}, {0,0,0,2,5164}, {0,0,0,2,5166},
+	{0,0,0,2,5168}, {0,0,0,2,5170}, {0,0,0,2,5172}, {0,0,0,2,5174},
+	{0,0,0,2,5176}, {0,0,0,2,5178}, {0,0,0,2,5180}, {0,0,0,2,5182},
+	{0,0,0,2,5184}, {0,0,0,2,5186}, {0,0,0,2,5188}, {0,0,0,2,5190},
+	{0,0,0,2,5192}, {0,0,0,2,5194}, {0,0,0,2,5196}, {0,0,0,2,5198},
+	{0,0,0,2,5200}, {0,0,0,2,5202}, {0,0,0,2,5204}, {0,0,0,2,5206},
+	{0,0,0,2,5208}, {0,0,0,2,5210}, {0,0,0,2,5212}, {0,0,0,2,5214},
+	{0,0,0,2,5216}, {0,0,0,2,5218}, {0,0,0,2,5220}, {0,0,0,2,5222},
+	{0,0,0,2,5224}, {0,0,0,2,5226}, {0,0,0,3,5228}, {0,0,0,3,5231},
+	{0,0,0,3,5234}, {0,0,0,3,5237}, {0,0,0,3,5240}, {0,0,0,3,5243},
+	{0,0,0,3,5246}, {0,0,0,3,5249}, {0,0,0,3,5252}, {0,0,0,2,5255},
+	{0,0,0,2,5257}, {0,0,0,2,5259}, {0,0,0,2,5261}, {0,0,0,2,5263},
+	{0,0,0,2,5265}, {0,0,0,2,5267}, {0,0,0,2,5269}, {0,0,0,2,5271},
+	{0,0,0,2,5273}, {0,0,0,2,5275}, {0,0,0,2,5277}, {0,0,0,2,5279},
+	{0,0,0,2,5281}, {0,0,0,2,5283}, {0,0,0,2,5285}, {0,0,0,3,5287},
+	{0,0,0,3,5290}, {0,0,0,2,5293}, {0,0,0,2,5295}, {0,0,0,2,5297},
+	{0,0,0,2,5299}, {0,0,0,2,5301}, {0,0,0,2,5303}, {0,0,0,2,5305},
+	{0,0,0,2,5307}, {0,0,0,2,5309}, {0,0,0,2,5311}, {0,0,0,2,5313},
+	{0,0,0,3,5315}, {0,0,0,3,5318}, {0,0,0,3,5321}, {0,0,0,2,5324},
+	{0,0,0,2,5326}, {0,0,0,2,5328}, {0,0,0,2,5330}, {0,0,0,2,5332},
+	{0,0,0,2,5334}, {0,0,0,2,5336}, {0,0,0,2,5338}, {0,0,0,2,5340},
+	{0,0,0,2,5342}, {0,0,0,2,5344}, {0,0,0,2,5346}, {0,0,0,2,5348},
+	{0,0,0,2,5350}, {0,0,0,2,5352}, {0,0,0,2,5354}, {0,0,0,2,5356},
+	{0,0,0,2,5358}, {0,0,0,2,5360}, {0,0,0,2,5362}, {0,0,0,2,5364},
+	{0,0,0,2,5366}, {0,0,0,2,5368}, {0,0,0,2,5370}, {0,0,0,2,5372},
+	{0,0,0,2,5374}, {0,0,0,2,5376}, {0,0,0,2,5378}, {0,0,0,3,5380},
+	{0,0,0,3,5383}, {0,0,0,3,5386}, {0,0,0,3,5389}, {0,0,0,3,5392},
+	{0,0,0,3,5395}, {0,0,0,3,5398}, {0,0,0,3,5401}, {0,0,0,3,5404},
+	{0,0,0,3,5407}, {0,0,0,3,5410}, {0,0,0,3,5413}, {0,0,0,3,5416},
+	{0,0,0,3,5419}, {0,0,0,3,5422}, {0,0,0,3,5425}, {0,0,0,3,5428},
+	{0,0,0,3,5431}, {0,0,0,3,5434}, {0,0,0,3,5437}, {0,0,0,3,5440},
+	{0,0,0,3,5443}, {0,0,0,3,5446}, {0,0,0,3,5449}, {0,0,0,3,5452},
+	{0,0,0,3,5455}, {0,0,0,3,5458}, {0,0,0,3,5461}, {0,0,0,3,5464},
+	{0,0,0,3,5467}, {0,0,0,3,5470}, {0,0,0,3,5473}, {0,0,0,3,5476},
+	{0,0,0,3,5479}, {0,0,0,3,5482}, {0,0,0,3,5485}, {0,0,0,3,5488},
+	{0,0,0,3,5491}, {0,0,0,3,5494}, {0,0,0,3,5497}, {0,0,0,3,5500},
+	{0,0,0,3,5503}, {0,0,0,3,5506}, {0,0,0,3,5509}, {0,0,0,3,5512},
+	{0,0,0,3,5515}, {0,0,0,3,5518}, {0,0,0,3,5521}, {0,0,0,3,5524},
+	{0,0,0,3,5527}, {0,0,0,3,5530}, {0,0,0,3,5533}, {0,0,0,3,5536},
+	{0,0,0,3,5539}, {0,0,0,3,5542}, {0,0,0,3,5545}, {0,0,0,3,5548},
+	{0,0,0,3,5551}, {0,0,0,3,5554}, {0,0,0,3,5557}, {0,0,0,3,5560},
+	{0,0,0,3,5563}, {0,0,0,3,5566}, {0,0,0,3,5569}, {0,0,0,3,5572},
+	{0,0,0,3,5575}, {0,0,0,3,5578}, {0,0,0,3,5581}, {0,0,0,3,5584},
+	{0,0,0,3,5587}, {0,0,0,3,5590}, {0,0,0,3,5593}, {0,0,0,3,5596},
+	{0,0,0,3,5599}, {0,0,0,3,5602}, {0,0,0,3,5605}, {0,0,0,3,5608},
+	{0,0,0,3,5611}, {0,0,0,3,5614}, {0,0,0,3,5617}, {0,0,0,3,5620},
+	{0,0,0,3,5623}, {0,0,0,3,5626}, {0,0,0,3,5629}, {0,0,0,3,5632},
+	{0,0,0,3,5635}, {0,0,0,3,5638}, {0,0,0,3,5641}, {0,0,0,3,5644},
+	{0,0,0,3,5647}, {0,0,0,3,5650}, {0,0,0,3,5653}, {0,0,0,3,5656},
+	{0,0,0,3,5659}, {0,0,0,3,5662}, {0,0,0,3,5665}, {0,0,0,4,5668},
+	{0,0,0,4,5672}, {0,0,0,4,5676}, {0,0,0,4,5680}, {0,0,0,4,5684},
+	{0,0,0,4,5688}, {0,0,0,4,5692}, {0,0,0,3,5696}, {0,0,0,18,5699},
+	{0,0,0,8,5717}, {0,0,0,4,5725}, {0,0,0,1,5729}, {0,0,0,1,5730},
+	{0,0,0,1,5731}, {0,0,0,1,5732}, {0,0,0,1,621}, {0,0,0,1,5733},
+	{0,0,0,1,5734}, {0,0,0,1,5735}, {0,0,0,1,5736}, {0,0,0,1,5737},
+	{0,0,0,1,5738}, {0,0,0,1,5739}, {0,0,0,1,5740}, {0,0,0,1,5741},
+	{0,0,0,1,5742}, {0,0,0,1,5743}, {0,0,0,1,5744}, {0,0,0,1,5745},
+	{0,0,0,1,5746}, {0,0,0,1,5747}, {0,0,0,1,2557}, {0,0,0,1,2558},
+	{0,0,0,1,5748}, {0,0,0,1,5749}, {0,0,0,1,5750}, {0,0,0,1,5751},
+	{0,0,0,1,5752}, {0,0,0,1,5753}, {0,0,0,1,5754}, {0,0,0,1,5755},
+	{0,0,0,1,5756}, {0,0,0,1,5757}, {0,0,0,1,5758}, {0,0,0,1,5759},
+	{0,0,0,1,5760}, {0,0,0,1,5761}, {0,0,0,1,5762}, {0,0,0,1,5763},
+	{0,0,0,2,5764}, {0,0,0,2,5766}, {0,0,0,2,5768}, {0,0,0,2,5770},
+	{0,0,0,2,5772}, {0,0,0,2,5774}, {0,0,0,2,5776}, {0,0,0,2,5778},
+	{0,0,0,2,5780}, {0,0,0,2,5782}, {0,0,0,2,5784}, {0,0,0,2,5786},
+	{0,0,0,2,5788}, {0,0,0,2,5790}, {0,0,0,1,5792}, {0,0,0,2,791},
+	{0,0,0,2,793}, {0,0,0,2,795}, {0,0,0,2,797}, {0,0,0,2,799},
+	{0,0,0,1,5793}, {0,0,0,1,5794}, {0,0,0,1,5795}, {0,0,0,1,5796},
+	{0,0,0,1,5797}, {0,0,0,1,5798}, {0,0,0,1,5799}, {0,0,0,1,5800},
+	{0,0,0,1,5801}, {0,0,0,1,5802}, {0,0,0,1,5803}, {0,0,0,1,5804},
+	{0,0,0,1,5805}, {0,0,0,1,5806}, {0,0,0,1,5807}, {0,0,0,1,5808},
+	{0,0,0,1,5809}, {0,0,0,1,5810}, {0,0,0,1,5811}, {0,0,0,1,5812},
+	{0,0,0,1,5813}, {0,0,0,1,5814}, {0,0,0,1,5815}, {0,0,0,1,5816},
+	{0,0,0,1,5817}, {0,0,0,1,5818}, {0,0,0,1,5819}, {0,0,0,1,5820},
+	{0,0,0,1,5821}, {0,0,0,3,5822}, {0,0,0,3,5825}, {0,0,0,3,5828},
+	{0,0,0,2,5831}, {0,0,0,1,5833}, {0,0,0,1,5834}, {0,0,0,1,5835},
+	{0,0,0,1,5836}, {0,0,0,1,2245}, {0,0,0,1,5837}, {0,0,0,1,5838},
+	{0,0,0,1,5839}, {0,0,0,1,5840}, {0,0,0,1,5841}, {0,0,0,1,5842},
+	{0,0,0,1,5843}, {0,0,0,1,5844}, {0,0,0,1,5845}, {0,0,0,1,5846},
+	{0,0,0,1,5847}, {0,0,0,1,5848}, {0,0,0,1,5849}, {0,0,0,1,5850},
+	{0,0,0,1,5851}, {0,0,0,1,5852}, {0,0,0,1,5853}, {0,0,0,1,5854},
+	{0,0,0,1,5855}, {0,0,0,1,5856}, {0,0,0,1,5857}, {0,0,0,1,5858},
+	{0,0,0,1,5859}, {0,0,0,1,5860}, {0,0,0,1,5861}, {0,0,0,1,5862},
+	{0,0,0,1,5863}, {0,0,0,1,5864}, {0,0,0,1,5865}, {0,0,0,1,5866},
+	{0,0,0,1,5867}, {0,2,5868,2,5868}, {0,2,5870,2,5870}, {0,2,5872,2,5872},
+	{0,2,5874,2,5874}, {0,2,5876,2,5876}, {0,2,5878,2,5878}, {0,2,5880,2,5880},
+	{0,2,5882,2,5882}, {0,2,5884,2,5884}, {0,2,5886,2,5886}, {0,2,5888,2,5888},
+	{0,2,5890,2,5890}, {0,2,5892,2,5892}, {0,2,5894,2,5894}, {0,3,5896,3,5896},
+	{0,3,5899,3,5899}, {0,3,5902,3,5902}, {0,3,5905,3,5905}, {0,3,5908,3,5908},
+	{226,0,0,0,0}, {0,2,5911,2,5911}, {0,2,5913,2,5913}, {0,3,5915,3,5915},
+	{0,3,5918,3,5918}, {0,3,5921,3,5921}, {0,3,5924,3,5924}, {0,0,0,1,5927},
+	{0,0,0,1,5928}, {0,0,0,1,5929}, {0,0,0,1,5930}, {0,0,0,1,5931},
+	{0,0,0,1,5932}, {0,0,0,1,5933}, {0,0,0,1,5934}, {0,0,0,1,5935},
+	{0,0,0,1,5936}, {0,0,0,1,5937}, {0,0,0,1,5938}, {0,0,0,1,5939},
+	{0,0,0,1,5940}, {0,0,0,1,5941}, {0,0,0,1,5942}, {0,0,0,1,5943},
+	{0,0,0,1,5944}, {0,0,0,1,5945}, {0,0,0,1,5946}, {0,0,0,1,2348},
+	{0,0,0,1,5947}, {0,0,0,1,5948}, {0,0,0,1,5949}, {0,0,0,1,5950},
+	{0,0,0,1,2141}, {0,0,0,1,5951}, {0,0,0,1,5952}, {0,0,0,1,5953},
+	{0,0,0,1,5954}, {0,0,0,1,5955}, {0,0,0,1,5956}, {0,0,0,1,5957},
+	{0,0,0,1,5958}, {0,0,0,1,5959}, {0,0,0,1,5960}, {0,0,0,1,5961},
+	{0,0,0,1,5962}, {0,0,0,1,5963}, {0,0,0,1,5964}, {0,0,0,1,5965},
+	{0,0,0,2,5966}, {0,0,0,2,5968}, {0,0,0,2,5970}, {0,0,0,2,5972},
+	{0,0,0,2,5974}, {0,0,0,2,5976}, {0,0,0,2,5978}, {0,0,0,2,5980},
+	{0,0,0,2,5982}, {0,0,0,2,5984}, {0,0,0,2,5986}, {0,0,0,3,5988},
+	{0,0,0,3,5991}, {0,0,0,3,5994}, {0,0,0,3,5997}, {0,0,0,3,6000},
+	{0,0,0,3,6003}, {0,0,0,3,6006}, {0,0,0,3,6009}, {0,0,0,3,6012},
+	{0,0,0,3,6015}, {0,0,0,3,6018}, {0,0,0,3,6021}, {0,0,0,3,6024},
+	{0,0,0,3,6027}, {0,0,0,3,6030}, {0,0,0,3,6033}, {0,0,0,3,6036},
+	{0,0,0,3,6039}, {0,0,0,3,6042}, {0,0,0,3,6045}, {0,0,0,3,6048},
+	{0,0,0,3,6051}, {0,0,0,3,6054}, {0,0,0,3,6057}, {0,0,0,3,6060},
+	{0,0,0,3,6063}, {0,0,0,3,6066}, {0,0,0,2,6069}, {0,0,0,2,6071},
+	{0,0,0,2,6073}, {0,0,0,2,6075}, {0,0,0,2,6077}, {0,0,0,3,6079},
+	{0,0,0,2,6082}, {0,0,0,2,6084}, {0,0,0,2,6086}, {0,0,0,2,6088},
+	{0,0,0,2,6090}, {0,0,0,2,6092}, {0,0,0,1,6094}, {0,0,0,1,6095},
+	{0,0,0,2,3104}, {0,0,0,1,6096}, {0,0,0,1,6097}, {0,0,0,1,6098},
+	{0,0,0,1,6099}, {0,0,0,1,6100}, {0,0,0,1,4645}, {0,0,0,1,6101},
+	{0,0,0,1,6102}, {0,0,0,1,6103}, {0,0,0,1,6104}, {0,0,0,1,6105},
+	{0,0,0,1,6106}, {0,0,0,1,6107}, {0,0,0,1,6108}, {0,0,0,1,6109},
+	{0,0,0,1,6110}, {0,0,0,1,6111}, {0,0,0,1,6112}, {0,0,0,1,6113},
+	{0,0,0,1,6114}, {0,0,0,1,6115}, {0,0,0,1,6116}, {0,0,0,1,6117},
+	{0,0,0,1,6118}, {0,0,0,1,6119}, {0,0,0,1,6120}, {0,0,0,1,6121},
+	{0,0,0,1,6122}, {0,0,0,3,6123}, {0,0,0,3,6126}, {0,0,0,3,6129},
+	{0,0,0,3,6132}, {0,0,0,3,6135}, {0,0,0,3,6138}, {0,0,0,3,6141},
+	{0,0,0,3,6144}, {0,0,0,3,6147}, {0,0,0,1,6150}, {0,0,0,1,6151},
+	{0,1,6152,1,6152}, {0,1,6153,1,6153}, {0,1,6154,1,6154}, {0,1,6155,1,6155},
+	{0,1,6156,1,6156}, {0,1,6157,1,6157}, {0,1,6158,1,6158}, {0,1,6159,1,6159},
+	{0,1,6160,1,6160}, {0,1,6161,1,6161}, {0,1,6162,1,6162}, {0,1,6163,1,6163},
+	{0,1,6164,1,6164}, {0,1,6165,1,6165}, {0,1,6166,1,6166}, {0,1,6167,1,6167},
+	{0,1,6168,1,6168}, {0,1,6169,1,6169}, {0,1,6103,1,6103}, {0,1,6170,1,6170},
+	{0,1,6171,1,6171}, {0,1,6172,1,6172}, {0,1,6173,1,6173}, {0,1,6174,1,6174},
+	{0,1,6175,1,6175}, {0,1,2817,1,2817}, {0,1,6176,1,6176}, {0,1,6177,1,6177},
+	{0,1,6178,1,6178}, {0,1,6179,1,6179}, {0,1,6121,1,6121}, {0,1,6180,1,6180},
+	{0,1,6181,1,6181}, {0,1,6182,1,6182}, {0,1,6183,1,6183}, {0,1,6184,1,6184},
+	{0,1,6185,1,6185}, {0,1,6186,1,6186}, {0,1,6187,1,6187}, {0,1,6188,1,6188},
+	{0,1,6189,1,6189}, {0,1,6190,1,6190}, {0,1,6191,1,6191}, {0,1,6192,1,6192},
+	{0,1,6193,1,6193}, {0,1,6194,1,6194}, {0,1,6195,1,6195}, {0,1,6196,1,6196},
+	{0,1,6197,1,6197}, {0,1,6198,1,6198}, {0,1,6199,1,6199}, {0,1,6200,1,6200},
+	{0,1,6201,1,6201}, {0,1,6202,1,6202}, {0,1,6203,1,6203}, {0,1,6204,1,6204},
+	{0,1,6205,1,6205}, {0,1,6206,1,6206}, {0,1,6207,1,6207}, {0,1,6208,1,6208},
+	{0,1,6209,1,6209}, {0,1,6210,1,6210}, {0,1,6211,1,6211}, {0,1,6212,1,6212},
+	{0,1,6213,1,6213}, {0,1,6214,1,6214}, {0,1,6215,1,6215}, {0,1,6216,1,6216},
+	{0,1,6217,1,6217}, {0,1,6218,1,6218}, {0,1,6219,1,6219}, {0,1,6220,1,6220},
+	{0,1,6221,1,6221}, {0,1,6222,1,6222}, {0,1,6223,1,6223}, {0,1,6224,1,6224},
+	{0,1,6225,1,6225}, {0,1,6096,1,6096}, {0,1,6226,1,6226}, {0,1,6227,1,6227},
+	{0,1,6228,1,6228}, {0,1,6229,1,6229}, {0,1,6230,1,6230}, {0,1,6231,1,6231},
+	{0,1,6232,1,6232}, {0,1,6233,1,6233}, {0,1,6234,1,6234}, {0,1,6235,1,6235},
+	{0,1,6236,1,6236}, {0,1,6237,1,6237}, {0,1,6238,1,6238}, {0,1,6239,1,6239},
+	{0,1,6240,1,6240}, {0,1,6241,1,6241}, {0,1,6242,1,6242}, {0,1,6243,1,6243},
+	{0,1,6244,1,6244}, {0,1,6245,1,6245}, {0,1,6246,1,6246}, {0,1,2843,1,2843},
+	{0,1,6247,1,6247}, {0,1,6248,1,6248}, {0,1,6249,1,6249}, {0,1,6250,1,6250},
+	{0,1,6251,1,6251}, {0,1,6252,1,6252}, {0,1,6253,1,6253}, {0,1,6254,1,6254},
+	{0,1,6255,1,6255}, {0,1,6256,1,6256}, {0,1,6257,1,6257}, {0,1,6258,1,6258},
+	{0,1,6259,1,6259}, {0,1,6260,1,6260}, {0,1,6261,1,6261}, {0,1,6262,1,6262},
+	{0,1,6263,1,6263}, {0,1,6264,1,6264}, {0,1,6265,1,6265}, {0,1,6266,1,6266},
+	{0,1,6267,1,6267}, {0,1,6268,1,6268}, {0,1,6269,1,6269}, {0,1,6270,1,6270},
+	{0,1,2855,1,2855}, {0,1,6271,1,6271}, {0,1,6272,1,6272}, {0,1,6273,1,6273},
+	{0,1,6274,1,6274}, {0,1,6275,1,6275}, {0,1,6276,1,6276}, {0,1,6277,1,6277},
+	{0,1,6278,1,6278}, {0,1,6279,1,6279}, {0,1,6280,1,6280}, {0,1,6281,1,6281},
+	{0,1,6282,1,6282}, {0,1,6283,1,6283}, {0,1,6284,1,6284}, {0,1,6285,1,6285},
+	{0,1,6286,1,6286}, {0,1,6287,1,6287}, {0,1,6288,1,6288}, {0,1,6289,1,6289},
+	{0,1,6290,1,6290}, {0,1,6291,1,6291}, {0,1,6292,1,6292}, {0,1,6293,1,6293},
+	{0,1,6294,1,6294}, {0,1,6295,1,6295}, {0,1,6296,1,6296}, {0,1,6297,1,6297},
+	{0,1,6298,1,6298}, {0,1,6299,1,6299}, {0,1,6300,1,6300}, {0,1,6301,1,6301},
+	{0,1,6302,1,6302}, {0,1,6303,1,6303}, {0,1,6304,1,6304}, {0,1,6305,1,6305},
+	{0,1,6306,1,6306}, {0,1,6307,1,6307}, {0,1,6308,1,6308}, {0,1,6309,1,6309},
+	{0,1,6310,1,6310}, {0,1,6311,1,6311}, {0,1,6312,1,6312}, {0,1,6313,1,6313},
+	{0,1,6314,1,6314}, {0,1,6315,1,6315}, {0,1,6316,1,6316}, {0,1,6317,1,6317},
+	{0,1,6318,1,6318}, {0,1,6319,1,6319}, {0,1,6320,1,6320}, {0,1,6321,1,6321},
+	{0,1,6322,1,6322}, {0,1,6323,1,6323}, {0,1,6324,1,6324}, {0,1,6325,1,6325},
+	{0,1,6326,1,6326}, {0,1,6327,1,6327}, {0,1,6328,1,6328}, {0,1,6329,1,6329},
+	{0,1,6330,1,6330}, {0,1,6331,1,6331}, {0,1,6332,1,6332}, {0,1,6333,1,6333},
+	{0,1,6334,1,6334}, {0,1,6335,1,6335}, {0,1,6336,1,6336}, {0,1,6337,1,6337},
+	{0,1,6338,1,6338}, {0,1,6339,1,6339}, {0,1,6340,1,6340}, {0,1,6341,1,6341},
+	{0,1,6342,1,6342}, {0,1,6343,1,6343}, {0,1,6344,1,6344}, {0,1,6345,1,6345},
+	{0,1,6346,1,6346}, {0,1,6347,1,6347}, {0,1,6348,1,6348}, {0,1,6349,1,6349},
+	{0,1,6350,1,6350}, {0,1,6351,1,6351}, {0,1,6352,1,6352}, {0,1,6353,1,6353},
+	{0,1,6354,1,6354}, {0,1,6355,1,6355}, {0,1,6356,1,6356}, {0,1,6357,1,6357},
+	{0,1,6358,1,6358}, {0,1,6359,1,6359}, {0,1,6360,1,6360}, {0,1,6361,1,6361},
+	{0,1,6362,1,6362}, {0,1,6363,1,6363}, {0,1,6364,1,6364}, {0,1,6365,1,6365},
+	{0,1,6366,1,6366}, {0,1,6367,1,6367}, {0,1,6368,1,6368}, {0,1,6369,1,6369},
+	{0,1,6370,1,6370}, {0,1,6371,1,6371}, {0,1,6372,1,6372}, {0,1,6373,1,6373},
+	{0,1,6374,1,6374}, {0,1,6375,1,6375}, {0,1,6376,1,6376}, {0,1,6377,1,6377},
+	{0,1,6378,1,6378}, {0,1,6379,1,6379}, {0,1,6380,1,6380}, {0,1,6381,1,6381},
+	{0,1,6382,1,6382}, {0,1,6383,1,6383}, {0,1,6384,1,6384}, {0,1,6385,1,6385},
+	{0,1,6386,1,6386}, {0,1,6387,1,6387}, {0,1,6388,1,6388}, {0,1,6389,1,6389},
+	{0,1,6390,1,6390}, {0,1,6391,1,6391}, {0,1,6392,1,6392}, {0,1,6393,1,6393},
+	{0,1,6394,1,6394}, {0,1,6395,1,6395}, {0,1,6396,1,6396}, {0,1,6397,1,6397},
+	{0,1,6398,1,6398}, {0,1,6399,1,6399}, {0,1,6400,1,6400}, {0,1,6401,1,6401},
+	{0,1,6402,1,6402}, {0,1,6403,1,6403}, {0,1,6404,1,6404}, {0,1,6405,1,6405},
+	{0,1,6406,1,6406}, {0,1,6407,1,6407}, {0,1,6408,1,6408}, {0,1,6409,1,6409},
+	{0,1,6410,1,6410}, {0,1,6411,1,6411}, {0,1,6412,1,6412}, {0,1,6413,1,6413},
+	{0,1,6414,1,6414}, {0,1,6415,1,6415}, {0,1,6416,1,6416}, {0,1,6417,1,6417},
+	{0,1,6418,1,6418}, {0,1,6419,1,6419}, {0,1,6420,1,6420}, {0,1,6421,1,6421},
+	{0,1,6422,1,6422}, {0,1,6423,1,6423}, {0,1,6424,1,6424}, {0,1,6425,1,6425},
+	{0,1,6426,1,6426}, {0,1,6427,1,6427}, {0,1,6428,1,6428}, {0,1,6429,1,6429},
+	{0,1,6430,1,6430}, {0,1,6431,1,6431}, {0,1,6432,1,6432}, {0,1,6433,1,6433},
+	{0,1,6434,1,6434}, {0,1,6435,1,6435}, {0,1,6436,1,6436}, {0,1,6437,1,6437},
+	{0,1,6438,1,6438}, {0,1,6439,1,6439}, {0,1,6440,1,6440}, {0,1,6441,1,6441},
+	{0,1,6442,1,6442}, {0,1,6443,1,6443}, {0,1,6444,1,6444}, {0,1,6445,1,6445},
+	{0,1,6446,1,6446}, {0,1,6447,1,6447}, {0,1,6448,1,6448}, {0,1,6449,1,6449},
+	{0,1,6450,1,6450}, {0,1,6451,1,6451}, {0,1,6452,1,6452}, {0,1,6453,1,6453},
+	{0,1,6454,1,6454}, {0,1,6455,1,6455}, {0,1,6456,1,6456}, {0,1,6457,1,6457},
+	{0,1,6458,1,6458}, {0,1,6459,1,6459}, {0,1,6460,1,6460}, {0,1,6461,1,6461},
+	{0,1,6462,1,6462}, {0,1,6463,1,6463}, {0,1,6464,1,6464}, {0,1,6465,1,6465},
+	{0,1,6466,1,6466}, {0,1,6467,1,6467}, {0,1,6468,1,6468}, {0,1,6469,1,6469},
+	{0,1,6470,1,6470}, {0,1,6471,1,6471}, {0,1,6472,1,6472}, {0,1,6473,1,6473},
+	{0,1,6474,1,6474}, {0,1,6475,1,6475}, {0,1,6476,1,6476}, {0,1,6477,1,6477},
+	{0,1,6478,1,6478}, {0,1,6479,1,6479}, {0,1,6480,1,6480}, {0,1,6481,1,6481},
+	{0,1,6482,1,6482}, {0,1,6483,1,6483}, {0,1,6484,1,6484}, {0,1,6485,1,6485},
+	{0,1,6486,1,6486}, {0,1,6487,1,6487}, {0,1,6488,1,6488}, {0,1,6489,1,6489},
+	{0,1,6490,1,6490}, {0,1,6491,1,6491}, {0,1,6492,1,6492}, {0,1,6493,1,6493},
+	{0,1,6494,1,6494}, {0,1,6495,1,6495}, {0,1,6496,1,6496}, {0,1,6497,1,6497},
+	{0,1,6498,1,6498}, {0,1,6499,1,6499}, {0,1,6500,1,6500}, {0,1,6501,1,6501},
+	{0,1,6502,1,6502}, {0,1,6503,1,6503}, {0,1,6504,1,6504}, {0,1,6505,1,6505},
+	{0,1,6506,1,6506}, {0,1,6507,1,6507}, {0,1,6508,1,6508}, {0,1,6509,1,6509},
+	{0,1,6510,1,6510}, {0,1,6511,1,6511}, {0,1,6512,1,6512}, {0,1,6513,1,6513},
+	{0,1,6514,1,6514}, {0,1,6515,1,6515}, {0,1,6516,1,6516}, {0,1,6517,1,6517},
+	{0,1,6518,1,6518}, {0,1,6519,1,6519}, {0,1,6520,1,6520}, {0,1,6521,1,6521},
+	{0,1,6522,1,6522}, {0,1,6523,1,6523}, {0,1,6524,1,6524}, {0,1,6525,1,6525},
+	{0,1,6526,1,6526}, {0,1,6527,1,6527}, {0,1,6528,1,6528}, {0,1,6529,1,6529},
+	{0,1,6530,1,6530}, {0,1,6531,1,6531}, {0,1,6532,1,6532}, {0,1,6533,1,6533},
+	{0,1,6534,1,6534}, {0,1,6535,1,6535}, {0,1,6536,1,6536}, {0,1,6537,1,6537},
+	{0,1,6538,1,6538}, {0,1,2945,1,2945}, {0,1,6539,1,6539}, {0,1,6540,1,6540},
+	{0,1,6541,1,6541}, {0,1,6542,1,6542}, {0,1,6543,1,6543}, {0,1,6544,1,6544},
+	{0,1,6545,1,6545}, {0,1,6546,1,6546}, {0,1,6547,1,6547}, {0,1,6548,1,6548},
+	{0,1,6549,1,6549}, {0,1,2952,1,2952}, {0,1,6550,1,6550}, {0,1,6551,1,6551},
+	{0,1,6552,1,6552}, {0,1,6553,1,6553}, {0,1,6554,1,6554}, {0,1,6555,1,6555},
+	{0,1,6556,1,6556}, {0,1,6557,1,6557}, {0,1,6558,1,6558}, {0,1,6559,1,6559},
+	{0,1,6560,1,6560}, {0,1,6561,1,6561}, {0,1,6562,1,6562}, {0,1,6563,1,6563},
+	{0,1,6564,1,6564}, {0,1,6565,1,6565}, {0,1,6566,1,6566}, {0,1,6567,1,6567},
+	{0,1,6568,1,6568}, {0,1,6569,1,6569}, {0,1,6570,1,6570}, {0,1,6571,1,6571},
+	{0,1,6572,1,6572}, {0,1,6573,1,6573}, {0,1,6574,1,6574}, {0,1,6575,1,6575},
+	{0,1,6576,1,6576}, {0,1,6577,1,6577}, {0,1,6578,1,6578}, {0,1,6579,1,6579},
+	{0,1,6580,1,6580}, {0,1,6581,1,6581}, {0,1,6582,1,6582}, {0,1,6583,1,6583},
+	{0,1,6584,1,6584}, {0,1,6585,1,6585}, {0,1,6586,1,6586}, {0,1,6587,1,6587},
+	{0,1,6588,1,6588}, {0,1,6589,1,6589}, {0,1,6590,1,6590}, {0,1,6591,1,6591},
+	{0,1,6592,1,6592}, {0,1,6593,1,6593}, {0,1,6594,1,6594}, {0,1,6595,1,6595},
+	{0,1,6596,1,6596}, {0,1,6597,1,6597}, {0,1,6598,1,6598}, {0,1,6599,1,6599},
+	{0,1,6600,1,6600}, {0,1,6601,1,6601}, {0,1,6602,1,6602}, {0,1,6603,1,6603},
+	{0,1,6604,1,6604}, {0,1,6605,1,6605}, {0,1,6606,1,6606}, {0,1,6607,1,6607},
+	{0,1,6608,1,6608}, {0,1,6609,1,6609}, {0,1,6610,1,6610}, {0,1,6611,1,6611},
+	{0,1,3000,1,3000}, {0,1,6612,1,6612}, {0,1,3004,1,3004}, {0,1,6613,1,6613},
+	{0,1,6614,1,6614}, {0,1,6615,1,6615}, {0,1,6616,1,6616}, {0,1,3009,1,3009},
+	{0,1,6617,1,6617}
+};
+static const a_cp a_norm_data[6618] = 
+{
+	0x00020, 0x00020, 0x00308, 0x00061, 0x00020, 0x00304, 0x00032, 0x00033, 0x00020, 0x00301,
+	0x003BC, 0x00020, 0x00327, 0x00031, 0x0006F, 0x00031, 0x02044, 0x00034, 0x00031, 0x02044,
+	0x00032, 0x00033, 0x02044, 0x00034, 0x00041, 0x00300, 0x00041, 0x00301, 0x00041, 0x00302,
+	0x00041, 0x00303, 0x00041, 0x00308, 0x00041, 0x0030A, 0x00043, 0x00327, 0x00045, 0x00300,
+	0x00045, 0x00301, 0x00045, 0x00302, 0x00045, 0x00308, 0x00049, 0x00300, 0x00049, 0x00301,
+	0x00049, 0x00302, 0x00049, 0x00308, 0x0004E, 0x00303, 0x0004F, 0x00300, 0x0004F, 0x00301,
+	0x0004F, 0x00302, 0x0004F, 0x00303, 0x0004F, 0x00308, 0x00055, 0x00300, 0x00055, 0x00301,
+	0x00055, 0x00302, 0x00055, 0x00308, 0x00059, 0x00301, 0x00061, 0x00300, 0x00061, 0x00301,
+	0x00061, 0x00302, 0x00061, 0x00303, 0x00061, 0x00308, 0x00061, 0x0030A, 0x00063, 0x00327,
+	0x00065, 0x00300, 0x00065, 0x00301, 0x00065, 0x00302, 0x00065, 0x00308, 0x00069, 0x00300,
+	0x00069, 0x00301, 0x00069, 0x00302, 0x00069, 0x00308, 0x0006E, 0x00303, 0x0006F, 0x00300,
+	0x0006F, 0x00301, 0x0006F, 0x00302, 0x0006F, 0x00303, 0x0006F, 0x00308, 0x00075, 0x00300,
+	0x00075, 0x00301, 0x00075, 0x00302, 0x00075, 0x00308, 0x00079, 0x00301, 0x00079, 0x00308,
+	0x00041, 0x00304, 0x00061, 0x00304, 0x00041, 0x00306, 0x00061, 0x00306, 0x00041, 0x00328,
+	0x00061, 0x00328, 0x00043, 0x00301, 0x00063, 0x00301, 0x00043, 0x00302, 0x00063, 0x00302,
+	0x00043, 0x00307, 0x00063, 0x00307, 0x00043, 0x0030C, 0x00063, 0x0030C, 0x00044, 0x0030C,
+	0x00064, 0x0030C, 0x00045, 0x00304, 0x00065, 0x00304, 0x00045, 0x00306, 0x00065, 0x00306,
+	0x00045, 0x00307, 0x00065, 0x00307, 0x00045, 0x00328, 0x00065, 0x00328, 0x00045, 0x0030C,
+	0x00065, 0x0030C, 0x00047, 0x00302, 0x00067, 0x00302, 0x00047, 0x00306, 0x00067, 0x00306,
+	0x00047, 0x00307, 0x00067, 0x00307, 0x00047, 0x00327, 0x00067, 0x00327, 0x00048, 0x00302,
+	0x00068, 0x00302, 0x00049, 0x00303, 0x00069, 0x00303, 0x00049, 0x00304, 0x00069, 0x00304,
+	0x00049, 0x00306, 0x00069, 0x00306, 0x00049, 0x00328, 0x00069, 0x00328, 0x00049, 0x00307,
+	0x00049, 0x0004A, 0x00069, 0x0006A, 0x0004A, 0x00302, 0x0006A, 0x00302, 0x0004B, 0x00327,
+	0x0006B, 0x00327, 0x0004C, 0x00301, 0x0006C, 0x00301, 0x0004C, 0x00327, 0x0006C, 0x00327,
+	0x0004C, 0x0030C, 0x0006C, 0x0030C, 0x0004C, 0x000B7, 0x0006C, 0x000B7, 0x0004E, 0x00301,
+	0x0006E, 0x00301, 0x0004E, 0x00327, 0x0006E, 0x00327, 0x0004E, 0x0030C, 0x0006E, 0x0030C,
+	0x002BC, 0x0006E, 0x0004F, 0x00304, 0x0006F, 0x00304, 0x0004F, 0x00306, 0x0006F, 0x00306,
+	0x0004F, 0x0030B, 0x0006F, 0x0030B, 0x00052, 0x00301, 0x00072, 0x00301, 0x00052, 0x00327,
+	0x00072, 0x00327, 0x00052, 0x0030C, 0x00072, 0x0030C, 0x00053, 0x00301, 0x00073, 0x00301,
+	0x00053, 0x00302, 0x00073, 0x00302, 0x00053, 0x00327, 0x00073, 0x00327, 0x00053, 0x0030C,
+	0x00073, 0x0030C, 0x00054, 0x00327, 0x00074, 0x00327, 0x00054, 0x0030C, 0x00074, 0x0030C,
+	0x00055, 0x00303, 0x00075, 0x00303, 0x00055, 0x00304, 0x00075, 0x00304, 0x00055, 0x00306,
+	0x00075, 0x00306, 0x00055, 0x0030A, 0x00075, 0x0030A, 0x00055, 0x0030B, 0x00075, 0x0030B,
+	0x00055, 0x00328, 0x00075, 0x00328, 0x00057, 0x00302, 0x00077, 0x00302, 0x00059, 0x00302,
+	0x00079, 0x00302, 0x00059, 0x00308, 0x0005A, 0x00301, 0x0007A, 0x00301, 0x0005A, 0x00307,
+	0x0007A, 0x00307, 0x0005A, 0x0030C, 0x0007A, 0x0030C, 0x00073, 0x0004F, 0x0031B, 0x0006F,
+	0x0031B, 0x00055, 0x0031B, 0x00075, 0x0031B, 0x00044, 0x0005A, 0x0030C, 0x00044, 0x0007A,
+	0x0030C, 0x00064, 0x0007A, 0x0030C, 0x0004C, 0x0004A, 0x0004C, 0x0006A, 0x0006C, 0x0006A,
+	0x0004E, 0x0004A, 0x0004E, 0x0006A, 0x0006E, 0x0006A, 0x00041, 0x0030C, 0x00061, 0x0030C,
+	0x00049, 0x0030C, 0x00069, 0x0030C, 0x0004F, 0x0030C, 0x0006F, 0x0030C, 0x00055, 0x0030C,
+	0x00075, 0x0030C, 0x00055, 0x00308, 0x00304, 0x00075, 0x00308, 0x00304, 0x00055, 0x00308,
+	0x00301, 0x00075, 0x00308, 0x00301, 0x00055, 0x00308, 0x0030C, 0x00075, 0x00308, 0x0030C,
+	0x00055, 0x00308, 0x00300, 0x00075, 0x00308, 0x00300, 0x00041, 0x00308, 0x00304, 0x00061,
+	0x00308, 0x00304, 0x00041, 0x00307, 0x00304, 0x00061, 0x00307, 0x00304, 0x000C6, 0x00304,
+	0x000E6, 0x00304, 0x00047, 0x0030C, 0x00067, 0x0030C, 0x0004B, 0x0030C, 0x0006B, 0x0030C,
+	0x0004F, 0x00328, 0x0006F, 0x00328, 0x0004F, 0x00328, 0x00304, 0x0006F, 0x00328, 0x00304,
+	0x001B7, 0x0030C, 0x00292, 0x0030C, 0x0006A, 0x0030C, 0x00044, 0x0005A, 0x00044, 0x0007A,
+	0x00064, 0x0007A, 0x00047, 0x00301, 0x00067, 0x00301, 0x0004E, 0x00300, 0x0006E, 0x00300,
+	0x00041, 0x0030A, 0x00301, 0x00061, 0x0030A, 0x00301, 0x000C6, 0x00301, 0x000E6, 0x00301,
+	0x000D8, 0x00301, 0x000F8, 0x00301, 0x00041, 0x0030F, 0x00061, 0x0030F, 0x00041, 0x00311,
+	0x00061, 0x00311, 0x00045, 0x0030F, 0x00065, 0x0030F, 0x00045, 0x00311, 0x00065, 0x00311,
+	0x00049, 0x0030F, 0x00069, 0x0030F, 0x00049, 0x00311, 0x00069, 0x00311, 0x0004F, 0x0030F,
+	0x0006F, 0x0030F, 0x0004F, 0x00311, 0x0006F, 0x00311, 0x00052, 0x0030F, 0x00072, 0x0030F,
+	0x00052, 0x00311, 0x00072, 0x00311, 0x00055, 0x0030F, 0x00075, 0x0030F, 0x00055, 0x00311,
+	0x00075, 0x00311, 0x00053, 0x00326, 0x00073, 0x00326, 0x00054, 0x00326, 0x00074, 0x00326,
+	0x00048, 0x0030C, 0x00068, 0x0030C, 0x00041, 0x00307, 0x00061, 0x00307, 0x00045, 0x00327,
+	0x00065, 0x00327, 0x0004F, 0x00308, 0x00304, 0x0006F, 0x00308, 0x00304, 0x0004F, 0x00303,
+	0x00304, 0x0006F, 0x00303, 0x00304, 0x0004F, 0x00307, 0x0006F, 0x00307, 0x0004F, 0x00307,
+	0x00304, 0x0006F, 0x00307, 0x00304, 0x00059, 0x00304, 0x00079, 0x00304, 0x00068, 0x00266,
+	0x0006A, 0x00072, 0x00279, 0x0027B, 0x00281, 0x00077, 0x00079, 0x00020, 0x00306, 0x00020,
+	0x00307, 0x00020, 0x0030A, 0x00020, 0x00328, 0x00020, 0x00303, 0x00020, 0x0030B, 0x00263,
+	0x0006C, 0x00078, 0x00295, 0x00300, 0x00301, 0x00313, 0x00308, 0x00301, 0x002B9, 0x00020,
+	0x00345, 0x0003B, 0x000A8, 0x00301, 0x00020, 0x00308, 0x00301, 0x00391, 0x00301, 0x000B7,
+	0x00395, 0x00301, 0x00397, 0x00301, 0x00399, 0x00301, 0x0039F, 0x00301, 0x003A5, 0x00301,
+	0x003A9, 0x00301, 0x003B9, 0x00308, 0x00301, 0x00399, 0x00308, 0x003A5, 0x00308, 0x003B1,
+	0x00301, 0x003B5, 0x00301, 0x003B7, 0x00301, 0x003B9, 0x00301, 0x003C5, 0x00308, 0x00301,
+	0x003B9, 0x00308, 0x003C5, 0x00308, 0x003BF, 0x00301, 0x003C5, 0x00301, 0x003C9, 0x00301,
+	0x003B2, 0x003B8, 0x003A5, 0x003D2, 0x00301, 0x003D2, 0x00308, 0x003C6, 0x003C0, 0x003BA,
+	0x003C1, 0x003C2, 0x00398, 0x003B5, 0x003A3, 0x00415, 0x00300, 0x00415, 0x00308, 0x00413,
+	0x00301, 0x00406, 0x00308, 0x0041A, 0x00301, 0x00418, 0x00300, 0x00423, 0x00306, 0x00418,
+	0x00306, 0x00438, 0x00306, 0x00435, 0x00300, 0x00435, 0x00308, 0x00433, 0x00301, 0x00456,
+	0x00308, 0x0043A, 0x00301, 0x00438, 0x00300, 0x00443, 0x00306, 0x00474, 0x0030F, 0x00475,
+	0x0030F, 0x00416, 0x00306, 0x00436, 0x00306, 0x00410, 0x00306, 0x00430, 0x00306, 0x00410,
+	0x00308, 0x00430, 0x00308, 0x00415, 0x00306, 0x00435, 0x00306, 0x004D8, 0x00308, 0x004D9,
+	0x00308, 0x00416, 0x00308, 0x00436, 0x00308, 0x00417, 0x00308, 0x00437, 0x00308, 0x00418,
+	0x00304, 0x00438, 0x00304, 0x00418, 0x00308, 0x00438, 0x00308, 0x0041E, 0x00308, 0x0043E,
+	0x00308, 0x004E8, 0x00308, 0x004E9, 0x00308, 0x0042D, 0x00308, 0x0044D, 0x00308, 0x00423,
+	0x00304, 0x00443, 0x00304, 0x00423, 0x00308, 0x00443, 0x00308, 0x00423, 0x0030B, 0x00443,
+	0x0030B, 0x00427, 0x00308, 0x00447, 0x00308, 0x0042B, 0x00308, 0x0044B, 0x00308, 0x00565,
+	0x00582, 0x00627, 0x00653, 0x00627, 0x00654, 0x00648, 0x00654, 0x00627, 0x00655, 0x0064A,
+	0x00654, 0x00627, 0x00674, 0x00648, 0x00674, 0x006C7, 0x00674, 0x0064A, 0x00674, 0x006D5,
+	0x00654, 0x006C1, 0x00654, 0x006D2, 0x00654, 0x00928, 0x0093C, 0x00930, 0x0093C, 0x00933,
+	0x0093C, 0x00915, 0x0093C, 0x00916, 0x0093C, 0x00917, 0x0093C, 0x0091C, 0x0093C, 0x00921,
+	0x0093C, 0x00922, 0x0093C, 0x0092B, 0x0093C, 0x0092F, 0x0093C, 0x009C7, 0x009BE, 0x009C7,
+	0x009D7, 0x009A1, 0x009BC, 0x009A2, 0x009BC, 0x009AF, 0x009BC, 0x00A32, 0x00A3C, 0x00A38,
+	0x00A3C, 0x00A16, 0x00A3C, 0x00A17, 0x00A3C, 0x00A1C, 0x00A3C, 0x00A2B, 0x00A3C, 0x00B47,
+	0x00B56, 0x00B47, 0x00B3E, 0x00B47, 0x00B57, 0x00B21, 0x00B3C, 0x00B22, 0x00B3C, 0x00B92,
+	0x00BD7, 0x00BC6, 0x00BBE, 0x00BC7, 0x00BBE, 0x00BC6, 0x00BD7, 0x00C46, 0x00C56, 0x00CBF,
+	0x00CD5, 0x00CC6, 0x00CD5, 0x00CC6, 0x00CD6, 0x00CC6, 0x00CC2, 0x00CC6, 0x00CC2, 0x00CD5,
+	0x00D46, 0x00D3E, 0x00D47, 0x00D3E, 0x00D46, 0x00D57, 0x00DD9, 0x00DCA, 0x00DD9, 0x00DCF,
+	0x00DD9, 0x00DCF, 0x00DCA, 0x00DD9, 0x00DDF, 0x00E4D, 0x00E32, 0x00ECD, 0x00EB2, 0x00EAB,
+	0x00E99, 0x00EAB, 0x00EA1, 0x00F0B, 0x00F42, 0x00FB7, 0x00F4C, 0x00FB7, 0x00F51, 0x00FB7,
+	0x00F56, 0x00FB7, 0x00F5B, 0x00FB7, 0x00F40, 0x00FB5, 0x00F71, 0x00F72, 0x00F71, 0x00F74,
+	0x00FB2, 0x00F80, 0x00FB2, 0x00F71, 0x00F80, 0x00FB3, 0x00F80, 0x00FB3, 0x00F71, 0x00F80,
+	0x00F71, 0x00F80, 0x00F92, 0x00FB7, 0x00F9C, 0x00FB7, 0x00FA1, 0x00FB7, 0x00FA6, 0x00FB7,
+	0x00FAB, 0x00FB7, 0x00F90, 0x00FB5, 0x01025, 0x0102E, 0x010DC, 0x01B05, 0x01B35, 0x01B07,
+	0x01B35, 0x01B09, 0x01B35, 0x01B0B, 0x01B35, 0x01B0D, 0x01B35, 0x01B11, 0x01B35, 0x01B3A,
+	0x01B35, 0x01B3C, 0x01B35, 0x01B3E, 0x01B35, 0x01B3F, 0x01B35, 0x01B42, 0x01B35, 0x00041,
+	0x000C6, 0x00042, 0x00044, 0x00045, 0x0018E, 0x00047, 0x00048, 0x00049, 0x0004A, 0x0004B,
+	0x0004C, 0x0004D, 0x0004E, 0x0004F, 0x00222, 0x00050, 0x00052, 0x00054, 0x00055, 0x00057,
+	0x00250, 0x00251, 0x01D02, 0x00062, 0x00064, 0x00065, 0x00259, 0x0025B, 0x0025C, 0x00067,
+	0x0006B, 0x0006D, 0x0014B, 0x00254, 0x01D16, 0x01D17, 0x00070, 0x00074, 0x00075, 0x01D1D,
+	0x0026F, 0x00076, 0x01D25, 0x003B3, 0x003B4, 0x003C7, 0x00069, 0x0043D, 0x00252, 0x00063,
+	0x00255, 0x000F0, 0x00066, 0x0025F, 0x00261, 0x00265, 0x00268, 0x00269, 0x0026A, 0x01D7B,
+	0x0029D, 0x0026D, 0x01D85, 0x0029F, 0x00271, 0x00270, 0x00272, 0x00273, 0x00274, 0x00275,
+	0x00278, 0x00282, 0x00283, 0x001AB, 0x00289, 0x0028A, 0x01D1C, 0x0028B, 0x0028C, 0x0007A,
+	0x00290, 0x00291, 0x00292, 0x00041, 0x00325, 0x00061, 0x00325, 0x00042, 0x00307, 0x00062,
+	0x00307, 0x00042, 0x00323, 0x00062, 0x00323, 0x00042, 0x00331, 0x00062, 0x00331, 0x00043,
+	0x00327, 0x00301, 0x00063, 0x00327, 0x00301, 0x00044, 0x00307, 0x00064, 0x00307, 0x00044,
+	0x00323, 0x00064, 0x00323, 0x00044, 0x00331, 0x00064, 0x00331, 0x00044, 0x00327, 0x00064,
+	0x00327, 0x00044, 0x0032D, 0x00064, 0x0032D, 0x00045, 0x00304, 0x00300, 0x00065, 0x00304,
+	0x00300, 0x00045, 0x00304, 0x00301, 0x00065, 0x00304, 0x00301, 0x00045, 0x0032D, 0x00065,
+	0x0032D, 0x00045, 0x00330, 0x00065, 0x00330, 0x00045, 0x00327, 0x00306, 0x00065, 0x00327,
+	0x00306, 0x00046, 0x00307, 0x00066, 0x00307, 0x00047, 0x00304, 0x00067, 0x00304, 0x00048,
+	0x00307, 0x00068, 0x00307, 0x00048, 0x00323, 0x00068, 0x00323, 0x00048, 0x00308, 0x00068,
+	0x00308, 0x00048, 0x00327, 0x00068, 0x00327, 0x00048, 0x0032E, 0x00068, 0x0032E, 0x00049,
+	0x00330, 0x00069, 0x00330, 0x00049, 0x00308, 0x00301, 0x00069, 0x00308, 0x00301, 0x0004B,
+	0x00301, 0x0006B, 0x00301, 0x0004B, 0x00323, 0x0006B, 0x00323, 0x0004B, 0x00331, 0x0006B,
+	0x00331, 0x0004C, 0x00323, 0x0006C, 0x00323, 0x0004C, 0x00323, 0x00304, 0x0006C, 0x00323,
+	0x00304, 0x0004C, 0x00331, 0x0006C, 0x00331, 0x0004C, 0x0032D, 0x0006C, 0x0032D, 0x0004D,
+	0x00301, 0x0006D, 0x00301, 0x0004D, 0x00307, 0x0006D, 0x00307, 0x0004D, 0x00323, 0x0006D,
+	0x00323, 0x0004E, 0x00307, 0x0006E, 0x00307, 0x0004E, 0x00323, 0x0006E, 0x00323, 0x0004E,
+	0x00331, 0x0006E, 0x00331, 0x0004E, 0x0032D, 0x0006E, 0x0032D, 0x0004F, 0x00303, 0x00301,
+	0x0006F, 0x00303, 0x00301, 0x0004F, 0x00303, 0x00308, 0x0006F, 0x00303, 0x00308, 0x0004F,
+	0x00304, 0x00300, 0x0006F, 0x00304, 0x00300, 0x0004F, 0x00304, 0x00301, 0x0006F, 0x00304,
+	0x00301, 0x00050, 0x00301, 0x00070, 0x00301, 0x00050, 0x00307, 0x00070, 0x00307, 0x00052,
+	0x00307, 0x00072, 0x00307, 0x00052, 0x00323, 0x00072, 0x00323, 0x00052, 0x00323, 0x00304,
+	0x00072, 0x00323, 0x00304, 0x00052, 0x00331, 0x00072, 0x00331, 0x00053, 0x00307, 0x00073,
+	0x00307, 0x00053, 0x00323, 0x00073, 0x00323, 0x00053, 0x00301, 0x00307, 0x00073, 0x00301,
+	0x00307, 0x00053, 0x0030C, 0x00307, 0x00073, 0x0030C, 0x00307, 0x00053, 0x00323, 0x00307,
+	0x00073, 0x00323, 0x00307, 0x00054, 0x00307, 0x00074, 0x00307, 0x00054, 0x00323, 0x00074,
+	0x00323, 0x00054, 0x00331, 0x00074, 0x00331, 0x00054, 0x0032D, 0x00074, 0x0032D, 0x00055,
+	0x00324, 0x00075, 0x00324, 0x00055, 0x00330, 0x00075, 0x00330, 0x00055, 0x0032D, 0x00075,
+	0x0032D, 0x00055, 0x00303, 0x00301, 0x00075, 0x00303, 0x00301, 0x00055, 0x00304, 0x00308,
+	0x00075, 0x00304, 0x00308, 0x00056, 0x00303, 0x00076, 0x00303, 0x00056, 0x00323, 0x00076,
+	0x00323, 0x00057, 0x00300, 0x00077, 0x00300, 0x00057, 0x00301, 0x00077, 0x00301, 0x00057,
+	0x00308, 0x00077, 0x00308, 0x00057, 0x00307, 0x00077, 0x00307, 0x00057, 0x00323, 0x00077,
+	0x00323, 0x00058, 0x00307, 0x00078, 0x00307, 0x00058, 0x00308, 0x00078, 0x00308, 0x00059,
+	0x00307, 0x00079, 0x00307, 0x0005A, 0x00302, 0x0007A, 0x00302, 0x0005A, 0x00323, 0x0007A,
+	0x00323, 0x0005A, 0x00331, 0x0007A, 0x00331, 0x00068, 0x00331, 0x00074, 0x00308, 0x00077,
+	0x0030A, 0x00079, 0x0030A, 0x00061, 0x002BE, 0x0017F, 0x00307, 0x00041, 0x00323, 0x00061,
+	0x00323, 0x00041, 0x00309, 0x00061, 0x00309, 0x00041, 0x00302, 0x00301, 0x00061, 0x00302,
+	0x00301, 0x00041, 0x00302, 0x00300, 0x00061, 0x00302, 0x00300, 0x00041, 0x00302, 0x00309,
+	0x00061, 0x00302, 0x00309, 0x00041, 0x00302, 0x00303, 0x00061, 0x00302, 0x00303, 0x00041,
+	0x00323, 0x00302, 0x00061, 0x00323, 0x00302, 0x00041, 0x00306, 0x00301, 0x00061, 0x00306,
+	0x00301, 0x00041, 0x00306, 0x00300, 0x00061, 0x00306, 0x00300, 0x00041, 0x00306, 0x00309,
+	0x00061, 0x00306, 0x00309, 0x00041, 0x00306, 0x00303, 0x00061, 0x00306, 0x00303, 0x00041,
+	0x00323, 0x00306, 0x00061, 0x00323, 0x00306, 0x00045, 0x00323, 0x00065, 0x00323, 0x00045,
+	0x00309, 0x00065, 0x00309, 0x00045, 0x00303, 0x00065, 0x00303, 0x00045, 0x00302, 0x00301,
+	0x00065, 0x00302, 0x00301, 0x00045, 0x00302, 0x00300, 0x00065, 0x00302, 0x00300, 0x00045,
+	0x00302, 0x00309, 0x00065, 0x00302, 0x00309, 0x00045, 0x00302, 0x00303, 0x00065, 0x00302,
+	0x00303, 0x00045, 0x00323, 0x00302, 0x00065, 0x00323, 0x00302, 0x00049, 0x00309, 0x00069,
+	0x00309, 0x00049, 0x00323, 0x00069, 0x00323, 0x0004F, 0x00323, 0x0006F, 0x00323, 0x0004F,
+	0x00309, 0x0006F, 0x00309, 0x0004F, 0x00302, 0x00301, 0x0006F, 0x00302, 0x00301, 0x0004F,
+	0x00302, 0x00300, 0x0006F, 0x00302, 0x00300, 0x0004F, 0x00302, 0x00309, 0x0006F, 0x00302,
+	0x00309, 0x0004F, 0x00302, 0x00303, 0x0006F, 0x00302, 0x00303, 0x0004F, 0x00323, 0x00302,
+	0x0006F, 0x00323, 0x00302, 0x0004F, 0x0031B, 0x00301, 0x0006F, 0x0031B, 0x00301, 0x0004F,
+	0x0031B, 0x00300, 0x0006F, 0x0031B, 0x00300, 0x0004F, 0x0031B, 0x00309, 0x0006F, 0x0031B,
+	0x00309, 0x0004F, 0x0031B, 0x00303, 0x0006F, 0x0031B, 0x00303, 0x0004F, 0x0031B, 0x00323,
+	0x0006F, 0x0031B, 0x00323, 0x00055, 0x00323, 0x00075, 0x00323, 0x00055, 0x00309, 0x00075,
+	0x00309, 0x00055, 0x0031B, 0x00301, 0x00075, 0x0031B, 0x00301, 0x00055, 0x0031B, 0x00300,
+	0x00075, 0x0031B, 0x00300, 0x00055, 0x0031B, 0x00309, 0x00075, 0x0031B, 0x00309, 0x00055,
+	0x0031B, 0x00303, 0x00075, 0x0031B, 0x00303, 0x00055, 0x0031B, 0x00323, 0x00075, 0x0031B,
+	0x00323, 0x00059, 0x00300, 0x00079, 0x00300, 0x00059, 0x00323, 0x00079, 0x00323, 0x00059,
+	0x00309, 0x00079, 0x00309, 0x00059, 0x00303, 0x00079, 0x00303, 0x003B1, 0x00313, 0x003B1,
+	0x00314, 0x003B1, 0x00313, 0x00300, 0x003B1, 0x00314, 0x00300, 0x003B1, 0x00313, 0x00301,
+	0x003B1, 0x00314, 0x00301, 0x003B1, 0x00313, 0x00342, 0x003B1, 0x00314, 0x00342, 0x00391,
+	0x00313, 0x00391, 0x00314, 0x00391, 0x00313, 0x00300, 0x00391, 0x00314, 0x00300, 0x00391,
+	0x00313, 0x00301, 0x00391, 0x00314, 0x00301, 0x00391, 0x00313, 0x00342, 0x00391, 0x00314,
+	0x00342, 0x003B5, 0x00313, 0x003B5, 0x00314, 0x003B5, 0x00313, 0x00300, 0x003B5, 0x00314,
+	0x00300, 0x003B5, 0x00313, 0x00301, 0x003B5, 0x00314, 0x00301, 0x00395, 0x00313, 0x00395,
+	0x00314, 0x00395, 0x00313, 0x00300, 0x00395, 0x00314, 0x00300, 0x00395, 0x00313, 0x00301,
+	0x00395, 0x00314, 0x00301, 0x003B7, 0x00313, 0x003B7, 0x00314, 0x003B7, 0x00313, 0x00300,
+	0x003B7, 0x00314, 0x00300, 0x003B7, 0x00313, 0x00301, 0x003B7, 0x00314, 0x00301, 0x003B7,
+	0x00313, 0x00342, 0x003B7, 0x00314, 0x00342, 0x00397, 0x00313, 0x00397, 0x00314, 0x00397,
+	0x00313, 0x00300, 0x00397, 0x00314, 0x00300, 0x00397, 0x00313, 0x00301, 0x00397, 0x00314,
+	0x00301, 0x00397, 0x00313, 0x00342, 0x00397, 0x00314, 0x00342, 0x003B9, 0x00313, 0x003B9,
+	0x00314, 0x003B9, 0x00313, 0x00300, 0x003B9, 0x00314, 0x00300, 0x003B9, 0x00313, 0x00301,
+	0x003B9, 0x00314, 0x00301, 0x003B9, 0x00313, 0x00342, 0x003B9, 0x00314, 0x00342, 0x00399,
+	0x00313, 0x00399, 0x00314, 0x00399, 0x00313, 0x00300, 0x00399, 0x00314, 0x00300, 0x00399,
+	0x00313, 0x00301, 0x00399, 0x00314, 0x00301, 0x00399, 0x00313, 0x00342, 0x00399, 0x00314,
+	0x00342, 0x003BF, 0x00313, 0x003BF, 0x00314, 0x003BF, 0x00313, 0x00300, 0x003BF, 0x00314,
+	0x00300, 0x003BF, 0x00313, 0x00301, 0x003BF, 0x00314, 0x00301, 0x0039F, 0x00313, 0x0039F,
+	0x00314, 0x0039F, 0x00313, 0x00300, 0x0039F, 0x00314, 0x00300, 0x0039F, 0x00313, 0x00301,
+	0x0039F, 0x00314, 0x00301, 0x003C5, 0x00313, 0x003C5, 0x00314, 0x003C5, 0x00313, 0x00300,
+	0x003C5, 0x00314, 0x00300, 0x003C5, 0x00313, 0x00301, 0x003C5, 0x00314, 0x00301, 0x003C5,
+	0x00313, 0x00342, 0x003C5, 0x00314, 0x00342, 0x003A5, 0x00314, 0x003A5, 0x00314, 0x00300,
+	0x003A5, 0x00314, 0x00301, 0x003A5, 0x00314, 0x00342, 0x003C9, 0x00313, 0x003C9, 0x00314,
+	0x003C9, 0x00313, 0x00300, 0x003C9, 0x00314, 0x00300, 0x003C9, 0x00313, 0x00301, 0x003C9,
+	0x00314, 0x00301, 0x003C9, 0x00313, 0x00342, 0x003C9, 0x00314, 0x00342, 0x003A9, 0x00313,
+	0x003A9, 0x00314, 0x003A9, 0x00313, 0x00300, 0x003A9, 0x00314, 0x00300, 0x003A9, 0x00313,
+	0x00301, 0x003A9, 0x00314, 0x00301, 0x003A9, 0x00313, 0x00342, 0x003A9, 0x00314, 0x00342,
+	0x003B1, 0x00300, 0x003B5, 0x00300, 0x003B7, 0x00300, 0x003B9, 0x00300, 0x003BF, 0x00300,
+	0x003C5, 0x00300, 0x003C9, 0x00300, 0x003B1, 0x00313, 0x00345, 0x003B1, 0x00314, 0x00345,
+	0x003B1, 0x00313, 0x00300, 0x00345, 0x003B1, 0x00314, 0x00300, 0x00345, 0x003B1, 0x00313,
+	0x00301, 0x00345, 0x003B1, 0x00314, 0x00301, 0x00345, 0x003B1, 0x00313, 0x00342, 0x00345,
+	0x003B1, 0x00314, 0x00342, 0x00345, 0x00391, 0x00313, 0x00345, 0x00391, 0x00314, 0x00345,
+	0x00391, 0x00313, 0x00300, 0x00345, 0x00391, 0x00314, 0x00300, 0x00345, 0x00391, 0x00313,
+	0x00301, 0x00345, 0x00391, 0x00314, 0x00301, 0x00345, 0x00391, 0x00313, 0x00342, 0x00345,
+	0x00391, 0x00314, 0x00342, 0x00345, 0x003B7, 0x00313, 0x00345, 0x003B7, 0x00314, 0x00345,
+	0x003B7, 0x00313, 0x00300, 0x00345, 0x003B7, 0x00314, 0x00300, 0x00345, 0x003B7, 0x00313,
+	0x00301, 0x00345, 0x003B7, 0x00314, 0x00301, 0x00345, 0x003B7, 0x00313, 0x00342, 0x00345,
+	0x003B7, 0x00314, 0x00342, 0x00345, 0x00397, 0x00313, 0x00345, 0x00397, 0x00314, 0x00345,
+	0x00397, 0x00313, 0x00300, 0x00345, 0x00397, 0x00314, 0x00300, 0x00345, 0x00397, 0x00313,
+	0x00301, 0x00345, 0x00397, 0x00314, 0x00301, 0x00345, 0x00397, 0x00313, 0x00342, 0x00345,
+	0x00397, 0x00314, 0x00342, 0x00345, 0x003C9, 0x00313, 0x00345, 0x003C9, 0x00314, 0x00345,
+	0x003C9, 0x00313, 0x00300, 0x00345, 0x003C9, 0x00314, 0x00300, 0x00345, 0x003C9, 0x00313,
+	0x00301, 0x00345, 0x003C9, 0x00314, 0x00301, 0x00345, 0x003C9, 0x00313, 0x00342, 0x00345,
+	0x003C9, 0x00314, 0x00342, 0x00345, 0x003A9, 0x00313, 0x00345, 0x003A9, 0x00314, 0x00345,
+	0x003A9, 0x00313, 0x00300, 0x00345, 0x003A9, 0x00314, 0x00300, 0x00345, 0x003A9, 0x00313,
+	0x00301, 0x00345, 0x003A9, 0x00314, 0x00301, 0x00345, 0x003A9, 0x00313, 0x00342, 0x00345,
+	0x003A9, 0x00314, 0x00342, 0x00345, 0x003B1, 0x00306, 0x003B1, 0x00304, 0x003B1, 0x00300,
+	0x00345, 0x003B1, 0x00345, 0x003B1, 0x00301, 0x00345, 0x003B1, 0x00342, 0x003B1, 0x00342,
+	0x00345, 0x00391, 0x00306, 0x00391, 0x00304, 0x00391, 0x00300, 0x00391, 0x00345, 0x00020,
+	0x00313, 0x003B9, 0x00020, 0x00342, 0x000A8, 0x00342, 0x00020, 0x00308, 0x00342, 0x003B7,
+	0x00300, 0x00345, 0x003B7, 0x00345, 0x003B7, 0x00301, 0x00345, 0x003B7, 0x00342, 0x003B7,
+	0x00342, 0x00345, 0x00395, 0x00300, 0x00397, 0x00300, 0x00397, 0x00345, 0x01FBF, 0x00300,
+	0x00020, 0x00313, 0x00300, 0x01FBF, 0x00301, 0x00020, 0x00313, 0x00301, 0x01FBF, 0x00342,
+	0x00020, 0x00313, 0x00342, 0x003B9, 0x00306, 0x003B9, 0x00304, 0x003B9, 0x00308, 0x00300,
+	0x003B9, 0x00342, 0x003B9, 0x00308, 0x00342, 0x00399, 0x00306, 0x00399, 0x00304, 0x00399,
+	0x00300, 0x01FFE, 0x00300, 0x00020, 0x00314, 0x00300, 0x01FFE, 0x00301, 0x00020, 0x00314,
+	0x00301, 0x01FFE, 0x00342, 0x00020, 0x00314, 0x00342, 0x003C5, 0x00306, 0x003C5, 0x00304,
+	0x003C5, 0x00308, 0x00300, 0x003C1, 0x00313, 0x003C1, 0x00314, 0x003C5, 0x00342, 0x003C5,
+	0x00308, 0x00342, 0x003A5, 0x00306, 0x003A5, 0x00304, 0x003A5, 0x00300, 0x003A1, 0x00314,
+	0x000A8, 0x00300, 0x00020, 0x00308, 0x00300, 0x00060, 0x003C9, 0x00300, 0x00345, 0x003C9,
+	0x00345, 0x003C9, 0x00301, 0x00345, 0x003C9, 0x00342, 0x003C9, 0x00342, 0x00345, 0x0039F,
+	0x00300, 0x003A9, 0x00300, 0x003A9, 0x00345, 0x000B4, 0x00020, 0x00314, 0x02002, 0x02003,
+	0x02010, 0x00020, 0x00333, 0x0002E, 0x0002E, 0x0002E, 0x0002E, 0x0002E, 0x0002E, 0x02032,
+	0x02032, 0x02032, 0x02032, 0x02032, 0x02035, 0x02035, 0x02035, 0x02035, 0x02035, 0x00021,
+	0x00021, 0x00020, 0x00305, 0x0003F, 0x0003F, 0x0003F, 0x00021, 0x00021, 0x0003F, 0x02032,
+	0x02032, 0x02032, 0x02032, 0x00030, 0x00034, 0x00035, 0x00036, 0x00037, 0x00038, 0x00039,
+	0x0002B, 0x02212, 0x0003D, 0x00028, 0x00029, 0x0006E, 0x00052, 0x00073, 0x00061, 0x0002F,
+	0x00063, 0x00061, 0x0002F, 0x00073, 0x00043, 0x000B0, 0x00043, 0x00063, 0x0002F, 0x0006F,
+	0x00063, 0x0002F, 0x00075, 0x00190, 0x000B0, 0x00046, 0x00127, 0x0004E, 0x0006F, 0x00051,
+	0x00053, 0x0004D, 0x00054, 0x00045, 0x0004C, 0x00054, 0x0004D, 0x0005A, 0x003A9, 0x00046,
+	0x005D0, 0x005D1, 0x005D2, 0x005D3, 0x00046, 0x00041, 0x00058, 0x00393, 0x003A0, 0x02211,
+	0x00031, 0x02044, 0x00037, 0x00031, 0x02044, 0x00039, 0x00031, 0x02044, 0x00031, 0x00030,
+	0x00031, 0x02044, 0x00033, 0x00032, 0x02044, 0x00033, 0x00031, 0x02044, 0x00035, 0x00032,
+	0x02044, 0x00035, 0x00033, 0x02044, 0x00035, 0x00034, 0x02044, 0x00035, 0x00031, 0x02044,
+	0x00036, 0x00035, 0x02044, 0x00036, 0x00031, 0x02044, 0x00038, 0x00033, 0x02044, 0x00038,
+	0x00035, 0x02044, 0x00038, 0x00037, 0x02044, 0x00038, 0x00031, 0x02044, 0x00049, 0x00049,
+	0x00049, 0x00049, 0x00049, 0x00049, 0x00056, 0x00056, 0x00056, 0x00049, 0x00056, 0x00049,
+	0x00049, 0x00056, 0x00049, 0x00049, 0x00049, 0x00049, 0x00058, 0x00058, 0x00058, 0x00049,
+	0x00058, 0x00049, 0x00049, 0x00069, 0x00069, 0x00069, 0x00069, 0x00069, 0x00069, 0x00076,
+	0x00076, 0x00069, 0x00076, 0x00069, 0x00069, 0x00076, 0x00069, 0x00069, 0x00069, 0x00069,
+	0x00078, 0x00078, 0x00069, 0x00078, 0x00069, 0x00069, 0x00030, 0x02044, 0x00033, 0x02190,
+	0x00338, 0x02192, 0x00338, 0x02194, 0x00338, 0x021D0, 0x00338, 0x021D4, 0x00338, 0x021D2,
+	0x00338, 0x02203, 0x00338, 0x02208, 0x00338, 0x0220B, 0x00338, 0x02223, 0x00338, 0x02225,
+	0x00338, 0x0222B, 0x0222B, 0x0222B, 0x0222B, 0x0222B, 0x0222E, 0x0222E, 0x0222E, 0x0222E,
+	0x0222E, 0x0223C, 0x00338, 0x02243, 0x00338, 0x02245, 0x00338, 0x02248, 0x00338, 0x0003D,
+	0x00338, 0x02261, 0x00338, 0x0224D, 0x00338, 0x0003C, 0x00338, 0x0003E, 0x00338, 0x02264,
+	0x00338, 0x02265, 0x00338, 0x02272, 0x00338, 0x02273, 0x00338, 0x02276, 0x00338, 0x02277,
+	0x00338, 0x0227A, 0x00338, 0x0227B, 0x00338, 0x02282, 0x00338, 0x02283, 0x00338, 0x02286,
+	0x00338, 0x02287, 0x00338, 0x022A2, 0x00338, 0x022A8, 0x00338, 0x022A9, 0x00338, 0x022AB,
+	0x00338, 0x0227C, 0x00338, 0x0227D, 0x00338, 0x02291, 0x00338, 0x02292, 0x00338, 0x022B2,
+	0x00338, 0x022B3, 0x00338, 0x022B4, 0x00338, 0x022B5, 0x00338, 0x03008, 0x03009, 0x00031,
+	0x00030, 0x00031, 0x00031, 0x00031, 0x00032, 0x00031, 0x00033, 0x00031, 0x00034, 0x00031,
+	0x00035, 0x00031, 0x00036, 0x00031, 0x00037, 0x00031, 0x00038, 0x00031, 0x00039, 0x00032,
+	0x00030, 0x00028, 0x00031, 0x00029, 0x00028, 0x00032, 0x00029, 0x00028, 0x00033, 0x00029,
+	0x00028, 0x00034, 0x00029, 0x00028, 0x00035, 0x00029, 0x00028, 0x00036, 0x00029, 0x00028,
+	0x00037, 0x00029, 0x00028, 0x00038, 0x00029, 0x00028, 0x00039, 0x00029, 0x00028, 0x00031,
+	0x00030, 0x00029, 0x00028, 0x00031, 0x00031, 0x00029, 0x00028, 0x00031, 0x00032, 0x00029,
+	0x00028, 0x00031, 0x00033, 0x00029, 0x00028, 0x00031, 0x00034, 0x00029, 0x00028, 0x00031,
+	0x00035, 0x00029, 0x00028, 0x00031, 0x00036, 0x00029, 0x00028, 0x00031, 0x00037, 0x00029,
+	0x00028, 0x00031, 0x00038, 0x00029, 0x00028, 0x00031, 0x00039, 0x00029, 0x00028, 0x00032,
+	0x00030, 0x00029, 0x00031, 0x0002E, 0x00032, 0x0002E, 0x00033, 0x0002E, 0x00034, 0x0002E,
+	0x00035, 0x0002E, 0x00036, 0x0002E, 0x00037, 0x0002E, 0x00038, 0x0002E, 0x00039, 0x0002E,
+	0x00031, 0x00030, 0x0002E, 0x00031, 0x00031, 0x0002E, 0x00031, 0x00032, 0x0002E, 0x00031,
+	0x00033, 0x0002E, 0x00031, 0x00034, 0x0002E, 0x00031, 0x00035, 0x0002E, 0x00031, 0x00036,
+	0x0002E, 0x00031, 0x00037, 0x0002E, 0x00031, 0x00038, 0x0002E, 0x00031, 0x00039, 0x0002E,
+	0x00032, 0x00030, 0x0002E, 0x00028, 0x00061, 0x00029, 0x00028, 0x00062, 0x00029, 0x00028,
+	0x00063, 0x00029, 0x00028, 0x00064, 0x00029, 0x00028, 0x00065, 0x00029, 0x00028, 0x00066,
+	0x00029, 0x00028, 0x00067, 0x00029, 0x00028, 0x00068, 0x00029, 0x00028, 0x00069, 0x00029,
+	0x00028, 0x0006A, 0x00029, 0x00028, 0x0006B, 0x00029, 0x00028, 0x0006C, 0x00029, 0x00028,
+	0x0006D, 0x00029, 0x00028, 0x0006E, 0x00029, 0x00028, 0x0006F, 0x00029, 0x00028, 0x00070,
+	0x00029, 0x00028, 0x00071, 0x00029, 0x00028, 0x00072, 0x00029, 0x00028, 0x00073, 0x00029,
+	0x00028, 0x00074, 0x00029, 0x00028, 0x00075, 0x00029, 0x00028, 0x00076, 0x00029, 0x00028,
+	0x00077, 0x00029, 0x00028, 0x00078, 0x00029, 0x00028, 0x00079, 0x00029, 0x00028, 0x0007A,
+	0x00029, 0x00053, 0x00059, 0x00071, 0x0222B, 0x0222B, 0x0222B, 0x0222B, 0x0003A, 0x0003A,
+	0x0003D, 0x0003D, 0x0003D, 0x0003D, 0x0003D, 0x0003D, 0x02ADD, 0x00338, 0x02D61, 0x06BCD,
+	0x09F9F, 0x04E00, 0x04E28, 0x04E36, 0x04E3F, 0x04E59, 0x04E85, 0x04E8C, 0x04EA0, 0x04EBA,
+	0x0513F, 0x05165, 0x0516B, 0x05182, 0x05196, 0x051AB, 0x051E0, 0x051F5, 0x05200, 0x0529B,
+	0x052F9, 0x05315, 0x0531A, 0x05338, 0x05341, 0x0535C, 0x05369, 0x05382, 0x053B6, 0x053C8,
+	0x053E3, 0x056D7, 0x0571F, 0x058EB, 0x05902, 0x0590A, 0x05915, 0x05927, 0x05973, 0x05B50,
+	0x05B80, 0x05BF8, 0x05C0F, 0x05C22, 0x05C38, 0x05C6E, 0x05C71, 0x05DDB, 0x05DE5, 0x05DF1,
+	0x05DFE, 0x05E72, 0x05E7A, 0x05E7F, 0x05EF4, 0x05EFE, 0x05F0B, 0x05F13, 0x05F50, 0x05F61,
+	0x05F73, 0x05FC3, 0x06208, 0x06236, 0x0624B, 0x0652F, 0x06534, 0x06587, 0x06597, 0x065A4,
+	0x065B9, 0x065E0, 0x065E5, 0x066F0, 0x06708, 0x06728, 0x06B20, 0x06B62, 0x06B79, 0x06BB3,
+	0x06BCB, 0x06BD4, 0x06BDB, 0x06C0F, 0x06C14, 0x06C34, 0x0706B, 0x0722A, 0x07236, 0x0723B,
+	0x0723F, 0x07247, 0x07259, 0x0725B, 0x072AC, 0x07384, 0x07389, 0x074DC, 0x074E6, 0x07518,
+	0x0751F, 0x07528, 0x07530, 0x0758B, 0x07592, 0x07676, 0x0767D, 0x076AE, 0x076BF, 0x076EE,
+	0x077DB, 0x077E2, 0x077F3, 0x0793A, 0x079B8, 0x079BE, 0x07A74, 0x07ACB, 0x07AF9, 0x07C73,
+	0x07CF8, 0x07F36, 0x07F51, 0x07F8A, 0x07FBD, 0x08001, 0x0800C, 0x08012, 0x08033, 0x0807F,
+	0x08089, 0x081E3, 0x081EA, 0x081F3, 0x081FC, 0x0820C, 0x0821B, 0x0821F, 0x0826E, 0x08272,
+	0x08278, 0x0864D, 0x0866B, 0x08840, 0x0884C, 0x08863, 0x0897E, 0x0898B, 0x089D2, 0x08A00,
+	0x08C37, 0x08C46, 0x08C55, 0x08C78, 0x08C9D, 0x08D64, 0x08D70, 0x08DB3, 0x08EAB, 0x08ECA,
+	0x08F9B, 0x08FB0, 0x08FB5, 0x09091, 0x09149, 0x091C6, 0x091CC, 0x091D1, 0x09577, 0x09580,
+	0x0961C, 0x096B6, 0x096B9, 0x096E8, 0x09751, 0x0975E, 0x09762, 0x09769, 0x097CB, 0x097ED,
+	0x097F3, 0x09801, 0x098A8, 0x098DB, 0x098DF, 0x09996, 0x09999, 0x099AC, 0x09AA8, 0x09AD8,
+	0x09ADF, 0x09B25, 0x09B2F, 0x09B32, 0x09B3C, 0x09B5A, 0x09CE5, 0x09E75, 0x09E7F, 0x09EA5,
+	0x09EBB, 0x09EC3, 0x09ECD, 0x09ED1, 0x09EF9, 0x09EFD, 0x09F0E, 0x09F13, 0x09F20, 0x09F3B,
+	0x09F4A, 0x09F52, 0x09F8D, 0x09F9C, 0x09FA0, 0x03012, 0x05344, 0x05345, 0x0304B, 0x03099,
+	0x0304D, 0x03099, 0x0304F, 0x03099, 0x03051, 0x03099, 0x03053, 0x03099, 0x03055, 0x03099,
+	0x03057, 0x03099, 0x03059, 0x03099, 0x0305B, 0x03099, 0x0305D, 0x03099, 0x0305F, 0x03099,
+	0x03061, 0x03099, 0x03064, 0x03099, 0x03066, 0x03099, 0x03068, 0x03099, 0x0306F, 0x03099,
+	0x0306F, 0x0309A, 0x03072, 0x03099, 0x03072, 0x0309A, 0x03075, 0x03099, 0x03075, 0x0309A,
+	0x03078, 0x03099, 0x03078, 0x0309A, 0x0307B, 0x03099, 0x0307B, 0x0309A, 0x03046, 0x03099,
+	0x00020, 0x03099, 0x00020, 0x0309A, 0x0309D, 0x03099, 0x03088, 0x0308A, 0x030AB, 0x03099,
+	0x030AD, 0x03099, 0x030AF, 0x03099, 0x030B1, 0x03099, 0x030B3, 0x03099, 0x030B5, 0x03099,
+	0x030B7, 0x03099, 0x030B9, 0x03099, 0x030BB, 0x03099, 0x030BD, 0x03099, 0x030BF, 0x03099,
+	0x030C1, 0x03099, 0x030C4, 0x03099, 0x030C6, 0x03099, 0x030C8, 0x03099, 0x030CF, 0x03099,
+	0x030CF, 0x0309A, 0x030D2, 0x03099, 0x030D2, 0x0309A, 0x030D5, 0x03099, 0x030D5, 0x0309A,
+	0x030D8, 0x03099, 0x030D8, 0x0309A, 0x030DB, 0x03099, 0x030DB, 0x0309A, 0x030A6, 0x03099,
+	0x030EF, 0x03099, 0x030F0, 0x03099, 0x030F1, 0x03099, 0x030F2, 0x03099, 0x030FD, 0x03099,
+	0x030B3, 0x030C8, 0x01100, 0x01101, 0x011AA, 0x01102, 0x011AC, 0x011AD, 0x01103, 0x01104,
+	0x01105, 0x011B0, 0x011B1, 0x011B2, 0x011B3, 0x011B4, 0x011B5, 0x0111A, 0x01106, 0x01107,
+	0x01108, 0x01121, 0x01109, 0x0110A, 0x0110B, 0x0110C, 0x0110D, 0x0110E, 0x0110F, 0x01110,
+	0x01111, 0x01112, 0x01161, 0x01162, 0x01163, 0x01164, 0x01165, 0x01166, 0x01167, 0x01168,
+	0x01169, 0x0116A, 0x0116B, 0x0116C, 0x0116D, 0x0116E, 0x0116F, 0x01170, 0x01171, 0x01172,
+	0x01173, 0x01174, 0x01175, 0x01160, 0x01114, 0x01115, 0x011C7, 0x011C8, 0x011CC, 0x011CE,
+	0x011D3, 0x011D7, 0x011D9, 0x0111C, 0x011DD, 0x011DF, 0x0111D, 0x0111E, 0x01120, 0x01122,
+	0x01123, 0x01127, 0x01129, 0x0112B, 0x0112C, 0x0112D, 0x0112E, 0x0112F, 0x01132, 0x01136,
+	0x01140, 0x01147, 0x0114C, 0x011F1, 0x011F2, 0x01157, 0x01158, 0x01159, 0x01184, 0x01185,
+	0x01188, 0x01191, 0x01192, 0x01194, 0x0119E, 0x011A1, 0x04E09, 0x056DB, 0x04E0A, 0x04E2D,
+	0x04E0B, 0x07532, 0x04E19, 0x04E01, 0x05929, 0x05730, 0x00028, 0x01100, 0x00029, 0x00028,
+	0x01102, 0x00029, 0x00028, 0x01103, 0x00029, 0x00028, 0x01105, 0x00029, 0x00028, 0x01106,
+	0x00029, 0x00028, 0x01107, 0x00029, 0x00028, 0x01109, 0x00029, 0x00028, 0x0110B, 0x00029,
+	0x00028, 0x0110C, 0x00029, 0x00028, 0x0110E, 0x00029, 0x00028, 0x0110F, 0x00029, 0x00028,
+	0x01110, 0x00029, 0x00028, 0x01111, 0x00029, 0x00028, 0x01112, 0x00029, 0x00028, 0x01100,
+	0x01161, 0x00029, 0x00028, 0x01102, 0x01161, 0x00029, 0x00028, 0x01103, 0x01161, 0x00029,
+	0x00028, 0x01105, 0x01161, 0x00029, 0x00028, 0x01106, 0x01161, 0x00029, 0x00028, 0x01107,
+	0x01161, 0x00029, 0x00028, 0x01109, 0x01161, 0x00029, 0x00028, 0x0110B, 0x01161, 0x00029,
+	0x00028, 0x0110C, 0x01161, 0x00029, 0x00028, 0x0110E, 0x01161, 0x00029, 0x00028, 0x0110F,
+	0x01161, 0x00029, 0x00028, 0x01110, 0x01161, 0x00029, 0x00028, 0x01111, 0x01161, 0x00029,
+	0x00028, 0x01112, 0x01161, 0x00029, 0x00028, 0x0110C, 0x0116E, 0x00029, 0x00028, 0x0110B,
+	0x01169, 0x0110C, 0x01165, 0x011AB, 0x00029, 0x00028, 0x0110B, 0x01169, 0x01112, 0x0116E,
+	0x00029, 0x00028, 0x04E00, 0x00029, 0x00028, 0x04E8C, 0x00029, 0x00028, 0x04E09, 0x00029,
+	0x00028, 0x056DB, 0x00029, 0x00028, 0x04E94, 0x00029, 0x00028, 0x0516D, 0x00029, 0x00028,
+	0x04E03, 0x00029, 0x00028, 0x0516B, 0x00029, 0x00028, 0x04E5D, 0x00029, 0x00028, 0x05341,
+	0x00029, 0x00028, 0x06708, 0x00029, 0x00028, 0x0706B, 0x00029, 0x00028, 0x06C34, 0x00029,
+	0x00028, 0x06728, 0x00029, 0x00028, 0x091D1, 0x00029, 0x00028, 0x0571F, 0x00029, 0x00028,
+	0x065E5, 0x00029, 0x00028, 0x0682A, 0x00029, 0x00028, 0x06709, 0x00029, 0x00028, 0x0793E,
+	0x00029, 0x00028, 0x0540D, 0x00029, 0x00028, 0x07279, 0x00029, 0x00028, 0x08CA1, 0x00029,
+	0x00028, 0x0795D, 0x00029, 0x00028, 0x052B4, 0x00029, 0x00028, 0x04EE3, 0x00029, 0x00028,
+	0x0547C, 0x00029, 0x00028, 0x05B66, 0x00029, 0x00028, 0x076E3, 0x00029, 0x00028, 0x04F01,
+	0x00029, 0x00028, 0x08CC7, 0x00029, 0x00028, 0x05354, 0x00029, 0x00028, 0x0796D, 0x00029,
+	0x00028, 0x04F11, 0x00029, 0x00028, 0x081EA, 0x00029, 0x00028, 0x081F3, 0x00029, 0x0554F,
+	0x05E7C, 0x07B8F, 0x00050, 0x00054, 0x00045, 0x00032, 0x00031, 0x00032, 0x00032, 0x00032,
+	0x00033, 0x00032, 0x00034, 0x00032, 0x00035, 0x00032, 0x00036, 0x00032, 0x00037, 0x00032,
+	0x00038, 0x00032, 0x00039, 0x00033, 0x00030, 0x00033, 0x00031, 0x00033, 0x00032, 0x00033,
+	0x00033, 0x00033, 0x00034, 0x00033, 0x00035, 0x01100, 0x01161, 0x01102, 0x01161, 0x01103,
+	0x01161, 0x01105, 0x01161, 0x01106, 0x01161, 0x01107, 0x01161, 0x01109, 0x01161, 0x0110B,
+	0x01161, 0x0110C, 0x01161, 0x0110E, 0x01161, 0x0110F, 0x01161, 0x01110, 0x01161, 0x01111,
+	0x01161, 0x01112, 0x01161, 0x0110E, 0x01161, 0x011B7, 0x01100, 0x01169, 0x0110C, 0x0116E,
+	0x0110B, 0x01174, 0x0110B, 0x0116E, 0x04E94, 0x0516D, 0x04E03, 0x04E5D, 0x0682A, 0x06709,
+	0x0793E, 0x0540D, 0x07279, 0x08CA1, 0x0795D, 0x052B4, 0x079D8, 0x07537, 0x09069, 0x0512A,
+	0x05370, 0x06CE8, 0x09805, 0x04F11, 0x05199, 0x06B63, 0x05DE6, 0x053F3, 0x0533B, 0x05B97,
+	0x05B66, 0x076E3, 0x04F01, 0x08CC7, 0x05354, 0x0591C, 0x00033, 0x00036, 0x00033, 0x00037,
+	0x00033, 0x00038, 0x00033, 0x00039, 0x00034, 0x00030, 0x00034, 0x00031, 0x00034, 0x00032,
+	0x00034, 0x00033, 0x00034, 0x00034, 0x00034, 0x00035, 0x00034, 0x00036, 0x00034, 0x00037,
+	0x00034, 0x00038, 0x00034, 0x00039, 0x00035, 0x00030, 0x00031, 0x06708, 0x00032, 0x06708,
+	0x00033, 0x06708, 0x00034, 0x06708, 0x00035, 0x06708, 0x00036, 0x06708, 0x00037, 0x06708,
+	0x00038, 0x06708, 0x00039, 0x06708, 0x00031, 0x00030, 0x06708, 0x00031, 0x00031, 0x06708,
+	0x00031, 0x00032, 0x06708, 0x00048, 0x00067, 0x00065, 0x00072, 0x00067, 0x00065, 0x00056,
+	0x0004C, 0x00054, 0x00044, 0x030A2, 0x030A4, 0x030A6, 0x030A8, 0x030AA, 0x030AB, 0x030AD,
+	0x030AF, 0x030B1, 0x030B3, 0x030B5, 0x030B7, 0x030B9, 0x030BB, 0x030BD, 0x030BF, 0x030C1,
+	0x030C4, 0x030C6, 0x030C8, 0x030CA, 0x030CB, 0x030CC, 0x030CD, 0x030CE, 0x030CF, 0x030D2,
+	0x030D5, 0x030D8, 0x030DB, 0x030DE, 0x030DF, 0x030E0, 0x030E1, 0x030E2, 0x030E4, 0x030E6,
+	0x030E8, 0x030E9, 0x030EA, 0x030EB, 0x030EC, 0x030ED, 0x030EF, 0x030F0, 0x030F1, 0x030F2,
+	0x030A2, 0x030CF, 0x0309A, 0x030FC, 0x030C8, 0x030A2, 0x030EB, 0x030D5, 0x030A1, 0x030A2,
+	0x030F3, 0x030D8, 0x0309A, 0x030A2, 0x030A2, 0x030FC, 0x030EB, 0x030A4, 0x030CB, 0x030F3,
+	0x030AF, 0x03099, 0x030A4, 0x030F3, 0x030C1, 0x030A6, 0x030A9, 0x030F3, 0x030A8, 0x030B9,
+	0x030AF, 0x030FC, 0x030C8, 0x03099, 0x030A8, 0x030FC, 0x030AB, 0x030FC, 0x030AA, 0x030F3,
+	0x030B9, 0x030AA, 0x030FC, 0x030E0, 0x030AB, 0x030A4, 0x030EA, 0x030AB, 0x030E9, 0x030C3,
+	0x030C8, 0x030AB, 0x030ED, 0x030EA, 0x030FC, 0x030AB, 0x03099, 0x030ED, 0x030F3, 0x030AB,
+	0x03099, 0x030F3, 0x030DE, 0x030AD, 0x03099, 0x030AB, 0x03099, 0x030AD, 0x03099, 0x030CB,
+	0x030FC, 0x030AD, 0x030E5, 0x030EA, 0x030FC, 0x030AD, 0x03099, 0x030EB, 0x030BF, 0x03099,
+	0x030FC, 0x030AD, 0x030ED, 0x030AD, 0x030ED, 0x030AF, 0x03099, 0x030E9, 0x030E0, 0x030AD,
+	0x030ED, 0x030E1, 0x030FC, 0x030C8, 0x030EB, 0x030AD, 0x030ED, 0x030EF, 0x030C3, 0x030C8,
+	0x030AF, 0x03099, 0x030E9, 0x030E0, 0x030AF, 0x03099, 0x030E9, 0x030E0, 0x030C8, 0x030F3,
+	0x030AF, 0x030EB, 0x030BB, 0x03099, 0x030A4, 0x030ED, 0x030AF, 0x030ED, 0x030FC, 0x030CD,
+	0x030B1, 0x030FC, 0x030B9, 0x030B3, 0x030EB, 0x030CA, 0x030B3, 0x030FC, 0x030DB, 0x0309A,
+	0x030B5, 0x030A4, 0x030AF, 0x030EB, 0x030B5, 0x030F3, 0x030C1, 0x030FC, 0x030E0, 0x030B7,
+	0x030EA, 0x030F3, 0x030AF, 0x03099, 0x030BB, 0x030F3, 0x030C1, 0x030BB, 0x030F3, 0x030C8,
+	0x030BF, 0x03099, 0x030FC, 0x030B9, 0x030C6, 0x03099, 0x030B7, 0x030C8, 0x03099, 0x030EB,
+	0x030C8, 0x030F3, 0x030CA, 0x030CE, 0x030CE, 0x030C3, 0x030C8, 0x030CF, 0x030A4, 0x030C4,
+	0x030CF, 0x0309A, 0x030FC, 0x030BB, 0x030F3, 0x030C8, 0x030CF, 0x0309A, 0x030FC, 0x030C4,
+	0x030CF, 0x03099, 0x030FC, 0x030EC, 0x030EB, 0x030D2, 0x0309A, 0x030A2, 0x030B9, 0x030C8,
+	0x030EB, 0x030D2, 0x0309A, 0x030AF, 0x030EB, 0x030D2, 0x0309A, 0x030B3, 0x030D2, 0x03099,
+	0x030EB, 0x030D5, 0x030A1, 0x030E9, 0x030C3, 0x030C8, 0x03099, 0x030D5, 0x030A3, 0x030FC,
+	0x030C8, 0x030D5, 0x03099, 0x030C3, 0x030B7, 0x030A7, 0x030EB, 0x030D5, 0x030E9, 0x030F3,
+	0x030D8, 0x030AF, 0x030BF, 0x030FC, 0x030EB, 0x030D8, 0x0309A, 0x030BD, 0x030D8, 0x0309A,
+	0x030CB, 0x030D2, 0x030D8, 0x030EB, 0x030C4, 0x030D8, 0x0309A, 0x030F3, 0x030B9, 0x030D8,
+	0x0309A, 0x030FC, 0x030B7, 0x03099, 0x030D8, 0x03099, 0x030FC, 0x030BF, 0x030DB, 0x0309A,
+	0x030A4, 0x030F3, 0x030C8, 0x030DB, 0x03099, 0x030EB, 0x030C8, 0x030DB, 0x030F3, 0x030DB,
+	0x0309A, 0x030F3, 0x030C8, 0x03099, 0x030DB, 0x030FC, 0x030EB, 0x030DB, 0x030FC, 0x030F3,
+	0x030DE, 0x030A4, 0x030AF, 0x030ED, 0x030DE, 0x030A4, 0x030EB, 0x030DE, 0x030C3, 0x030CF,
+	0x030DE, 0x030EB, 0x030AF, 0x030DE, 0x030F3, 0x030B7, 0x030E7, 0x030F3, 0x030DF, 0x030AF,
+	0x030ED, 0x030F3, 0x030DF, 0x030EA, 0x030DF, 0x030EA, 0x030CF, 0x03099, 0x030FC, 0x030EB,
+	0x030E1, 0x030AB, 0x03099, 0x030E1, 0x030AB, 0x03099, 0x030C8, 0x030F3, 0x030E1, 0x030FC,
+	0x030C8, 0x030EB, 0x030E4, 0x030FC, 0x030C8, 0x03099, 0x030E4, 0x030FC, 0x030EB, 0x030E6,
+	0x030A2, 0x030F3, 0x030EA, 0x030C3, 0x030C8, 0x030EB, 0x030EA, 0x030E9, 0x030EB, 0x030D2,
+	0x0309A, 0x030FC, 0x030EB, 0x030FC, 0x030D5, 0x03099, 0x030EB, 0x030EC, 0x030E0, 0x030EC,
+	0x030F3, 0x030C8, 0x030B1, 0x03099, 0x030F3, 0x030EF, 0x030C3, 0x030C8, 0x00030, 0x070B9,
+	0x00031, 0x070B9, 0x00032, 0x070B9, 0x00033, 0x070B9, 0x00034, 0x070B9, 0x00035, 0x070B9,
+	0x00036, 0x070B9, 0x00037, 0x070B9, 0x00038, 0x070B9, 0x00039, 0x070B9, 0x00031, 0x00030,
+	0x070B9, 0x00031, 0x00031, 0x070B9, 0x00031, 0x00032, 0x070B9, 0x00031, 0x00033, 0x070B9,
+	0x00031, 0x00034, 0x070B9, 0x00031, 0x00035, 0x070B9, 0x00031, 0x00036, 0x070B9, 0x00031,
+	0x00037, 0x070B9, 0x00031, 0x00038, 0x070B9, 0x00031, 0x00039, 0x070B9, 0x00032, 0x00030,
+	0x070B9, 0x00032, 0x00031, 0x070B9, 0x00032, 0x00032, 0x070B9, 0x00032, 0x00033, 0x070B9,
+	0x00032, 0x00034, 0x070B9, 0x00068, 0x00050, 0x00061, 0x00064, 0x00061, 0x00041, 0x00055,
+	0x00062, 0x00061, 0x00072, 0x0006F, 0x00056, 0x00070, 0x00063, 0x00064, 0x0006D, 0x00064,
+	0x0006D, 0x00032, 0x00064, 0x0006D, 0x00033, 0x00049, 0x00055, 0x05E73, 0x06210, 0x0662D,
+	0x0548C, 0x05927, 0x06B63, 0x0660E, 0x06CBB, 0x0682A, 0x05F0F, 0x04F1A, 0x0793E, 0x00070,
+	0x00041, 0x0006E, 0x00041, 0x003BC, 0x00041, 0x0006D, 0x00041, 0x0006B, 0x00041, 0x0004B,
+	0x00042, 0x0004D, 0x00042, 0x00047, 0x00042, 0x00063, 0x00061, 0x0006C, 0x0006B, 0x00063,
+	0x00061, 0x0006C, 0x00070, 0x00046, 0x0006E, 0x00046, 0x003BC, 0x00046, 0x003BC, 0x00067,
+	0x0006D, 0x00067, 0x0006B, 0x00067, 0x00048, 0x0007A, 0x0006B, 0x00048, 0x0007A, 0x0004D,
+	0x00048, 0x0007A, 0x00047, 0x00048, 0x0007A, 0x00054, 0x00048, 0x0007A, 0x003BC, 0x0006C,
+	0x0006D, 0x0006C, 0x00064, 0x0006C, 0x0006B, 0x0006C, 0x00066, 0x0006D, 0x0006E, 0x0006D,
+	0x003BC, 0x0006D, 0x0006D, 0x0006D, 0x00063, 0x0006D, 0x0006B, 0x0006D, 0x0006D, 0x0006D,
+	0x00032, 0x00063, 0x0006D, 0x00032, 0x0006D, 0x00032, 0x0006B, 0x0006D, 0x00032, 0x0006D,
+	0x0006D, 0x00033, 0x00063, 0x0006D, 0x00033, 0x0006D, 0x00033, 0x0006B, 0x0006D, 0x00033,
+	0x0006D, 0x02215, 0x00073, 0x0006D, 0x02215, 0x00073, 0x00032, 0x00050, 0x00061, 0x0006B,
+	0x00050, 0x00061, 0x0004D, 0x00050, 0x00061, 0x00047, 0x00050, 0x00061, 0x00072, 0x00061,
+	0x00064, 0x00072, 0x00061, 0x00064, 0x02215, 0x00073, 0x00072, 0x00061, 0x00064, 0x02215,
+	0x00073, 0x00032, 0x00070, 0x00073, 0x0006E, 0x00073, 0x003BC, 0x00073, 0x0006D, 0x00073,
+	0x00070, 0x00056, 0x0006E, 0x00056, 0x003BC, 0x00056, 0x0006D, 0x00056, 0x0006B, 0x00056,
+	0x0004D, 0x00056, 0x00070, 0x00057, 0x0006E, 0x00057, 0x003BC, 0x00057, 0x0006D, 0x00057,
+	0x0006B, 0x00057, 0x0004D, 0x00057, 0x0006B, 0x003A9, 0x0004D, 0x003A9, 0x00061, 0x0002E,
+	0x0006D, 0x0002E, 0x00042, 0x00071, 0x00063, 0x00063, 0x00063, 0x00064, 0x00043, 0x02215,
+	0x0006B, 0x00067, 0x00043, 0x0006F, 0x0002E, 0x00064, 0x00042, 0x00047, 0x00079, 0x00068,
+	0x00061, 0x00048, 0x00050, 0x00069, 0x0006E, 0x0004B, 0x0004B, 0x0004B, 0x0004D, 0x0006B,
+	0x00074, 0x0006C, 0x0006D, 0x0006C, 0x0006E, 0x0006C, 0x0006F, 0x00067, 0x0006C, 0x00078,
+	0x0006D, 0x00062, 0x0006D, 0x00069, 0x0006C, 0x0006D, 0x0006F, 0x0006C, 0x00050, 0x00048,
+	0x00070, 0x0002E, 0x0006D, 0x0002E, 0x00050, 0x00050, 0x0004D, 0x00050, 0x00052, 0x00073,
+	0x00072, 0x00053, 0x00076, 0x00057, 0x00062, 0x00056, 0x02215, 0x0006D, 0x00041, 0x02215,
+	0x0006D, 0x00031, 0x065E5, 0x00032, 0x065E5, 0x00033, 0x065E5, 0x00034, 0x065E5, 0x00035,
+	0x065E5, 0x00036, 0x065E5, 0x00037, 0x065E5, 0x00038, 0x065E5, 0x00039, 0x065E5, 0x00031,
+	0x00030, 0x065E5, 0x00031, 0x00031, 0x065E5, 0x00031, 0x00032, 0x065E5, 0x00031, 0x00033,
+	0x065E5, 0x00031, 0x00034, 0x065E5, 0x00031, 0x00035, 0x065E5, 0x00031, 0x00036, 0x065E5,
+	0x00031, 0x00037, 0x065E5, 0x00031, 0x00038, 0x065E5, 0x00031, 0x00039, 0x065E5, 0x00032,
+	0x00030, 0x065E5, 0x00032, 0x00031, 0x065E5, 0x00032, 0x00032, 0x065E5, 0x00032, 0x00033,
+	0x065E5, 0x00032, 0x00034, 0x065E5, 0x00032, 0x00035, 0x065E5, 0x00032, 0x00036, 0x065E5,
+	0x00032, 0x00037, 0x065E5, 0x00032, 0x00038, 0x065E5, 0x00032, 0x00039, 0x065E5, 0x00033,
+	0x00030, 0x065E5, 0x00033, 0x00031, 0x065E5, 0x00067, 0x00061, 0x0006C, 0x0044A, 0x0044C,
+	0x0A76F, 0x00126, 0x00153, 0x0A727, 0x0AB37, 0x0026B, 0x0AB52, 0x08C48, 0x066F4, 0x08CC8,
+	0x06ED1, 0x04E32, 0x053E5, 0x05951, 0x05587, 0x05948, 0x061F6, 0x07669, 0x07F85, 0x0863F,
+	0x087BA, 0x088F8, 0x0908F, 0x06A02, 0x06D1B, 0x070D9, 0x073DE, 0x0843D, 0x0916A, 0x099F1,
+	0x04E82, 0x05375, 0x06B04, 0x0721B, 0x0862D, 0x09E1E, 0x05D50, 0x06FEB, 0x085CD, 0x08964,
+	0x062C9, 0x081D8, 0x0881F, 0x05ECA, 0x06717, 0x06D6A, 0x072FC, 0x090CE, 0x04F86, 0x051B7,
+	0x052DE, 0x064C4, 0x06AD3, 0x07210, 0x076E7, 0x08606, 0x0865C, 0x08DEF, 0x09732, 0x09B6F,
+	0x09DFA, 0x0788C, 0x0797F, 0x07DA0, 0x083C9, 0x09304, 0x08AD6, 0x058DF, 0x05F04, 0x07C60,
+	0x0807E, 0x07262, 0x078CA, 0x08CC2, 0x096F7, 0x058D8, 0x05C62, 0x06A13, 0x06DDA, 0x06F0F,
+	0x07D2F, 0x07E37, 0x0964B, 0x052D2, 0x0808B, 0x051DC, 0x051CC, 0x07A1C, 0x07DBE, 0x083F1,
+	0x09675, 0x08B80, 0x062CF, 0x08AFE, 0x04E39, 0x05BE7, 0x06012, 0x07387, 0x07570, 0x05317,
+	0x078FB, 0x04FBF, 0x05FA9, 0x04E0D, 0x06CCC, 0x06578, 0x07D22, 0x053C3, 0x0585E, 0x07701,
+	0x08449, 0x08AAA, 0x06BBA, 0x06C88, 0x062FE, 0x082E5, 0x063A0, 0x07565, 0x04EAE, 0x05169,
+	0x051C9, 0x06881, 0x07CE7, 0x0826F, 0x08AD2, 0x091CF, 0x052F5, 0x05442, 0x05EEC, 0x065C5,
+	0x06FFE, 0x0792A, 0x095AD, 0x09A6A, 0x09E97, 0x09ECE, 0x066C6, 0x06B77, 0x08F62, 0x05E74,
+	0x06190, 0x06200, 0x0649A, 0x06F23, 0x07149, 0x07489, 0x079CA, 0x07DF4, 0x0806F, 0x08F26,
+	0x084EE, 0x09023, 0x0934A, 0x05217, 0x052A3, 0x054BD, 0x070C8, 0x088C2, 0x05EC9, 0x05FF5,
+	0x0637B, 0x06BAE, 0x07C3E, 0x07375, 0x04EE4, 0x056F9, 0x05DBA, 0x0601C, 0x073B2, 0x07469,
+	0x07F9A, 0x08046, 0x09234, 0x096F6, 0x09748, 0x09818, 0x04F8B, 0x079AE, 0x091B4, 0x096B8,
+	0x060E1, 0x04E86, 0x050DA, 0x05BEE, 0x05C3F, 0x06599, 0x071CE, 0x07642, 0x084FC, 0x0907C,
+	0x06688, 0x0962E, 0x05289, 0x0677B, 0x067F3, 0x06D41, 0x06E9C, 0x07409, 0x07559, 0x0786B,
+	0x07D10, 0x0985E, 0x0622E, 0x09678, 0x0502B, 0x05D19, 0x06DEA, 0x08F2A, 0x05F8B, 0x06144,
+	0x06817, 0x09686, 0x05229, 0x0540F, 0x05C65, 0x06613, 0x0674E, 0x068A8, 0x06CE5, 0x07406,
+	0x075E2, 0x07F79, 0x088CF, 0x088E1, 0x096E2, 0x0533F, 0x06EBA, 0x0541D, 0x071D0, 0x07498,
+	0x085FA, 0x096A3, 0x09C57, 0x09E9F, 0x06797, 0x06DCB, 0x081E8, 0x07B20, 0x07C92, 0x072C0,
+	0x07099, 0x08B58, 0x04EC0, 0x08336, 0x0523A, 0x05207, 0x05EA6, 0x062D3, 0x07CD6, 0x05B85,
+	0x06D1E, 0x066B4, 0x08F3B, 0x0964D, 0x05ED3, 0x05140, 0x055C0, 0x0585A, 0x06674, 0x051DE,
+	0x0732A, 0x076CA, 0x0793C, 0x0795E, 0x07965, 0x0798F, 0x09756, 0x07CBE, 0x08612, 0x08AF8,
+	0x09038, 0x090FD, 0x098EF, 0x098FC, 0x09928, 0x09DB4, 0x090DE, 0x096B7, 0x04FAE, 0x050E7,
+	0x0514D, 0x052C9, 0x052E4, 0x05351, 0x0559D, 0x05606, 0x05668, 0x05840, 0x058A8, 0x05C64,
+	0x06094, 0x06168, 0x0618E, 0x061F2, 0x0654F, 0x065E2, 0x06691, 0x06885, 0x06D77, 0x06E1A,
+	0x06F22, 0x0716E, 0x0722B, 0x07422, 0x07891, 0x07949, 0x07948, 0x07950, 0x07956, 0x0798D,
+	0x0798E, 0x07A40, 0x07A81, 0x07BC0, 0x07E09, 0x07E41, 0x07F72, 0x08005, 0x081ED, 0x08279,
+	0x08457, 0x08910, 0x08996, 0x08B01, 0x08B39, 0x08CD3, 0x08D08, 0x08FB6, 0x096E3, 0x097FF,
+	0x0983B, 0x06075, 0x242EE, 0x08218, 0x04E26, 0x051B5, 0x05168, 0x04F80, 0x05145, 0x05180,
+	0x052C7, 0x052FA, 0x05555, 0x05599, 0x055E2, 0x058B3, 0x05944, 0x05954, 0x05A62, 0x05B28,
+	0x05ED2, 0x05ED9, 0x05F69, 0x05FAD, 0x060D8, 0x0614E, 0x06108, 0x06160, 0x06234, 0x063C4,
+	0x0641C, 0x06452, 0x06556, 0x0671B, 0x06756, 0x06EDB, 0x06ECB, 0x0701E, 0x077A7, 0x07235,
+	0x072AF, 0x07471, 0x07506, 0x0753B, 0x0761D, 0x0761F, 0x076DB, 0x076F4, 0x0774A, 0x07740,
+	0x078CC, 0x07AB1, 0x07C7B, 0x07D5B, 0x07F3E, 0x08352, 0x083EF, 0x08779, 0x08941, 0x08986,
+	0x08ABF, 0x08ACB, 0x08AED, 0x08B8A, 0x08F38, 0x09072, 0x09199, 0x09276, 0x0967C, 0x097DB,
+	0x0980B, 0x09B12, 0x2284A, 0x22844, 0x233D5, 0x03B9D, 0x04018, 0x04039, 0x25249, 0x25CD0,
+	0x27ED3, 0x09F43, 0x09F8E, 0x00066, 0x00066, 0x00066, 0x00069, 0x00066, 0x0006C, 0x00066,
+	0x00066, 0x00069, 0x00066, 0x00066, 0x0006C, 0x00073, 0x00074, 0x00574, 0x00576, 0x00574,
+	0x00565, 0x00574, 0x0056B, 0x0057E, 0x00576, 0x00574, 0x0056D, 0x005D9, 0x005B4, 0x005F2,
+	0x005B7, 0x005E2, 0x005D4, 0x005DB, 0x005DC, 0x005DD, 0x005E8, 0x005EA, 0x005E9, 0x005C1,
+	0x005E9, 0x005C2, 0x005E9, 0x005BC, 0x005C1, 0x005E9, 0x005BC, 0x005C2, 0x005D0, 0x005B7,
+	0x005D0, 0x005B8, 0x005D0, 0x005BC, 0x005D1, 0x005BC, 0x005D2, 0x005BC, 0x005D3, 0x005BC,
+	0x005D4, 0x005BC, 0x005D5, 0x005BC, 0x005D6, 0x005BC, 0x005D8, 0x005BC, 0x005D9, 0x005BC,
+	0x005DA, 0x005BC, 0x005DB, 0x005BC, 0x005DC, 0x005BC, 0x005DE, 0x005BC, 0x005E0, 0x005BC,
+	0x005E1, 0x005BC, 0x005E3, 0x005BC, 0x005E4, 0x005BC, 0x005E6, 0x005BC, 0x005E7, 0x005BC,
+	0x005E8, 0x005BC, 0x005E9, 0x005BC, 0x005EA, 0x005BC, 0x005D5, 0x005B9, 0x005D1, 0x005BF,
+	0x005DB, 0x005BF, 0x005E4, 0x005BF, 0x005D0, 0x005DC, 0x00671, 0x0067B, 0x0067E, 0x00680,
+	0x0067A, 0x0067F, 0x00679, 0x006A4, 0x006A6, 0x00684, 0x00683, 0x00686, 0x00687, 0x0068D,
+	0x0068C, 0x0068E, 0x00688, 0x00698, 0x00691, 0x006A9, 0x006AF, 0x006B3, 0x006B1, 0x006BA,
+	0x006BB, 0x006C1, 0x006BE, 0x006D2, 0x006AD, 0x006C7, 0x006C6, 0x006C8, 0x006CB, 0x006C5,
+	0x006C9, 0x006D0, 0x00649, 0x0064A, 0x00654, 0x00627, 0x0064A, 0x00654, 0x006D5, 0x0064A,
+	0x00654, 0x00648, 0x0064A, 0x00654, 0x006C7, 0x0064A, 0x00654, 0x006C6, 0x0064A, 0x00654,
+	0x006C8, 0x0064A, 0x00654, 0x006D0, 0x0064A, 0x00654, 0x00649, 0x006CC, 0x0064A, 0x00654,
+	0x0062C, 0x0064A, 0x00654, 0x0062D, 0x0064A, 0x00654, 0x00645, 0x0064A, 0x00654, 0x0064A,
+	0x00628, 0x0062C, 0x00628, 0x0062D, 0x00628, 0x0062E, 0x00628, 0x00645, 0x00628, 0x00649,
+	0x00628, 0x0064A, 0x0062A, 0x0062C, 0x0062A, 0x0062D, 0x0062A, 0x0062E, 0x0062A, 0x00645,
+	0x0062A, 0x00649, 0x0062A, 0x0064A, 0x0062B, 0x0062C, 0x0062B, 0x00645, 0x0062B, 0x00649,
+	0x0062B, 0x0064A, 0x0062C, 0x0062D, 0x0062C, 0x00645, 0x0062D, 0x0062C, 0x0062D, 0x00645,
+	0x0062E, 0x0062C, 0x0062E, 0x0062D, 0x0062E, 0x00645, 0x00633, 0x0062C, 0x00633, 0x0062D,
+	0x00633, 0x0062E, 0x00633, 0x00645, 0x00635, 0x0062D, 0x00635, 0x00645, 0x00636, 0x0062C,
+	0x00636, 0x0062D, 0x00636, 0x0062E, 0x00636, 0x00645, 0x00637, 0x0062D, 0x00637, 0x00645,
+	0x00638, 0x00645, 0x00639, 0x0062C, 0x00639, 0x00645, 0x0063A, 0x0062C, 0x0063A, 0x00645,
+	0x00641, 0x0062C, 0x00641, 0x0062D, 0x00641, 0x0062E, 0x00641, 0x00645, 0x00641, 0x00649,
+	0x00641, 0x0064A, 0x00642, 0x0062D, 0x00642, 0x00645, 0x00642, 0x00649, 0x00642, 0x0064A,
+	0x00643, 0x00627, 0x00643, 0x0062C, 0x00643, 0x0062D, 0x00643, 0x0062E, 0x00643, 0x00644,
+	0x00643, 0x00645, 0x00643, 0x00649, 0x00643, 0x0064A, 0x00644, 0x0062C, 0x00644, 0x0062D,
+	0x00644, 0x0062E, 0x00644, 0x00645, 0x00644, 0x00649, 0x00644, 0x0064A, 0x00645, 0x0062C,
+	0x00645, 0x0062D, 0x00645, 0x0062E, 0x00645, 0x00645, 0x00645, 0x00649, 0x00645, 0x0064A,
+	0x00646, 0x0062C, 0x00646, 0x0062D, 0x00646, 0x0062E, 0x00646, 0x00645, 0x00646, 0x00649,
+	0x00646, 0x0064A, 0x00647, 0x0062C, 0x00647, 0x00645, 0x00647, 0x00649, 0x00647, 0x0064A,
+	0x0064A, 0x0062C, 0x0064A, 0x0062D, 0x0064A, 0x0062E, 0x0064A, 0x00645, 0x0064A, 0x00649,
+	0x0064A, 0x0064A, 0x00630, 0x00670, 0x00631, 0x00670, 0x00649, 0x00670, 0x00020, 0x0064C,
+	0x00651, 0x00020, 0x0064D, 0x00651, 0x00020, 0x0064E, 0x00651, 0x00020, 0x0064F, 0x00651,
+	0x00020, 0x00650, 0x00651, 0x00020, 0x00651, 0x00670, 0x0064A, 0x00654, 0x00631, 0x0064A,
+	0x00654, 0x00632, 0x0064A, 0x00654, 0x00646, 0x00628, 0x00631, 0x00628, 0x00632, 0x00628,
+	0x00646, 0x0062A, 0x00631, 0x0062A, 0x00632, 0x0062A, 0x00646, 0x0062B, 0x00631, 0x0062B,
+	0x00632, 0x0062B, 0x00646, 0x00645, 0x00627, 0x00646, 0x00631, 0x00646, 0x00632, 0x00646,
+	0x00646, 0x0064A, 0x00631, 0x0064A, 0x00632, 0x0064A, 0x00646, 0x0064A, 0x00654, 0x0062E,
+	0x0064A, 0x00654, 0x00647, 0x00628, 0x00647, 0x0062A, 0x00647, 0x00635, 0x0062E, 0x00644,
+	0x00647, 0x00646, 0x00647, 0x00647, 0x00670, 0x0064A, 0x00647, 0x0062B, 0x00647, 0x00633,
+	0x00647, 0x00634, 0x00645, 0x00634, 0x00647, 0x00640, 0x0064E, 0x00651, 0x00640, 0x0064F,
+	0x00651, 0x00640, 0x00650, 0x00651, 0x00637, 0x00649, 0x00637, 0x0064A, 0x00639, 0x00649,
+	0x00639, 0x0064A, 0x0063A, 0x00649, 0x0063A, 0x0064A, 0x00633, 0x00649, 0x00633, 0x0064A,
+	0x00634, 0x00649, 0x00634, 0x0064A, 0x0062D, 0x00649, 0x0062D, 0x0064A, 0x0062C, 0x00649,
+	0x0062C, 0x0064A, 0x0062E, 0x00649, 0x0062E, 0x0064A, 0x00635, 0x00649, 0x00635, 0x0064A,
+	0x00636, 0x00649, 0x00636, 0x0064A, 0x00634, 0x0062C, 0x00634, 0x0062D, 0x00634, 0x0062E,
+	0x00634, 0x00631, 0x00633, 0x00631, 0x00635, 0x00631, 0x00636, 0x00631, 0x00627, 0x0064B,
+	0x0062A, 0x0062C, 0x00645, 0x0062A, 0x0062D, 0x0062C, 0x0062A, 0x0062D, 0x00645, 0x0062A,
+	0x0062E, 0x00645, 0x0062A, 0x00645, 0x0062C, 0x0062A, 0x00645, 0x0062D, 0x0062A, 0x00645,
+	0x0062E, 0x0062C, 0x00645, 0x0062D, 0x0062D, 0x00645, 0x0064A, 0x0062D, 0x00645, 0x00649,
+	0x00633, 0x0062D, 0x0062C, 0x00633, 0x0062C, 0x0062D, 0x00633, 0x0062C, 0x00649, 0x00633,
+	0x00645, 0x0062D, 0x00633, 0x00645, 0x0062C, 0x00633, 0x00645, 0x00645, 0x00635, 0x0062D,
+	0x0062D, 0x00635, 0x00645, 0x00645, 0x00634, 0x0062D, 0x00645, 0x00634, 0x0062C, 0x0064A,
+	0x00634, 0x00645, 0x0062E, 0x00634, 0x00645, 0x00645, 0x00636, 0x0062D, 0x00649, 0x00636,
+	0x0062E, 0x00645, 0x00637, 0x00645, 0x0062D, 0x00637, 0x00645, 0x00645, 0x00637, 0x00645,
+	0x0064A, 0x00639, 0x0062C, 0x00645, 0x00639, 0x00645, 0x00645, 0x00639, 0x00645, 0x00649,
+	0x0063A, 0x00645, 0x00645, 0x0063A, 0x00645, 0x0064A, 0x0063A, 0x00645, 0x00649, 0x00641,
+	0x0062E, 0x00645, 0x00642, 0x00645, 0x0062D, 0x00642, 0x00645, 0x00645, 0x00644, 0x0062D,
+	0x00645, 0x00644, 0x0062D, 0x0064A, 0x00644, 0x0062D, 0x00649, 0x00644, 0x0062C, 0x0062C,
+	0x00644, 0x0062E, 0x00645, 0x00644, 0x00645, 0x0062D, 0x00645, 0x0062D, 0x0062C, 0x00645,
+	0x0062D, 0x00645, 0x00645, 0x0062D, 0x0064A, 0x00645, 0x0062C, 0x0062D, 0x00645, 0x0062C,
+	0x00645, 0x00645, 0x0062E, 0x0062C, 0x00645, 0x0062E, 0x00645, 0x00645, 0x0062C, 0x0062E,
+	0x00647, 0x00645, 0x0062C, 0x00647, 0x00645, 0x00645, 0x00646, 0x0062D, 0x00645, 0x00646,
+	0x0062D, 0x00649, 0x00646, 0x0062C, 0x00645, 0x00646, 0x0062C, 0x00649, 0x00646, 0x00645,
+	0x0064A, 0x00646, 0x00645, 0x00649, 0x0064A, 0x00645, 0x00645, 0x00628, 0x0062E, 0x0064A,
+	0x0062A, 0x0062C, 0x0064A, 0x0062A, 0x0062C, 0x00649, 0x0062A, 0x0062E, 0x0064A, 0x0062A,
+	0x0062E, 0x00649, 0x0062A, 0x00645, 0x0064A, 0x0062A, 0x00645, 0x00649, 0x0062C, 0x00645,
+	0x0064A, 0x0062C, 0x0062D, 0x00649, 0x0062C, 0x00645, 0x00649, 0x00633, 0x0062E, 0x00649,
+	0x00635, 0x0062D, 0x0064A, 0x00634, 0x0062D, 0x0064A, 0x00636, 0x0062D, 0x0064A, 0x00644,
+	0x0062C, 0x0064A, 0x00644, 0x00645, 0x0064A, 0x0064A, 0x0062D, 0x0064A, 0x0064A, 0x0062C,
+	0x0064A, 0x0064A, 0x00645, 0x0064A, 0x00645, 0x00645, 0x0064A, 0x00642, 0x00645, 0x0064A,
+	0x00646, 0x0062D, 0x0064A, 0x00639, 0x00645, 0x0064A, 0x00643, 0x00645, 0x0064A, 0x00646,
+	0x0062C, 0x0062D, 0x00645, 0x0062E, 0x0064A, 0x00644, 0x0062C, 0x00645, 0x00643, 0x00645,
+	0x00645, 0x0062C, 0x0062D, 0x0064A, 0x0062D, 0x0062C, 0x0064A, 0x00645, 0x0062C, 0x0064A,
+	0x00641, 0x00645, 0x0064A, 0x00628, 0x0062D, 0x0064A, 0x00633, 0x0062E, 0x0064A, 0x00646,
+	0x0062C, 0x0064A, 0x00635, 0x00644, 0x006D2, 0x00642, 0x00644, 0x006D2, 0x00627, 0x00644,
+	0x00644, 0x00647, 0x00627, 0x00643, 0x00628, 0x00631, 0x00645, 0x0062D, 0x00645, 0x0062F,
+	0x00635, 0x00644, 0x00639, 0x00645, 0x00631, 0x00633, 0x00648, 0x00644, 0x00639, 0x00644,
+	0x0064A, 0x00647, 0x00648, 0x00633, 0x00644, 0x00645, 0x00635, 0x00644, 0x00649, 0x00635,
+	0x00644, 0x00649, 0x00020, 0x00627, 0x00644, 0x00644, 0x00647, 0x00020, 0x00639, 0x00644,
+	0x0064A, 0x00647, 0x00020, 0x00648, 0x00633, 0x00644, 0x00645, 0x0062C, 0x00644, 0x00020,
+	0x0062C, 0x00644, 0x00627, 0x00644, 0x00647, 0x00631, 0x006CC, 0x00627, 0x00644, 0x0002C,
+	0x03001, 0x03002, 0x0003A, 0x00021, 0x0003F, 0x03016, 0x03017, 0x02014, 0x02013, 0x0005F,
+	0x0007B, 0x0007D, 0x03014, 0x03015, 0x03010, 0x03011, 0x0300A, 0x0300B, 0x0300C, 0x0300D,
+	0x0300E, 0x0300F, 0x0005B, 0x0005D, 0x00023, 0x00026, 0x0002A, 0x0002D, 0x0003C, 0x0003E,
+	0x0005C, 0x00024, 0x00025, 0x00040, 0x00020, 0x0064B, 0x00640, 0x0064B, 0x00020, 0x0064C,
+	0x00020, 0x0064D, 0x00020, 0x0064E, 0x00640, 0x0064E, 0x00020, 0x0064F, 0x00640, 0x0064F,
+	0x00020, 0x00650, 0x00640, 0x00650, 0x00020, 0x00651, 0x00640, 0x00651, 0x00020, 0x00652,
+	0x00640, 0x00652, 0x00621, 0x00627, 0x00628, 0x00629, 0x0062A, 0x0062B, 0x0062C, 0x0062D,
+	0x0062E, 0x0062F, 0x00630, 0x00631, 0x00632, 0x00633, 0x00634, 0x00635, 0x00636, 0x00637,
+	0x00638, 0x00639, 0x0063A, 0x00641, 0x00642, 0x00643, 0x00644, 0x00645, 0x00646, 0x00647,
+	0x00648, 0x0064A, 0x00644, 0x00627, 0x00653, 0x00644, 0x00627, 0x00654, 0x00644, 0x00627,
+	0x00655, 0x00644, 0x00627, 0x00022, 0x00027, 0x0002F, 0x0005E, 0x0007C, 0x0007E, 0x02985,
+	0x02986, 0x030FB, 0x030A1, 0x030A3, 0x030A5, 0x030A7, 0x030A9, 0x030E3, 0x030E5, 0x030E7,
+	0x030C3, 0x030FC, 0x030F3, 0x03099, 0x0309A, 0x000A2, 0x000A3, 0x000AC, 0x000A6, 0x000A5,
+	0x020A9, 0x02502, 0x02190, 0x02191, 0x02192, 0x02193, 0x025A0, 0x025CB, 0x11099, 0x110BA,
+	0x1109B, 0x110BA, 0x110A5, 0x110BA, 0x11131, 0x11127, 0x11132, 0x11127, 0x11347, 0x1133E,
+	0x11347, 0x11357, 0x114B9, 0x114BA, 0x114B9, 0x114B0, 0x114B9, 0x114BD, 0x115B8, 0x115AF,
+	0x115B9, 0x115AF, 0x1D157, 0x1D165, 0x1D158, 0x1D165, 0x1D158, 0x1D165, 0x1D16E, 0x1D158,
+	0x1D165, 0x1D16F, 0x1D158, 0x1D165, 0x1D170, 0x1D158, 0x1D165, 0x1D171, 0x1D158, 0x1D165,
+	0x1D172, 0x1D1B9, 0x1D165, 0x1D1BA, 0x1D165, 0x1D1B9, 0x1D165, 0x1D16E, 0x1D1BA, 0x1D165,
+	0x1D16E, 0x1D1B9, 0x1D165, 0x1D16F, 0x1D1BA, 0x1D165, 0x1D16F, 0x00131, 0x00237, 0x00391,
+	0x00392, 0x00394, 0x00395, 0x00396, 0x00397, 0x00399, 0x0039A, 0x0039B, 0x0039C, 0x0039D,
+	0x0039E, 0x0039F, 0x003A1, 0x003A4, 0x003A6, 0x003A7, 0x003A8, 0x02207, 0x003B1, 0x003B6,
+	0x003B7, 0x003BB, 0x003BD, 0x003BE, 0x003BF, 0x003C3, 0x003C4, 0x003C5, 0x003C8, 0x003C9,
+	0x02202, 0x003DC, 0x003DD, 0x0066E, 0x006A1, 0x0066F, 0x00030, 0x0002E, 0x00030, 0x0002C,
+	0x00031, 0x0002C, 0x00032, 0x0002C, 0x00033, 0x0002C, 0x00034, 0x0002C, 0x00035, 0x0002C,
+	0x00036, 0x0002C, 0x00037, 0x0002C, 0x00038, 0x0002C, 0x00039, 0x0002C, 0x00028, 0x00041,
+	0x00029, 0x00028, 0x00042, 0x00029, 0x00028, 0x00043, 0x00029, 0x00028, 0x00044, 0x00029,
+	0x00028, 0x00045, 0x00029, 0x00028, 0x00046, 0x00029, 0x00028, 0x00047, 0x00029, 0x00028,
+	0x00048, 0x00029, 0x00028, 0x00049, 0x00029, 0x00028, 0x0004A, 0x00029, 0x00028, 0x0004B,
+	0x00029, 0x00028, 0x0004C, 0x00029, 0x00028, 0x0004D, 0x00029, 0x00028, 0x0004E, 0x00029,
+	0x00028, 0x0004F, 0x00029, 0x00028, 0x00050, 0x00029, 0x00028, 0x00051, 0x00029, 0x00028,
+	0x00052, 0x00029, 0x00028, 0x00053, 0x00029, 0x00028, 0x00054, 0x00029, 0x00028, 0x00055,
+	0x00029, 0x00028, 0x00056, 0x00029, 0x00028, 0x00057, 0x00029, 0x00028, 0x00058, 0x00029,
+	0x00028, 0x00059, 0x00029, 0x00028, 0x0005A, 0x00029, 0x03014, 0x00053, 0x03015, 0x00043,
+	0x00044, 0x00057, 0x0005A, 0x00048, 0x00056, 0x00053, 0x00044, 0x00053, 0x00053, 0x00050,
+	0x00050, 0x00056, 0x00057, 0x00043, 0x0004D, 0x00043, 0x0004D, 0x00044, 0x00044, 0x0004A,
+	0x0307B, 0x0304B, 0x030B3, 0x030B3, 0x05B57, 0x053CC, 0x0591A, 0x089E3, 0x04EA4, 0x06620,
+	0x07121, 0x0524D, 0x05F8C, 0x0518D, 0x065B0, 0x0521D, 0x07D42, 0x08CA9, 0x058F0, 0x05439,
+	0x06F14, 0x06295, 0x06355, 0x0904A, 0x06307, 0x06253, 0x07981, 0x07A7A, 0x05408, 0x06E80,
+	0x07533, 0x05272, 0x055B6, 0x03014, 0x0672C, 0x03015, 0x03014, 0x04E09, 0x03015, 0x03014,
+	0x04E8C, 0x03015, 0x03014, 0x05B89, 0x03015, 0x03014, 0x070B9, 0x03015, 0x03014, 0x06253,
+	0x03015, 0x03014, 0x076D7, 0x03015, 0x03014, 0x052DD, 0x03015, 0x03014, 0x06557, 0x03015,
+	0x05F97, 0x053EF, 0x04E3D, 0x04E38, 0x04E41, 0x20122, 0x04F60, 0x04FBB, 0x05002, 0x0507A,
+	0x05099, 0x050CF, 0x0349E, 0x2063A, 0x05154, 0x05164, 0x05177, 0x2051C, 0x034B9, 0x05167,
+	0x2054B, 0x05197, 0x051A4, 0x04ECC, 0x051AC, 0x291DF, 0x05203, 0x034DF, 0x0523B, 0x05246,
+	0x05277, 0x03515, 0x05305, 0x05306, 0x05349, 0x0535A, 0x05373, 0x0537D, 0x0537F, 0x20A2C,
+	0x07070, 0x053CA, 0x053DF, 0x20B63, 0x053EB, 0x053F1, 0x05406, 0x0549E, 0x05438, 0x05448,
+	0x05468, 0x054A2, 0x054F6, 0x05510, 0x05553, 0x05563, 0x05584, 0x055AB, 0x055B3, 0x055C2,
+	0x05716, 0x05717, 0x05651, 0x05674, 0x058EE, 0x057CE, 0x057F4, 0x0580D, 0x0578B, 0x05832,
+	0x05831, 0x058AC, 0x214E4, 0x058F2, 0x058F7, 0x05906, 0x05922, 0x05962, 0x216A8, 0x216EA,
+	0x059EC, 0x05A1B, 0x05A27, 0x059D8, 0x05A66, 0x036EE, 0x036FC, 0x05B08, 0x05B3E, 0x219C8,
+	0x05BC3, 0x05BD8, 0x05BF3, 0x21B18, 0x05BFF, 0x05C06, 0x05F53, 0x03781, 0x05C60, 0x05CC0,
+	0x05C8D, 0x21DE4, 0x05D43, 0x21DE6, 0x05D6E, 0x05D6B, 0x05D7C, 0x05DE1, 0x05DE2, 0x0382F,
+	0x05DFD, 0x05E28, 0x05E3D, 0x05E69, 0x03862, 0x22183, 0x0387C, 0x05EB0, 0x05EB3, 0x05EB6,
+	0x2A392, 0x22331, 0x08201, 0x05F22, 0x038C7, 0x232B8, 0x261DA, 0x05F62, 0x05F6B, 0x038E3,
+	0x05F9A, 0x05FCD, 0x05FD7, 0x05FF9, 0x06081, 0x0393A, 0x0391C, 0x226D4, 0x060C7, 0x06148,
+	0x0614C, 0x0617A, 0x061B2, 0x061A4, 0x061AF, 0x061DE, 0x06210, 0x0621B, 0x0625D, 0x062B1,
+	0x062D4, 0x06350, 0x22B0C, 0x0633D, 0x062FC, 0x06368, 0x06383, 0x063E4, 0x22BF1, 0x06422,
+	0x063C5, 0x063A9, 0x03A2E, 0x06469, 0x0647E, 0x0649D, 0x06477, 0x03A6C, 0x0656C, 0x2300A,
+	0x065E3, 0x066F8, 0x06649, 0x03B19, 0x03B08, 0x03AE4, 0x05192, 0x05195, 0x06700, 0x0669C,
+	0x080AD, 0x043D9, 0x06721, 0x0675E, 0x06753, 0x233C3, 0x03B49, 0x067FA, 0x06785, 0x06852,
+	0x2346D, 0x0688E, 0x0681F, 0x06914, 0x06942, 0x069A3, 0x069EA, 0x06AA8, 0x236A3, 0x06ADB,
+	0x03C18, 0x06B21, 0x238A7, 0x06B54, 0x03C4E, 0x06B72, 0x06B9F, 0x06BBB, 0x23A8D, 0x21D0B,
+	0x23AFA, 0x06C4E, 0x23CBC, 0x06CBF, 0x06CCD, 0x06C67, 0x06D16, 0x06D3E, 0x06D69, 0x06D78,
+	0x06D85, 0x23D1E, 0x06D34, 0x06E2F, 0x06E6E, 0x03D33, 0x06EC7, 0x23ED1, 0x06DF9, 0x06F6E,
+	0x23F5E, 0x23F8E, 0x06FC6, 0x07039, 0x0701B, 0x03D96, 0x0704A, 0x0707D, 0x07077, 0x070AD,
+	0x20525, 0x07145, 0x24263, 0x0719C, 0x243AB, 0x07228, 0x07250, 0x24608, 0x07280, 0x07295,
+	0x24735, 0x24814, 0x0737A, 0x0738B, 0x03EAC, 0x073A5, 0x03EB8, 0x07447, 0x0745C, 0x07485,
+	0x074CA, 0x03F1B, 0x07524, 0x24C36, 0x0753E, 0x24C92, 0x2219F, 0x07610, 0x24FA1, 0x24FB8,
+	0x25044, 0x03FFC, 0x04008, 0x250F3, 0x250F2, 0x25119, 0x25133, 0x0771E, 0x0771F, 0x0778B,
+	0x04046, 0x04096, 0x2541D, 0x0784E, 0x040E3, 0x25626, 0x2569A, 0x256C5, 0x079EB, 0x0412F,
+	0x07A4A, 0x07A4F, 0x2597C, 0x25AA7, 0x07AEE, 0x04202, 0x25BAB, 0x07BC6, 0x07BC9, 0x04227,
+	0x25C80, 0x07CD2, 0x042A0, 0x07CE8, 0x07CE3, 0x07D00, 0x25F86, 0x07D63, 0x04301, 0x07DC7,
+	0x07E02, 0x07E45, 0x04334, 0x26228, 0x26247, 0x04359, 0x262D9, 0x07F7A, 0x2633E, 0x07F95,
+	0x07FFA, 0x264DA, 0x26523, 0x08060, 0x265A8, 0x08070, 0x2335F, 0x043D5, 0x080B2, 0x08103,
+	0x0440B, 0x0813E, 0x05AB5, 0x267A7, 0x267B5, 0x23393, 0x2339C, 0x08204, 0x08F9E, 0x0446B,
+	0x08291, 0x0828B, 0x0829D, 0x052B3, 0x082B1, 0x082B3, 0x082BD, 0x082E6, 0x26B3C, 0x0831D,
+	0x08363, 0x083AD, 0x08323, 0x083BD, 0x083E7, 0x08353, 0x083CA, 0x083CC, 0x083DC, 0x26C36,
+	0x26D6B, 0x26CD5, 0x0452B, 0x084F1, 0x084F3, 0x08516, 0x273CA, 0x08564, 0x26F2C, 0x0455D,
+	0x04561, 0x26FB1, 0x270D2, 0x0456B, 0x08650, 0x08667, 0x08669, 0x086A9, 0x08688, 0x0870E,
+	0x086E2, 0x08728, 0x0876B, 0x08786, 0x045D7, 0x087E1, 0x08801, 0x045F9, 0x08860, 0x27667,
+	0x088D7, 0x088DE, 0x04635, 0x088FA, 0x034BB, 0x278AE, 0x27966, 0x046BE, 0x046C7, 0x08AA0,
+	0x27CA8, 0x08CAB, 0x08CC1, 0x08D1B, 0x08D77, 0x27F2F, 0x20804, 0x08DCB, 0x08DBC, 0x08DF0,
+	0x208DE, 0x08ED4, 0x285D2, 0x285ED, 0x09094, 0x090F1, 0x09111, 0x2872E, 0x0911B, 0x09238,
+	0x092D7, 0x092D8, 0x0927C, 0x093F9, 0x09415, 0x28BFA, 0x0958B, 0x04995, 0x095B7, 0x28D77,
+	0x049E6, 0x096C3, 0x05DB2, 0x09723, 0x29145, 0x2921A, 0x04A6E, 0x04A76, 0x097E0, 0x2940A,
+	0x04AB2, 0x29496, 0x09829, 0x295B6, 0x098E2, 0x04B33, 0x09929, 0x099A7, 0x099C2, 0x099FE,
+	0x04BCE, 0x29B30, 0x09C40, 0x09CFD, 0x04CCE, 0x04CED, 0x09D67, 0x2A0CE, 0x04CF8, 0x2A105,
+	0x2A20E, 0x2A291, 0x04D56, 0x09EFE, 0x09F05, 0x09F0F, 0x09F16, 0x2A600
+};
+static const a_cp a_norm_compositions[A_MAX_COMPOSITIONS][3] =
+{
+	{0x0003C, 0x00338, 0x0226E}, {0x0003D, 0x00338, 0x02260}, {0x0003E, 0x00338, 0x0226F},
+	{0x00041, 0x00300, 0x000C0}, {0x00041, 0x00301, 0x000C1}, {0x00041, 0x00302, 0x000C2},
+	{0x00041, 0x00303, 0x000C3}, {0x00041, 0x00304, 0x00100}, {0x00041, 0x00306, 0x00102},
+	{0x00041, 0x00307, 0x00226}, {0x00041, 0x00308, 0x000C4}, {0x00041, 0x00309, 0x01EA2},
+	{0x00041, 0x0030A, 0x000C5}, {0x00041, 0x0030C, 0x001CD}, {0x00041, 0x0030F, 0x00200},
+	{0x00041, 0x00311, 0x00202}, {0x00041, 0x00323, 0x01EA0}, {0x00041, 0x00325, 0x01E00},
+	{0x00041, 0x00328, 0x00104}, {0x00042, 0x00307, 0x01E02}, {0x00042, 0x00323, 0x01E04},
+	{0x00042, 0x00331, 0x01E06}, {0x00043, 0x00301, 0x00106}, {0x00043, 0x00302, 0x00108},
+	{0x00043, 0x00307, 0x0010A}, {0x00043, 0x0030C, 0x0010C}, {0x00043, 0x00327, 0x000C7},
+	{0x00044, 0x00307, 0x01E0A}, {0x00044, 0x0030C, 0x0010E}, {0x00044, 0x00323, 0x01E0C},
+	{0x00044, 0x00327, 0x01E10}, {0x00044, 0x0032D, 0x01E12}, {0x00044, 0x00331, 0x01E0E},
+	{0x00045, 0x00300, 0x000C8}, {0x00045, 0x00301, 0x000C9}, {0x00045, 0x00302, 0x000CA},
+	{0x00045, 0x00303, 0x01EBC}, {0x00045, 0x00304, 0x00112}, {0x00045, 0x00306, 0x00114},
+	{0x00045, 0x00307, 0x00116}, {0x00045, 0x00308, 0x000CB}, {0x00045, 0x00309, 0x01EBA},
+	{0x00045, 0x0030C, 0x0011A}, {0x00045, 0x0030F, 0x00204}, {0x00045, 0x00311, 0x00206},
+	{0x00045, 0x00323, 0x01EB8}, {0x00045, 0x00327, 0x00228}, {0x00045, 0x00328, 0x00118},
+	{0x00045, 0x0032D, 0x01E18}, {0x00045, 0x00330, 0x01E1A}, {0x00046, 0x00307, 0x01E1E},
+	{0x00047, 0x00301, 0x001F4}, {0x00047, 0x00302, 0x0011C}, {0x00047, 0x00304, 0x01E20},
+	{0x00047, 0x00306, 0x0011E}, {0x00047, 0x00307, 0x00120}, {0x00047, 0x0030C, 0x001E6},
+	{0x00047, 0x00327, 0x00122}, {0x00048, 0x00302, 0x00124}, {0x00048, 0x00307, 0x01E22},
+	{0x00048, 0x00308, 0x01E26}, {0x00048, 0x0030C, 0x0021E}, {0x00048, 0x00323, 0x01E24},
+	{0x00048, 0x00327, 0x01E28}, {0x00048, 0x0032E, 0x01E2A}, {0x00049, 0x00300, 0x000CC},
+	{0x00049, 0x00301, 0x000CD}, {0x00049, 0x00302, 0x000CE}, {0x00049, 0x00303, 0x00128},
+	{0x00049, 0x00304, 0x0012A}, {0x00049, 0x00306, 0x0012C}, {0x00049, 0x00307, 0x00130},
+	{0x00049, 0x00308, 0x000CF}, {0x00049, 0x00309, 0x01EC8}, {0x00049, 0x0030C, 0x001CF},
+	{0x00049, 0x0030F, 0x00208}, {0x00049, 0x00311, 0x0020A}, {0x00049, 0x00323, 0x01ECA},
+	{0x00049, 0x00328, 0x0012E}, {0x00049, 0x00330, 0x01E2C}, {0x0004A, 0x00302, 0x00134},
+	{0x0004B, 0x00301, 0x01E30}, {0x0004B, 0x0030C, 0x001E8}, {0x0004B, 0x00323, 0x01E32},
+	{0x0004B, 0x00327, 0x00136}, {0x0004B, 0x00331, 0x01E34}, {0x0004C, 0x00301, 0x00139},
+	{0x0004C, 0x0030C, 0x0013D}, {0x0004C, 0x00323, 0x01E36}, {0x0004C, 0x00327, 0x0013B},
+	{0x0004C, 0x0032D, 0x01E3C}, {0x0004C, 0x00331, 0x01E3A}, {0x0004D, 0x00301, 0x01E3E},
+	{0x0004D, 0x00307, 0x01E40}, {0x0004D, 0x00323, 0x01E42}, {0x0004E, 0x00300, 0x001F8},
+	{0x0004E, 0x00301, 0x00143}, {0x0004E, 0x00303, 0x000D1}, {0x0004E, 0x00307, 0x01E44},
+	{0x0004E, 0x0030C, 0x00147}, {0x0004E, 0x00323, 0x01E46}, {0x0004E, 0x00327, 0x00145},
+	{0x0004E, 0x0032D, 0x01E4A}, {0x0004E, 0x00331, 0x01E48}, {0x0004F, 0x00300, 0x000D2},
+	{0x0004F, 0x00301, 0x000D3}, {0x0004F, 0x00302, 0x000D4}, {0x0004F, 0x00303, 0x000D5},
+	{0x0004F, 0x00304, 0x0014C}, {0x0004F, 0x00306, 0x0014E}, {0x0004F, 0x00307, 0x0022E},
+	{0x0004F, 0x00308, 0x000D6}, {0x0004F, 0x00309, 0x01ECE}, {0x0004F, 0x0030B, 0x00150},
+	{0x0004F, 0x0030C, 0x001D1}, {0x0004F, 0x0030F, 0x0020C}, {0x0004F, 0x00311, 0x0020E},
+	{0x0004F, 0x0031B, 0x001A0}, {0x0004F, 0x00323, 0x01ECC}, {0x0004F, 0x00328, 0x001EA},
+	{0x00050, 0x00301, 0x01E54}, {0x00050, 0x00307, 0x01E56}, {0x00052, 0x00301, 0x00154},
+	{0x00052, 0x00307, 0x01E58}, {0x00052, 0x0030C, 0x00158}, {0x00052, 0x0030F, 0x00210},
+	{0x00052, 0x00311, 0x00212}, {0x00052, 0x00323, 0x01E5A}, {0x00052, 0x00327, 0x00156},
+	{0x00052, 0x00331, 0x01E5E}, {0x00053, 0x00301, 0x0015A}, {0x00053, 0x00302, 0x0015C},
+	{0x00053, 0x00307, 0x01E60}, {0x00053, 0x0030C, 0x00160}, {0x00053, 0x00323, 0x01E62},
+	{0x00053, 0x00326, 0x00218}, {0x00053, 0x00327, 0x0015E}, {0x00054, 0x00307, 0x01E6A},
+	{0x00054, 0x0030C, 0x00164}, {0x00054, 0x00323, 0x01E6C}, {0x00054, 0x00326, 0x0021A},
+	{0x00054, 0x00327, 0x00162}, {0x00054, 0x0032D, 0x01E70}, {0x00054, 0x00331, 0x01E6E},
+	{0x00055, 0x00300, 0x000D9}, {0x00055, 0x00301, 0x000DA}, {0x00055, 0x00302, 0x000DB},
+	{0x00055, 0x00303, 0x00168}, {0x00055, 0x00304, 0x0016A}, {0x00055, 0x00306, 0x0016C},
+	{0x00055, 0x00308, 0x000DC}, {0x00055, 0x00309, 0x01EE6}, {0x00055, 0x0030A, 0x0016E},
+	{0x00055, 0x0030B, 0x00170}, {0x00055, 0x0030C, 0x001D3}, {0x00055, 0x0030F, 0x00214},
+	{0x00055, 0x00311, 0x00216}, {0x00055, 0x0031B, 0x001AF}, {0x00055, 0x00323, 0x01EE4},
+	{0x00055, 0x00324, 0x01E72}, {0x00055, 0x00328, 0x00172}, {0x00055, 0x0032D, 0x01E76},
+	{0x00055, 0x00330, 0x01E74}, {0x00056, 0x00303, 0x01E7C}, {0x00056, 0x00323, 0x01E7E},
+	{0x00057, 0x00300, 0x01E80}, {0x00057, 0x00301, 0x01E82}, {0x00057, 0x00302, 0x00174},
+	{0x00057, 0x00307, 0x01E86}, {0x00057, 0x00308, 0x01E84}, {0x00057, 0x00323, 0x01E88},
+	{0x00058, 0x00307, 0x01E8A}, {0x00058, 0x00308, 0x01E8C}, {0x00059, 0x00300, 0x01EF2},
+	{0x00059, 0x00301, 0x000DD}, {0x00059, 0x00302, 0x00176}, {0x00059, 0x00303, 0x01EF8},
+	{0x00059, 0x00304, 0x00232}, {0x00059, 0x00307, 0x01E8E}, {0x00059, 0x00308, 0x00178},
+	{0x00059, 0x00309, 0x01EF6}, {0x00059, 0x00323, 0x01EF4}, {0x0005A, 0x00301, 0x00179},
+	{0x0005A, 0x00302, 0x01E90}, {0x0005A, 0x00307, 0x0017B}, {0x0005A, 0x0030C, 0x0017D},
+	{0x0005A, 0x00323, 0x01E92}, {0x0005A, 0x00331, 0x01E94}, {0x00061, 0x00300, 0x000E0},
+	{0x00061, 0x00301, 0x000E1}, {0x00061, 0x00302, 0x000E2}, {0x00061, 0x00303, 0x000E3},
+	{0x00061, 0x00304, 0x00101}, {0x00061, 0x00306, 0x00103}, {0x00061, 0x00307, 0x00227},
+	{0x00061, 0x00308, 0x000E4}, {0x00061, 0x00309, 0x01EA3}, {0x00061, 0x0030A, 0x000E5},
+	{0x00061, 0x0030C, 0x001CE}, {0x00061, 0x0030F, 0x00201}, {0x00061, 0x00311, 0x00203},
+	{0x00061, 0x00323, 0x01EA1}, {0x00061, 0x00325, 0x01E01}, {0x00061, 0x00328, 0x00105},
+	{0x00062, 0x00307, 0x01E03}, {0x00062, 0x00323, 0x01E05}, {0x00062, 0x00331, 0x01E07},
+	{0x00063, 0x00301, 0x00107}, {0x00063, 0x00302, 0x00109}, {0x00063, 0x00307, 0x0010B},
+	{0x00063, 0x0030C, 0x0010D}, {0x00063, 0x00327, 0x000E7}, {0x00064, 0x00307, 0x01E0B},
+	{0x00064, 0x0030C, 0x0010F}, {0x00064, 0x00323, 0x01E0D}, {0x00064, 0x00327, 0x01E11},
+	{0x00064, 0x0032D, 0x01E13}, {0x00064, 0x00331, 0x01E0F}, {0x00065, 0x00300, 0x000E8},
+	{0x00065, 0x00301, 0x000E9}, {0x00065, 0x00302, 0x000EA}, {0x00065, 0x00303, 0x01EBD},
+	{0x00065, 0x00304, 0x00113}, {0x00065, 0x00306, 0x00115}, {0x00065, 0x00307, 0x00117},
+	{0x00065, 0x00308, 0x000EB}, {0x00065, 0x00309, 0x01EBB}, {0x00065, 0x0030C, 0x0011B},
+	{0x00065, 0x0030F, 0x00205}, {0x00065, 0x00311, 0x00207}, {0x00065, 0x00323, 0x01EB9},
+	{0x00065, 0x00327, 0x00229}, {0x00065, 0x00328, 0x00119}, {0x00065, 0x0032D, 0x01E19},
+	{0x00065, 0x00330, 0x01E1B}, {0x00066, 0x00307, 0x01E1F}, {0x00067, 0x00301, 0x001F5},
+	{0x00067, 0x00302, 0x0011D}, {0x00067, 0x00304, 0x01E21}, {0x00067, 0x00306, 0x0011F},
+	{0x00067, 0x00307, 0x00121}, {0x00067, 0x0030C, 0x001E7}, {0x00067, 0x00327, 0x00123},
+	{0x00068, 0x00302, 0x00125}, {0x00068, 0x00307, 0x01E23}, {0x00068, 0x00308, 0x01E27},
+	{0x00068, 0x0030C, 0x0021F}, {0x00068, 0x00323, 0x01E25}, {0x00068, 0x00327, 0x01E29},
+	{0x00068, 0x0032E, 0x01E2B}, {0x00068, 0x00331, 0x01E96}, {0x00069, 0x00300, 0x000EC},
+	{0x00069, 0x00301, 0x000ED}, {0x00069, 0x00302, 0x000EE}, {0x00069, 0x00303, 0x00129},
+	{0x00069, 0x00304, 0x0012B}, {0x00069, 0x00306, 0x0012D}, {0x00069, 0x00308, 0x000EF},
+	{0x00069, 0x00309, 0x01EC9}, {0x00069, 0x0030C, 0x001D0}, {0x00069, 0x0030F, 0x00209},
+	{0x00069, 0x00311, 0x0020B}, {0x00069, 0x00323, 0x01ECB}, {0x00069, 0x00328, 0x0012F},
+	{0x00069, 0x00330, 0x01E2D}, {0x0006A, 0x00302, 0x00135}, {0x0006A, 0x0030C, 0x001F0},
+	{0x0006B, 0x00301, 0x01E31}, {0x0006B, 0x0030C, 0x001E9}, {0x0006B, 0x00323, 0x01E33},
+	{0x0006B, 0x00327, 0x00137}, {0x0006B, 0x00331, 0x01E35}, {0x0006C, 0x00301, 0x0013A},
+	{0x0006C, 0x0030C, 0x0013E}, {0x0006C, 0x00323, 0x01E37}, {0x0006C, 0x00327, 0x0013C},
+	{0x0006C, 0x0032D, 0x01E3D}, {0x0006C, 0x00331, 0x01E3B}, {0x0006D, 0x00301, 0x01E3F},
+	{0x0006D, 0x00307, 0x01E41}, {0x0006D, 0x00323, 0x01E43}, {0x0006E, 0x00300, 0x001F9},
+	{0x0006E, 0x00301, 0x00144}, {0x0006E, 0x00303, 0x000F1}, {0x0006E, 0x00307, 0x01E45},
+	{0x0006E, 0x0030C, 0x00148}, {0x0006E, 0x00323, 0x01E47}, {0x0006E, 0x00327, 0x00146},
+	{0x0006E, 0x0032D, 0x01E4B}, {0x0006E, 0x00331, 0x01E49}, {0x0006F, 0x00300, 0x000F2},
+	{0x0006F, 0x00301, 0x000F3}, {0x0006F, 0x00302, 0x000F4}, {0x0006F, 0x00303, 0x000F5},
+	{0x0006F, 0x00304, 0x0014D}, {0x0006F, 0x00306, 0x0014F}, {0x0006F, 0x00307, 0x0022F},
+	{0x0006F, 0x00308, 0x000F6}, {0x0006F, 0x00309, 0x01ECF}, {0x0006F, 0x0030B, 0x00151},
+	{0x0006F, 0x0030C, 0x001D2}, {0x0006F, 0x0030F, 0x0020D}, {0x0006F, 0x00311, 0x0020F},
+	{0x0006F, 0x0031B, 0x001A1}, {0x0006F, 0x00323, 0x01ECD}, {0x0006F, 0x00328, 0x001EB},
+	{0x00070, 0x00301, 0x01E55}, {0x00070, 0x00307, 0x01E57}, {0x00072, 0x00301, 0x00155},
+	{0x00072, 0x00307, 0x01E59}, {0x00072, 0x0030C, 0x00159}, {0x00072, 0x0030F, 0x00211},
+	{0x00072, 0x00311, 0x00213}, {0x00072, 0x00323, 0x01E5B}, {0x00072, 0x00327, 0x00157},
+	{0x00072, 0x00331, 0x01E5F}, {0x00073, 0x00301, 0x0015B}, {0x00073, 0x00302, 0x0015D},
+	{0x00073, 0x00307, 0x01E61}, {0x00073, 0x0030C, 0x00161}, {0x00073, 0x00323, 0x01E63},
+	{0x00073, 0x00326, 0x00219}, {0x00073, 0x00327, 0x0015F}, {0x00074, 0x00307, 0x01E6B},
+	{0x00074, 0x00308, 0x01E97}, {0x00074, 0x0030C, 0x00165}, {0x00074, 0x00323, 0x01E6D},
+	{0x00074, 0x00326, 0x0021B}, {0x00074, 0x00327, 0x00163}, {0x00074, 0x0032D, 0x01E71},
+	{0x00074, 0x00331, 0x01E6F}, {0x00075, 0x00300, 0x000F9}, {0x00075, 0x00301, 0x000FA},
+	{0x00075, 0x00302, 0x000FB}, {0x00075, 0x00303, 0x00169}, {0x00075, 0x00304, 0x0016B},
+	{0x00075, 0x00306, 0x0016D}, {0x00075, 0x00308, 0x000FC}, {0x00075, 0x00309, 0x01EE7},
+	{0x00075, 0x0030A, 0x0016F}, {0x00075, 0x0030B, 0x00171}, {0x00075, 0x0030C, 0x001D4},
+	{0x00075, 0x0030F, 0x00215}, {0x00075, 0x00311, 0x00217}, {0x00075, 0x0031B, 0x001B0},
+	{0x00075, 0x00323, 0x01EE5}, {0x00075, 0x00324, 0x01E73}, {0x00075, 0x00328, 0x00173},
+	{0x00075, 0x0032D, 0x01E77}, {0x00075, 0x00330, 0x01E75}, {0x00076, 0x00303, 0x01E7D},
+	{0x00076, 0x00323, 0x01E7F}, {0x00077, 0x00300, 0x01E81}, {0x00077, 0x00301, 0x01E83},
+	{0x00077, 0x00302, 0x00175}, {0x00077, 0x00307, 0x01E87}, {0x00077, 0x00308, 0x01E85},
+	{0x00077, 0x0030A, 0x01E98}, {0x00077, 0x00323, 0x01E89}, {0x00078, 0x00307, 0x01E8B},
+	{0x00078, 0x00308, 0x01E8D}, {0x00079, 0x00300, 0x01EF3}, {0x00079, 0x00301, 0x000FD},
+	{0x00079, 0x00302, 0x00177}, {0x00079, 0x00303, 0x01EF9}, {0x00079, 0x00304, 0x00233},
+	{0x00079, 0x00307, 0x01E8F}, {0x00079, 0x00308, 0x000FF}, {0x00079, 0x00309, 0x01EF7},
+	{0x00079, 0x0030A, 0x01E99}, {0x00079, 0x00323, 0x01EF5}, {0x0007A, 0x00301, 0x0017A},
+	{0x0007A, 0x00302, 0x01E91}, {0x0007A, 0x00307, 0x0017C}, {0x0007A, 0x0030C, 0x0017E},
+	{0x0007A, 0x00323, 0x01E93}, {0x0007A, 0x00331, 0x01E95}, {0x000A8, 0x00300, 0x01FED},
+	{0x000A8, 0x00301, 0x00385}, {0x000A8, 0x00342, 0x01FC1}, {0x000C2, 0x00300, 0x01EA6},
+	{0x000C2, 0x00301, 0x01EA4}, {0x000C2, 0x00303, 0x01EAA}, {0x000C2, 0x00309, 0x01EA8},
+	{0x000C4, 0x00304, 0x001DE}, {0x000C5, 0x00301, 0x001FA}, {0x000C6, 0x00301, 0x001FC},
+	{0x000C6, 0x00304, 0x001E2}, {0x000C7, 0x00301, 0x01E08}, {0x000CA, 0x00300, 0x01EC0},
+	{0x000CA, 0x00301, 0x01EBE}, {0x000CA, 0x00303, 0x01EC4}, {0x000CA, 0x00309, 0x01EC2},
+	{0x000CF, 0x00301, 0x01E2E}, {0x000D4, 0x00300, 0x01ED2}, {0x000D4, 0x00301, 0x01ED0},
+	{0x000D4, 0x00303, 0x01ED6}, {0x000D4, 0x00309, 0x01ED4}, {0x000D5, 0x00301, 0x01E4C},
+	{0x000D5, 0x00304, 0x0022C}, {0x000D5, 0x00308, 0x01E4E}, {0x000D6, 0x00304, 0x0022A},
+	{0x000D8, 0x00301, 0x001FE}, {0x000DC, 0x00300, 0x001DB}, {0x000DC, 0x00301, 0x001D7},
+	{0x000DC, 0x00304, 0x001D5}, {0x000DC, 0x0030C, 0x001D9}, {0x000E2, 0x00300, 0x01EA7},
+	{0x000E2, 0x00301, 0x01EA5}, {0x000E2, 0x00303, 0x01EAB}, {0x000E2, 0x00309, 0x01EA9},
+	{0x000E4, 0x00304, 0x001DF}, {0x000E5, 0x00301, 0x001FB}, {0x000E6, 0x00301, 0x001FD},
+	{0x000E6, 0x00304, 0x001E3}, {0x000E7, 0x00301, 0x01E09}, {0x000EA, 0x00300, 0x01EC1},
+	{0x000EA, 0x00301, 0x01EBF}, {0x000EA, 0x00303, 0x01EC5}, {0x000EA, 0x00309, 0x01EC3},
+	{0x000EF, 0x00301, 0x01E2F}, {0x000F4, 0x00300, 0x01ED3}, {0x000F4, 0x00301, 0x01ED1},
+	{0x000F4, 0x00303, 0x01ED7}, {0x000F4, 0x00309, 0x01ED5}, {0x000F5, 0x00301, 0x01E4D},
+	{0x000F5, 0x00304, 0x0022D}, {0x000F5, 0x00308, 0x01E4F}, {0x000F6, 0x00304, 0x0022B},
+	{0x000F8, 0x00301, 0x001FF}, {0x000FC, 0x00300, 0x001DC}, {0x000FC, 0x00301, 0x001D8},
+	{0x000FC, 0x00304, 0x001D6}, {0x000FC, 0x0030C, 0x001DA}, {0x00102, 0x00300, 0x01EB0},
+	{0x00102, 0x00301, 0x01EAE}, {0x00102, 0x00303, 0x01EB4}, {0x00102, 0x00309, 0x01EB2},
+	{0x00103, 0x00300, 0x01EB1}, {0x00103, 0x00301, 0x01EAF}, {0x00103, 0x00303, 0x01EB5},
+	{0x00103, 0x00309, 0x01EB3}, {0x00112, 0x00300, 0x01E14}, {0x00112, 0x00301, 0x01E16},
+	{0x00113, 0x00300, 0x01E15}, {0x00113, 0x00301, 0x01E17}, {0x0014C, 0x00300, 0x01E50},
+	{0x0014C, 0x00301, 0x01E52}, {0x0014D, 0x00300, 0x01E51}, {0x0014D, 0x00301, 0x01E53},
+	{0x0015A, 0x00307, 0x01E64}, {0x0015B, 0x00307, 0x01E65}, {0x00160, 0x00307, 0x01E66},
+	{0x00161, 0x00307, 0x01E67}, {0x00168, 0x00301, 0x01E78}, {0x00169, 0x00301, 0x01E79},
+	{0x0016A, 0x00308, 0x01E7A}, {0x0016B, 0x00308, 0x01E7B}, {0x0017F, 0x00307, 0x01E9B},
+	{0x001A0, 0x00300, 0x01EDC}, {0x001A0, 0x00301, 0x01EDA}, {0x001A0, 0x00303, 0x01EE0},
+	{0x001A0, 0x00309, 0x01EDE}, {0x001A0, 0x00323, 0x01EE2}, {0x001A1, 0x00300, 0x01EDD},
+	{0x001A1, 0x00301, 0x01EDB}, {0x001A1, 0x00303, 0x01EE1}, {0x001A1, 0x00309, 0x01EDF},
+	{0x001A1, 0x00323, 0x01EE3}, {0x001AF, 0x00300, 0x01EEA}, {0x001AF, 0x00301, 0x01EE8},
+	{0x001AF, 0x00303, 0x01EEE}, {0x001AF, 0x00309, 0x01EEC}, {0x001AF, 0x00323, 0x01EF0},
+	{0x001B0, 0x00300, 0x01EEB}, {0x001B0, 0x00301, 0x01EE9}, {0x001B0, 0x00303, 0x01EEF},
+	{0x001B0, 0x00309, 0x01EED}, {0x001B0, 0x00323, 0x01EF1}, {0x001B7, 0x0030C, 0x001EE},
+	{0x001EA, 0x00304, 0x001EC}, {0x001EB, 0x00304, 0x001ED}, {0x00226, 0x00304, 0x001E0},
+	{0x00227, 0x00304, 0x001E1}, {0x00228, 0x00306, 0x01E1C}, {0x00229, 0x00306, 0x01E1D},
+	{0x0022E, 0x00304, 0x00230}, {0x0022F, 0x00304, 0x00231}, {0x00292, 0x0030C, 0x001EF},
+	{0x00391, 0x00300, 0x01FBA}, {0x00391, 0x00301, 0x00386}, {0x00391, 0x00304, 0x01FB9},
+	{0x00391, 0x00306, 0x01FB8}, {0x00391, 0x00313, 0x01F08}, {0x00391, 0x00314, 0x01F09},
+	{0x00391, 0x00345, 0x01FBC}, {0x00395, 0x00300, 0x01FC8}, {0x00395, 0x00301, 0x00388},
+	{0x00395, 0x00313, 0x01F18}, {0x00395, 0x00314, 0x01F19}, {0x00397, 0x00300, 0x01FCA},
+	{0x00397, 0x00301, 0x00389}, {0x00397, 0x00313, 0x01F28}, {0x00397, 0x00314, 0x01F29},
+	{0x00397, 0x00345, 0x01FCC}, {0x00399, 0x00300, 0x01FDA}, {0x00399, 0x00301, 0x0038A},
+	{0x00399, 0x00304, 0x01FD9}, {0x00399, 0x00306, 0x01FD8}, {0x00399, 0x00308, 0x003AA},
+	{0x00399, 0x00313, 0x01F38}, {0x00399, 0x00314, 0x01F39}, {0x0039F, 0x00300, 0x01FF8},
+	{0x0039F, 0x00301, 0x0038C}, {0x0039F, 0x00313, 0x01F48}, {0x0039F, 0x00314, 0x01F49},
+	{0x003A1, 0x00314, 0x01FEC}, {0x003A5, 0x00300, 0x01FEA}, {0x003A5, 0x00301, 0x0038E},
+	{0x003A5, 0x00304, 0x01FE9}, {0x003A5, 0x00306, 0x01FE8}, {0x003A5, 0x00308, 0x003AB},
+	{0x003A5, 0x00314, 0x01F59}, {0x003A9, 0x00300, 0x01FFA}, {0x003A9, 0x00301, 0x0038F},
+	{0x003A9, 0x00313, 0x01F68}, {0x003A9, 0x00314, 0x01F69}, {0x003A9, 0x00345, 0x01FFC},
+	{0x003AC, 0x00345, 0x01FB4}, {0x003AE, 0x00345, 0x01FC4}, {0x003B1, 0x00300, 0x01F70},
+	{0x003B1, 0x00301, 0x003AC}, {0x003B1, 0x00304, 0x01FB1}, {0x003B1, 0x00306, 0x01FB0},
+	{0x003B1, 0x00313, 0x01F00}, {0x003B1, 0x00314, 0x01F01}, {0x003B1, 0x00342, 0x01FB6},
+	{0x003B1, 0x00345, 0x01FB3}, {0x003B5, 0x00300, 0x01F72}, {0x003B5, 0x00301, 0x003AD},
+	{0x003B5, 0x00313, 0x01F10}, {0x003B5, 0x00314, 0x01F11}, {0x003B7, 0x00300, 0x01F74},
+	{0x003B7, 0x00301, 0x003AE}, {0x003B7, 0x00313, 0x01F20}, {0x003B7, 0x00314, 0x01F21},
+	{0x003B7, 0x00342, 0x01FC6}, {0x003B7, 0x00345, 0x01FC3}, {0x003B9, 0x00300, 0x01F76},
+	{0x003B9, 0x00301, 0x003AF}, {0x003B9, 0x00304, 0x01FD1}, {0x003B9, 0x00306, 0x01FD0},
+	{0x003B9, 0x00308, 0x003CA}, {0x003B9, 0x00313, 0x01F30}, {0x003B9, 0x00314, 0x01F31},
+	{0x003B9, 0x00342, 0x01FD6}, {0x003BF, 0x00300, 0x01F78}, {0x003BF, 0x00301, 0x003CC},
+	{0x003BF, 0x00313, 0x01F40}, {0x003BF, 0x00314, 0x01F41}, {0x003C1, 0x00313, 0x01FE4},
+	{0x003C1, 0x00314, 0x01FE5}, {0x003C5, 0x00300, 0x01F7A}, {0x003C5, 0x00301, 0x003CD},
+	{0x003C5, 0x00304, 0x01FE1}, {0x003C5, 0x00306, 0x01FE0}, {0x003C5, 0x00308, 0x003CB},
+	{0x003C5, 0x00313, 0x01F50}, {0x003C5, 0x00314, 0x01F51}, {0x003C5, 0x00342, 0x01FE6},
+	{0x003C9, 0x00300, 0x01F7C}, {0x003C9, 0x00301, 0x003CE}, {0x003C9, 0x00313, 0x01F60},
+	{0x003C9, 0x00314, 0x01F61}, {0x003C9, 0x00342, 0x01FF6}, {0x003C9, 0x00345, 0x01FF3},
+	{0x003CA, 0x00300, 0x01FD2}, {0x003CA, 0x00301, 0x00390}, {0x003CA, 0x00342, 0x01FD7},
+	{0x003CB, 0x00300, 0x01FE2}, {0x003CB, 0x00301, 0x003B0}, {0x003CB, 0x00342, 0x01FE7},
+	{0x003CE, 0x00345, 0x01FF4}, {0x003D2, 0x00301, 0x003D3}, {0x003D2, 0x00308, 0x003D4},
+	{0x00406, 0x00308, 0x00407}, {0x00410, 0x00306, 0x004D0}, {0x00410, 0x00308, 0x004D2},
+	{0x00413, 0x00301, 0x00403}, {0x00415, 0x00300, 0x00400}, {0x00415, 0x00306, 0x004D6},
+	{0x00415, 0x00308, 0x00401}, {0x00416, 0x00306, 0x004C1}, {0x00416, 0x00308, 0x004DC},
+	{0x00417, 0x00308, 0x004DE}, {0x00418, 0x00300, 0x0040D}, {0x00418, 0x00304, 0x004E2},
+	{0x00418, 0x00306, 0x00419}, {0x00418, 0x00308, 0x004E4}, {0x0041A, 0x00301, 0x0040C},
+	{0x0041E, 0x00308, 0x004E6}, {0x00423, 0x00304, 0x004EE}, {0x00423, 0x00306, 0x0040E},
+	{0x00423, 0x00308, 0x004F0}, {0x00423, 0x0030B, 0x004F2}, {0x00427, 0x00308, 0x004F4},
+	{0x0042B, 0x00308, 0x004F8}, {0x0042D, 0x00308, 0x004EC}, {0x00430, 0x00306, 0x004D1},
+	{0x00430, 0x00308, 0x004D3}, {0x00433, 0x00301, 0x00453}, {0x00435, 0x00300, 0x00450},
+	{0x00435, 0x00306, 0x004D7}, {0x00435, 0x00308, 0x00451}, {0x00436, 0x00306, 0x004C2},
+	{0x00436, 0x00308, 0x004DD}, {0x00437, 0x00308, 0x004DF}, {0x00438, 0x00300, 0x0045D},
+	{0x00438, 0x00304, 0x004E3}, {0x00438, 0x00306, 0x00439}, {0x00438, 0x00308, 0x004E5},
+	{0x0043A, 0x00301, 0x0045C}, {0x0043E, 0x00308, 0x004E7}, {0x00443, 0x00304, 0x004EF},
+	{0x00443, 0x00306, 0x0045E}, {0x00443, 0x00308, 0x004F1}, {0x00443, 0x0030B, 0x004F3},
+	{0x00447, 0x00308, 0x004F5}, {0x0044B, 0x00308, 0x004F9}, {0x0044D, 0x00308, 0x004ED},
+	{0x00456, 0x00308, 0x00457}, {0x00474, 0x0030F, 0x00476}, {0x00475, 0x0030F, 0x00477},
+	{0x004D8, 0x00308, 0x004DA}, {0x004D9, 0x00308, 0x004DB}, {0x004E8, 0x00308, 0x004EA},
+	{0x004E9, 0x00308, 0x004EB}, {0x00627, 0x00653, 0x00622}, {0x00627, 0x00654, 0x00623},
+	{0x00627, 0x00655, 0x00625}, {0x00648, 0x00654, 0x00624}, {0x0064A, 0x00654, 0x00626},
+	{0x006C1, 0x00654, 0x006C2}, {0x006D2, 0x00654, 0x006D3}, {0x006D5, 0x00654, 0x006C0},
+	{0x00928, 0x0093C, 0x00929}, {0x00930, 0x0093C, 0x00931}, {0x00933, 0x0093C, 0x00934},
+	{0x009C7, 0x009BE, 0x009CB}, {0x009C7, 0x009D7, 0x009CC}, {0x00B47, 0x00B3E, 0x00B4B},
+	{0x00B47, 0x00B56, 0x00B48}, {0x00B47, 0x00B57, 0x00B4C}, {0x00B92, 0x00BD7, 0x00B94},
+	{0x00BC6, 0x00BBE, 0x00BCA}, {0x00BC6, 0x00BD7, 0x00BCC}, {0x00BC7, 0x00BBE, 0x00BCB},
+	{0x00C46, 0x00C56, 0x00C48}, {0x00CBF, 0x00CD5, 0x00CC0}, {0x00CC6, 0x00CC2, 0x00CCA},
+	{0x00CC6, 0x00CD5, 0x00CC7}, {0x00CC6, 0x00CD6, 0x00CC8}, {0x00CCA, 0x00CD5, 0x00CCB},
+	{0x00D46, 0x00D3E, 0x00D4A}, {0x00D46, 0x00D57, 0x00D4C}, {0x00D47, 0x00D3E, 0x00D4B},
+	{0x00DD9, 0x00DCA, 0x00DDA}, {0x00DD9, 0x00DCF, 0x00DDC}, {0x00DD9, 0x00DDF, 0x00DDE},
+	{0x00DDC, 0x00DCA, 0x00DDD}, {0x01025, 0x0102E, 0x01026}, {0x01B05, 0x01B35, 0x01B06},
+	{0x01B07, 0x01B35, 0x01B08}, {0x01B09, 0x01B35, 0x01B0A}, {0x01B0B, 0x01B35, 0x01B0C},
+	{0x01B0D, 0x01B35, 0x01B0E}, {0x01B11, 0x01B35, 0x01B12}, {0x01B3A, 0x01B35, 0x01B3B},
+	{0x01B3C, 0x01B35, 0x01B3D}, {0x01B3E, 0x01B35, 0x01B40}, {0x01B3F, 0x01B35, 0x01B41},
+	{0x01B42, 0x01B35, 0x01B43}, {0x01E36, 0x00304, 0x01E38}, {0x01E37, 0x00304, 0x01E39},
+	{0x01E5A, 0x00304, 0x01E5C}, {0x01E5B, 0x00304, 0x01E5D}, {0x01E62, 0x00307, 0x01E68},
+	{0x01E63, 0x00307, 0x01E69}, {0x01EA0, 0x00302, 0x01EAC}, {0x01EA0, 0x00306, 0x01EB6},
+	{0x01EA1, 0x00302, 0x01EAD}, {0x01EA1, 0x00306, 0x01EB7}, {0x01EB8, 0x00302, 0x01EC6},
+	{0x01EB9, 0x00302, 0x01EC7}, {0x01ECC, 0x00302, 0x01ED8}, {0x01ECD, 0x00302, 0x01ED9},
+	{0x01F00, 0x00300, 0x01F02}, {0x01F00, 0x00301, 0x01F04}, {0x01F00, 0x00342, 0x01F06},
+	{0x01F00, 0x00345, 0x01F80}, {0x01F01, 0x00300, 0x01F03}, {0x01F01, 0x00301, 0x01F05},
+	{0x01F01, 0x00342, 0x01F07}, {0x01F01, 0x00345, 0x01F81}, {0x01F02, 0x00345, 0x01F82},
+	{0x01F03, 0x00345, 0x01F83}, {0x01F04, 0x00345, 0x01F84}, {0x01F05, 0x00345, 0x01F85},
+	{0x01F06, 0x00345, 0x01F86}, {0x01F07, 0x00345, 0x01F87}, {0x01F08, 0x00300, 0x01F0A},
+	{0x01F08, 0x00301, 0x01F0C}, {0x01F08, 0x00342, 0x01F0E}, {0x01F08, 0x00345, 0x01F88},
+	{0x01F09, 0x00300, 0x01F0B}, {0x01F09, 0x00301, 0x01F0D}, {0x01F09, 0x00342, 0x01F0F},
+	{0x01F09, 0x00345, 0x01F89}, {0x01F0A, 0x00345, 0x01F8A}, {0x01F0B, 0x00345, 0x01F8B},
+	{0x01F0C, 0x00345, 0x01F8C}, {0x01F0D, 0x00345, 0x01F8D}, {0x01F0E, 0x00345, 0x01F8E},
+	{0x01F0F, 0x00345, 0x01F8F}, {0x01F10, 0x00300, 0x01F12}, {0x01F10, 0x00301, 0x01F14},
+	{0x01F11, 0x00300, 0x01F13}, {0x01F11, 0x00301, 0x01F15}, {0x01F18, 0x00300, 0x01F1A},
+	{0x01F18, 0x00301, 0x01F1C}, {0x01F19, 0x00300, 0x01F1B}, {0x01F19, 0x00301, 0x01F1D},
+	{0x01F20, 0x00300, 0x01F22}, {0x01F20, 0x00301, 0x01F24}, {0x01F20, 0x00342, 0x01F26},
+	{0x01F20, 0x00345, 0x01F90}, {0x01F21, 0x00300, 0x01F23}, {0x01F21, 0x00301, 0x01F25},
+	{0x01F21, 0x00342, 0x01F27}, {0x01F21, 0x00345, 0x01F91}, {0x01F22, 0x00345, 0x01F92},
+	{0x01F23, 0x00345, 0x01F93}, {0x01F24, 0x00345, 0x01F94}, {0x01F25, 0x00345, 0x01F95},
+	{0x01F26, 0x00345, 0x01F96}, {0x01F27, 0x00345, 0x01F97}, {0x01F28, 0x00300, 0x01F2A},
+	{0x01F28, 0x00301, 0x01F2C}, {0x01F28, 0x00342, 0x01F2E}, {0x01F28, 0x00345, 0x01F98},
+	{0x01F29, 0x00300, 0x01F2B}, {0x01F29, 0x00301, 0x01F2D}, {0x01F29, 0x00342, 0x01F2F},
+	{0x01F29, 0x00345, 0x01F99}, {0x01F2A, 0x00345, 0x01F9A}, {0x01F2B, 0x00345, 0x01F9B},
+	{0x01F2C, 0x00345, 0x01F9C}, {0x01F2D, 0x00345, 0x01F9D}, {0x01F2E, 0x00345, 0x01F9E},
+	{0x01F2F, 0x00345, 0x01F9F}, {0x01F30, 0x00300, 0x01F32}, {0x01F30, 0x00301, 0x01F34},
+	{0x01F30, 0x00342, 0x01F36}, {0x01F31, 0x00300, 0x01F33}, {0x01F31, 0x00301, 0x01F35},
+	{0x01F31, 0x00342, 0x01F37}, {0x01F38, 0x00300, 0x01F3A}, {0x01F38, 0x00301, 0x01F3C},
+	{0x01F38, 0x00342, 0x01F3E}, {0x01F39, 0x00300, 0x01F3B}, {0x01F39, 0x00301, 0x01F3D},
+	{0x01F39, 0x00342, 0x01F3F}, {0x01F40, 0x00300, 0x01F42}, {0x01F40, 0x00301, 0x01F44},
+	{0x01F41, 0x00300, 0x01F43}, {0x01F41, 0x00301, 0x01F45}, {0x01F48, 0x00300, 0x01F4A},
+	{0x01F48, 0x00301, 0x01F4C}, {0x01F49, 0x00300, 0x01F4B}, {0x01F49, 0x00301, 0x01F4D},
+	{0x01F50, 0x00300, 0x01F52}, {0x01F50, 0x00301, 0x01F54}, {0x01F50, 0x00342, 0x01F56},
+	{0x01F51, 0x00300, 0x01F53}, {0x01F51, 0x00301, 0x01F55}, {0x01F51, 0x00342, 0x01F57},
+	{0x01F59, 0x00300, 0x01F5B}, {0x01F59, 0x00301, 0x01F5D}, {0x01F59, 0x00342, 0x01F5F},
+	{0x01F60, 0x00300, 0x01F62}, {0x01F60, 0x00301, 0x01F64}, {0x01F60, 0x00342, 0x01F66},
+	{0x01F60, 0x00345, 0x01FA0}, {0x01F61, 0x00300, 0x01F63}, {0x01F61, 0x00301, 0x01F65},
+	{0x01F61, 0x00342, 0x01F67}, {0x01F61, 0x00345, 0x01FA1}, {0x01F62, 0x00345, 0x01FA2},
+	{0x01F63, 0x00345, 0x01FA3}, {0x01F64, 0x00345, 0x01FA4}, {0x01F65, 0x00345, 0x01FA5},
+	{0x01F66, 0x00345, 0x01FA6}, {0x01F67, 0x00345, 0x01FA7}, {0x01F68, 0x00300, 0x01F6A},
+	{0x01F68, 0x00301, 0x01F6C}, {0x01F68, 0x00342, 0x01F6E}, {0x01F68, 0x00345, 0x01FA8},
+	{0x01F69, 0x00300, 0x01F6B}, {0x01F69, 0x00301, 0x01F6D}, {0x01F69, 0x00342, 0x01F6F},
+	{0x01F69, 0x00345, 0x01FA9}, {0x01F6A, 0x00345, 0x01FAA}, {0x01F6B, 0x00345, 0x01FAB},
+	{0x01F6C, 0x00345, 0x01FAC}, {0x01F6D, 0x00345, 0x01FAD}, {0x01F6E, 0x00345, 0x01FAE},
+	{0x01F6F, 0x00345, 0x01FAF}, {0x01F70, 0x00345, 0x01FB2}, {0x01F74, 0x00345, 0x01FC2},
+	{0x01F7C, 0x00345, 0x01FF2}, {0x01FB6, 0x00345, 0x01FB7}, {0x01FBF, 0x00300, 0x01FCD},
+	{0x01FBF, 0x00301, 0x01FCE}, {0x01FBF, 0x00342, 0x01FCF}, {0x01FC6, 0x00345, 0x01FC7},
+	{0x01FF6, 0x00345, 0x01FF7}, {0x01FFE, 0x00300, 0x01FDD}, {0x01FFE, 0x00301, 0x01FDE},
+	{0x01FFE, 0x00342, 0x01FDF}, {0x02190, 0x00338, 0x0219A}, {0x02192, 0x00338, 0x0219B},
+	{0x02194, 0x00338, 0x021AE}, {0x021D0, 0x00338, 0x021CD}, {0x021D2, 0x00338, 0x021CF},
+	{0x021D4, 0x00338, 0x021CE}, {0x02203, 0x00338, 0x02204}, {0x02208, 0x00338, 0x02209},
+	{0x0220B, 0x00338, 0x0220C}, {0x02223, 0x00338, 0x02224}, {0x02225, 0x00338, 0x02226},
+	{0x0223C, 0x00338, 0x02241}, {0x02243, 0x00338, 0x02244}, {0x02245, 0x00338, 0x02247},
+	{0x02248, 0x00338, 0x02249}, {0x0224D, 0x00338, 0x0226D}, {0x02261, 0x00338, 0x02262},
+	{0x02264, 0x00338, 0x02270}, {0x02265, 0x00338, 0x02271}, {0x02272, 0x00338, 0x02274},
+	{0x02273, 0x00338, 0x02275}, {0x02276, 0x00338, 0x02278}, {0x02277, 0x00338, 0x02279},
+	{0x0227A, 0x00338, 0x02280}, {0x0227B, 0x00338, 0x02281}, {0x0227C, 0x00338, 0x022E0},
+	{0x0227D, 0x00338, 0x022E1}, {0x02282, 0x00338, 0x02284}, {0x02283, 0x00338, 0x02285},
+	{0x02286, 0x00338, 0x02288}, {0x02287, 0x00338, 0x02289}, {0x02291, 0x00338, 0x022E2},
+	{0x02292, 0x00338, 0x022E3}, {0x022A2, 0x00338, 0x022AC}, {0x022A8, 0x00338, 0x022AD},
+	{0x022A9, 0x00338, 0x022AE}, {0x022AB, 0x00338, 0x022AF}, {0x022B2, 0x00338, 0x022EA},
+	{0x022B3, 0x00338, 0x022EB}, {0x022B4, 0x00338, 0x022EC}, {0x022B5, 0x00338, 0x022ED},
+	{0x03046, 0x03099, 0x03094}, {0x0304B, 0x03099, 0x0304C}, {0x0304D, 0x03099, 0x0304E},
+	{0x0304F, 0x03099, 0x03050}, {0x03051, 0x03099, 0x03052}, {0x03053, 0x03099, 0x03054},
+	{0x03055, 0x03099, 0x03056}, {0x03057, 0x03099, 0x03058}, {0x03059, 0x03099, 0x0305A},
+	{0x0305B, 0x03099, 0x0305C}, {0x0305D, 0x03099, 0x0305E}, {0x0305F, 0x03099, 0x03060},
+	{0x03061, 0x03099, 0x03062}, {0x03064, 0x03099, 0x03065}, {0x03066, 0x03099, 0x03067},
+	{0x03068, 0x03099, 0x03069}, {0x0306F, 0x03099, 0x03070}, {0x0306F, 0x0309A, 0x03071},
+	{0x03072, 0x03099, 0x03073}, {0x03072, 0x0309A, 0x03074}, {0x03075, 0x03099, 0x03076},
+	{0x03075, 0x0309A, 0x03077}, {0x03078, 0x03099, 0x03079}, {0x03078, 0x0309A, 0x0307A},
+	{0x0307B, 0x03099, 0x0307C}, {0x0307B, 0x0309A, 0x0307D}, {0x0309D, 0x03099, 0x0309E},
+	{0x030A6, 0x03099, 0x030F4}, {0x030AB, 0x03099, 0x030AC}, {0x030AD, 0x03099, 0x030AE},
+	{0x030AF, 0x03099, 0x030B0}, {0x030B1, 0x03099, 0x030B2}, {0x030B3, 0x03099, 0x030B4},
+	{0x030B5, 0x03099, 0x030B6}, {0x030B7, 0x03099, 0x030B8}, {0x030B9, 0x03099, 0x030BA},
+	{0x030BB, 0x03099, 0x030BC}, {0x030BD, 0x03099, 0x030BE}, {0x030BF, 0x03099, 0x030C0},
+	{0x030C1, 0x03099, 0x030C2}, {0x030C4, 0x03099, 0x030C5}, {0x030C6, 0x03099, 0x030C7},
+	{0x030C8, 0x03099, 0x030C9}, {0x030CF, 0x03099, 0x030D0}, {0x030CF, 0x0309A, 0x030D1},
+	{0x030D2, 0x03099, 0x030D3}, {0x030D2, 0x0309A, 0x030D4}, {0x030D5, 0x03099, 0x030D6},
+	{0x030D5, 0x0309A, 0x030D7}, {0x030D8, 0x03099, 0x030D9}, {0x030D8, 0x0309A, 0x030DA},
+	{0x030DB, 0x03099, 0x030DC}, {0x030DB, 0x0309A, 0x030DD}, {0x030EF, 0x03099, 0x030F7},
+	{0x030F0, 0x03099, 0x030F8}, {0x030F1, 0x03099, 0x030F9}, {0x030F2, 0x03099, 0x030FA},
+	{0x030FD, 0x03099, 0x030FE}, {0x11099, 0x110BA, 0x1109A}, {0x1109B, 0x110BA, 0x1109C},
+	{0x110A5, 0x110BA, 0x110AB}, {0x11131, 0x11127, 0x1112E}, {0x11132, 0x11127, 0x1112F},
+	{0x11347, 0x1133E, 0x1134B}, {0x11347, 0x11357, 0x1134C}, {0x114B9, 0x114B0, 0x114BC},
+	{0x114B9, 0x114BA, 0x114BB}, {0x114B9, 0x114BD, 0x114BE}, {0x115B8, 0x115AF, 0x115BA},
+	{0x115B9, 0x115AF, 0x115BB}
+};
@@ -212,12 +212,14 @@
  *    - \ref length_functions "Length/Size"
  * - String Manipulation
  *    - \ref concatenation_functions "Concatenation"
+ *    - \ref parsing_functions "Parsing"
  *    - \ref transformation_functions "Transformations"
  *    - \ref case_functions "Case Detection & Manipulation"
  *    - \ref insertion_functions "Insertion"
  *    - \ref replacement_functions "Replacement"
  *    - \ref deletion_functions "Deletion"
  *    - \ref trimming_functions "Trimming"
+ *    - \ref padding_functions "Padding"
  *    - \ref reversal_functions "Reversal"
  *    - \ref escaping_functions "Escaping/Unescaping"
  * - Splitting/Joining
@@ -240,6 +242,7 @@
  *    - \ref debug_functions "Debug"
  * - I/O Functions
  *    - \ref io_functions "I/O Functions"
+ *    - \ref line_functions "Line Counting/Indexing"
  * - Locale
  *    - \ref locale_functions "Locale"
  * - Miscellaneous
@@ -259,6 +262,7 @@
  */
 #include <stddef.h> /* used for 'size_t'   */ 
 #include <assert.h> /* used for 'assert()' */
+#include <stdarg.h> /* used for 'va_list'  */
 /*
  * 
  */
@@ -266,11 +270,19 @@
 /**
  * \brief Used as the minimum buffer size for newly-allocated strings. You can
  *        define this yourself if you know your application will be dealing
- *        with mostly larger strings.
+ *        with mostly larger strings. It can't be less than the size of a
+ *        pointer.
  */
 /** \hideinitializer */
 #   define A_MIN_STR_SIZE 16
 #endif
+#ifndef A_READER_SIZE
+/**
+ * \brief The size of the buffer of an ::a_reader.
+ */
+/** \hideinitializer */
+#   define A_READER_SIZE (64 * 1024)
+#endif
 /** 
  * \anchor custom_memory_functions
  * \name Custom Memory
@@ -313,6 +325,49 @@
 #else
 #   include <stdio.h>
 #endif
+#ifndef A_HAVE_MMAP
+    /* strict ISO modes hide the POSIX declarations */
+#   if (defined(__unix__) || defined(__APPLE__)) && !defined(__STRICT_ANSI__)
+#       define A_HAVE_MMAP 1
+#   else
+#       define A_HAVE_MMAP 0
+#   endif
+#endif
+#ifndef A_HAVE_WRITEV
+#   define A_HAVE_WRITEV A_HAVE_MMAP
+#endif
+#ifndef A_WRITER_SIZE
+/**
+ * \brief The size of the buffer of an ::a_writer.
+ */
+/** \hideinitializer */
+#   define A_WRITER_SIZE (64 * 1024)
+#endif
+#ifndef A_APPEND_SEGMENT_SIZE
+/**
+ * \brief The size of the segments of an ::a_append buffer, which holds at
+ *        most 4096 of them.
+ */
+/** \hideinitializer */
+#   define A_APPEND_SEGMENT_SIZE (1024 * 1024)
+#endif
+/**
+ * \brief Defining A_INCLUDE_THREADS to 1 lets the functions that work on
+ *        large inputs split the work across threads (POSIX threads,
+ *        link with -pthread).
+ */
+#ifndef A_INCLUDE_THREADS
+/** \hideinitializer */
+#   define A_INCLUDE_THREADS 0
+#endif
+#ifndef A_THREADS_MIN_SIZE
+/**
+ * \brief The least number of bytes given to a thread; inputs smaller than
+ *        twice that are never split. See a_threads_set().
+ */
+/** \hideinitializer */
+#   define A_THREADS_MIN_SIZE (1024 * 1024)
+#endif
 #ifndef A_INCLUDE_MEM
 #   define A_INCLUDE_MEM 0
 #else
@@ -396,7 +451,25 @@ typedef int a_cp;
  * \brief A struct typdef that hold a temp string pool object.
  */
 typedef struct a_pool *a_pool;
+/**
+ * \brief A struct typedef that holds a pool any thread can collect into.
+ */
+typedef struct a_shared_pool *a_shared_pool;
+/**
+ * \brief A struct typedef that holds a queue of strings to be freed by
+ *        the thread that owns it.
+ */
+typedef struct a_free_queue *a_free_queue;
 #endif
+/**
+ * \brief A single replacement used by a_edit() and a_edit_offset().
+ */
+struct a_edit
+{
+    size_t start;       /**< start of the replaced range           */
+    size_t length;      /**< length of the replaced range          */
+    const char *rep;    /**< replacement, NULL to delete the range */
+};
 /**
  * \brief A sentinel value representing EOS.
  */
@@ -957,6 +1030,14 @@ size_t      a_size(a_cstr s);
 size_t      a_gsize_chr_cstr(const char *str);
 size_t      a_glen(a_cstr str);
 size_t      a_glen_cstr(const char *s);
+/**
+ * \brief Returns the number of display columns needed by the string.
+ * 
+ * East Asian wide and fullwidth characters take two columns, combining
+ * marks, format and control characters take none, everything else one.
+ */
+size_t      a_width(a_cstr str);
+size_t      a_width_cstr(const char *s);
 size_t      a_mem(a_cstr str);
 int         a_is_empty(a_cstr str);
 /*@}*/
@@ -983,6 +1064,58 @@ a_str       a_cat_cp(a_str str, a_cp codepoint);
 a_str       a_cat_norm(a_str str, a_str str2, int mode);
 a_str       a_cat_ulong(a_str str, unsigned long val);
 a_str       a_cat_long(a_str str, long val);
+/**
+ * \brief Appends an array of numbers, separated by \p sep.
+ * 
+ * The space needed is reserved once up front.
+ * 
+ * \param str A pointer to the string to operate on.
+ * \param vals The numbers to append.
+ * \param count The number of elements in \p vals.
+ * \param sep The separator placed between numbers, or NULL.
+ */
+a_str       a_cat_ulong_vec(a_str str, const unsigned long *vals, size_t count, const char *sep);
+a_str       a_cat_long_vec(a_str str, const long *vals, size_t count, const char *sep);
+#if ALEPH_C_V == 2
+/**
+ * \brief Appends the shortest representation of \p val that reads back
+ *        as the same double.
+ * 
+ * The output matches Python's repr(): positional notation with at least
+ * one fractional digit for decimal exponents in [-4, 16), scientific
+ * notation (e.g. 1e+16, 5e-324) otherwise, and "inf", "-inf" and "nan".
+ */
+a_str       a_cat_double(a_str str, double val);
+a_str       a_cat_double_vec(a_str str, const double *vals, size_t count, const char *sep);
+#endif
+/*@}*/
+
+
+/**
+ * \anchor parsing_functions
+ * \name Parsing
+ *
+ * Functions used to read numbers off the front of a string. Any decimal
+ * digit (General_Category=Nd) is accepted, e.g. "\u0661\u0662" parses as
+ * 12, as long as all the digits of a number come from the same script.
+ * None of these functions allocate.
+ *
+ * All of them return the number of bytes consumed, or 0 if \p str doesn't
+ * start with a number. The integer functions return #A_EOS if the value
+ * is out of range, in which case it's clamped to the nearest limit.
+ * @{
+ */
+size_t      a_parse_long(const char *str, size_t size, long *val);
+size_t      a_parse_ulong(const char *str, size_t size, unsigned long *val);
+/**
+ * \brief Parses a decimal floating point number.
+ * 
+ * Accepts an optional sign, digits with an optional '.', an optional
+ * exponent ("e" followed by digits), as well as "inf", "infinity" and
+ * "nan" in any case. The result is correctly rounded; values out of
+ * range become infinity or zero.
+ */
+size_t      a_parse_double(const char *str, size_t size, double *val);
 /*@}*/
 
 
@@ -1055,6 +1188,24 @@ a_str       a_rep_all_cp(a_str str, a_cp oldcp, a_cp newcp);
  */
 a_str       a_del(a_str str, size_t start, size_t length);
 a_str       a_del_offset(a_str str, size_t start, size_t length);
+/**
+ * \brief Applies a list of edits to a string in a single pass.
+ * 
+ * Every edit replaces \p length code points starting at \p start with
+ * \p rep (or deletes them if \p rep is NULL). The edits must be sorted
+ * by \p start and must not overlap; all positions refer to the original
+ * string. The string is compacted in place whenever possible, otherwise
+ * it is rebuilt once at its exact final size.
+ * 
+ * \param str A pointer to the string to operate on.
+ * \param edits An array of edits.
+ * \param count The number of edits in \p edits.
+ * 
+ * \return \p str with all the edits applied or NULL on failure, in which
+ *         case \p str is freed.
+ */
+a_str       a_edit(a_str str, const struct a_edit *edits, size_t count);
+a_str       a_edit_offset(a_str str, const struct a_edit *edits, size_t count);
 /*@}*/
 
 
@@ -1118,7 +1269,8 @@ a_str       a_ensure(a_str str, size_t l);
  * \name Substring Counting
  *
  * Various functions used to count the number of delimiters/substrings
- * found in the original string.
+ * found in the original string. Occurrences of a substring don't overlap,
+ * "aaaa" has two "aa".
  * @{
  */
 size_t      a_count(a_cstr str, a_cstr delmiters);
@@ -1141,6 +1293,13 @@ size_t      a_icount_substr_cstr_cstr(const char *str, const char *substr);
  * \name Substring Extraction
  *
  * Various functions used to extract a substring from a string.
+ *
+ * A negative \a start counts back from the end of the string and a negative
+ * \a length leaves that many code points (bytes for the _offset variants)
+ * off the end. Out of range arguments are clamped. The _offset variants
+ * never walk the string, and the _inplace variants never allocate.
+ * a_substr_between_cstr() yields an empty string if either delimiter
+ * can't be found.
  * @{
  */
 a_str       a_substr(a_cstr str, long start, long length);
@@ -1174,6 +1333,38 @@ a_str       a_trim_right_cstr(a_str str, const char *chars);
 /*@}*/
 
 
+/** 
+ * \anchor padding_functions
+ * \name Padding
+ *
+ * Functions used to pad a string up to a given width with a fill
+ * character, and to repeat a string. The width is measured according to
+ * \ref a_pad_options: in code points, in graphemes or in display
+ * columns (see a_width()). A fill character that is two columns wide
+ * never overshoots the width; the string may then come up one column
+ * short. The result is sized exactly and written in a single pass.
+ * @{
+ */
+enum a_pad_options
+{
+    a_pad_cp       = 0x00,
+    a_pad_grapheme = 0x01,
+    a_pad_columns  = 0x02
+};
+a_str       a_pad_left(a_str str, size_t width, const char *chr, int opts);
+a_str       a_pad_right(a_str str, size_t width, const char *chr, int opts);
+/**
+ * \brief Pads both sides of \p str, the right side gets the extra fill
+ *        character if the padding is odd.
+ */
+a_str       a_center(a_str str, size_t width, const char *chr, int opts);
+/**
+ * \brief Replaces \p str with \p count copies of itself.
+ */
+a_str       a_repeat(a_str str, size_t count);
+/*@}*/
+
+
 /** 
  * \anchor matching_functions
  * \name Matching
@@ -1231,7 +1422,16 @@ size_t      a_find_offset(a_cstr str, a_cstr substr);
 size_t      a_find_offset_cstr(a_cstr str, const char *substr);/*
 size_t      a_find_offset_cp(a_cstr str, a_cp codepoint);*/
 size_t      a_find_offset_from(a_cstr str, a_cstr substr, size_t offset);
-size_t      a_find_offset_from_cstr(a_cstr str, const char *substr, size_t offset);/*
+size_t      a_find_offset_from_cstr(a_cstr str, const char *substr, size_t offset);
+/**
+ * \brief Finds every (non-overlapping) occurrence of \p substr and returns
+ *        their number; the offsets of the first \p max ones are stored to
+ *        \p offsets.
+ * 
+ * Call it with a \p max of 0 first to size the array.
+ */
+size_t      a_find_all_offset(a_cstr str, a_cstr substr, size_t *offsets, size_t max);
+size_t      a_find_all_offset_cstr(a_cstr str, const char *substr, size_t *offsets, size_t max);/*
 size_t      a_find_offset_from_cp(a_cstr str, a_cp codepoint, size_t offset);
 size_t      a_rfind(a_cstr str, a_cstr substr);
 size_t      a_rfind_cstr(a_cstr str, const char *substr);
@@ -1358,9 +1558,67 @@ a_str       a_greverse_str(a_cstr str, a_str output);
  * 
  * @{
  */
-a_str       a_escape(a_str str); /* escape '\b', '\f', '\n', '\r', '\t', '\v', '\' and '"'; 0x01-0x1F, and 0x7F-0xFF  */
+a_str       a_escape(a_str str); /* escape '\b', '\f', '\n', '\r', '\t', '\v', '\' and '"'; 0x00-0x1F, and 0x7F  */
 a_str       a_escape_except(a_str str, const char *except);
+/**
+ * \brief Escapes a string for a C or JSON string literal.
+ * 
+ * Control characters, '"' and '\' are always escaped. In C mode, 0x7F
+ * is escaped too and characters without a short escape use 3 digit
+ * octal escapes; in JSON mode they use \\u00XX. With #a_escape_ascii,
+ * every non-ASCII character is escaped as well, using \\uXXXX
+ * (surrogate pairs in JSON mode, \\UXXXXXXXX in C mode beyond the BMP).
+ * 
+ * \param str A pointer to the string to operate on.
+ * \param except ASCII characters that must not be escaped, or NULL.
+ * \param opts A combination of ::a_escape_options.
+ * 
+ * \return The escaped string or NULL on failure, in which case \p str
+ *         is freed. \p str is returned as is if nothing needs escaping.
+ */
+a_str       a_escape_opts(a_str str, const char *except, int opts);
+/**
+ * \brief Unescapes a string in place.
+ * 
+ * Understands the C and JSON escape sequences, including octal, \\xHH,
+ * \\UXXXXXXXX and \\uXXXX escapes. Surrogate pairs are combined, lone
+ * surrogates decode to U+FFFD.
+ */
 a_str       a_unescape(a_str str);
+enum a_escape_options
+{
+    a_escape_c     = 0x00,
+    a_escape_json  = 0x01,
+    a_escape_ascii = 0x02
+};
+/*@}*/
+
+
+/** 
+ * \anchor url_encoding_functions
+ * \name URL Encoding/Decoding
+ *
+ * Functions used to percent-encode and decode a string.
+ * 
+ * a_url_encode() leaves the characters allowed by the selected mode as is
+ * and percent-encodes every other byte; #a_url_form also turns spaces into
+ * '+'. a_url_decode() decodes in place and leaves malformed escapes alone;
+ * with #a_url_form it turns '+' into spaces, and with #a_url_validate it
+ * frees the string and returns NULL if the decoded bytes aren't valid
+ * UTF-8.
+ * 
+ * @{
+ */
+a_str       a_url_encode(a_str str, int opts);
+a_str       a_url_decode(a_str str, int opts);
+enum a_url_options
+{
+    a_url_component = 0x00, /* only unreserved characters are kept (RFC 3986) */
+    a_url_path      = 0x01, /* also keep sub-delims, ':', '@' and '/'          */
+    a_url_query     = 0x02, /* also keep sub-delims, ':', '@', '/' and '?'     */
+    a_url_form      = 0x03, /* application/x-www-form-urlencoded               */
+    a_url_validate  = 0x10  /* decoding only: require valid UTF-8              */
+};
 /*@}*/
 
 
@@ -1375,14 +1633,728 @@ a_str       a_unescape(a_str str);
  * @{
  */
 a_str       a_file_read(FILE *fp);
+/**
+ * \brief Text encodings understood by a_file_read_enc() and
+ *        a_reader_new_enc().
+ */
+enum a_encoding
+{
+    a_encoding_detect  = 0x00, /* look for a BOM, guess without one */
+    a_encoding_utf8    = 0x01,
+    a_encoding_utf16le = 0x02,
+    a_encoding_utf16be = 0x03,
+    a_encoding_latin1  = 0x04
+};
+/**
+ * \brief Reads the rest of \p fp, converting it from its encoding.
+ * 
+ * The input is decoded a block at a time straight into the result. A BOM
+ * is skipped, anything that can't be decoded becomes U+FFFD, so the result
+ * is always valid UTF-8.
+ * 
+ * When \p enc is NULL or points to #a_encoding_detect, the encoding is
+ * taken from the BOM, or guessed from the first block: many zero bytes in
+ * the even or odd positions mean UTF-16, valid UTF-8 means UTF-8, and
+ * anything else is read as Latin-1.
+ * 
+ * \param fp The stream to read.
+ * \param enc The encoding (an \ref a_encoding), receives the one used.
+ */
+a_str       a_file_read_enc(FILE *fp, int *enc);
+enum a_file_map_options
+{
+    a_file_map_no_options = 0x00,
+    a_file_map_validate   = 0x01  /* fail unless the whole file is valid UTF-8 */
+};
+/**
+ * \brief Maps a file into memory as a read-only string, without copying it.
+ * 
+ * The header lives in its own page right before the mapping and the file
+ * is followed by zeroes, so the result is a regular, NUL terminated
+ * string to every function that doesn't modify it. The length in code
+ * points is only counted on the first call to a_len().
+ * 
+ * Release it with a_file_unmap() or a_free(). Where mmap() isn't
+ * available (#A_HAVE_MMAP is 0), the file is read into memory instead.
+ * 
+ * \param path The path of the file to map.
+ * \param opts A combination of \ref a_file_map_options.
+ * \return The string, or NULL if the file couldn't be mapped (or isn't
+ *         valid UTF-8 when asked to validate).
+ */
+a_cstr      a_file_map(const char *path, int opts);
+#if A_HAVE_MMAP || defined(DOXYGEN_DOCS)
+/**
+ * \brief Maps the file open on \p fd, as a_file_map() does. Only available
+ *        with mmap() (#A_HAVE_MMAP).
+ */
+a_cstr      a_file_map_fd(int fd, int opts);
+#endif
+void        a_file_unmap(a_cstr str);
+/**
+ * \brief Reads up to the next \p delim ("\\n" for a_file_readline()).
+ * 
+ * The delimiter is consumed but not stored. The _str version reuses the
+ * buffer of \p str (which may be NULL) instead of allocating a new one.
+ * 
+ * \return The line, or NULL at the end of the input (\p str is freed).
+ */
 a_str       a_file_readline(FILE *fp);
 a_str       a_file_readline_delim(FILE *fp, const char *delim);
 a_str       a_file_readline_delim_str(FILE *fp, const char *delim, a_str str);
+/**
+ * \brief A struct typedef that holds a buffered line reader.
+ */
+typedef struct a_reader *a_reader;
+/**
+ * \brief Creates a reader that pulls \p fp through its own buffer.
+ * 
+ * The stream is read in large blocks (see #A_READER_SIZE), so that the
+ * locking and call overhead of stdio is paid once per block instead of
+ * once per character. The stream must not be read by other means while
+ * the reader is in use.
+ */
+a_reader    a_reader_new(FILE *fp);
+/**
+ * \brief Creates a reader that decodes \p fp like a_file_read_enc() does,
+ *        block by block as lines are read.
+ */
+a_reader    a_reader_new_enc(FILE *fp, int enc);
+/**
+ * \brief Returns the (possibly detected) encoding the reader decodes.
+ */
+int         a_reader_encoding(a_reader r);
+void        a_reader_free(a_reader r);
+#if A_HAVE_WRITEV == 1
+/**
+ * \brief Writes \p count strings to \p fd as one, without joining them.
+ * 
+ * The strings are handed to writev() in batches; partial writes and
+ * interruptions are resumed until everything is written.
+ * 
+ * \return 1 on success, 0 on a write error (with errno set).
+ */
+int         a_write_vec(int fd, const a_cstr *strs, size_t count);
+/**
+ * \brief Like a_write_vec(), for arbitrary spans of memory.
+ */
+int         a_write_size_vec(int fd, const char *const *ptrs, const size_t *sizes, size_t count);
+/**
+ * \brief A struct typedef that holds a buffered writer.
+ */
+typedef struct a_writer *a_writer;
+/**
+ * \brief Creates a writer that collects small pieces in a buffer (see
+ *        #A_WRITER_SIZE) before writing them to \p fd.
+ * 
+ * Large pieces aren't copied: they are written together with whatever is
+ * buffered in a single writev().
+ */
+a_writer    a_writer_new(int fd);
+int         a_writer_put(a_writer w, a_cstr str);
+int         a_writer_put_cstr(a_writer w, const char *str);
+int         a_writer_put_size(a_writer w, const char *str, size_t size);
+int         a_writer_flush(a_writer w);
+/**
+ * \brief Flushes and frees the writer, returns 0 if the flush failed.
+ */
+int         a_writer_free(a_writer w);
+#endif
+/**
+ * \brief Reads the next line from \p r into \p str.
+ * 
+ * Works like a_file_readline_delim_str(); the delimiter is searched with
+ * memchr() or the substring search, and the length in code points is
+ * counted as the line is copied out.
+ * 
+ * \code
+ * a_str line = NULL;
+ * while ((line = a_reader_line(r, "\n", line)))
+ *     process(line);
+ * \endcode
+ */
+a_str       a_reader_line(a_reader r, const char *delim, a_str str);
+/**
+ * \brief Counts the lines from the current position of \p fp to its end.
+ * 
+ * Regular files are mapped and counted with a_line_count(), other streams
+ * are read through. A last line without a '\\n' counts as well.
+ */
 size_t      a_file_line_count(FILE *fp);
 #endif
 /*@}*/
 
 
+/**
+ * \anchor line_functions
+ * \name Line Counting/Indexing
+ *
+ * Functions used to count the lines of large texts (e.g. files mapped
+ * with a_file_map()) and to find the start of any line quickly. When
+ * #A_INCLUDE_THREADS is 1, large texts are split across threads (see
+ * a_threads_set()).
+ * 
+ * A line index keeps the offset of every \p every th line; finding a line
+ * takes one lookup and a scan over at most \p every - 1 lines. It can be
+ * saved alongside the text and read back instead of being rebuilt.
+ * @{
+ */
+/**
+ * \brief A struct typedef that holds a line index.
+ */
+typedef struct a_line_index *a_line_index;
+size_t          a_line_count(const char *s, size_t size);
+a_line_index    a_line_index_new(const char *s, size_t size, size_t every);
+void            a_line_index_free(a_line_index idx);
+size_t          a_line_index_lines(a_line_index idx);
+/**
+ * \brief Returns the offset of the start of line \p line (counting from 0)
+ *        in \p s, the text the index was built from, or #A_EOS.
+ */
+size_t          a_line_index_offset(a_line_index idx, const char *s, size_t line);
+#if A_INCLUDE_IO == 1
+/**
+ * \brief Saves the index to \p fp, returns 0 on failure.
+ * 
+ * The format is native (size_t width and byte order), it's meant to be
+ * read back on the same machine.
+ */
+int             a_line_index_write(a_line_index idx, FILE *fp);
+/**
+ * \brief Reads an index saved by a_line_index_write(), or returns NULL if
+ *        it is invalid or wasn't built for a text of \p size bytes.
+ */
+a_line_index    a_line_index_read(FILE *fp, size_t size);
+#endif
+/*@}*/
+
+
+/**
+ * \anchor thread_functions
+ * \name Threads
+ *
+ * When #A_INCLUDE_THREADS is 1, the functions that go over a whole string
+ * split large ones into chunks (on code point boundaries) and run them on
+ * a small pool of threads, then stitch the results together. That's the
+ * case for a_len() and a_len_cstr(), a_is_valid_utf8(), the a_count_cp()
+ * and a_count_substr() families, a_find_all_offset(), a_to_upper(),
+ * a_to_lower() and a_escape_opts() (and the functions built on them), as
+ * well as the line functions. The pool is started the first time it is
+ * needed; only one call uses it at a time, other ones meanwhile run on
+ * their own thread.
+ * @{
+ */
+/**
+ * \brief Sets the number of threads used on a large string and the least
+ *        number of bytes given to each.
+ * 
+ * A \p count of 0 means one per processor (the default), 1 turns the
+ * splitting off. A \p min_size of 0 means #A_THREADS_MIN_SIZE. Strings of
+ * less than twice \p min_size bytes always run on the calling thread, so
+ * that small ones never pay for the dispatch.
+ * 
+ * Stops the threads of the pool, they are started again when next
+ * needed. Not meant to be called while other threads use the library.
+ * Without #A_INCLUDE_THREADS, it has no effect.
+ */
+void            a_threads_set(size_t count, size_t min_size);
+/*@}*/
+
+
+/**
+ * \anchor vector_functions
+ * \name Vector Transforms
+ *
+ * Functions that apply the same transform to \p count strings at once,
+ * replacing each of them like the single string function would. The
+ * arguments and the locale are checked once for the whole vector, and
+ * the strings are transformed in place whenever their buffer is large
+ * enough. When #A_INCLUDE_THREADS is 1, large vectors are split across
+ * threads (see a_threads_set()).
+ * 
+ * None of the strings may be NULL.
+ * @{
+ */
+/**
+ * \brief Lowercases every string, see a_to_lower().
+ * 
+ * \return 1, or 0 if a string couldn't be transformed; it was then left
+ *         as it was, or freed and set to NULL if growing it failed.
+ */
+int             a_vec_to_lower(a_str *strv, size_t count);
+int             a_vec_to_upper(a_str *strv, size_t count);
+int             a_vec_to_fold(a_str *strv, size_t count);
+int             a_vec_trim(a_str *strv, size_t count);
+/**
+ * \brief Returns the number of strings that aren't valid UTF-8.
+ * 
+ * If \p offsets isn't NULL, offsets[i] receives the offset of the first
+ * invalid byte of strv[i], or #A_EOS.
+ */
+size_t          a_vec_validate(a_str *strv, size_t count, size_t *offsets);
+/**
+ * \brief Stores a_hash() of every string to \p hashes.
+ */
+void            a_vec_hash(a_str *strv, size_t count, unsigned long *hashes);
+/*@}*/
+
+
+/**
+ * \anchor interning_functions
+ * \name Interning
+ *
+ * An intern table keeps a single copy of every distinct string given to
+ * it: equal strings are interned to the same pointer, so comparing two
+ * interned strings only takes comparing pointers. Interned strings are
+ * immutable and reference counted; each a_intern() or a_intern_ref() is
+ * matched by an a_intern_release(), never by a_free(). The table is split
+ * into shards with a lock of their own, any number of threads can use it
+ * at once.
+ * @{
+ */
+/**
+ * \brief A struct typedef that holds an intern table.
+ */
+typedef struct a_intern_table *a_intern_table;
+a_intern_table  a_intern_table_new(void);
+/**
+ * \brief Frees the table and every string still in it.
+ */
+void            a_intern_table_free(a_intern_table t);
+/**
+ * \brief Returns the number of distinct strings in the table.
+ */
+size_t          a_intern_table_count(a_intern_table t);
+/**
+ * \brief Returns the interned copy of \p str, made on first use, with one
+ *        more reference; NULL on failure.
+ */
+a_cstr          a_intern(a_intern_table t, a_cstr str);
+a_cstr          a_intern_cstr(a_intern_table t, const char *str);
+a_cstr          a_intern_size(a_intern_table t, const char *str, size_t size);
+/**
+ * \brief Adds a reference to an interned string and returns it.
+ */
+a_cstr          a_intern_ref(a_intern_table t, a_cstr interned);
+/**
+ * \brief Drops a reference, the last one frees the string.
+ */
+void            a_intern_release(a_intern_table t, a_cstr interned);
+/**
+ * \brief Returns the hash of an interned string, kept with it; the same as
+ *        a_hash().
+ */
+unsigned long   a_intern_hash(a_cstr interned);
+/*@}*/
+
+
+/**
+ * \anchor append_functions
+ * \name Concurrent Appending
+ *
+ * An append buffer assembles text put by any number of threads at once,
+ * such as a shared log. Each put reserves its range with a single atomic
+ * add and copies into it, so appenders never wait on each other; the
+ * pieces land in segments of #A_APPEND_SEGMENT_SIZE bytes which keep
+ * their own count of code points. A single thread flushes: everything up
+ * to the first segment still being written goes out, and the rest of it
+ * as well once no put is under way. A put is never interleaved with
+ * another put, but one that runs over the end of a segment may be split
+ * between two flushes (even within a code point): only a flush made while
+ * no put is under way is sure to end on a whole put.
+ * @{
+ */
+/**
+ * \brief A struct typedef that holds an append buffer.
+ */
+typedef struct a_append *a_append;
+a_append    a_append_new(void);
+/**
+ * \brief Frees the buffer, along with whatever wasn't flushed.
+ */
+void        a_append_free(a_append a);
+/**
+ * \brief Appends \p str, from any thread.
+ * 
+ * \return 1 on success, 0 if the buffer is full (4096 segments not yet
+ *         flushed) or out of memory, after which it keeps everything
+ *         before the failed put flushable but nothing after it.
+ */
+int         a_append_put(a_append a, a_cstr str);
+int         a_append_put_cstr(a_append a, const char *str);
+int         a_append_put_size(a_append a, const char *str, size_t size);
+/**
+ * \brief Returns the number of bytes put so far, flushed or not.
+ */
+size_t      a_append_size(a_append a);
+/**
+ * \brief Appends what can be flushed to \p str, from the thread that
+ *        flushes.
+ * 
+ * \return The string, or NULL on failure (\p str is then freed, and the
+ *         pieces not flushed yet stay in the buffer).
+ */
+a_str       a_append_flush(a_append a, a_str str);
+#if A_INCLUDE_IO == 1 && A_HAVE_WRITEV == 1
+/**
+ * \brief Writes what can be flushed to \p fd, from the thread that
+ *        flushes; returns 0 on a write error (with errno set).
+ */
+int         a_append_flush_fd(a_append a, int fd);
+#endif
+/*@}*/
+
+
+/**
+ * \anchor map_functions
+ * \name Maps
+ *
+ * A hash map from strings to pointers. Keys are copied into blocks owned
+ * by the map, so adding one rarely allocates, and stay there until the
+ * map is freed (a removed key keeps its place). The keys handed back are
+ * strings of the map, valid as long as it is, and never to be modified
+ * or freed. A map made with a_map_new_icase() matches keys like a_icmp()
+ * does, by their case folding; its keys must not be added and looked up
+ * under different locales.
+ * @{
+ */
+/**
+ * \brief A struct typedef that holds a map.
+ */
+typedef struct a_map *a_map;
+a_map       a_map_new(void);
+a_map       a_map_new_icase(void);
+void        a_map_free(a_map m);
+size_t      a_map_count(a_map m);
+/**
+ * \brief Maps \p key to \p value, replacing what it was mapped to.
+ * 
+ * \return 1 on success, 0 when out of memory.
+ */
+int         a_map_set(a_map m, a_cstr key, void *value);
+int         a_map_set_cstr(a_map m, const char *key, void *value);
+int         a_map_set_size(a_map m, const char *key, size_t size, void *value);
+/**
+ * \brief Returns what \p key is mapped to, NULL if it isn't.
+ */
+void       *a_map_get(a_map m, a_cstr key);
+void       *a_map_get_cstr(a_map m, const char *key);
+void       *a_map_get_size(a_map m, const char *key, size_t size);
+/**
+ * \brief Returns the key of the map equal to \p key, NULL if there is
+ *        none; tells a key mapped to NULL from a missing one.
+ */
+a_cstr      a_map_key(a_map m, a_cstr key);
+a_cstr      a_map_key_cstr(a_map m, const char *key);
+a_cstr      a_map_key_size(a_map m, const char *key, size_t size);
+/**
+ * \brief Removes \p key, returns 0 if it wasn't there.
+ */
+int         a_map_remove(a_map m, a_cstr key);
+int         a_map_remove_cstr(a_map m, const char *key);
+int         a_map_remove_size(a_map m, const char *key, size_t size);
+/**
+ * \brief Iterates over the map, in no particular order.
+ * 
+ * \p iter starts at 0. Each call stores the next key and value to \p key
+ * and \p value (either may be NULL) and returns 1, or returns 0 once all
+ * have been seen. The map must not be changed meanwhile, except for
+ * removing the key just returned.
+ */
+int         a_map_next(a_map m, size_t *iter, a_cstr *key, void **value);
+/*@}*/
+
+
+/**
+ * \anchor trie_functions
+ * \name Tries
+ *
+ * A trie maps strings to pointers like a map does, and also finds the
+ * keys that start a string (the longest one, as for routing) or that a
+ * string starts (all of them, as for completion) without going through
+ * every key. A trie made with a_trie_new_icase() matches keys like
+ * a_istartswith() does, by their case folding; its keys must not be added
+ * and looked up under different locales.
+ * @{
+ */
+/**
+ * \brief A struct typedef that holds a trie.
+ */
+typedef struct a_trie *a_trie;
+a_trie      a_trie_new(void);
+a_trie      a_trie_new_icase(void);
+void        a_trie_free(a_trie t);
+/**
+ * \brief Returns the number of keys in the trie.
+ */
+size_t      a_trie_count(a_trie t);
+/**
+ * \brief Maps \p key to \p value, replacing what it was mapped to.
+ * 
+ * \return 1 on success, 0 when out of memory.
+ */
+int         a_trie_set(a_trie t, a_cstr key, void *value);
+int         a_trie_set_cstr(a_trie t, const char *key, void *value);
+int         a_trie_set_size(a_trie t, const char *key, size_t size, void *value);
+/**
+ * \brief Returns what \p key is mapped to, NULL if it isn't.
+ */
+void       *a_trie_get(a_trie t, a_cstr key);
+void       *a_trie_get_cstr(a_trie t, const char *key);
+void       *a_trie_get_size(a_trie t, const char *key, size_t size);
+/**
+ * \brief Finds the longest key that \p str starts with.
+ * 
+ * Stores the key (as it was added) to \p key and its value to \p value,
+ * either of which may be NULL. In a case insensitive trie, a key may end
+ * inside the folding of a code point of \p str (as "s" starts "\xC3\x9F"),
+ * the match then takes that code point whole.
+ * 
+ * \return The number of bytes of \p str matched, #A_EOS if no key
+ *         starts it.
+ */
+size_t      a_trie_longest_prefix(a_trie t, a_cstr str, a_cstr *key, void **value);
+size_t      a_trie_longest_prefix_cstr(a_trie t, const char *str, a_cstr *key, void **value);
+size_t      a_trie_longest_prefix_size(a_trie t, const char *str, size_t size, a_cstr *key, void **value);
+/**
+ * \brief Calls \p fn on every key that starts with \p prefix, in order of
+ *        their (folded) bytes, until it returns 0.
+ * 
+ * \return The number of calls made.
+ */
+size_t      a_trie_each_prefixed(a_trie t, a_cstr prefix,
+                                 int (*fn)(a_cstr key, void *value, void *ctx), void *ctx);
+size_t      a_trie_each_prefixed_cstr(a_trie t, const char *prefix,
+                                      int (*fn)(a_cstr key, void *value, void *ctx), void *ctx);
+size_t      a_trie_each_prefixed_size(a_trie t, const char *prefix, size_t size,
+                                      int (*fn)(a_cstr key, void *value, void *ctx), void *ctx);
+/*@}*/
+
+
+/**
+ * \anchor suffix_index_functions
+ * \name Suffix Indexes
+ *
+ * A suffix index is built once over a string, or a set of them, and then
+ * answers any number of substring queries with a binary search instead of
+ * a scan: a query compares the pattern at most once per step, so it costs
+ * no more than the size of the pattern times the logarithm of the text,
+ * and finding the first occurrence adds a constant. The index keeps a
+ * copy of the text, a sorted array of its suffixes and the minima of
+ * blocks of it, about 10 bytes per byte on 64 bit targets. Large texts are sorted on several threads.
+ *
+ * The strings of a set are indexed as if joined, each followed by a
+ * '\0'; offsets are into that joined text, a_suffix_index_doc() tells
+ * which string one falls in. Unlike a_count_substr(), occurrences may
+ * overlap.
+ * @{
+ */
+/**
+ * \brief Options of a_suffix_index_new().
+ */
+enum a_suffix_index_options
+{
+    a_suffix_index_no_options = 0x00,
+    a_suffix_index_icase      = 0x01  /* match like a_ifind(), by case folding */
+};
+/**
+ * \brief A struct typedef that holds a suffix index.
+ */
+typedef struct a_suffix_index *a_suffix_index;
+a_suffix_index  a_suffix_index_new(a_cstr str, int options);
+a_suffix_index  a_suffix_index_new_vec(const a_cstr *strv, size_t count, int options);
+void            a_suffix_index_free(a_suffix_index idx);
+/**
+ * \brief Returns the offset of the first occurrence of \p pattern, or
+ *        #A_EOS.
+ */
+size_t          a_suffix_index_find(a_suffix_index idx, a_cstr pattern);
+size_t          a_suffix_index_find_cstr(a_suffix_index idx, const char *pattern);
+size_t          a_suffix_index_find_size(a_suffix_index idx, const char *pattern, size_t size);
+/**
+ * \brief Returns the number of occurrences of \p pattern.
+ */
+size_t          a_suffix_index_count(a_suffix_index idx, a_cstr pattern);
+size_t          a_suffix_index_count_cstr(a_suffix_index idx, const char *pattern);
+size_t          a_suffix_index_count_size(a_suffix_index idx, const char *pattern, size_t size);
+/**
+ * \brief Returns the number of occurrences of \p pattern, and stores the
+ *        offsets of \p max of them, in order, to \p offsets.
+ * 
+ * When there are more than \p max, which ones are stored is unspecified.
+ */
+size_t          a_suffix_index_locate(a_suffix_index idx, a_cstr pattern, size_t *offsets, size_t max);
+size_t          a_suffix_index_locate_cstr(a_suffix_index idx, const char *pattern,
+                                           size_t *offsets, size_t max);
+size_t          a_suffix_index_locate_size(a_suffix_index idx, const char *pattern, size_t size,
+                                           size_t *offsets, size_t max);
+/**
+ * \brief Returns the index of the string \p offset falls in, and stores
+ *        the offset within it to \p doc_offset (if not NULL); #A_EOS past
+ *        the end.
+ */
+size_t          a_suffix_index_doc(a_suffix_index idx, size_t offset, size_t *doc_offset);
+/*@}*/
+
+
+/**
+ * \anchor sketch_functions
+ * \name Similarity Sketches
+ *
+ * Sketches for finding near duplicates among many strings without
+ * comparing them pairwise. Both are computed over the shingles of a
+ * string, its runs of \p n consecutive code points (or grapheme clusters),
+ * in a single pass: units whose general category is in the mask \p skip
+ * (e.g. a_gc_punctuation | a_gc_separator) are left out as if they were
+ * not there, and no intermediate string is built. A string shorter than
+ * \p n units is a single shingle.
+ *
+ * The fraction of equal entries of two MinHash signatures estimates the
+ * Jaccard similarity of the sets of shingles; signatures of the same \p k
+ * can be stored and compared later. Similar strings have SimHashes that
+ * differ in few bits.
+ * @{
+ */
+/**
+ * \brief Options of a_minhash() and a_simhash().
+ */
+enum a_shingle_options
+{
+    a_shingle_cp       = 0x00,  /* shingles of code points              */
+    a_shingle_grapheme = 0x01,  /* shingles of grapheme clusters        */
+    a_shingle_fold     = 0x02   /* case fold, like a_ifind()            */
+};
+/**
+ * \brief Stores the MinHash signature of \p str, \p k values, to \p sig.
+ *        Returns the number of shingles.
+ */
+size_t          a_minhash(a_cstr str, size_t n, int options, int skip, unsigned long *sig, size_t k);
+size_t          a_minhash_cstr(const char *str, size_t n, int options, int skip, unsigned long *sig, size_t k);
+/**
+ * \brief Returns the estimated similarity of two signatures, from 0 to 1.
+ */
+double          a_minhash_similarity(const unsigned long *sig1, const unsigned long *sig2, size_t k);
+/**
+ * \brief Returns the SimHash of \p str.
+ */
+unsigned long   a_simhash(a_cstr str, size_t n, int options, int skip);
+unsigned long   a_simhash_cstr(const char *str, size_t n, int options, int skip);
+/**
+ * \brief Returns the number of bits two SimHashes differ in.
+ */
+int             a_simhash_distance(unsigned long hash1, unsigned long hash2);
+/*@}*/
+
+
+/**
+ * \anchor pipeline_functions
+ * \name Pipelines
+ *
+ * A pipeline turns documents into tokens for indexing in a single pass,
+ * with no intermediate strings: the stages chosen when it is created
+ * (normalization, case folding, stripping of marks, dropping code points
+ * by category, word segmentation) are applied to each code point as it is
+ * read, and each token is handed to a callback along with the byte range
+ * of the document it came from. The stages always run in that order;
+ * without #a_pipeline_words the whole document is a single token.
+ *
+ * A pipeline is not changed by running it, so several threads can share
+ * one. Folding follows the locale at the time it is created.
+ * @{
+ */
+/**
+ * \brief Stages of a_pipeline_new().
+ */
+enum a_pipeline_stages
+{
+    a_pipeline_no_stages   = 0x00,
+    a_pipeline_nfc         = 0x01,  /* normalize to NFC                     */
+    a_pipeline_nfkc        = 0x02,  /* normalize to NFKC                    */
+    a_pipeline_fold        = 0x04,  /* case fold, like a_to_fold()          */
+    a_pipeline_strip_marks = 0x08,  /* drop nonspacing marks, e.g. accents  */
+    a_pipeline_words       = 0x10   /* emit words instead of the whole text */
+};
+/**
+ * \brief A struct typedef that holds a pipeline.
+ */
+typedef struct a_pipeline *a_pipeline;
+/**
+ * \brief Returns a pipeline running \p stages, that drops the code points
+ *        whose general category is in the mask \p drop (0 for none).
+ */
+a_pipeline  a_pipeline_new(int stages, int drop);
+void        a_pipeline_free(a_pipeline p);
+/**
+ * \brief Runs a pipeline over \p str, calls \p fn with every token (a
+ *        NUL terminated buffer, reused after \p fn returns), its size and
+ *        the range of bytes of \p str it came from. Stops when \p fn
+ *        returns 0. Returns the number of tokens, #A_EOS if out of memory.
+ */
+size_t      a_pipeline_run(a_pipeline p, a_cstr str,
+                           int (*fn)(const char *token, size_t size, size_t start, size_t end, void *ctx),
+                           void *ctx);
+size_t      a_pipeline_run_cstr(a_pipeline p, const char *str,
+                                int (*fn)(const char *token, size_t size, size_t start, size_t end, void *ctx),
+                                void *ctx);
+size_t      a_pipeline_run_size(a_pipeline p, const char *str, size_t size,
+                                int (*fn)(const char *token, size_t size, size_t start, size_t end, void *ctx),
+                                void *ctx);
+/*@}*/
+
+
+/**
+ * \anchor diff_functions
+ * \name Diffing
+ *
+ * Finds the shortest edit script turning one string into another, in
+ * units that never split a UTF-8 sequence: code points, grapheme
+ * clusters, or words (runs of letters and digits, runs of spaces, and
+ * anything else a code point at a time). The script is reported as runs
+ * of byte ranges, in order: a_diff_equal runs cover the same bytes of
+ * both, a_diff_delete runs bytes of the first only (at a position of the
+ * second) and a_diff_insert runs bytes of the second only (at a position
+ * of the first). Between two equal runs, a delete comes before an insert.
+ *
+ * Myers' O(ND) algorithm, in linear space for large inputs; the common
+ * start and end of the strings are skipped without cutting them into
+ * units.
+ * @{
+ */
+/**
+ * \brief Options of a_diff().
+ */
+enum a_diff_options
+{
+    a_diff_cp       = 0x00,     /* code points      */
+    a_diff_grapheme = 0x01,     /* grapheme clusters */
+    a_diff_words    = 0x02      /* words            */
+};
+/**
+ * \brief The runs of an edit script.
+ */
+enum a_diff_ops
+{
+    a_diff_equal,
+    a_diff_delete,
+    a_diff_insert
+};
+/**
+ * \brief Calls \p fn with every run of the edit script from \p str1 to
+ *        \p str2, until it returns 0. Returns the number of units deleted
+ *        and inserted, #A_EOS if out of memory.
+ */
+size_t      a_diff(a_cstr str1, a_cstr str2, int options,
+                   int (*fn)(int op, size_t start1, size_t end1, size_t start2, size_t end2, void *ctx),
+                   void *ctx);
+size_t      a_diff_cstr(const char *str1, const char *str2, int options,
+                        int (*fn)(int op, size_t start1, size_t end1, size_t start2, size_t end2, void *ctx),
+                        void *ctx);
+size_t      a_diff_size(const char *str1, size_t size1, const char *str2, size_t size2, int options,
+                        int (*fn)(int op, size_t start1, size_t end1, size_t start2, size_t end2, void *ctx),
+                        void *ctx);
+/*@}*/
+
+
 #if A_INCLUDE_MEM == 1 || defined(DOXYGEN_DOCS)
 /** 
  * \anchor gc_functions
@@ -1401,18 +2373,70 @@ a_pool      a_gc_new();
 #define     a_gc_done() a_gc_free(a_tmp_pool)
 #define     a_(s) a_gc_collect(&a_tmp_pool, s)
 #define     A_(p, s) a_gc_collect(&p, s)
+/**
+ * \brief A pool like the above, which any number of threads can collect
+ *        into at the same time (under a lock when #A_INCLUDE_THREADS is 1).
+ */
+a_shared_pool   a_gc_shared_new(void);
+a_str           a_gc_shared_collect(a_shared_pool pool, a_str str);
+void            a_gc_shared_free(a_shared_pool pool);
+/**
+ * \brief Creates a queue of strings to be freed later by the thread that
+ *        owns it.
+ * 
+ * Strings handed from one thread to another can be given back to the
+ * thread that made them, so that they are freed where they were
+ * allocated (where a thread caching allocator wants them). Any thread
+ * can push, without locking and without allocating; only the owner
+ * drains, freeing everything pushed so far in one batch.
+ */
+a_free_queue    a_free_queue_new(void);
+void            a_free_queue_push(a_free_queue q, a_str str);
+/**
+ * \brief Pushes \p count strings at once, with a single atomic operation.
+ *        NULL entries are skipped.
+ */
+void            a_free_queue_push_vec(a_free_queue q, a_str *strv, size_t count);
+/**
+ * \brief Frees every string pushed so far, returns their number.
+ */
+size_t          a_free_queue_drain(a_free_queue q);
+/**
+ * \brief Drains the queue, then frees it.
+ */
+void            a_free_queue_free(a_free_queue q);
 /*@}*/
 #endif
 
 
 #if ALEPH_C_V == 2
+/**
+ * \brief A struct typedef that holds a compiled format string.
+ */
+typedef struct a_fmt *a_fmt;
 /** \name Formatting
  *
- * ...
+ * printf-like formatting straight into an Aleph string. a_format()
+ * replaces the content of the string while a_cat_format() appends to it.
+ * 
+ * All the standard conversions are supported except for \%n. In addition,
+ * \%S takes an Aleph string (its size and length are taken from the
+ * header) and \%C takes an ::a_cp. The width and precision of \%s and
+ * \%S count code points, or graphemes if the '#' flag is given.
+ * 
+ * Format strings used over and over can be compiled once with a_fmt_new()
+ * and used with a_cat_fmt().
  * 
  * @{
  */
 a_str       a_format(a_str str, const char *format, ...);
+a_str       a_format_va(a_str str, const char *format, va_list ap);
+a_str       a_cat_format(a_str str, const char *format, ...);
+a_str       a_cat_format_va(a_str str, const char *format, va_list ap);
+a_fmt       a_fmt_new(const char *format);
+void        a_fmt_free(a_fmt fmt);
+a_str       a_cat_fmt(a_str str, a_fmt fmt, ...);
+a_str       a_cat_fmt_va(a_str str, a_fmt fmt, va_list ap);
 /*@}*/
 #endif
 
@@ -1993,7 +3017,10 @@ enum a_blocks
  */
 a_str       a_normalize(a_str str, int mode);
 a_str       a_normalize_cstr(const char *str, int mode);
-a_str       a_new_normalize(a_cstr str, int mode); /* also declared above */
+/**
+ * \brief Returns #a_norm_yes if \p str is already normalized to \p mode,
+ *        #a_norm_no if not (#a_norm_maybe when out of memory).
+ */
 int         a_is_quick_normalized(a_str str, int mode);
 enum a_normalization_forms
 {
@@ -2011,6 +3038,45 @@ enum a_normalization_forms_quick_check
 /*@}*/
 
 
+/** 
+ * \anchor transliteration_functions
+ * \name Transliteration
+ *
+ * A lossy mapping of Unicode text to ASCII, for slugs, identifiers and
+ * systems that take nothing else: Latin letters lose their diacritics
+ * ("\xC3\xBC" to "u") or are spelled out ("\xC3\x86" to "AE",
+ * "\xC3\x9F" to "ss"), Greek and Cyrillic are romanized ("\xD0\xB6" to
+ * "zh"), digits of any script become 0-9 and compatibility forms (ligatures,
+ * fullwidth, fractions) are followed. Marks and format characters are
+ * dropped, and so is anything with no transliteration.
+ * 
+ * @{
+ */
+/**
+ * \brief The buffer size required by a_to_ascii_cp(), null terminator
+ *        included.
+ */
+/** \hideinitializer */
+#define A_MAX_ASCII (6+1)
+/**
+ * \brief Transliterates the string to ASCII.
+ * 
+ * \note A string that is already ASCII is returned as is, without
+ *       being copied.
+ * 
+ * \param str The string in context.
+ * \return \p str transliterated; otherwise NULL on failure.
+ */
+a_str       a_to_ascii(a_str str);
+a_str       a_to_ascii_cstr(const char *str);
+/**
+ * \brief Stores the transliteration of \p cp to \p b (of at least
+ *        #A_MAX_ASCII bytes), returns \p b.
+ */
+char       *a_to_ascii_cp(a_cp cp, char *b);
+/*@}*/
+
+
 
 /** 
  * \anchor hashing_functions
@@ -2020,6 +3086,9 @@ enum a_normalization_forms_quick_check
  * 
  * @{
  */
+/**
+ * \brief Returns the FNV-1a hash of the bytes of the string.
+ */
 unsigned long   a_hash(a_cstr str);
 unsigned int    a_crc32(a_cstr str);
 /*@}*/
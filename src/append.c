@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC
+ *
+ * License: MIT
+ */
+
+/*
+ * Concurrent Appending
+ *
+ * Every put takes its range of bytes with a fetch-add on reserved, then
+ * copies into the segments under it, allocating the ones missing (the
+ * first pointer stored wins). A segment counts the bytes written into it,
+ * so it is complete once that reaches its size, whatever order the puts
+ * finished in; the flusher hands out complete segments and frees them.
+ * The bytes past the last complete segment are only known to be all
+ * there once done, added to at the end of each put, catches up with
+ * reserved. The first failed put is kept in failed, nothing past it is
+ * ever flushed.
+ *
+ * The segments are a ring: segment k lives in slot k % A_APPEND_MAX_SEGMENTS,
+ * and a put may only use segments less than a whole ring ahead of the one
+ * being flushed. The flusher empties a slot before it moves flushed past
+ * it, so a put that sees the new flushed finds the slot free.
+ */
+#if A_INCLUDE_THREADS == 1 && !A_ATOMICS
+#include <pthread.h>
+#endif
+
+#define A_APPEND_MAX_SEGMENTS 4096
+
+struct a_append_segment
+{
+    size_t written;                 /* bytes copied into the segment so far */
+    size_t cps;                     /* code points in them                  */
+    /* followed by A_APPEND_SEGMENT_SIZE bytes */
+};
+#define a_append_data(seg) ((char*)((struct a_append_segment*)(seg) + 1))
+
+struct a_append
+{
+    size_t reserved;
+    char pad1[64];                  /* keep the counters apart              */
+    size_t done;
+    char pad2[64];
+    size_t failed;                  /* offset of the first failed put       */
+    size_t flushed;                 /* written by the flusher only          */
+    size_t flushed_cps;             /* code points flushed from its segment */
+#if A_INCLUDE_THREADS == 1 && !A_ATOMICS
+    pthread_mutex_t lock;
+#endif
+    struct a_append_segment *segs[A_APPEND_MAX_SEGMENTS];
+};
+
+#if !A_ATOMICS
+static void a_append_internal_lock(a_append a)
+{
+#   if A_INCLUDE_THREADS == 1
+    pthread_mutex_lock(&a->lock);
+#   else
+    (void)a;
+#   endif
+}
+static void a_append_internal_unlock(a_append a)
+{
+#   if A_INCLUDE_THREADS == 1
+    pthread_mutex_unlock(&a->lock);
+#   else
+    (void)a;
+#   endif
+}
+#endif
+
+static size_t a_append_internal_load(a_append a, size_t *p)
+{
+#if A_ATOMICS
+    (void)a;
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+#else
+    size_t v;
+
+    a_append_internal_lock(a);
+    v = *p;
+    a_append_internal_unlock(a);
+    return v;
+#endif
+}
+/* adds v to *p, returns what it was */
+static size_t a_append_internal_add(a_append a, size_t *p, size_t v)
+{
+#if A_ATOMICS
+    (void)a;
+    return __atomic_fetch_add(p, v, __ATOMIC_ACQ_REL);
+#else
+    size_t old;
+
+    a_append_internal_lock(a);
+    old = *p;
+    *p += v;
+    a_append_internal_unlock(a);
+    return old;
+#endif
+}
+static void a_append_internal_store(a_append a, size_t *p, size_t v)
+{
+#if A_ATOMICS
+    (void)a;
+    __atomic_store_n(p, v, __ATOMIC_RELEASE);
+#else
+    a_append_internal_lock(a);
+    *p = v;
+    a_append_internal_unlock(a);
+#endif
+}
+/* lowers *p to v */
+static void a_append_internal_min(a_append a, size_t *p, size_t v)
+{
+#if A_ATOMICS
+    size_t old = __atomic_load_n(p, __ATOMIC_RELAXED);
+
+    (void)a;
+    while (v < old && !__atomic_compare_exchange_n(p, &old, v, 1, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+        ;
+#else
+    a_append_internal_lock(a);
+    if (v < *p)
+        *p = v;
+    a_append_internal_unlock(a);
+#endif
+}
+
+static struct a_append_segment *a_append_internal_segment_get(a_append a, size_t k)
+{
+#if A_ATOMICS
+    (void)a;
+    return __atomic_load_n(&a->segs[k % A_APPEND_MAX_SEGMENTS], __ATOMIC_ACQUIRE);
+#else
+    struct a_append_segment *seg;
+
+    a_append_internal_lock(a);
+    seg = a->segs[k % A_APPEND_MAX_SEGMENTS];
+    a_append_internal_unlock(a);
+    return seg;
+#endif
+}
+/* returns segment k, allocated on first use, or NULL when out of memory */
+static struct a_append_segment *a_append_internal_segment(a_append a, size_t k)
+{
+    struct a_append_segment *seg, *current = NULL;
+
+    if ((seg = a_append_internal_segment_get(a, k)))
+        return seg;
+    if (!(seg = A_MALLOC(sizeof *seg + A_APPEND_SEGMENT_SIZE)))
+        return NULL;
+    seg->written = 0;
+    seg->cps = 0;
+#if A_ATOMICS
+    if (__atomic_compare_exchange_n(&a->segs[k % A_APPEND_MAX_SEGMENTS], &current, seg, 0,
+                                    __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+        return seg;
+#else
+    a_append_internal_lock(a);
+    if (!(current = a->segs[k % A_APPEND_MAX_SEGMENTS]))
+        a->segs[k % A_APPEND_MAX_SEGMENTS] = seg;
+    a_append_internal_unlock(a);
+    if (!current)
+        return seg;
+#endif
+    A_FREE(seg);
+    return current;
+}
+
+/*
+ * Finds the next piece to flush: returns its size (0 if there is none
+ * yet) and sets *p and *cps to its bytes and code points.
+ */
+static size_t a_append_internal_piece(a_append a, const char **p, size_t *cps)
+{
+    size_t k = a->flushed / A_APPEND_SEGMENT_SIZE, at = a->flushed % A_APPEND_SEGMENT_SIZE;
+    size_t size = A_APPEND_SEGMENT_SIZE - at, done, reserved, failed;
+    struct a_append_segment *seg;
+
+    if (!(seg = a_append_internal_segment_get(a, k)))
+        return 0;
+    *p = a_append_data(seg) + at;
+    failed = a_append_internal_load(a, &a->failed);
+    if (failed - a->flushed >= size
+            && a_append_internal_load(a, &seg->written) == A_APPEND_SEGMENT_SIZE)
+    {
+        *cps = a_append_internal_load(a, &seg->cps) - a->flushed_cps;
+        return size;
+    }
+
+    /* done first: if reserved is no more, no put was under way in between */
+    done = a_append_internal_load(a, &a->done);
+    reserved = a_append_internal_load(a, &a->reserved);
+    if (done != reserved)
+        return 0;
+    if (reserved > failed)
+        reserved = failed;
+    if (reserved - a->flushed < size)
+        size = reserved - a->flushed;
+    *cps = a_internal_count_cp_seq(*p, size);
+    return size;
+}
+/* moves past a piece, freeing its segment once it is all flushed */
+static void a_append_internal_consume(a_append a, size_t size, size_t cps)
+{
+    size_t k = a->flushed / A_APPEND_SEGMENT_SIZE, flushed = a->flushed + size;
+
+    a->flushed_cps += cps;
+    if (!(flushed % A_APPEND_SEGMENT_SIZE))
+    {
+        /* every put that had a part in it is over, its slot can take another */
+        A_FREE(a->segs[k % A_APPEND_MAX_SEGMENTS]);
+#if A_ATOMICS
+        __atomic_store_n(&a->segs[k % A_APPEND_MAX_SEGMENTS], NULL, __ATOMIC_RELAXED);
+#else
+        a_append_internal_lock(a);
+        a->segs[k % A_APPEND_MAX_SEGMENTS] = NULL;
+        a_append_internal_unlock(a);
+#endif
+        a->flushed_cps = 0;
+    }
+    a_append_internal_store(a, &a->flushed, flushed);
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+a_append a_append_new(void)
+{
+    a_append a;
+    size_t i;
+
+    if (!(a = A_MALLOC(sizeof *a)))
+        return NULL;
+    a->reserved = 0;
+    a->done = 0;
+    a->failed = (size_t)-1;
+    a->flushed = 0;
+    a->flushed_cps = 0;
+#if A_INCLUDE_THREADS == 1 && !A_ATOMICS
+    pthread_mutex_init(&a->lock, NULL);
+#endif
+    for (i = 0; i < A_APPEND_MAX_SEGMENTS; ++i)
+        a->segs[i] = NULL;
+    return a;
+}
+void a_append_free(a_append a)
+{
+    size_t i;
+
+    if (!a)
+        return;
+    for (i = 0; i < A_APPEND_MAX_SEGMENTS; ++i)
+        A_FREE(a->segs[i]);
+#if A_INCLUDE_THREADS == 1 && !A_ATOMICS
+    pthread_mutex_destroy(&a->lock);
+#endif
+    A_FREE(a);
+}
+int a_append_put(a_append a, a_cstr str)
+{
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, 0);
+    return a_append_put_size(a, str, a_size(str));
+}
+int a_append_put_cstr(a_append a, const char *str)
+{
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, 0);
+    return a_append_put_size(a, str, strlen(str));
+}
+int a_append_put_size(a_append a, const char *str, size_t size)
+{
+    struct a_append_segment *seg;
+    size_t off, at, end, k, in, n;
+    int ok = 1;
+    assert(a != NULL && str != NULL);
+    PASSTHROUGH_ON_FAIL(a != NULL && str != NULL, 0);
+
+    if (!size)
+        return 1;
+    off = a_append_internal_add(a, &a->reserved, size);
+    end = off + size;
+    /* no further than a ring ahead of the flusher, which is never past off */
+    if (end < off || (end - 1) / A_APPEND_SEGMENT_SIZE
+            - a_append_internal_load(a, &a->flushed) / A_APPEND_SEGMENT_SIZE >= A_APPEND_MAX_SEGMENTS)
+        ok = 0;
+    for (at = off; ok && at < end; at += n, str += n)
+    {
+        k = at / A_APPEND_SEGMENT_SIZE;
+        in = at % A_APPEND_SEGMENT_SIZE;
+        if ((n = A_APPEND_SEGMENT_SIZE - in) > end - at)
+            n = end - at;
+        if (!(seg = a_append_internal_segment(a, k)))
+        {
+            ok = 0;
+            break;
+        }
+        memcpy(a_append_data(seg) + in, str, n);
+        /* a code point cut by the end of a segment is counted on its first byte */
+        a_append_internal_add(a, &seg->cps, a_internal_count_cp_seq(str, n));
+        a_append_internal_add(a, &seg->written, n);
+    }
+    if (!ok)
+        a_append_internal_min(a, &a->failed, off);
+    a_append_internal_add(a, &a->done, size);
+    return ok && off < a_append_internal_load(a, &a->failed);
+}
+size_t a_append_size(a_append a)
+{
+    assert(a != NULL);
+    PASSTHROUGH_ON_FAIL(a != NULL, 0);
+    return a_append_internal_load(a, &a->reserved);
+}
+a_str a_append_flush(a_append a, a_str str)
+{
+    const char *p;
+    size_t n, cps;
+    assert(a != NULL && str != NULL);
+    PASSTHROUGH_ON_FAIL(a != NULL && str != NULL, NULL);
+
+    while ((n = a_append_internal_piece(a, &p, &cps)))
+    {
+        if (!(str = a_ensure(str, n)))
+            return NULL;
+        memcpy(str + a_size(str), p, n);
+        a_header(str)->size += n;
+        a_header(str)->len += cps;
+        str[a_size(str)] = '\0';
+        a_append_internal_consume(a, n, cps);
+    }
+    return str;
+}
+#if A_INCLUDE_IO == 1 && A_HAVE_WRITEV == 1
+int a_append_flush_fd(a_append a, int fd)
+{
+    const char *p;
+    size_t n, cps;
+    assert(a != NULL);
+    PASSTHROUGH_ON_FAIL(a != NULL, 0);
+
+    while ((n = a_append_internal_piece(a, &p, &cps)))
+    {
+        if (!a_write_size_vec(fd, (const char *const *)&p, &n, 1))
+            return 0;
+        a_append_internal_consume(a, n, cps);
+    }
+    return 1;
+}
+#endif
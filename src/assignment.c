@@ -37,7 +37,12 @@ a_str a_set(a_str str, a_str newstr)
     size = a_size(newstr);
     str = a_reserve(str, size);
     if (str)
-        memcpy(a_header(str), a_header(newstr), sizeof (struct a_header) + size + 1);
+    {
+        /* the header's mem describes newstr's buffer, not ours */
+        memcpy(str, newstr, size + 1);
+        a_header(str)->size = size;
+        a_header(str)->len = a_len(newstr);
+    }
 
     return str;
 }
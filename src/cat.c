@@ -72,109 +72,504 @@ a_str a_cat_chr(a_str s, const char *chr)
 
 
 
+/* powers of 10 that fit an unsigned long, a_pow10[0] is 0 on purpose */
+static const unsigned long a_pow10[] =
+{
+    0UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL,
+    100000000UL, 1000000000UL
+#if ULONG_MAX > 0xFFFFFFFFUL
+    , 10000000000UL, 100000000000UL, 1000000000000UL, 10000000000000UL,
+    100000000000000UL, 1000000000000000UL, 10000000000000000UL,
+    100000000000000000UL, 1000000000000000000UL, 10000000000000000000UL
+#endif
+};
+
 /* number of digits in an integer */ 
-static int a_digits_count(const long n)
+static int a_digits_count(unsigned long n)
 {
-    if (n < 100000)
+#if defined(__GNUC__)
+    /* log10(n) ~= log2(n) * 1233/4096, off by at most one */
+    int t = (int)(((sizeof n * CHAR_BIT - (size_t)__builtin_clzl(n | 1)) * 1233) >> 12);
+    return t + 1 - (n < a_pow10[t]);
+#else
+    int d = 1;
+    size_t i;
+    for (i = 1; i < sizeof a_pow10 / sizeof *a_pow10; ++i)
+        d += (n >= a_pow10[i]);
+    return d;
+#endif
+}
+
+static const char a_digits_pairs[200] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899"
+;
+
+/* writes the digits of val backward, ending right before end */
+static char *a_cat_internal_ulong(char *end, unsigned long val)
+{
+    while (val >= 100)
+    {
+        unsigned n = (unsigned)(val % 100) * 2;
+        val /= 100;
+        *--end = a_digits_pairs[n + 1];
+        *--end = a_digits_pairs[n];
+    }
+    if (val >= 10)
     {
-        if (n < 10) return 1;
+        *--end = a_digits_pairs[val * 2 + 1];
+        *--end = a_digits_pairs[val * 2];
+    }
+    else
+        *--end = (char)('0' + val);
+    return end;
+}
+
+a_str a_cat_ulong(a_str s, unsigned long val)
+{
+    struct a_header *h;
+    int length;
+    assert(s != NULL);
+    PASSTHROUGH_ON_FAIL(s != NULL, NULL);
+    
+    length = a_digits_count(val);
+    if (!(s = a_ensure(s, (size_t)length)))
+        return NULL;
+    
+    h = a_header(s);
+    a_cat_internal_ulong(s + h->size + length, val);
+    h->size += length;
+    h->len += length;
+    s[h->size] = '\0';
+    return s;
+}
+
+a_str a_cat_long(a_str s, long val)
+{
+    struct a_header *h;
+    unsigned long uval = val;
+    int length, neg = val < 0;
+    assert(s != NULL);
+    PASSTHROUGH_ON_FAIL(s != NULL, NULL);
+    
+    if (neg)
+        uval = -uval; /* this avoid implemention-defined behavior */
+    length = a_digits_count(uval) + neg;
+    if (!(s = a_ensure(s, (size_t)length)))
+        return NULL;
+    
+    h = a_header(s);
+    if (neg)
+        s[h->size] = '-';
+    a_cat_internal_ulong(s + h->size + length, uval);
+    h->size += length;
+    h->len += length;
+    s[h->size] = '\0';
+    return s;
+}
+
+/*
+ * Appends count numbers separated by sep (which may be NULL), reserving
+ * the exact space needed once.
+ */
+static a_str a_cat_internal_vec(a_str s, const unsigned long *uvals, const long *vals,
+                                size_t count, const char *sep)
+{
+    struct a_header *h;
+    size_t i, total, sep_size = sep ? strlen(sep) : 0, sep_len;
+    char *w;
+    assert(s != NULL && (uvals != NULL || vals != NULL || count == 0));
+    PASSTHROUGH_ON_FAIL(s != NULL && (uvals != NULL || vals != NULL || count == 0), NULL);
+    
+    if (!count)
+        return s;
+    
+    sep_len = a_internal_count_cp(sep, sep_size);
+    total = (count - 1) * sep_size;
+    for (i = 0; i < count; ++i)
+        total += uvals ? (size_t)a_digits_count(uvals[i])
+                       : (size_t)a_digits_count(vals[i] < 0 ? 0UL - (unsigned long)vals[i] : (unsigned long)vals[i]) + (vals[i] < 0);
+    
+    if (!(s = a_ensure(s, total)))
+        return NULL;
+    h = a_header(s);
+    w = s + h->size;
+    for (i = 0; i < count; ++i)
+    {
+        unsigned long v;
+        int length;
         
-        if (n < 1000)
+        if (i && sep_size)
+            memcpy(w, sep, sep_size), w += sep_size;
+        if (uvals)
+            v = uvals[i];
+        else if (vals[i] < 0)
+            v = 0UL - (unsigned long)vals[i], *w++ = '-';
+        else
+            v = (unsigned long)vals[i];
+        length = a_digits_count(v);
+        a_cat_internal_ulong(w + length, v);
+        w += length;
+    }
+    *w = '\0';
+    h->len += total - (count - 1) * (sep_size - sep_len);
+    h->size += total;
+    return s;
+}
+a_str a_cat_ulong_vec(a_str s, const unsigned long *vals, size_t count, const char *sep)
+{
+    return a_cat_internal_vec(s, vals, NULL, count, sep);
+}
+a_str a_cat_long_vec(a_str s, const long *vals, size_t count, const char *sep)
+{
+    return a_cat_internal_vec(s, NULL, vals, count, sep);
+}
+
+#if ALEPH_C_V == 2
+/*
+ * Shortest round-trip double to decimal conversion, after Ulf Adams'
+ * "Ryū: fast float-to-string conversion" (PLDI 2018).
+ */
+#define A_DBL_MANTISSA_BITS 52
+#define A_DBL_EXPONENT_BITS 11
+#define A_DBL_BIAS 1023
+
+static int32_t a_dbl_pow5bits(int32_t e)
+{
+    return (int32_t)(((uint32_t)e * 1217359) >> 19) + 1;
+}
+static uint32_t a_dbl_log10_pow2(int32_t e)
+{
+    return ((uint32_t)e * 78913) >> 18;
+}
+static uint32_t a_dbl_log10_pow5(int32_t e)
+{
+    return ((uint32_t)e * 732923) >> 20;
+}
+static uint32_t a_dbl_pow5_factor(uint64_t v)
+{
+    uint32_t count = 0;
+    
+    for (; v % 5 == 0; v /= 5)
+        ++count;
+    return count;
+}
+static int a_dbl_multiple_of_pow5(uint64_t v, uint32_t p)
+{
+    return a_dbl_pow5_factor(v) >= p;
+}
+static int a_dbl_multiple_of_pow2(uint64_t v, uint32_t p)
+{
+    return (v & ((1ULL << p) - 1)) == 0;
+}
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 a_uint128;
+#endif
+
+/* (m * mul) >> j, where mul is a 128-bit {low, high} pair and j >= 64 */
+static uint64_t a_dbl_mul_shift(uint64_t m, const uint64_t *mul, int32_t j)
+{
+#if defined(__SIZEOF_INT128__)
+    a_uint128 b0 = (a_uint128)m * mul[0];
+    a_uint128 b2 = (a_uint128)m * mul[1];
+    return (uint64_t)(((b0 >> 64) + b2) >> (j - 64));
+#else
+    uint64_t a_lo = (uint32_t)m, a_hi = m >> 32;
+    uint64_t b0_hi, b2_lo, b2_hi, sum, hi;
+    int k;
+    
+    /* high half of m * mul[0] */
+    {
+        uint64_t b_lo = (uint32_t)mul[0], b_hi = mul[0] >> 32;
+        uint64_t lo_lo = a_lo * b_lo, hi_lo = a_hi * b_lo, lo_hi = a_lo * b_hi, hi_hi = a_hi * b_hi;
+        uint64_t mid = hi_lo + (lo_lo >> 32);
+        uint64_t mid2 = lo_hi + (uint32_t)mid;
+        b0_hi = hi_hi + (mid >> 32) + (mid2 >> 32);
+    }
+    /* full m * mul[1] */
+    {
+        uint64_t b_lo = (uint32_t)mul[1], b_hi = mul[1] >> 32;
+        uint64_t lo_lo = a_lo * b_lo, hi_lo = a_hi * b_lo, lo_hi = a_lo * b_hi, hi_hi = a_hi * b_hi;
+        uint64_t mid = hi_lo + (lo_lo >> 32);
+        uint64_t mid2 = lo_hi + (uint32_t)mid;
+        b2_lo = (mid2 << 32) | (uint32_t)lo_lo;
+        b2_hi = hi_hi + (mid >> 32) + (mid2 >> 32);
+    }
+    sum = b0_hi + b2_lo;
+    hi = b2_hi + (sum < b0_hi);
+    k = j - 64;
+    return k ? (hi << (64 - k)) | (sum >> k) : sum;
+#endif
+}
+
+/*
+ * Converts the IEEE fields of a finite, non-zero double into the
+ * shortest decimal *mantissa * 10^*exponent that rounds back to it.
+ */
+static void a_dbl_to_decimal(uint64_t ieee_mantissa, uint32_t ieee_exponent,
+                             uint64_t *mantissa, int32_t *exponent)
+{
+    int32_t e2, e10, removed = 0;
+    uint64_t m2, mv, vr, vp, vm, output;
+    uint32_t mm_shift, last_removed = 0;
+    int accept_bounds, vm_trailing = 0, vr_trailing = 0;
+    
+    if (ieee_exponent == 0)
+    {
+        e2 = 1 - A_DBL_BIAS - A_DBL_MANTISSA_BITS - 2;
+        m2 = ieee_mantissa;
+    }
+    else
+    {
+        e2 = (int32_t)ieee_exponent - A_DBL_BIAS - A_DBL_MANTISSA_BITS - 2;
+        m2 = (1ULL << A_DBL_MANTISSA_BITS) | ieee_mantissa;
+    }
+    accept_bounds = (m2 & 1) == 0;
+    
+    /* the interval of valid representations is [mm, mp] around mv */
+    mv = 4 * m2;
+    mm_shift = ieee_mantissa != 0 || ieee_exponent <= 1;
+    
+    if (e2 >= 0)
+    {
+        uint32_t q = a_dbl_log10_pow2(e2) - (e2 > 3);
+        int32_t k = A_POW5_INV_BITCOUNT + a_dbl_pow5bits((int32_t)q) - 1;
+        int32_t i = -e2 + (int32_t)q + k;
+        
+        e10 = (int32_t)q;
+        vr = a_dbl_mul_shift(4 * m2, a_pow5_inv_split[q], i);
+        vp = a_dbl_mul_shift(4 * m2 + 2, a_pow5_inv_split[q], i);
+        vm = a_dbl_mul_shift(4 * m2 - 1 - mm_shift, a_pow5_inv_split[q], i);
+        if (q <= 21)
         {
-            if (n < 100) return 2;
-        /*  if (n < 1000)*/ return 3;
+            if (mv % 5 == 0)
+                vr_trailing = a_dbl_multiple_of_pow5(mv, q);
+            else if (accept_bounds)
+                vm_trailing = a_dbl_multiple_of_pow5(mv - 1 - mm_shift, q);
+            else
+                vp -= a_dbl_multiple_of_pow5(mv + 2, q);
         }
-        
-        if (n < 10000) return 4;
-       /*if (n < 100000)*/ return 5;
     }
     else
     {
-        if (n < 10000000)
+        uint32_t q = a_dbl_log10_pow5(-e2) - (-e2 > 1);
+        int32_t i = -e2 - (int32_t)q;
+        int32_t k = a_dbl_pow5bits(i) - A_POW5_BITCOUNT;
+        int32_t j = (int32_t)q - k;
+        
+        e10 = (int32_t)q + e2;
+        vr = a_dbl_mul_shift(4 * m2, a_pow5_split[i], j);
+        vp = a_dbl_mul_shift(4 * m2 + 2, a_pow5_split[i], j);
+        vm = a_dbl_mul_shift(4 * m2 - 1 - mm_shift, a_pow5_split[i], j);
+        if (q <= 1)
         {
-            if (n < 1000000) return 6;
-         /* if (n < 10000000) */ return 7;
+            vr_trailing = 1;
+            if (accept_bounds)
+                vm_trailing = mm_shift == 1;
+            else
+                --vp;
         }
-        if (n < 100000000) return 8;
-        
-        if (n < 10000000000)
+        else if (q < 63)
+            vr_trailing = a_dbl_multiple_of_pow2(mv, q);
+    }
+    
+    /* drop digits for as long as the interval allows */
+    if (vm_trailing || vr_trailing)
+    {
+        while (vp / 10 > vm / 10)
         {
-            if (n < 1000000000) return 9;
-            return 10;
+            vm_trailing &= vm % 10 == 0;
+            vr_trailing &= last_removed == 0;
+            last_removed = (uint32_t)(vr % 10);
+            vr /= 10, vp /= 10, vm /= 10;
+            ++removed;
         }
+        if (vm_trailing)
+            while (vm % 10 == 0)
+            {
+                vr_trailing &= last_removed == 0;
+                last_removed = (uint32_t)(vr % 10);
+                vr /= 10, vp /= 10, vm /= 10;
+                ++removed;
+            }
+        if (vr_trailing && last_removed == 5 && vr % 2 == 0)
+            last_removed = 4; /* round half to even */
+        output = vr + ((vr == vm && (!accept_bounds || !vm_trailing)) || last_removed >= 5);
+    }
+    else
+    {
+        int round_up = 0;
         
-        if (n < 1000000000000)
+        if (vp / 100 > vm / 100)
+        {
+            round_up = vr % 100 >= 50;
+            vr /= 100, vp /= 100, vm /= 100;
+            removed += 2;
+        }
+        while (vp / 10 > vm / 10)
         {
-            if (n < 100000000000) return 11;
-            return 12;
+            round_up = vr % 10 >= 5;
+            vr /= 10, vp /= 10, vm /= 10;
+            ++removed;
         }
+        output = vr + (vr == vm || round_up);
     }
     
-    return 1;
+    *mantissa = output;
+    *exponent = e10 + removed;
 }
 
-static const char a_digits_1sts[100] =
-    "00000000001111111111"
-    "22222222223333333333"
-    "44444444445555555555"
-    "66666666667777777777"
-    "88888888889999999999"
-;
-static const char a_digits_2nds[100] =
-    "01234567890123456789"
-    "01234567890123456789"
-    "01234567890123456789"
-    "01234567890123456789"
-    "01234567890123456789"
-;
-
-a_str a_cat_ulong(a_str s, unsigned long val)
+/*
+ * Writes val the way Python's repr() does: the shortest digits that round
+ * trip, in positional notation for exponents in [-4, 16) and scientific
+ * notation otherwise. Returns the number of bytes written (at most 24).
+ */
+static size_t a_cat_internal_double(char *b, double val)
 {
-    int const length = a_digits_count(val);
-    int pos = length - 1;
-    
-    struct a_header *h;
-    char *buf;
-    
-    h = a_header(s);
-    buf = s + h->size;
+    uint64_t bits, mantissa, output;
+    uint32_t exponent;
+    int32_t e10;
+    char digits[20], *d, *w = b;
+    int ndigits, point, i;
     
-    s = a_ensure(s, length);
-    if (!s)
-        return NULL;
+    memcpy(&bits, &val, sizeof bits);
+    mantissa = bits & ((1ULL << A_DBL_MANTISSA_BITS) - 1);
+    exponent = (uint32_t)((bits >> A_DBL_MANTISSA_BITS) & ((1u << A_DBL_EXPONENT_BITS) - 1));
     
-    while (val >= 100)
+    if (exponent == (1u << A_DBL_EXPONENT_BITS) - 1)
     {
-        const int n = val % 100;  /* hopfuly it turns into an IDIVL */
-        val /= 100;
-        
-        buf[pos] = a_digits_2nds[n];
-        buf[pos-1] = a_digits_1sts[n];
-        
-        pos -= 2;
+        if (mantissa)
+            return memcpy(w, "nan", 3), 3;
+        if (bits >> 63)
+            *w++ = '-';
+        memcpy(w, "inf", 3);
+        return (size_t)(w - b) + 3;
+    }
+    if (bits >> 63)
+        *w++ = '-';
+    if (!exponent && !mantissa)
+    {
+        memcpy(w, "0.0", 3);
+        return (size_t)(w - b) + 3;
     }
     
+    a_dbl_to_decimal(mantissa, exponent, &output, &e10);
     
-    buf[pos] = a_digits_2nds[val];
-    if (val > 9)
-        buf[pos-1] = a_digits_1sts[val];
+    /* the digits, without the trailing zeros Ryu may leave in */
+    while (output % 10 == 0)
+        output /= 10, ++e10;
+    d = digits + sizeof digits;
+    for (; output >= 100; output /= 100)
+    {
+        unsigned n = (unsigned)(output % 100) * 2;
+        *--d = a_digits_pairs[n + 1];
+        *--d = a_digits_pairs[n];
+    }
+    if (output >= 10)
+        *--d = a_digits_pairs[output * 2 + 1], *--d = a_digits_pairs[output * 2];
+    else
+        *--d = (char)('0' + output);
+    ndigits = (int)(digits + sizeof digits - d);
+    point = ndigits + e10; /* position of the decimal point */
     
-    buf[length] = 0;
-    h->size += length;
-    h->len += length;
+    if (-4 < point && point <= 16)
+    {
+        if (point <= 0)
+        {
+            *w++ = '0', *w++ = '.';
+            for (i = point; i < 0; ++i)
+                *w++ = '0';
+            memcpy(w, d, (size_t)ndigits), w += ndigits;
+        }
+        else if (point >= ndigits)
+        {
+            memcpy(w, d, (size_t)ndigits), w += ndigits;
+            for (i = ndigits; i < point; ++i)
+                *w++ = '0';
+            *w++ = '.', *w++ = '0';
+        }
+        else
+        {
+            memcpy(w, d, (size_t)point), w += point;
+            *w++ = '.';
+            memcpy(w, d + point, (size_t)(ndigits - point)), w += ndigits - point;
+        }
+    }
+    else
+    {
+        int e = point - 1;
+        
+        *w++ = *d;
+        if (ndigits > 1)
+        {
+            *w++ = '.';
+            memcpy(w, d + 1, (size_t)(ndigits - 1)), w += ndigits - 1;
+        }
+        *w++ = 'e';
+        *w++ = e < 0 ? '-' : '+';
+        if (e < 0)
+            e = -e;
+        if (e >= 100)
+            *w++ = (char)('0' + e / 100), e %= 100;
+        *w++ = a_digits_pairs[e * 2];
+        *w++ = a_digits_pairs[e * 2 + 1];
+    }
+    return (size_t)(w - b);
+}
+
+#define A_DOUBLE_MAX_SIZE 24
+
+a_str a_cat_double(a_str s, double val)
+{
+    struct a_header *h;
+    size_t size;
+    assert(s != NULL);
+    PASSTHROUGH_ON_FAIL(s != NULL, NULL);
     
+    if (!(s = a_ensure(s, A_DOUBLE_MAX_SIZE)))
+        return NULL;
+    h = a_header(s);
+    size = a_cat_internal_double(s + h->size, val);
+    h->size += size;
+    h->len += size;
+    s[h->size] = '\0';
     return s;
 }
-
-a_str a_cat_long(a_str s, long val)
+a_str a_cat_double_vec(a_str s, const double *vals, size_t count, const char *sep)
 {
-    unsigned long uval = val;
+    struct a_header *h;
+    size_t i, sep_size = sep ? strlen(sep) : 0, sep_len;
+    char *w;
+    assert(s != NULL && (vals != NULL || count == 0));
+    PASSTHROUGH_ON_FAIL(s != NULL && (vals != NULL || count == 0), NULL);
     
-    if(val < 0)
+    if (!count)
+        return s;
+    
+    /* reserve for the longest possible output once */
+    if (!(s = a_ensure(s, count * A_DOUBLE_MAX_SIZE + (count - 1) * sep_size)))
+        return NULL;
+    sep_len = a_internal_count_cp(sep, sep_size);
+    h = a_header(s);
+    w = s + h->size;
+    for (i = 0; i < count; ++i)
     {
-        s = a_cat_chr(s, "-");
-        uval = -uval; /* this avoid implemention-defined behavior */
+        if (i && sep_size)
+            memcpy(w, sep, sep_size), w += sep_size;
+        w += a_cat_internal_double(w, vals[i]);
     }
-    
-    return a_cat_ulong(s, uval);
-}
\ No newline at end of file
+    *w = '\0';
+    h->len += (size_t)(w - (s + h->size)) - (count - 1) * (sep_size - sep_len);
+    h->size = (size_t)(w - s);
+    return s;
+}
+#endif
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC
+ *
+ * License: MIT
+ */
+
+/*
+ * Substring Counting
+ *
+ * Occurrences don't overlap: they are counted from left to right and the
+ * search resumes after the end of each one, so "aaaa" has two "aa".
+ */
+
+/*
+ * Counts the occurrences of sub that start in [from, to), searching from
+ * from, and stores the offsets of the first max ones to out. *last gets
+ * the end of the last one, or from.
+ */
+static size_t a_count_internal_scan(const char *s, size_t size, const char *sub, size_t subsize,
+                                    size_t from, size_t to, size_t *out, size_t max, size_t *last)
+{
+    const char *p = s + from, *stop = s + to, *end = s + size;
+    size_t count = 0;
+
+    *last = from;
+    while (p < stop && (size_t)(end - p) >= subsize)
+    {
+        if (!(p = memchr(p, *sub, (size_t)(stop - p))) || (size_t)(end - p) < subsize)
+            break;
+        if (memcmp(p, sub, subsize))
+        {
+            ++p;
+            continue;
+        }
+        if (count < max)
+            out[count] = (size_t)(p - s);
+        ++count;
+        p += subsize;
+        *last = (size_t)(p - s);
+    }
+    return count;
+}
+
+struct a_count_job
+{
+    const char *s;
+    size_t size;
+    const char *sub;
+    size_t subsize;
+    size_t at[A_MAX_THREADS + 1];   /* chunk i is [at[i], at[i+1])             */
+    size_t from[A_MAX_THREADS];     /* where the search of chunk i starts      */
+    size_t counts[A_MAX_THREADS];
+    size_t last[A_MAX_THREADS];
+    size_t *out;                    /* offsets, NULL when only counting        */
+    size_t max;
+    size_t base[A_MAX_THREADS];     /* index in out of the first one of chunk i */
+};
+
+static void a_count_internal_job(void *ctx, size_t i)
+{
+    struct a_count_job *job = ctx;
+    size_t *out = NULL, max = 0;
+
+    if (job->out && job->base[i] < job->max)
+        out = job->out + job->base[i], max = job->max - job->base[i];
+    job->counts[i] = a_count_internal_scan(job->s, job->size, job->sub, job->subsize,
+                                           job->from[i], job->at[i+1], out, max, &job->last[i]);
+}
+
+/*
+ * Counts the occurrences of sub in s and stores the offsets of the first
+ * max ones to out. Large strings are searched a chunk per thread. Since
+ * an occurrence can run over the end of its chunk, the chunks are then
+ * checked in order, and one whose first occurrences overlap it is
+ * searched again from the end of it; offsets are only stored once the
+ * counts are right.
+ */
+static size_t a_count_internal(const char *s, size_t size, const char *sub, size_t subsize,
+                               size_t *out, size_t max)
+{
+    struct a_count_job job;
+    size_t n = a_internal_threads(size, 0), i, count = 0, last;
+
+    if (!subsize)
+        return 0;
+    if (n == 1)
+        return a_count_internal_scan(s, size, sub, subsize, 0, size, out, max, &last);
+
+    job.s = s;
+    job.size = size;
+    job.sub = sub;
+    job.subsize = subsize;
+    job.out = NULL;
+    a_internal_split(s, size, n, job.at);
+    for (i = 0; i < n; ++i)
+        job.from[i] = job.at[i];
+    a_internal_parallel(n, a_count_internal_job, &job);
+
+    for (i = 1; i < n; ++i)
+    {
+        if (job.last[i-1] > job.from[i])
+        {
+            job.from[i] = job.last[i-1];
+            job.counts[i] = a_count_internal_scan(s, size, sub, subsize, job.from[i], job.at[i+1],
+                                                  NULL, 0, &job.last[i]);
+        }
+    }
+    for (i = 0; i < n; ++i)
+    {
+        job.base[i] = count;
+        count += job.counts[i];
+    }
+
+    if (out && max)
+    {
+        job.out = out;
+        job.max = max;
+        a_internal_parallel(n, a_count_internal_job, &job);
+    }
+    return count;
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+size_t a_count_cp(a_cstr str, a_cp codepoint)
+{
+    char chr[7];
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, 0);
+    A_ASSERT_CODEPOINT(codepoint);
+
+    a_internal_cp_to_char(codepoint, chr);
+    return a_count_internal(str, a_size(str), chr, strlen(chr), NULL, 0);
+}
+size_t a_count_cstr_cp(const char *str, a_cp codepoint)
+{
+    char chr[7];
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, 0);
+    A_ASSERT_CODEPOINT(codepoint);
+
+    a_internal_cp_to_char(codepoint, chr);
+    return a_count_internal(str, strlen(str), chr, strlen(chr), NULL, 0);
+}
+size_t a_count_substr(a_cstr str, a_cstr substr)
+{
+    assert(str != NULL && substr != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL && substr != NULL, 0);
+
+    return a_count_internal(str, a_size(str), substr, a_size(substr), NULL, 0);
+}
+size_t a_count_substr_cstr(a_cstr str, const char *substr)
+{
+    assert(str != NULL && substr != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL && substr != NULL, 0);
+
+    return a_count_internal(str, a_size(str), substr, strlen(substr), NULL, 0);
+}
+size_t a_count_substr_cstr_cstr(const char *str, const char *substr)
+{
+    assert(str != NULL && substr != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL && substr != NULL, 0);
+
+    return a_count_internal(str, strlen(str), substr, strlen(substr), NULL, 0);
+}
@@ -88,7 +88,11 @@ a_str a_new_dup(a_cstr s)
     PASSTHROUGH_ON_FAIL(s != NULL, NULL);
     
     if ((dup = a_new_mem_raw(a_size(s) + 1)))
-        memcpy(a_header(dup), a_header(s), sizeof (struct a_header) + a_size(s) + 1);
+    {
+        memcpy(dup, s, a_size(s) + 1);
+        a_header(dup)->size = a_size(s);
+        a_header(dup)->len = a_len(s);
+    }
     return dup;
 }
 a_str a_new_long(long val)
@@ -107,11 +111,6 @@ a_str a_new_ulong(unsigned long val)
         str = a_cat_ulong(str, val);
     return str;
 }
-a_str a_new_normalize(a_cstr str, int mode)
-{
-    assert("Function not implemented.");
-    return NULL;
-}
 static a_str a_new_chr_internal(const char *chr, size_t size, size_t repeat)
 {
     size_t l;
@@ -121,10 +120,7 @@ static a_str a_new_chr_internal(const char *chr, size_t size, size_t repeat)
     l = size * repeat;
     if ((str = a_new_mem_raw(l + 1)))
     {
-        size_t i;
-        
-        for (i = 0; i < l; i += size)
-            memcpy(str + i, chr, size);
+        a_internal_fill(str, chr, size, repeat);
         str[l] = '\0';
         
         h = a_header(str);
@@ -140,6 +136,14 @@ static a_str a_new_chr_internal(const char *chr, size_t size, size_t repeat)
 
 void a_free(a_str s)
 {
+#if A_INCLUDE_IO == 1
+    /* buffers that aren't ours (file mappings) have no mem */
+    if (!a_header(s)->mem)
+    {
+        a_file_unmap(s);
+        return;
+    }
+#endif
     free(a_header(s));
 }
 void a_free_vec(a_str *sv)
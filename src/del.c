@@ -3,6 +3,10 @@
  * 
  * License: MIT
  */
+
+static a_str a_del_internal(a_str str, size_t start, size_t size, size_t len);
+static a_str a_edit_internal(a_str str, const struct a_edit *edits, size_t count, int counted);
+
 a_str a_del(a_str str, size_t start, size_t length)
 {
     size_t s, e;
@@ -13,20 +17,172 @@ a_str a_del(a_str str, size_t start, size_t length)
     
     s = a_internal_index_to_offset(str, start);
     e = a_internal_index_to_offset(str+s, length);
-    return a_del_offset(str, s, e);
+    return a_del_internal(str, s, e, length);
 }
 a_str a_del_offset(a_str str, size_t start, size_t length)
 {
-    struct a_header *h;
     assert(str != NULL);
-    assert(start < a_len(str));
-    assert(length+start <= a_len(str));
+    assert(start < a_size(str));
+    assert(length+start <= a_size(str));
     PASSTHROUGH_ON_FAIL(str != NULL, NULL);
     
-    h = a_header(str);
-    h->size -= length;
-    memmove(str + start, str + start + length, h->size - start);
+    return a_del_internal(str, start, length, a_internal_count_cp(str + start, length));
+}
+static a_str a_del_internal(a_str str, size_t start, size_t size, size_t len)
+{
+    struct a_header *h = a_header(str);
+    
+    h->size -= size;
+    h->len -= len;
+    memmove(str + start, str + start + size, h->size - start);
     str[h->size] = '\0';
-    h->len = a_len_cstr_max(str, h->size);
     return str;
-}
\ No newline at end of file
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+a_str a_edit(a_str str, const struct a_edit *edits, size_t count)
+{
+    struct a_edit *off;
+    size_t i, index, offset;
+    assert(str != NULL && (edits != NULL || count == 0));
+    PASSTHROUGH_ON_FAIL(str != NULL && (edits != NULL || count == 0), NULL);
+    
+    if (!count)
+        return str;
+    if (a_len(str) == a_size(str))
+        return a_edit_internal(str, edits, count, 0);
+    
+    if (!(off = A_MALLOC(count * sizeof *off)))
+    {
+        a_free(str);
+        return NULL;
+    }
+    
+    /* a single forward walk turns every index range into an offset range */
+    for (i = 0, index = 0, offset = 0; i < count; ++i)
+    {
+        assert(i == 0 || edits[i].start >= edits[i-1].start + edits[i-1].length);
+        offset += a_internal_index_to_offset(str + offset, edits[i].start - index);
+        off[i].start = offset;
+        offset += a_internal_index_to_offset(str + offset, edits[i].length);
+        off[i].length = offset - off[i].start;
+        off[i].rep = edits[i].rep;
+        index = edits[i].start + edits[i].length;
+    }
+    
+    /* the removed lengths are known, fold them into len up front */
+    for (i = 0; i < count; ++i)
+        a_header(str)->len -= edits[i].length;
+    
+    str = a_edit_internal(str, off, count, 1);
+    A_FREE(off);
+    return str;
+}
+a_str a_edit_offset(a_str str, const struct a_edit *edits, size_t count)
+{
+    assert(str != NULL && (edits != NULL || count == 0));
+    PASSTHROUGH_ON_FAIL(str != NULL && (edits != NULL || count == 0), NULL);
+    
+    if (!count)
+        return str;
+    return a_edit_internal(str, edits, count, 0);
+}
+
+/*
+ * Applies sorted, non-overlapping offset edits in a single pass. If the
+ * string never grows ahead of the read position, the edits are compacted
+ * in place left to right; if no edit shrinks and the result fits, they
+ * are expanded in place right to left; otherwise the result is assembled
+ * in a buffer of the exact size. If counted is set, len already accounts
+ * for the removed spans.
+ */
+static a_str a_edit_internal(a_str str, const struct a_edit *edits, size_t count, int counted)
+{
+    struct a_header *h = a_header(str);
+    size_t i, r, w, rsize, newsize, len;
+    int ascii = h->len == h->size, shrinks = 1, grows = 1;
+    
+    newsize = h->size;
+    len = h->len;
+    for (i = 0; i < count; ++i)
+    {
+        assert(edits[i].start + edits[i].length <= h->size);
+        assert(i == 0 || edits[i].start >= edits[i-1].start + edits[i-1].length);
+        A_ASSERT_CODEPOINT_BOUNDARY(str[edits[i].start]);
+        A_ASSERT_CODEPOINT_BOUNDARY(str[edits[i].start + edits[i].length]);
+        
+        rsize = edits[i].rep ? strlen(edits[i].rep) : 0;
+        newsize = newsize - edits[i].length + rsize;
+        len += a_internal_count_cp(edits[i].rep, rsize);
+        if (!counted)
+            len -= ascii ? edits[i].length : a_internal_count_cp(str + edits[i].start, edits[i].length);
+        
+        if (newsize > h->size)
+            shrinks = 0;
+        if (rsize < edits[i].length)
+            grows = 0;
+    }
+    
+    if (shrinks)
+    {
+        for (i = 0, r = 0, w = 0; i < count; ++i)
+        {
+            rsize = edits[i].rep ? strlen(edits[i].rep) : 0;
+            if (w != r)
+                memmove(str + w, str + r, edits[i].start - r);
+            w += edits[i].start - r;
+            if (rsize)
+                memcpy(str + w, edits[i].rep, rsize);
+            w += rsize;
+            r = edits[i].start + edits[i].length;
+        }
+        memmove(str + w, str + r, h->size - r);
+    }
+    else if (grows && newsize < h->mem)
+    {
+        for (i = count, r = h->size, w = newsize; i--;)
+        {
+            size_t tail = r - (edits[i].start + edits[i].length);
+            
+            rsize = edits[i].rep ? strlen(edits[i].rep) : 0;
+            w -= tail;
+            memmove(str + w, str + r - tail, tail);
+            w -= rsize;
+            if (rsize)
+                memcpy(str + w, edits[i].rep, rsize);
+            r = edits[i].start;
+        }
+    }
+    else
+    {
+        a_str newstr;
+        
+        if (!(newstr = a_new_mem_raw(newsize)))
+        {
+            a_free(str);
+            return NULL;
+        }
+        for (i = 0, r = 0, w = 0; i < count; ++i)
+        {
+            rsize = edits[i].rep ? strlen(edits[i].rep) : 0;
+            memcpy(newstr + w, str + r, edits[i].start - r);
+            w += edits[i].start - r;
+            if (rsize)
+                memcpy(newstr + w, edits[i].rep, rsize);
+            w += rsize;
+            r = edits[i].start + edits[i].length;
+        }
+        memcpy(newstr + w, str + r, h->size - r);
+        a_free(str);
+        str = newstr;
+        h = a_header(str);
+    }
+    
+    str[newsize] = '\0';
+    h->size = newsize;
+    h->len = len;
+    return str;
+}
@@ -0,0 +1,513 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC
+ *
+ * License: MIT
+ */
+
+/*
+ * Diffing
+ *
+ * The bytes the two strings start and end with in common are skipped
+ * first, backing off to a boundary of units found the same in both; only
+ * what is left is cut into units (code points, grapheme clusters or
+ * words), each with a hash so that comparing two is rarely more than
+ * comparing two numbers. Myers' O(ND) algorithm then runs over the units:
+ * small problems are solved greedily, keeping every round of the search
+ * to trace the path back, large ones are split at the middle snake found
+ * by searching from both ends at once, which needs space linear in the
+ * input only. Edits are merged into runs before they are reported: the
+ * units deleted and those inserted between two equal runs come as one
+ * delete and one insert.
+ */
+
+#define A_DIFF_SMALL 256                /* units of both, for the greedy search */
+
+struct a_diff_seq
+{
+    const char *s;
+    size_t *at;                         /* unit i is [at[i], at[i+1])             */
+    unsigned long *h;
+    size_t n;
+};
+
+struct a_diff
+{
+    struct a_diff_seq a, b;
+    int (*fn)(int op, size_t start1, size_t end1, size_t start2, size_t end2, void *ctx);
+    void *ctx;
+    int stop;
+    size_t distance;
+    long *v;                            /* both V arrays of the middle snake search */
+    short *trace;                       /* the rounds of the greedy search          */
+    size_t trace_mem;
+    struct                              /* byte ranges not reported yet             */
+    {
+        size_t a0, a1, b0, b1;
+    } equal, del, ins;
+    int has_equal, has_edit;
+};
+
+/* the unit kinds of word diffs: runs of word characters or spaces, or a code point alone */
+static int a_diff_internal_kind(a_cp cp)
+{
+    const unsigned int mask = A_CATEGORY_MASK(cp);
+
+    if (mask & (a_gc_letter | a_gc_mark | a_gc_number | a_gc_pc))
+        return 1;
+    if (cp == ' ' || cp == '\t' || (cp != 0x2028 && cp != 0x2029 && (mask & a_gc_separator)))
+        return 2;
+    return 0;
+}
+/* whether a unit ends between prev and cp */
+static int a_diff_internal_boundary(int options, a_cp prev, a_cp cp)
+{
+    int kind;
+
+    if (options & a_diff_words)
+        return (kind = a_diff_internal_kind(cp)) != a_diff_internal_kind(prev) || !kind;
+    if (options & a_diff_grapheme)
+        return a_grapheme_break_table[A_GCB(prev)][A_GCB(cp)];
+    return 1;
+}
+/* the size of the code point at s */
+static size_t a_diff_internal_size(const char *s)
+{
+    const unsigned char c = (unsigned char)*s;
+
+    return c < 0xC0 ? 1 : c < 0xE0 ? 2 : c < 0xF0 ? 3 : 4;
+}
+/* the start of the code point that ends at s + at */
+static size_t a_diff_internal_back(const char *s, size_t at)
+{
+    while (at && (s[--at] & 0xC0) == 0x80)
+        ;
+    return at;
+}
+
+/* cuts [start, end) of s into units */
+static int a_diff_internal_units(struct a_diff_seq *q, const char *s, size_t start, size_t end, int options)
+{
+    const char *at = s + start, *stop = s + end, *from;
+    a_cp cp, prev = 0;
+    size_t mem = 16, n = 0;
+    unsigned long h = A_HASH_BASIS;
+    size_t *grown;
+    unsigned long *hgrown;
+
+    q->s = s;
+    q->n = 0;
+    if (!(q->at = A_MALLOC(mem * sizeof *q->at)) || !(q->h = A_MALLOC(mem * sizeof *q->h)))
+        return 0;
+    while (at < stop)
+    {
+        from = at;
+        cp = a_internal_to_next_cp(&at);
+        if (at > stop)
+            at = stop;
+        if (from == s + start || a_diff_internal_boundary(options, prev, cp))
+        {
+            if (n + 1 == mem)
+            {
+                if (!(grown = A_REALLOC(q->at, mem * 2 * sizeof *q->at)))
+                    return 0;
+                q->at = grown;
+                if (!(hgrown = A_REALLOC(q->h, mem * 2 * sizeof *q->h)))
+                    return 0;
+                q->h = hgrown;
+                mem *= 2;
+            }
+            if (n)
+                q->h[n-1] = h;
+            q->at[n++] = (size_t)(from - s);
+            h = A_HASH_BASIS;
+        }
+        for (; from < at; ++from)
+            h = (h ^ (unsigned char)*from) * A_HASH_PRIME;
+        prev = cp;
+    }
+    if (n)
+        q->h[n-1] = h;
+    q->at[n] = end;
+    q->n = n;
+    return 1;
+}
+
+static int a_diff_internal_same(const struct a_diff *d, size_t i, size_t j)
+{
+    const size_t size = d->a.at[i+1] - d->a.at[i];
+
+    return d->a.h[i] == d->b.h[j] && size == d->b.at[j+1] - d->b.at[j]
+        && !memcmp(d->a.s + d->a.at[i], d->b.s + d->b.at[j], size);
+}
+
+/*
+ * The edit script: byte ranges go in as they are found, in order, and out
+ * merged into runs.
+ */
+static void a_diff_internal_report(struct a_diff *d, int op, size_t a0, size_t a1, size_t b0, size_t b1)
+{
+    if (!d->stop && !d->fn(op, a0, a1, b0, b1, d->ctx))
+        d->stop = 1;
+}
+static void a_diff_internal_flush_edit(struct a_diff *d)
+{
+    if (!d->has_edit)
+        return;
+    if (d->del.a0 != d->del.a1)
+        a_diff_internal_report(d, a_diff_delete, d->del.a0, d->del.a1, d->del.b0, d->del.b0);
+    if (d->ins.b0 != d->ins.b1)
+        a_diff_internal_report(d, a_diff_insert, d->ins.a0, d->ins.a0, d->ins.b0, d->ins.b1);
+    d->has_edit = 0;
+}
+static void a_diff_internal_flush(struct a_diff *d)
+{
+    a_diff_internal_flush_edit(d);
+    if (d->has_equal)
+        a_diff_internal_report(d, a_diff_equal, d->equal.a0, d->equal.a1, d->equal.b0, d->equal.b1);
+    d->has_equal = 0;
+}
+static void a_diff_internal_equal(struct a_diff *d, size_t a0, size_t a1, size_t b0, size_t b1)
+{
+    if (a0 == a1)
+        return;
+    a_diff_internal_flush_edit(d);
+    if (d->has_equal && d->equal.a1 == a0)
+    {
+        d->equal.a1 = a1;
+        d->equal.b1 = b1;
+        return;
+    }
+    a_diff_internal_flush(d);
+    d->equal.a0 = a0, d->equal.a1 = a1;
+    d->equal.b0 = b0, d->equal.b1 = b1;
+    d->has_equal = 1;
+}
+/* deletes units [i0, i1) of a, inserts units [j0, j1) of b */
+static void a_diff_internal_edit(struct a_diff *d, size_t i0, size_t i1, size_t j0, size_t j1)
+{
+    const size_t a0 = d->a.at[i0], a1 = d->a.at[i1], b0 = d->b.at[j0], b1 = d->b.at[j1];
+
+    if (i0 == i1 && j0 == j1)
+        return;
+    d->distance += (i1 - i0) + (j1 - j0);
+    if (!d->has_edit)
+    {
+        if (d->has_equal)
+            a_diff_internal_flush(d);
+        d->del.a0 = d->del.a1 = a0;
+        d->del.b0 = b0;
+        d->ins.b0 = d->ins.b1 = b0;
+        d->has_edit = 1;
+    }
+    if (a0 != a1)
+        d->del.a1 = a1;
+    if (b0 != b1)
+        d->ins.b1 = b1;
+    d->ins.a0 = d->del.a1;
+}
+static void a_diff_internal_equal_units(struct a_diff *d, size_t i0, size_t i1, size_t j0)
+{
+    if (i0 != i1)
+        a_diff_internal_equal(d, d->a.at[i0], d->a.at[i1], d->b.at[j0], d->b.at[j0 + i1 - i0]);
+}
+
+/*
+ * Where round e of the greedy search starts on diagonal k: after an insert
+ * from diagonal k+1 (*down is set) or a delete from k-1, whichever reaches
+ * further, given V of the round before (indexed from -(e-1)). -1 if it
+ * cannot be reached without leaving the grid.
+ */
+static long a_diff_internal_from(const short *prev, long e, long k, long n, long m, int *down)
+{
+    long xd = -1, xr = -1;
+
+    if (k + 1 <= e - 1 && prev[k + e] >= 0 && prev[k + e] - k <= m)
+        xd = prev[k + e];
+    if (k - 1 >= 1 - e && prev[k + e - 2] >= 0 && prev[k + e - 2] < n)
+        xr = prev[k + e - 2] + 1;
+    *down = xd >= xr;
+    return *down ? xd : xr;
+}
+
+/*
+ * Greedy forward search keeping V of every round e (its 2e+1 diagonals
+ * at e*e), then the path is traced back from the end.
+ */
+static int a_diff_internal_greedy(struct a_diff *d, size_t i0, size_t i1, size_t j0, size_t j1)
+{
+    const long n = (long)(i1 - i0), m = (long)(j1 - j0);
+    struct a_diff_step
+    {
+        long x0, y0, x, y;              /* after the edit of the round, the end of its snake */
+        int down;
+    } path[A_DIFF_SMALL + 1];
+    short *grown, *v;
+    long k, x, y, e, steps = 0;
+    size_t need;
+    int down;
+
+    for (e = 0;; ++e)
+    {
+        need = (size_t)(e + 1) * (size_t)(e + 1);
+        if (need > d->trace_mem)
+        {
+            if (!(grown = A_REALLOC(d->trace, need * 2 * sizeof *grown)))
+                return 0;
+            d->trace = grown;
+            d->trace_mem = need * 2;
+        }
+        v = d->trace + e * e;
+        for (k = -e; k <= e; k += 2)
+        {
+            x = e ? a_diff_internal_from(d->trace + (e - 1) * (e - 1), e, k, n, m, &down) : 0;
+            if (x < 0 || (y = x - k) < 0 || y > m)
+            {
+                v[k + e] = -1;
+                continue;
+            }
+            while (x < n && y < m && a_diff_internal_same(d, i0 + (size_t)x, j0 + (size_t)y))
+                ++x, ++y;
+            v[k + e] = (short)x;
+            if (x == n && y == m)
+                goto found;
+        }
+    }
+
+found:
+    for (x = n, y = m; e > 0; --e, ++steps)
+    {
+        k = x - y;
+        path[steps].x = x;
+        path[steps].y = y;
+        path[steps].x0 = a_diff_internal_from(d->trace + (e - 1) * (e - 1), e, k, n, m, &down);
+        path[steps].y0 = path[steps].x0 - k;
+        path[steps].down = down;
+        x = path[steps].x0 - !down;
+        y = path[steps].y0 - down;
+    }
+    /* the snake of round 0 */
+    a_diff_internal_equal_units(d, i0, i0 + (size_t)x, j0);
+    while (steps--)
+    {
+        const struct a_diff_step *s = &path[steps];
+
+        if (s->down)
+            a_diff_internal_edit(d, i0 + (size_t)s->x0, i0 + (size_t)s->x0, j0 + (size_t)s->y0 - 1, j0 + (size_t)s->y0);
+        else
+            a_diff_internal_edit(d, i0 + (size_t)s->x0 - 1, i0 + (size_t)s->x0, j0 + (size_t)s->y0, j0 + (size_t)s->y0);
+        a_diff_internal_equal_units(d, i0 + (size_t)s->x0, i0 + (size_t)s->x, j0 + (size_t)s->y0);
+    }
+    return 1;
+}
+
+/*
+ * Finds a point on the middle snake of the shortest path: searches from
+ * the start and from the end until the two meet. Returns 0 if they
+ * never do (they always do).
+ */
+static int a_diff_internal_bisect(struct a_diff *d, size_t i0, size_t i1, size_t j0, size_t j1,
+                                  size_t *split_x, size_t *split_y)
+{
+    const long n = (long)(i1 - i0), m = (long)(j1 - j0), max = (n + m + 1) / 2, size = 2 * max + 2;
+    const long delta = n - m;
+    const int front = delta % 2 != 0;
+    long *v1 = d->v, *v2 = d->v + size;
+    long e, k1, k2, off1, off2, x1, y1, x2, y2;
+    long k1start = 0, k1end = 0, k2start = 0, k2end = 0;
+
+    for (e = 0; e < size; ++e)
+        v1[e] = v2[e] = -1;
+    v1[max + 1] = v2[max + 1] = 0;
+
+    for (e = 0; e < max; ++e)
+    {
+        for (k1 = -e + k1start; k1 <= e - k1end; k1 += 2)
+        {
+            off1 = max + k1;
+            if (k1 == -e || (k1 != e && v1[off1 - 1] < v1[off1 + 1]))
+                x1 = v1[off1 + 1];
+            else
+                x1 = v1[off1 - 1] + 1;
+            y1 = x1 - k1;
+            while (x1 < n && y1 < m && a_diff_internal_same(d, i0 + x1, j0 + y1))
+                ++x1, ++y1;
+            v1[off1] = x1;
+            if (x1 > n)
+                k1end += 2;
+            else if (y1 > m)
+                k1start += 2;
+            else if (front)
+            {
+                off2 = max + delta - k1;
+                if (off2 >= 0 && off2 < size && v2[off2] != -1 && x1 >= n - v2[off2])
+                {
+                    *split_x = (size_t)x1;
+                    *split_y = (size_t)y1;
+                    return 1;
+                }
+            }
+        }
+        for (k2 = -e + k2start; k2 <= e - k2end; k2 += 2)
+        {
+            off2 = max + k2;
+            if (k2 == -e || (k2 != e && v2[off2 - 1] < v2[off2 + 1]))
+                x2 = v2[off2 + 1];
+            else
+                x2 = v2[off2 - 1] + 1;
+            y2 = x2 - k2;
+            while (x2 < n && y2 < m && a_diff_internal_same(d, i0 + n - x2 - 1, j0 + m - y2 - 1))
+                ++x2, ++y2;
+            v2[off2] = x2;
+            if (x2 > n)
+                k2end += 2;
+            else if (y2 > m)
+                k2start += 2;
+            else if (!front)
+            {
+                off1 = max + delta - k2;
+                if (off1 >= 0 && off1 < size && v1[off1] != -1 && v1[off1] >= n - x2)
+                {
+                    *split_x = (size_t)v1[off1];
+                    *split_y = (size_t)(max + v1[off1] - off1);
+                    return 1;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+static int a_diff_internal_run(struct a_diff *d, size_t i0, size_t i1, size_t j0, size_t j1)
+{
+    size_t head = 0, tail = 0, x, y;
+
+    while (i0 + head < i1 && j0 + head < j1 && a_diff_internal_same(d, i0 + head, j0 + head))
+        ++head;
+    a_diff_internal_equal_units(d, i0, i0 + head, j0);
+    i0 += head, j0 += head;
+    while (i1 - tail > i0 && j1 - tail > j0 && a_diff_internal_same(d, i1 - tail - 1, j1 - tail - 1))
+        ++tail;
+    i1 -= tail, j1 -= tail;
+
+    if (i0 == i1 || j0 == j1)
+        a_diff_internal_edit(d, i0, i1, j0, j1);
+    else if ((i1 - i0) + (j1 - j0) <= A_DIFF_SMALL)
+    {
+        if (!a_diff_internal_greedy(d, i0, i1, j0, j1))
+            return 0;
+    }
+    else if (a_diff_internal_bisect(d, i0, i1, j0, j1, &x, &y))
+    {
+        if (!a_diff_internal_run(d, i0, i0 + x, j0, j0 + y) || !a_diff_internal_run(d, i0 + x, i1, j0 + y, j1))
+            return 0;
+    }
+    else
+        a_diff_internal_edit(d, i0, i1, j0, j1);
+
+    a_diff_internal_equal_units(d, i1, i1 + tail, j1);
+    return 1;
+}
+
+static size_t a_diff_internal(const char *s1, size_t size1, const char *s2, size_t size2, int options,
+                              int (*fn)(int op, size_t start1, size_t end1, size_t start2, size_t end2, void *ctx),
+                              void *ctx)
+{
+    struct a_diff d;
+    size_t head = 0, tail = 0, cut, t, at, max;
+    int ok = 0;
+
+    d.fn = fn;
+    d.ctx = ctx;
+    d.stop = 0;
+    d.distance = 0;
+    d.v = NULL;
+    d.trace = NULL;
+    d.trace_mem = 0;
+    d.has_equal = d.has_edit = 0;
+    d.a.at = d.b.at = NULL;
+    d.a.h = d.b.h = NULL;
+
+    /* the same bytes at the start, cut back to where the same unit starts in both */
+    while (head < size1 && head < size2 && s1[head] == s2[head])
+        ++head;
+    for (cut = head; cut && ((cut < size1 && (s1[cut] & 0xC0) == 0x80) || (cut < size2 && (s2[cut] & 0xC0) == 0x80));)
+        --cut;
+    while (cut && (cut < size1 || cut < size2) && (options & (a_diff_grapheme | a_diff_words)))
+    {
+        /* whether a unit starts at the cut depends on the code point after it too */
+        at = a_diff_internal_back(s1, cut);
+        if (cut < head && cut + a_diff_internal_size(s1 + cut) <= head
+                && a_diff_internal_boundary(options, a_internal_char_to_cp(s1 + at), a_internal_char_to_cp(s1 + cut)))
+            break;
+        cut = at;
+    }
+
+    /* and at the end, short of the cut, where the code point before is the same in both */
+    while (tail < size1 - cut && tail < size2 - cut && s1[size1 - tail - 1] == s2[size2 - tail - 1])
+        ++tail;
+    for (t = tail; t;)
+    {
+        at = size1 - t;
+        if ((s1[at] & 0xC0) == 0x80)
+        {
+            --t;
+            continue;
+        }
+        if (!(options & (a_diff_grapheme | a_diff_words)))
+            break;
+        if (a_diff_internal_back(s1, at) >= size1 - tail
+                && a_diff_internal_boundary(options, a_internal_char_to_cp(s1 + a_diff_internal_back(s1, at)),
+                                            a_internal_char_to_cp(s1 + at)))
+            break;
+        t -= a_diff_internal_size(s1 + at) < t ? a_diff_internal_size(s1 + at) : t;
+    }
+
+    if (!a_diff_internal_units(&d.a, s1, cut, size1 - t, options)
+            || !a_diff_internal_units(&d.b, s2, cut, size2 - t, options))
+        goto done;
+    max = (d.a.n + d.b.n + 1) / 2;
+    if (d.a.n + d.b.n > A_DIFF_SMALL && !(d.v = A_MALLOC((4 * max + 4) * sizeof *d.v)))
+        goto done;
+
+    a_diff_internal_equal(&d, 0, cut, 0, cut);
+    if (!a_diff_internal_run(&d, 0, d.a.n, 0, d.b.n))
+        goto done;
+    a_diff_internal_equal(&d, size1 - t, size1, size2 - t, size2);
+    a_diff_internal_flush(&d);
+    ok = 1;
+
+done:
+    A_FREE(d.a.at);
+    A_FREE(d.a.h);
+    A_FREE(d.b.at);
+    A_FREE(d.b.h);
+    A_FREE(d.v);
+    A_FREE(d.trace);
+    return ok ? d.distance : A_EOS;
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+size_t a_diff(a_cstr str1, a_cstr str2, int options,
+              int (*fn)(int op, size_t start1, size_t end1, size_t start2, size_t end2, void *ctx), void *ctx)
+{
+    assert(str1 != NULL && str2 != NULL);
+    PASSTHROUGH_ON_FAIL(str1 != NULL && str2 != NULL, A_EOS);
+    return a_diff_size(str1, a_size(str1), str2, a_size(str2), options, fn, ctx);
+}
+size_t a_diff_cstr(const char *str1, const char *str2, int options,
+                   int (*fn)(int op, size_t start1, size_t end1, size_t start2, size_t end2, void *ctx), void *ctx)
+{
+    assert(str1 != NULL && str2 != NULL);
+    PASSTHROUGH_ON_FAIL(str1 != NULL && str2 != NULL, A_EOS);
+    return a_diff_size(str1, strlen(str1), str2, strlen(str2), options, fn, ctx);
+}
+size_t a_diff_size(const char *str1, size_t size1, const char *str2, size_t size2, int options,
+                   int (*fn)(int op, size_t start1, size_t end1, size_t start2, size_t end2, void *ctx), void *ctx)
+{
+    assert(str1 != NULL && str2 != NULL && fn != NULL);
+    PASSTHROUGH_ON_FAIL(str1 != NULL && str2 != NULL && fn != NULL, A_EOS);
+    return a_diff_internal(str1, size1, str2, size2, options, fn, ctx);
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC
+ *
+ * License: MIT
+ */
+
+/*
+ * Encoding Detection and Transcoding
+ *
+ * Input is decoded a block at a time. Units cut off at the end of a
+ * block are left for the next one, and whatever can't be decoded is
+ * replaced by U+FFFD as it goes, so the output is always valid UTF-8.
+ */
+#if A_INCLUDE_IO == 1
+
+/* worst case growth of the output, per input byte (an invalid byte -> U+FFFD) */
+#define A_ENCODING_MAX_GROWTH 3
+
+/* whether [p, end) could be the start of a valid sequence */
+static int a_encoding_internal_partial_utf8(const unsigned char *p, const unsigned char *end)
+{
+    const unsigned char *q;
+
+    if (*p < 0xC2 || *p > 0xF4 || (size_t)(end - p) >= (size_t)a_next_char_size[*p])
+        return 0;
+    for (q = p + 1; q < end; ++q)
+        if ((*q & 0xC0) != 0x80)
+            return 0;
+    return 1;
+}
+
+/*
+ * Guesses the encoding of the first size bytes of a text and returns the
+ * size of its BOM, if any. Without a BOM, a lot of zero bytes on one side
+ * of the 16-bit units means UTF-16, valid UTF-8 means UTF-8 and anything
+ * else is taken as Latin-1.
+ */
+static size_t a_encoding_internal_sniff(const char *s, size_t size, int *enc)
+{
+    const unsigned char *p = (const unsigned char*)s;
+    size_t i, zeros[2] = { 0, 0 }, valid;
+
+    if (size >= 3 && p[0] == 0xEF && p[1] == 0xBB && p[2] == 0xBF)
+        return *enc = a_encoding_utf8, 3;
+    if (size >= 2 && p[0] == 0xFF && p[1] == 0xFE)
+        return *enc = a_encoding_utf16le, 2;
+    if (size >= 2 && p[0] == 0xFE && p[1] == 0xFF)
+        return *enc = a_encoding_utf16be, 2;
+
+    for (i = 0; i < size; ++i)
+        zeros[i & 1] += !p[i];
+    if (zeros[1] > size / 8 && zeros[0] * 2 < zeros[1])
+        return *enc = a_encoding_utf16le, 0;
+    if (zeros[0] > size / 8 && zeros[1] * 2 < zeros[0])
+        return *enc = a_encoding_utf16be, 0;
+
+    /* a sequence cut off by the end of the block is still fine */
+    valid = a_internal_valid_utf8_size(s, size);
+    *enc = valid == size || a_encoding_internal_partial_utf8(p + valid, p + size)
+         ? a_encoding_utf8 : a_encoding_latin1;
+    return 0;
+}
+
+/*
+ * Resolves *enc (sniffing if it's a_encoding_detect) from the first block
+ * and returns the size of the BOM to skip, only if it matches *enc.
+ */
+static size_t a_encoding_internal_start(const char *s, size_t size, int *enc)
+{
+    int found;
+    size_t bom = a_encoding_internal_sniff(s, size, &found);
+
+    if (*enc == a_encoding_detect)
+        *enc = found;
+    return found == *enc ? bom : 0;
+}
+
+static size_t a_encoding_internal_put(char *o, a_cp cp)
+{
+    unsigned char *u = (unsigned char*)o;
+
+    if (cp < 0x80)
+        return u[0] = (unsigned char)cp, 1;
+    if (cp < 0x800)
+        return u[0] = (unsigned char)(0xC0 | (cp >> 6)),
+               u[1] = (unsigned char)(0x80 | (cp & 0x3F)), 2;
+    if (cp < 0x10000)
+        return u[0] = (unsigned char)(0xE0 | (cp >> 12)),
+               u[1] = (unsigned char)(0x80 | ((cp >> 6) & 0x3F)),
+               u[2] = (unsigned char)(0x80 | (cp & 0x3F)), 3;
+    return u[0] = (unsigned char)(0xF0 | (cp >> 18)),
+           u[1] = (unsigned char)(0x80 | ((cp >> 12) & 0x3F)),
+           u[2] = (unsigned char)(0x80 | ((cp >> 6) & 0x3F)),
+           u[3] = (unsigned char)(0x80 | (cp & 0x3F)), 4;
+}
+
+/*
+ * Decodes [in, in+size) in the given encoding into out, which must have
+ * room for size * A_ENCODING_MAX_GROWTH bytes. Returns the number of bytes
+ * written; *used receives the number of input bytes consumed, which is
+ * less than size when the block ends in the middle of a unit, unless eof.
+ */
+static size_t a_encoding_internal_decode(int enc, const char *in, size_t size, char *out,
+                                         size_t *used, int eof)
+{
+    const unsigned char *p = (const unsigned char*)in, *end = p + size;
+    char *o = out;
+
+    switch (enc)
+    {
+        case a_encoding_latin1:
+            while (p < end)
+            {
+                /* ASCII runs are copied a word at a time */
+                while ((size_t)(end - p) >= sizeof (size_t))
+                {
+                    size_t w;
+                    memcpy(&w, p, sizeof w);
+                    if (w & A_SWAR_HIGHS)
+                        break;
+                    memcpy(o, p, sizeof w);
+                    o += sizeof w, p += sizeof w;
+                }
+                if (p < end)
+                    o += a_encoding_internal_put(o, *p++);
+            }
+            break;
+        case a_encoding_utf16le:
+        case a_encoding_utf16be:
+        {
+            int be = enc == a_encoding_utf16be;
+
+            while (end - p >= 2)
+            {
+                a_cp cp = be ? (a_cp)(p[0] << 8 | p[1]) : (a_cp)(p[1] << 8 | p[0]);
+
+                if (0xD800 <= cp && cp <= 0xDBFF)
+                {
+                    a_cp lo;
+
+                    if (end - p < 4 && !eof)
+                        break;
+                    lo = end - p < 4 ? 0 : be ? (a_cp)(p[2] << 8 | p[3]) : (a_cp)(p[3] << 8 | p[2]);
+                    if (0xDC00 <= lo && lo <= 0xDFFF)
+                    {
+                        cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+                        p += 2;
+                    }
+                    else
+                        cp = 0xFFFD;
+                }
+                else if (0xDC00 <= cp && cp <= 0xDFFF)
+                    cp = 0xFFFD;
+                o += a_encoding_internal_put(o, cp);
+                p += 2;
+            }
+            if (eof && p < end)
+                o += a_encoding_internal_put(o, 0xFFFD), ++p;
+            break;
+        }
+        default: /* a_encoding_utf8 */
+            while (p < end)
+            {
+                size_t n = a_internal_valid_utf8_size((const char*)p, (size_t)(end - p));
+
+                memcpy(o, p, n);
+                o += n, p += n;
+                if (p == end || (!eof && a_encoding_internal_partial_utf8(p, end)))
+                    break;
+                o += a_encoding_internal_put(o, 0xFFFD);
+                ++p;
+            }
+            break;
+    }
+    *used = (size_t)(p - (const unsigned char*)in);
+    return (size_t)(o - out);
+}
+
+#endif
@@ -0,0 +1,404 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC
+ *
+ * License: MIT
+ */
+
+/*
+ * Escaping/Unescaping
+ */
+
+static const char a_escape_hex[] = "0123456789abcdef";
+
+/* checks whether a single byte has to be escaped */
+static int a_escape_internal_needs(unsigned char c, const char *except, int opts)
+{
+    if (!(c < 0x20 || c == '"' || c == '\\'
+            || (c == 0x7F && !(opts & a_escape_json))
+            || (c >= 0x80 && (opts & a_escape_ascii))))
+        return 0;
+    return !(except && c && c < 0x80 && strchr(except, c));
+}
+
+/*
+ * Returns a pointer to the first byte in [s, end) that has to be escaped,
+ * or end. Whole words are skipped as long as none of their bytes are
+ * below 0x20, '"', '\\' (or 0x7F and 0x80+ depending on opts); words
+ * that might contain one are rechecked a byte at a time.
+ */
+static const char *a_escape_internal_skip(const char *s, const char *end, const char *except, int opts)
+{
+    size_t i;
+
+    for (;;)
+    {
+        for (; (size_t)(end - s) >= sizeof (size_t); s += sizeof (size_t))
+        {
+            size_t w, q, b, t;
+
+            memcpy(&w, s, sizeof w);
+            q = w ^ (A_SWAR_ONES * '"');
+            b = w ^ (A_SWAR_ONES * '\\');
+            t = ((w - A_SWAR_ONES * 0x20) & ~w) /* < 0x20 */
+                | ((q - A_SWAR_ONES) & ~q)      /* == '"' */
+                | ((b - A_SWAR_ONES) & ~b);     /* == '\\' */
+            if (!(opts & a_escape_json))
+            {
+                size_t d = w ^ (A_SWAR_ONES * 0x7F);
+                t |= (d - A_SWAR_ONES) & ~d;
+            }
+            if (opts & a_escape_ascii)
+                t |= w;
+            if (t & A_SWAR_HIGHS)
+                break;
+        }
+        for (i = 0; i < sizeof (size_t) && s < end; ++i, ++s)
+            if (a_escape_internal_needs((unsigned char)*s, except, opts))
+                return s;
+        if (s >= end)
+            return end;
+    }
+}
+
+static char *a_escape_internal_u(char *b, char u, unsigned int v, int digits)
+{
+    *b++ = '\\';
+    *b++ = u;
+    while (digits--)
+        *b++ = a_escape_hex[(v >> (digits * 4)) & 0xF];
+    return b;
+}
+
+/*
+ * Writes the escape sequence for the character at s into b and returns
+ * its size. *consumed receives the number of bytes the character spans.
+ * A sequence cut off by end is not decoded: its bytes are escaped one by
+ * one in octal, or as a single \ufffd in JSON.
+ */
+static size_t a_escape_internal_seq(const char *s, const char *end, char *b, size_t *consumed, int opts)
+{
+    unsigned char c = (unsigned char)*s;
+    char *p = b;
+
+    *consumed = 1;
+    if (c >= 0x80 && (size_t)a_next_char_size[c] > (size_t)(end - s))
+    {
+        *consumed = (size_t)(end - s);
+        if (opts & a_escape_json)
+            return (size_t)(a_escape_internal_u(b, 'u', 0xFFFD, 4) - b);
+        for (; s < end; ++s)
+        {
+            c = (unsigned char)*s;
+            *p++ = '\\';
+            *p++ = (char)('0' + (c >> 6));
+            *p++ = (char)('0' + ((c >> 3) & 7));
+            *p++ = (char)('0' + (c & 7));
+        }
+        return (size_t)(p - b);
+    }
+    *p++ = '\\';
+    switch (c)
+    {
+        case '\b': *p++ = 'b'; break;
+        case '\f': *p++ = 'f'; break;
+        case '\n': *p++ = 'n'; break;
+        case '\r': *p++ = 'r'; break;
+        case '\t': *p++ = 't'; break;
+        case '"':  *p++ = '"'; break;
+        case '\\': *p++ = '\\'; break;
+        default:
+            if (c >= 0x80)
+            {
+                unsigned int cp = (unsigned int)a_internal_char_to_cp(s);
+
+                *consumed = (size_t)a_next_char_size[c];
+                if (!(opts & a_escape_json))
+                    p = a_escape_internal_u(b, cp > 0xFFFF ? 'U' : 'u', cp, cp > 0xFFFF ? 8 : 4);
+                else if (cp > 0xFFFF)
+                {
+                    cp -= 0x10000;
+                    p = a_escape_internal_u(b, 'u', 0xD800 + (cp >> 10), 4);
+                    p = a_escape_internal_u(p, 'u', 0xDC00 + (cp & 0x3FF), 4);
+                }
+                else
+                    p = a_escape_internal_u(b, 'u', cp, 4);
+            }
+            else if (opts & a_escape_json)
+                p = a_escape_internal_u(b, 'u', c, 4);
+            else if (c == '\v')
+                *p++ = 'v';
+            else
+            {
+                *p++ = (char)('0' + (c >> 6));
+                *p++ = (char)('0' + ((c >> 3) & 7));
+                *p++ = (char)('0' + (c & 7));
+            }
+            break;
+    }
+    return (size_t)(p - b);
+}
+
+struct a_escape_job
+{
+    const char *s;
+    const char *end;                /* end of the whole string          */
+    const char *except;
+    int opts;
+    size_t at[A_MAX_THREADS + 1];
+    size_t size[A_MAX_THREADS];     /* escaped size of every chunk      */
+    size_t len[A_MAX_THREADS];      /* code points added to every chunk */
+    char *out;                      /* NULL while precounting           */
+    size_t base[A_MAX_THREADS];     /* where every chunk goes in out    */
+};
+
+/*
+ * Precounts or escapes a single chunk. A character that runs over the
+ * end of the chunk (only in invalid UTF-8) is fully handled by it, both
+ * passes agreeing on that is all that matters for the sizes to be right.
+ */
+static void a_escape_internal_job(void *ctx, size_t i)
+{
+    struct a_escape_job *job = ctx;
+    const char *s = job->s + job->at[i], *end = job->s + job->at[i+1], *run;
+    char b[2 * 6], *w = job->out ? job->out + job->base[i] : NULL;
+    size_t size = 0, len = 0, consumed, n;
+
+    while (s < end)
+    {
+        run = s;
+        s = a_escape_internal_skip(s, end, job->except, job->opts);
+        if (w)
+            memcpy(w, run, (size_t)(s - run)), w += s - run;
+        size += (size_t)(s - run);
+        if (s == end)
+            break;
+        n = a_escape_internal_seq(s, job->end, w ? w : b, &consumed, job->opts);
+        if (w)
+            w += n;
+        size += n;
+        len += n - a_internal_count_cp_seq(s, consumed);
+        s += consumed;
+    }
+    job->size[i] = size;
+    job->len[i] = len;
+}
+
+/* large strings are precounted and escaped a chunk per thread */
+static a_str a_escape_internal_parallel(a_str str, const char *except, int opts, size_t n)
+{
+    struct a_escape_job job;
+    size_t i, size = 0, len = 0;
+    a_str newstr;
+
+    job.s = str;
+    job.end = str + a_size(str);
+    job.except = except;
+    job.opts = opts;
+    job.out = NULL;
+    a_internal_split(str, a_size(str), n, job.at);
+    a_internal_parallel(n, a_escape_internal_job, &job);
+    for (i = 0; i < n; ++i)
+    {
+        job.base[i] = size;
+        size += job.size[i];
+        len += job.len[i];
+    }
+    if (size == a_size(str))
+        return str;
+
+    if (!(newstr = a_new_mem_raw(size)))
+    {
+        a_free(str);
+        return NULL;
+    }
+    job.out = newstr;
+    a_internal_parallel(n, a_escape_internal_job, &job);
+    newstr[size] = '\0';
+    a_header(newstr)->size = size;
+    a_header(newstr)->len = a_len(str) + len;
+    a_free(str);
+    return newstr;
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+a_str a_escape(a_str str)
+{
+    return a_escape_opts(str, NULL, a_escape_c);
+}
+a_str a_escape_except(a_str str, const char *except)
+{
+    return a_escape_opts(str, except, a_escape_c);
+}
+a_str a_escape_opts(a_str str, const char *except, int opts)
+{
+    const char *s, *run, *end;
+    char b[2 * 6], *w;
+    size_t size, len, consumed, n;
+    a_str newstr;
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+
+    if ((n = a_internal_threads(a_size(str), 0)) > 1)
+        return a_escape_internal_parallel(str, except, opts, n);
+
+    /* precount the exact output size */
+    end = str + a_size(str);
+    size = a_size(str);
+    len = a_len(str);
+    for (s = str; (s = a_escape_internal_skip(s, end, except, opts)) != end; s += consumed)
+    {
+        n = a_escape_internal_seq(s, end, b, &consumed, opts);
+        size += n - consumed;
+        len += n - a_internal_count_cp_seq(s, consumed);
+    }
+    if (size == a_size(str))
+        return str;
+
+    if (!(newstr = a_new_mem_raw(size)))
+    {
+        a_free(str);
+        return NULL;
+    }
+
+    /* clean runs are copied as a whole */
+    for (s = str, w = newstr; ; s += consumed)
+    {
+        run = s;
+        s = a_escape_internal_skip(s, end, except, opts);
+        memcpy(w, run, (size_t)(s - run));
+        w += s - run;
+        if (s == end)
+            break;
+        w += a_escape_internal_seq(s, end, w, &consumed, opts);
+    }
+    *w = '\0';
+    a_header(newstr)->size = size;
+    a_header(newstr)->len = len;
+    a_free(str);
+    return newstr;
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+/* reads exactly n hex digits, unsigned as 8 of them may not fit an a_cp */
+static int a_unescape_internal_hex(const char *s, const char *end, int n, unsigned long *cp)
+{
+    unsigned long v = 0;
+
+    if (end - s < n)
+        return 0;
+    for (; n--; ++s)
+    {
+        if ('0' <= *s && *s <= '9')
+            v = (v << 4) | (unsigned long)(*s - '0');
+        else if ('a' <= (*s | 0x20) && (*s | 0x20) <= 'f')
+            v = (v << 4) | (unsigned long)((*s | 0x20) - 'a' + 10);
+        else
+            return 0;
+    }
+    *cp = v;
+    return 1;
+}
+
+a_str a_unescape(a_str str)
+{
+    struct a_header *h;
+    char *r, *w, *end, *bs;
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+
+    h = a_header(str);
+    end = str + h->size;
+
+    /* every escape sequence decodes to fewer bytes, so this works in place */
+    for (r = w = str; (bs = memchr(r, '\\', (size_t)(end - r))); )
+    {
+        unsigned long v, lo;
+        a_cp cp;
+        char c;
+
+        if (w != r)
+            memmove(w, r, (size_t)(bs - r));
+        w += bs - r;
+        r = bs + 1;
+        if (r == end)
+        {
+            *w++ = '\\';
+            break;
+        }
+
+        switch (c = *r++)
+        {
+            case 'a': *w++ = '\a'; break;
+            case 'b': *w++ = '\b'; break;
+            case 'f': *w++ = '\f'; break;
+            case 'n': *w++ = '\n'; break;
+            case 'r': *w++ = '\r'; break;
+            case 't': *w++ = '\t'; break;
+            case 'v': *w++ = '\v'; break;
+            case '0': case '1': case '2': case '3':
+            case '4': case '5': case '6': case '7':
+                cp = c - '0';
+                if (r < end && '0' <= *r && *r <= '7')
+                    cp = (cp << 3) | (*r++ - '0');
+                if (r < end && '0' <= *r && *r <= '7')
+                    cp = (cp << 3) | (*r++ - '0');
+                *w++ = (char)(cp & 0xFF);
+                break;
+            case 'x':
+                if (a_unescape_internal_hex(r, end, 2, &v))
+                    *w++ = (char)v, r += 2;
+                else if (a_unescape_internal_hex(r, end, 1, &v))
+                    *w++ = (char)v, r += 1;
+                else
+                    *w++ = c;
+                break;
+            case 'u':
+            case 'U':
+                if (!a_unescape_internal_hex(r, end, c == 'u' ? 4 : 8, &v))
+                {
+                    *w++ = c;
+                    break;
+                }
+                r += c == 'u' ? 4 : 8;
+                if (0xD800 <= v && v <= 0xDBFF && end - r >= 6 && r[0] == '\\' && r[1] == 'u'
+                        && a_unescape_internal_hex(r + 2, end, 4, &lo) && 0xDC00 <= lo && lo <= 0xDFFF)
+                {
+                    v = 0x10000 + ((v - 0xD800) << 10) + (lo - 0xDC00);
+                    r += 6;
+                }
+                /* checked before it is narrowed to an a_cp */
+                if (v > (unsigned long)A_MAX_CP || (0xD800 <= v && v <= 0xDFFF))
+                    v = 0xFFFD;
+                cp = (a_cp)v;
+                if (cp < 0x80)
+                    *w++ = (char)cp;
+                else
+                {
+                    char b[A_MAX_CHAR];
+                    int size;
+
+                    a_to_utf8_size(cp, b, &size);
+                    memcpy(w, b, (size_t)size);
+                    w += size;
+                }
+                break;
+            default:
+                *w++ = c;
+                break;
+        }
+    }
+    if (w != r)
+        memmove(w, r, (size_t)(end - r));
+    w += end - r;
+
+    *w = '\0';
+    h->size = (size_t)(w - str);
+    h->len = a_internal_count_cp(str, h->size);
+    return str;
+}
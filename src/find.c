@@ -115,6 +115,20 @@ size_t a_find_offset_from_cstr(a_cstr str, const char *substr, size_t offset)
     
     return a_find_offset_internal(str, substr, a_size(str), strlen(substr), offset);
 }
+size_t a_find_all_offset(a_cstr str, a_cstr substr, size_t *offsets, size_t max)
+{
+    assert(str != NULL && substr != NULL && (offsets != NULL || !max));
+    PASSTHROUGH_ON_FAIL(str != NULL && substr != NULL && (offsets != NULL || !max), 0);
+    
+    return a_count_internal(str, a_size(str), substr, a_size(substr), offsets, max);
+}
+size_t a_find_all_offset_cstr(a_cstr str, const char *substr, size_t *offsets, size_t max)
+{
+    assert(str != NULL && substr != NULL && (offsets != NULL || !max));
+    PASSTHROUGH_ON_FAIL(str != NULL && substr != NULL && (offsets != NULL || !max), 0);
+    
+    return a_count_internal(str, a_size(str), substr, strlen(substr), offsets, max);
+}
 
 /********************************************************************/
 
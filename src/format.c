@@ -0,0 +1,568 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC
+ *
+ * License: MIT
+ */
+
+/*
+ * Formatting
+ *
+ * Everything is written straight into the string's buffer. Integers and
+ * strings are converted here, floating point values go through snprintf()
+ * into the spare room of the buffer, which is grown and retried only if
+ * it turns out to be too small.
+ */
+#if ALEPH_C_V == 2
+#include <stddef.h>
+#include <stdint.h>
+
+enum a_fmt_flags
+{
+    a_fmt_left  = 0x01,
+    a_fmt_plus  = 0x02,
+    a_fmt_space = 0x04,
+    a_fmt_alt   = 0x08,
+    a_fmt_zero  = 0x10
+};
+#define A_FMT_NONE (-1) /* no width/precision given */
+#define A_FMT_ARG  (-2) /* width/precision taken from the arguments */
+
+struct a_fmt_spec
+{
+    int flags;
+    int width;
+    int prec;
+    char length;    /* 0, 'H' (hh), 'h', 'l', 'q' (ll), 'j', 'z', 't', 'L' */
+    char conv;
+};
+struct a_fmt_seg
+{
+    size_t offset;  /* literal text preceding the conversion */
+    size_t size;
+    size_t len;
+    struct a_fmt_spec spec; /* conv is 0 for the trailing literal */
+};
+struct a_fmt
+{
+    size_t count;
+    struct a_fmt_seg *segs;
+    char *text;
+};
+
+/*
+ * Parses a conversion specification, f points past the '%'. Returns a
+ * pointer past the conversion character or NULL if it isn't valid.
+ */
+static const char *a_fmt_internal_parse(const char *f, struct a_fmt_spec *spec)
+{
+    spec->flags = 0;
+    spec->width = A_FMT_NONE;
+    spec->prec = A_FMT_NONE;
+    spec->length = 0;
+
+    for (;; ++f)
+    {
+        if (*f == '-')      spec->flags |= a_fmt_left;
+        else if (*f == '+') spec->flags |= a_fmt_plus;
+        else if (*f == ' ') spec->flags |= a_fmt_space;
+        else if (*f == '#') spec->flags |= a_fmt_alt;
+        else if (*f == '0') spec->flags |= a_fmt_zero;
+        else break;
+    }
+
+    if (*f == '*')
+        spec->width = A_FMT_ARG, ++f;
+    else if ('0' <= *f && *f <= '9')
+        for (spec->width = 0; '0' <= *f && *f <= '9'; ++f)
+            spec->width = spec->width * 10 + (*f - '0');
+
+    if (*f == '.')
+    {
+        if (*++f == '*')
+            spec->prec = A_FMT_ARG, ++f;
+        else
+            for (spec->prec = 0; '0' <= *f && *f <= '9'; ++f)
+                spec->prec = spec->prec * 10 + (*f - '0');
+    }
+
+    switch (*f)
+    {
+        case 'h': spec->length = (f[1] == 'h') ? (++f, 'H') : 'h'; ++f; break;
+        case 'l': spec->length = (f[1] == 'l') ? (++f, 'q') : 'l'; ++f; break;
+        case 'j': case 'z': case 't': case 'L': spec->length = *f++; break;
+        default: break;
+    }
+
+    if (!*f || !strchr("diouxXcCsSpfFeEgGaA%", *f))
+        return NULL;
+    spec->conv = *f;
+    return f + 1;
+}
+
+/*
+ * Appends [prefix][zeros][body] padded to pad units (spaces on the left,
+ * or on the right if left is set). body spans len code points.
+ */
+static a_str a_fmt_internal_put(a_str str, const char *prefix, size_t prefix_size, size_t zeros,
+                                 const char *body, size_t size, size_t len, size_t pad, int left)
+{
+    struct a_header *h;
+    char *w;
+
+    if (!(str = a_ensure(str, pad + prefix_size + zeros + size)))
+        return NULL;
+    h = a_header(str);
+    w = str + h->size;
+    if (!left)
+        memset(w, ' ', pad), w += pad;
+    if (prefix_size)
+        memcpy(w, prefix, prefix_size), w += prefix_size;
+    memset(w, '0', zeros), w += zeros;
+    if (size)
+        memcpy(w, body, size), w += size;
+    if (left)
+        memset(w, ' ', pad), w += pad;
+    *w = '\0';
+    h->len += pad + prefix_size + zeros + len;
+    h->size = (size_t)(w - str);
+    return str;
+}
+
+/* appends a string, with width and precision in code points or graphemes */
+static a_str a_fmt_internal_str(a_str str, const struct a_fmt_spec *spec, int width, int prec,
+                                const char *s, size_t size, size_t len)
+{
+    size_t units;
+
+    if (spec->flags & a_fmt_alt)
+    {
+        const char *p = s, *end = s + size;
+
+        for (units = 0; p < end && (prec < 0 || units < (size_t)prec); ++units)
+            a_gnext_cstr(&p);
+        if (p < end)
+            size = (size_t)(p - s), len = A_EOS;
+    }
+    else
+    {
+        if (prec >= 0 && (size_t)prec < len)
+            size = a_internal_index_to_offset(s, (size_t)prec), len = (size_t)prec;
+        units = len;
+    }
+    if (len == A_EOS)
+        len = a_internal_count_cp(s, size);
+
+    return a_fmt_internal_put(str, NULL, 0, 0, s, size, len,
+                              width > 0 && (size_t)width > units ? (size_t)width - units : 0,
+                              spec->flags & a_fmt_left);
+}
+
+static a_str a_fmt_internal_int(a_str str, const struct a_fmt_spec *spec, int width, int prec,
+                                unsigned long long val, int negative)
+{
+    static const char lower[] = "0123456789abcdef", upper[] = "0123456789ABCDEF";
+    const char *digits = spec->conv == 'X' ? upper : lower;
+    char b[3 * sizeof val + 1], prefix[2], *p = b + sizeof b;
+    unsigned base = 10;
+    size_t prefix_size = 0, size, zeros = 0, total;
+
+    if (spec->conv == 'o')
+        base = 8;
+    else if (spec->conv == 'x' || spec->conv == 'X' || spec->conv == 'p')
+        base = 16;
+
+    if (base == 10)
+        while (val >= 100)
+        {
+            unsigned n = (unsigned)(val % 100) * 2;
+            val /= 100;
+            *--p = a_digits_pairs[n + 1];
+            *--p = a_digits_pairs[n];
+        }
+    while (val || (p == b + sizeof b && prec != 0))
+    {
+        *--p = digits[val % base];
+        val /= base;
+    }
+    size = (size_t)(b + sizeof b - p);
+
+    if (negative)
+        prefix[prefix_size++] = '-';
+    else if ((spec->conv == 'd' || spec->conv == 'i') && (spec->flags & a_fmt_plus))
+        prefix[prefix_size++] = '+';
+    else if ((spec->conv == 'd' || spec->conv == 'i') && (spec->flags & a_fmt_space))
+        prefix[prefix_size++] = ' ';
+    else if (base == 16 && (spec->flags & a_fmt_alt || spec->conv == 'p') && size && *p != '0')
+        prefix[prefix_size++] = '0', prefix[prefix_size++] = spec->conv == 'X' ? 'X' : 'x';
+    else if (base == 8 && (spec->flags & a_fmt_alt) && (!size || *p != '0') && prec <= (int)size)
+        prec = (int)size + 1;
+
+    if (prec >= 0 && (size_t)prec > size)
+        zeros = (size_t)prec - size;
+    total = prefix_size + zeros + size;
+    if (prec < 0 && (spec->flags & (a_fmt_zero | a_fmt_left)) == a_fmt_zero && width > 0 && (size_t)width > total)
+        zeros += (size_t)width - total, total = (size_t)width;
+
+    return a_fmt_internal_put(str, prefix, prefix_size, zeros, p, size, size,
+                              width > 0 && (size_t)width > total ? (size_t)width - total : 0,
+                              spec->flags & a_fmt_left);
+}
+
+static int a_fmt_internal_snprintf(char *b, size_t n, const struct a_fmt_spec *spec, int prec, va_list *ap)
+{
+    /* only literal formats, one per conversion */
+    #define A_FMT_DBL(c) ((spec->flags & a_fmt_alt) \
+        ? snprintf(b, n, "%#.*" c, prec, v) : snprintf(b, n, "%.*" c, prec, v))
+    #define A_FMT_CONV(T, L) \
+    { \
+        T v = va_arg(*ap, T); \
+        switch (spec->conv) \
+        { \
+            case 'f': return A_FMT_DBL(L "f"); \
+            case 'F': return A_FMT_DBL(L "F"); \
+            case 'e': return A_FMT_DBL(L "e"); \
+            case 'E': return A_FMT_DBL(L "E"); \
+            case 'g': return A_FMT_DBL(L "g"); \
+            case 'G': return A_FMT_DBL(L "G"); \
+            case 'a': return A_FMT_DBL(L "a"); \
+            default:  return A_FMT_DBL(L "A"); \
+        } \
+    }
+    if (spec->length == 'L')
+        A_FMT_CONV(long double, "L")
+    A_FMT_CONV(double, "")
+    #undef A_FMT_CONV
+    #undef A_FMT_DBL
+}
+
+static a_str a_fmt_internal_float(a_str str, const struct a_fmt_spec *spec, int width, int prec, va_list *ap)
+{
+    struct a_header *h = a_header(str);
+    size_t size = h->size, n, pad, sign, skip;
+    char *s;
+    int r;
+    va_list again;
+
+    if (prec < 0)
+        prec = (spec->conv == 'a' || spec->conv == 'A') ? -1 : 6;
+
+    /* +2 leaves room for a sign, the result goes into the spare buffer */
+    va_copy(again, *ap);
+    r = a_fmt_internal_snprintf(str + size + 1, h->mem - size - 1, spec, prec, ap);
+    if (r >= 0 && (size_t)r + 2 > h->mem - size)
+    {
+        if ((str = a_reserve(str, size + (size_t)r + 1)))
+        {
+            h = a_header(str);
+            r = a_fmt_internal_snprintf(str + size + 1, h->mem - size - 1, spec, prec, &again);
+        }
+    }
+    va_end(again);
+    if (!str)
+        return NULL;
+    if (r < 0)
+    {
+        str[size] = '\0';
+        return str;
+    }
+
+    n = (size_t)r;
+    s = str + size + 1;
+    sign = (*s != '-' && (spec->flags & (a_fmt_plus | a_fmt_space)));
+    if (sign)
+        *--s = (spec->flags & a_fmt_plus) ? '+' : ' ', ++n;
+    else
+        memmove(s - 1, s, n), --s;
+
+    pad = width > 0 && (size_t)width > n ? (size_t)width - n : 0;
+    if (pad)
+    {
+        if (!(str = a_reserve(str, size + n + pad)))
+            return NULL;
+        h = a_header(str);
+        s = str + size;
+        skip = (*s == '-' || sign);
+        if (spec->flags & a_fmt_left)
+            memset(s + n, ' ', pad);
+        else if ((spec->flags & a_fmt_zero) && '0' <= s[skip] && s[skip] <= '9')
+        {
+            /* zeros go after the sign and any 0x prefix, but not in inf/nan */
+            if ((spec->conv == 'a' || spec->conv == 'A') && s[skip] == '0' && (s[skip+1] | 0x20) == 'x')
+                skip += 2;
+            memmove(s + skip + pad, s + skip, n - skip);
+            memset(s + skip, '0', pad);
+        }
+        else
+        {
+            memmove(s + pad, s, n);
+            memset(s, ' ', pad);
+        }
+        n += pad;
+    }
+
+    h->size += n;
+    h->len += n;
+    str[h->size] = '\0';
+    return str;
+}
+
+/* performs a single conversion */
+static a_str a_fmt_internal_conv(a_str str, const struct a_fmt_spec *spec, va_list *ap)
+{
+    int width = spec->width, prec = spec->prec;
+
+    if (width == A_FMT_ARG)
+    {
+        width = va_arg(*ap, int);
+        if (width < 0)
+        {
+            struct a_fmt_spec left = *spec;
+            left.flags |= a_fmt_left;
+            left.width = -width;
+            left.prec = prec == A_FMT_ARG ? va_arg(*ap, int) : prec;
+            if (left.prec < 0)
+                left.prec = A_FMT_NONE;
+            return a_fmt_internal_conv(str, &left, ap);
+        }
+    }
+    if (prec == A_FMT_ARG && (prec = va_arg(*ap, int)) < 0)
+        prec = A_FMT_NONE;
+
+    switch (spec->conv)
+    {
+        case '%':
+            return a_fmt_internal_put(str, NULL, 0, 0, "%", 1, 1, 0, 0);
+        case 'c':
+        {
+            char c = (char)va_arg(*ap, int);
+            return a_fmt_internal_put(str, NULL, 0, 0, &c, 1, 1,
+                                      width > 1 ? (size_t)width - 1 : 0, spec->flags & a_fmt_left);
+        }
+        case 'C':
+        {
+            char b[A_MAX_CHAR];
+            int size;
+            a_to_utf8_size(va_arg(*ap, a_cp), b, &size);
+            return a_fmt_internal_put(str, NULL, 0, 0, b, (size_t)size, 1,
+                                      width > 1 ? (size_t)width - 1 : 0, spec->flags & a_fmt_left);
+        }
+        case 's':
+        {
+            const char *s = va_arg(*ap, const char*);
+            size_t size;
+
+            if (!s)
+                s = "(null)";
+            if (prec >= 0 && !(spec->flags & a_fmt_alt))
+                size = a_internal_index_to_offset(s, (size_t)prec);
+            else
+                size = strlen(s);
+            return a_fmt_internal_str(str, spec, width, prec, s, size, a_internal_count_cp(s, size));
+        }
+        case 'S':
+        {
+            a_cstr s = va_arg(*ap, a_cstr);
+
+            if (!s)
+                return a_fmt_internal_str(str, spec, width, prec, "(null)", 6, 6);
+            return a_fmt_internal_str(str, spec, width, prec, s, a_size(s), a_len(s));
+        }
+        case 'p':
+            return a_fmt_internal_int(str, spec, width, prec, (unsigned long long)(uintptr_t)va_arg(*ap, void*), 0);
+        case 'd':
+        case 'i':
+        {
+            long long v;
+            switch (spec->length)
+            {
+                case 'H': v = (signed char)va_arg(*ap, int); break;
+                case 'h': v = (short)va_arg(*ap, int); break;
+                case 'l': v = va_arg(*ap, long); break;
+                case 'q': v = va_arg(*ap, long long); break;
+                case 'j': v = va_arg(*ap, intmax_t); break;
+                case 'z': v = (long long)va_arg(*ap, size_t); break;
+                case 't': v = va_arg(*ap, ptrdiff_t); break;
+                default:  v = va_arg(*ap, int); break;
+            }
+            return a_fmt_internal_int(str, spec, width, prec,
+                                      v < 0 ? 0ULL - (unsigned long long)v : (unsigned long long)v, v < 0);
+        }
+        case 'o':
+        case 'u':
+        case 'x':
+        case 'X':
+        {
+            unsigned long long v;
+            switch (spec->length)
+            {
+                case 'H': v = (unsigned char)va_arg(*ap, unsigned); break;
+                case 'h': v = (unsigned short)va_arg(*ap, unsigned); break;
+                case 'l': v = va_arg(*ap, unsigned long); break;
+                case 'q': v = va_arg(*ap, unsigned long long); break;
+                case 'j': v = va_arg(*ap, uintmax_t); break;
+                case 'z': v = va_arg(*ap, size_t); break;
+                case 't': v = (unsigned long long)va_arg(*ap, ptrdiff_t); break;
+                default:  v = va_arg(*ap, unsigned); break;
+            }
+            return a_fmt_internal_int(str, spec, width, prec, v, 0);
+        }
+        default:
+            return a_fmt_internal_float(str, spec, width, prec, ap);
+    }
+}
+
+/* appends a literal run of the format string */
+static a_str a_fmt_internal_lit(a_str str, const char *s, size_t size, size_t len)
+{
+    struct a_header *h;
+
+    if (!size)
+        return str;
+    if (!(str = a_ensure(str, size)))
+        return NULL;
+    h = a_header(str);
+    memcpy(str + h->size, s, size);
+    h->size += size;
+    h->len += len;
+    str[h->size] = '\0';
+    return str;
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+a_str a_format(a_str str, const char *format, ...)
+{
+    va_list ap;
+
+    va_start(ap, format);
+    str = a_format_va(str, format, ap);
+    va_end(ap);
+    return str;
+}
+a_str a_format_va(a_str str, const char *format, va_list ap)
+{
+    assert(str != NULL && format != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL && format != NULL, NULL);
+
+    return a_cat_format_va(a_clear(str), format, ap);
+}
+a_str a_cat_format(a_str str, const char *format, ...)
+{
+    va_list ap;
+
+    va_start(ap, format);
+    str = a_cat_format_va(str, format, ap);
+    va_end(ap);
+    return str;
+}
+a_str a_cat_format_va(a_str str, const char *format, va_list ap)
+{
+    struct a_fmt_spec spec;
+    const char *p, *next;
+    va_list args;
+    assert(str != NULL && format != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL && format != NULL, NULL);
+
+    va_copy(args, ap);
+    for (p = format; str && *p; p = next)
+    {
+        const char *pct = strchr(p, '%');
+
+        if (!pct)
+            pct = p + strlen(p);
+        str = a_fmt_internal_lit(str, p, (size_t)(pct - p), a_internal_count_cp(p, (size_t)(pct - p)));
+        if (!*pct || !str)
+            break;
+
+        if ((next = a_fmt_internal_parse(pct + 1, &spec)))
+            str = a_fmt_internal_conv(str, &spec, &args);
+        else /* not a conversion, keep it as is */
+            str = a_fmt_internal_lit(str, pct, 1, 1), next = pct + 1;
+    }
+    va_end(args);
+    return str;
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+a_fmt a_fmt_new(const char *format)
+{
+    struct a_fmt_spec spec;
+    const char *p, *pct, *next;
+    size_t count, size, i;
+    a_fmt fmt;
+    assert(format != NULL);
+    PASSTHROUGH_ON_FAIL(format != NULL, NULL);
+
+    /* a conversion per segment, plus the trailing literal */
+    for (count = 1, p = format; (pct = strchr(p, '%')); )
+    {
+        if ((next = a_fmt_internal_parse(pct + 1, &spec)))
+            ++count, p = next;
+        else
+            p = pct + 1;
+    }
+
+    size = strlen(format) + 1;
+    if (!(fmt = A_MALLOC(sizeof *fmt + count * sizeof *fmt->segs + size)))
+        return NULL;
+    fmt->count = count;
+    fmt->segs = (struct a_fmt_seg*)(fmt + 1);
+    fmt->text = (char*)(fmt->segs + count);
+    memcpy(fmt->text, format, size);
+
+    /* malformed conversions become literal text */
+    for (i = 0, p = format; i < count; ++i)
+    {
+        struct a_fmt_seg *seg = &fmt->segs[i];
+
+        seg->offset = (size_t)(p - format);
+        seg->spec.conv = 0;
+        for (pct = p; (pct = strchr(pct, '%')); ++pct)
+            if (a_fmt_internal_parse(pct + 1, &seg->spec))
+                break;
+        if (!pct)
+            pct = p + strlen(p);
+        seg->size = (size_t)(pct - p);
+        seg->len = a_internal_count_cp(p, seg->size);
+        p = *pct ? a_fmt_internal_parse(pct + 1, &seg->spec) : pct;
+    }
+    return fmt;
+}
+void a_fmt_free(a_fmt fmt)
+{
+    A_FREE(fmt);
+}
+a_str a_cat_fmt(a_str str, a_fmt fmt, ...)
+{
+    va_list ap;
+
+    va_start(ap, fmt);
+    str = a_cat_fmt_va(str, fmt, ap);
+    va_end(ap);
+    return str;
+}
+a_str a_cat_fmt_va(a_str str, a_fmt fmt, va_list ap)
+{
+    size_t i;
+    va_list args;
+    assert(str != NULL && fmt != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL && fmt != NULL, NULL);
+
+    va_copy(args, ap);
+    for (i = 0; str && i < fmt->count; ++i)
+    {
+        const struct a_fmt_seg *seg = &fmt->segs[i];
+
+        str = a_fmt_internal_lit(str, fmt->text + seg->offset, seg->size, seg->len);
+        if (str && seg->spec.conv)
+            str = a_fmt_internal_conv(str, &seg->spec, &args);
+    }
+    va_end(args);
+    return str;
+}
+#endif
@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC
+ *
+ * License: MIT
+ */
+
+/*
+ * Hashing
+ *
+ * a_hash() is FNV-1a over the bytes of the string, as wide as an
+ * unsigned long.
+ */
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+unsigned long a_hash(a_cstr str)
+{
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, 0);
+
+    return a_hash_internal(str, a_size(str));
+}
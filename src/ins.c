@@ -35,7 +35,7 @@ a_str a_ins(a_str str, a_cstr str2, size_t index)
     h = a_header(str2);
     return a_ins_internal(str, str2, 
                 a_internal_index_to_offset(str, index),
-                h->size, h->len);
+                h->size, a_len(str2));
 }
 a_str a_ins_chr(a_str str, const char *chr, size_t index)
 {
@@ -74,7 +74,7 @@ a_str a_ins_offset(a_str str, a_cstr str2, size_t offset)
     A_ASSERT_CODEPOINT_BOUNDARY(str[offset]);
     
     h = a_header(str2);
-    return a_ins_internal(str, str2, offset, h->size, h->len);
+    return a_ins_internal(str, str2, offset, h->size, a_len(str2));
 }
 a_str a_ins_offset_chr(a_str str, const char *chr, size_t offset)
 {
@@ -114,7 +114,7 @@ a_str a_gins(a_str str, a_cstr str2, size_t index)
     h = a_header(str2);
     return a_ins_internal(str, str2, 
                 a_internal_gindex_to_offset(str, index),
-                h->size, h->len);
+                h->size, a_len(str2));
 }
 a_str a_gins_chr(a_str str, const char *chr, size_t index)
 {
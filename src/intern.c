@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC
+ *
+ * License: MIT
+ */
+
+/*
+ * String Interning
+ *
+ * The table is split into shards picked by the hash of the string, each
+ * with its own lock and its own open addressing table (linear probing,
+ * at most half full, deletions shift the following entries back). An
+ * interned string is allocated with a reference count and its hash just
+ * before its header, so that comparing two entries rarely needs more
+ * than comparing their hashes, and growing a shard never rehashes.
+ */
+#if A_INCLUDE_THREADS == 1
+#include <pthread.h>
+#endif
+
+/* number of shards, a power of two */
+#define A_INTERN_SHARDS 64
+#define A_INTERN_MIN_SLOTS 16
+
+struct a_intern_node
+{
+    size_t refs;
+    unsigned long hash;
+    /* followed by the a_header and the bytes of the string */
+};
+#define a_intern_str(n) a_buff(((struct a_intern_node*)(n) + 1))
+#define a_intern_node(s) ((struct a_intern_node*)a_header(s) - 1)
+
+struct a_intern_shard
+{
+#if A_INCLUDE_THREADS == 1
+    pthread_mutex_t lock;
+#endif
+    struct a_intern_node **slots;
+    size_t mask;                    /* number of slots - 1        */
+    size_t count;
+    char pad[64];                   /* keep the locks apart       */
+};
+
+struct a_intern_table
+{
+    struct a_intern_shard shards[A_INTERN_SHARDS];
+};
+
+static struct a_intern_shard *a_intern_internal_shard(a_intern_table t, unsigned long hash)
+{
+    return &t->shards[hash & (A_INTERN_SHARDS - 1)];
+}
+/* the shard's low bits are the same for all its entries, start from the others */
+static size_t a_intern_internal_slot(unsigned long hash, size_t mask)
+{
+    return (size_t)(hash / A_INTERN_SHARDS) & mask;
+}
+
+static void a_intern_internal_lock(struct a_intern_shard *sh)
+{
+#if A_INCLUDE_THREADS == 1
+    pthread_mutex_lock(&sh->lock);
+#else
+    (void)sh;
+#endif
+}
+static void a_intern_internal_unlock(struct a_intern_shard *sh)
+{
+#if A_INCLUDE_THREADS == 1
+    pthread_mutex_unlock(&sh->lock);
+#else
+    (void)sh;
+#endif
+}
+
+/* doubles the slots of a shard, locked */
+static int a_intern_internal_grow(struct a_intern_shard *sh)
+{
+    size_t mask = sh->mask ? sh->mask * 2 + 1 : A_INTERN_MIN_SLOTS - 1, i, j;
+    struct a_intern_node **slots;
+
+    if (!(slots = A_MALLOC((mask + 1) * sizeof *slots)))
+        return 0;
+    for (i = 0; i <= mask; ++i)
+        slots[i] = NULL;
+    for (i = 0; sh->slots && i <= sh->mask; ++i)
+    {
+        if (!sh->slots[i])
+            continue;
+        for (j = a_intern_internal_slot(sh->slots[i]->hash, mask); slots[j]; j = (j + 1) & mask)
+            ;
+        slots[j] = sh->slots[i];
+    }
+    A_FREE(sh->slots);
+    sh->slots = slots;
+    sh->mask = mask;
+    return 1;
+}
+
+/* removes slot i, moving back the entries that probed past it, locked */
+static void a_intern_internal_remove(struct a_intern_shard *sh, size_t i)
+{
+    size_t j = i, k;
+
+    sh->slots[i] = NULL;
+    for (;;)
+    {
+        j = (j + 1) & sh->mask;
+        if (!sh->slots[j])
+            break;
+        k = a_intern_internal_slot(sh->slots[j]->hash, sh->mask);
+        /* the entry at j stays if its home slot is cyclically in (i, j] */
+        if (i <= j ? (i < k && k <= j) : (i < k || k <= j))
+            continue;
+        sh->slots[i] = sh->slots[j];
+        sh->slots[j] = NULL;
+        i = j;
+    }
+    --sh->count;
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+a_intern_table a_intern_table_new(void)
+{
+    a_intern_table t;
+    size_t i;
+
+    if (!(t = A_MALLOC(sizeof *t)))
+        return NULL;
+    for (i = 0; i < A_INTERN_SHARDS; ++i)
+    {
+#if A_INCLUDE_THREADS == 1
+        pthread_mutex_init(&t->shards[i].lock, NULL);
+#endif
+        t->shards[i].slots = NULL;
+        t->shards[i].mask = 0;
+        t->shards[i].count = 0;
+    }
+    return t;
+}
+void a_intern_table_free(a_intern_table t)
+{
+    size_t i, j;
+
+    if (!t)
+        return;
+    for (i = 0; i < A_INTERN_SHARDS; ++i)
+    {
+        struct a_intern_shard *sh = &t->shards[i];
+
+        for (j = 0; sh->slots && j <= sh->mask; ++j)
+            A_FREE(sh->slots[j]);
+        A_FREE(sh->slots);
+#if A_INCLUDE_THREADS == 1
+        pthread_mutex_destroy(&sh->lock);
+#endif
+    }
+    A_FREE(t);
+}
+size_t a_intern_table_count(a_intern_table t)
+{
+    size_t i, count = 0;
+    assert(t != NULL);
+    PASSTHROUGH_ON_FAIL(t != NULL, 0);
+
+    for (i = 0; i < A_INTERN_SHARDS; ++i)
+    {
+        a_intern_internal_lock(&t->shards[i]);
+        count += t->shards[i].count;
+        a_intern_internal_unlock(&t->shards[i]);
+    }
+    return count;
+}
+
+a_cstr a_intern_size(a_intern_table t, const char *str, size_t size)
+{
+    unsigned long hash;
+    struct a_intern_shard *sh;
+    struct a_intern_node *n;
+    struct a_header *h;
+    size_t i;
+    assert(t != NULL && str != NULL);
+    PASSTHROUGH_ON_FAIL(t != NULL && str != NULL, NULL);
+
+    hash = a_hash_internal(str, size);
+    sh = a_intern_internal_shard(t, hash);
+    a_intern_internal_lock(sh);
+
+    if (sh->slots)
+    {
+        for (i = a_intern_internal_slot(hash, sh->mask); (n = sh->slots[i]); i = (i + 1) & sh->mask)
+        {
+            if (n->hash == hash && a_header(a_intern_str(n))->size == size
+                    && !memcmp(a_intern_str(n), str, size))
+            {
+                ++n->refs;
+                a_intern_internal_unlock(sh);
+                return a_intern_str(n);
+            }
+        }
+    }
+
+    if (((sh->count + 1) * 2 > sh->mask + 1 && !a_intern_internal_grow(sh))
+            || !(n = A_MALLOC(sizeof *n + sizeof *h + size + 1)))
+    {
+        a_intern_internal_unlock(sh);
+        return NULL;
+    }
+    n->refs = 1;
+    n->hash = hash;
+    h = a_header(a_intern_str(n));
+    h->size = size;
+    h->len = a_internal_count_cp_seq(str, size);
+    h->mem = size + 1;
+    memcpy(a_intern_str(n), str, size);
+    a_intern_str(n)[size] = '\0';
+
+    for (i = a_intern_internal_slot(hash, sh->mask); sh->slots[i]; i = (i + 1) & sh->mask)
+        ;
+    sh->slots[i] = n;
+    ++sh->count;
+    a_intern_internal_unlock(sh);
+    return a_intern_str(n);
+}
+a_cstr a_intern(a_intern_table t, a_cstr str)
+{
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+    return a_intern_size(t, str, a_size(str));
+}
+a_cstr a_intern_cstr(a_intern_table t, const char *str)
+{
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+    return a_intern_size(t, str, strlen(str));
+}
+a_cstr a_intern_ref(a_intern_table t, a_cstr interned)
+{
+    struct a_intern_shard *sh;
+    assert(t != NULL && interned != NULL);
+    PASSTHROUGH_ON_FAIL(t != NULL && interned != NULL, NULL);
+
+    sh = a_intern_internal_shard(t, a_intern_node(interned)->hash);
+    a_intern_internal_lock(sh);
+    ++a_intern_node(interned)->refs;
+    a_intern_internal_unlock(sh);
+    return interned;
+}
+void a_intern_release(a_intern_table t, a_cstr interned)
+{
+    struct a_intern_node *n;
+    struct a_intern_shard *sh;
+    size_t i;
+    assert(t != NULL && interned != NULL);
+    PASSTHROUGH_ON_FAIL(t != NULL && interned != NULL, ;);
+
+    n = a_intern_node(interned);
+    sh = a_intern_internal_shard(t, n->hash);
+    a_intern_internal_lock(sh);
+    if (!--n->refs)
+    {
+        for (i = a_intern_internal_slot(n->hash, sh->mask); sh->slots[i] != n; i = (i + 1) & sh->mask)
+            ;
+        a_intern_internal_remove(sh, i);
+        A_FREE(n);
+    }
+    a_intern_internal_unlock(sh);
+}
+unsigned long a_intern_hash(a_cstr interned)
+{
+    assert(interned != NULL);
+    PASSTHROUGH_ON_FAIL(interned != NULL, 0);
+    return a_intern_node(interned)->hash;
+}
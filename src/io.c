@@ -0,0 +1,666 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC
+ *
+ * License: MIT
+ */
+
+/*
+ * Input/Output
+ */
+#if A_INCLUDE_IO == 1
+
+#if A_HAVE_MMAP
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#   define MAP_ANONYMOUS MAP_ANON
+#endif
+#endif
+
+#if A_HAVE_WRITEV == 1
+#include <sys/uio.h>
+#include <errno.h>
+#include <unistd.h>
+#endif
+
+/* initial buffer size when the size of the stream can't be known */
+#define A_FILE_READ_CHUNK 4096
+
+a_str a_file_read(FILE *fp)
+{
+    a_str str;
+    size_t size = 0, n;
+    long pos, end;
+    assert(fp != NULL);
+    PASSTHROUGH_ON_FAIL(fp != NULL, NULL);
+
+    /* size the buffer up front when the stream is seekable */
+    n = A_FILE_READ_CHUNK;
+    if ((pos = ftell(fp)) >= 0 && !fseek(fp, 0, SEEK_END))
+    {
+        if ((end = ftell(fp)) > pos)
+            n = (size_t)(end - pos);
+        fseek(fp, pos, SEEK_SET);
+    }
+    if (!(str = a_new_mem_raw(n)))
+        return NULL;
+
+    for (;;)
+    {
+        size_t avail = a_header(str)->mem - 1 - size;
+
+        if (!avail)
+        {
+            if (!(str = a_reserve(str, size + size)))
+                return NULL;
+            continue;
+        }
+        size += (n = fread(str + size, 1, avail, fp));
+        if (n < avail)
+            break;
+    }
+    if (ferror(fp))
+    {
+        a_free(str);
+        return NULL;
+    }
+
+    str[size] = '\0';
+    a_header(str)->size = size;
+    a_header(str)->len = a_internal_count_cp(str, size);
+    return str;
+}
+
+a_str a_file_read_enc(FILE *fp, int *enc)
+{
+    char raw[A_FILE_READ_CHUNK * 4];
+    size_t rawend = 0, used, n;
+    int e = enc ? *enc : a_encoding_detect, eof = 0, first = 1;
+    a_str str;
+    assert(fp != NULL);
+    PASSTHROUGH_ON_FAIL(fp != NULL, NULL);
+
+    if (!(str = a_new_mem(A_FILE_READ_CHUNK)))
+        return NULL;
+
+    /* decoded a block at a time straight into str */
+    while (!eof)
+    {
+        struct a_header *h;
+
+        if (!(n = fread(raw + rawend, 1, sizeof raw - rawend, fp)))
+            eof = 1;
+        rawend += n;
+        if (first)
+        {
+            size_t bom = a_encoding_internal_start(raw, rawend, &e);
+            memmove(raw, raw + bom, rawend -= bom);
+            first = 0;
+        }
+
+        if (!(str = a_ensure(str, rawend * A_ENCODING_MAX_GROWTH)))
+            return NULL;
+        h = a_header(str);
+        n = a_encoding_internal_decode(e, raw, rawend, str + h->size, &used, eof);
+        h->len += a_internal_count_cp(str + h->size, n);
+        h->size += n;
+        memmove(raw, raw + used, rawend -= used);
+    }
+    if (ferror(fp))
+    {
+        a_free(str);
+        return NULL;
+    }
+
+    str[a_size(str)] = '\0';
+    if (enc)
+        *enc = e;
+    return str;
+}
+
+size_t a_file_line_count(FILE *fp)
+{
+    char buf[A_FILE_READ_CHUNK * 16];
+    size_t count = 0, n;
+    char last = '\n';
+    assert(fp != NULL);
+    PASSTHROUGH_ON_FAIL(fp != NULL, 0);
+
+#if A_HAVE_MMAP
+    {
+        /* regular files are counted in place, on several threads if possible */
+        long pos = ftell(fp);
+        a_cstr m;
+
+        if (pos >= 0 && (m = a_file_map_fd(fileno(fp), 0)))
+        {
+            if ((size_t)pos <= a_size(m))
+                count = a_line_count(m + pos, a_size(m) - (size_t)pos);
+            a_file_unmap(m);
+            fseek(fp, 0, SEEK_END);
+            return count;
+        }
+    }
+#endif
+    while ((n = fread(buf, 1, sizeof buf, fp)))
+    {
+        count += a_internal_count_nl(buf, n);
+        last = buf[n - 1];
+    }
+    return count + (last != '\n');
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+/* stdio locks the stream on every getc(), take the lock once per line */
+#if A_HAVE_MMAP
+#   define A_FILE_LOCK(fp)   flockfile(fp)
+#   define A_FILE_UNLOCK(fp) funlockfile(fp)
+#   define A_FILE_GETC(fp)   getc_unlocked(fp)
+#else
+#   define A_FILE_LOCK(fp)
+#   define A_FILE_UNLOCK(fp)
+#   define A_FILE_GETC(fp)   getc(fp)
+#endif
+
+/* appends size bytes to str, keeping the length in sync */
+static a_str a_file_internal_append(a_str str, const char *s, size_t size)
+{
+    struct a_header *h;
+
+    if (!size)
+        return str;
+    if (!(str = a_ensure(str, size)))
+        return NULL;
+    h = a_header(str);
+    memcpy(str + h->size, s, size);
+    h->size += size;
+    h->len += a_internal_count_cp(s, size);
+    return str;
+}
+
+a_str a_file_readline(FILE *fp)
+{
+    return a_file_readline_delim_str(fp, "\n", NULL);
+}
+a_str a_file_readline_delim(FILE *fp, const char *delim)
+{
+    return a_file_readline_delim_str(fp, delim, NULL);
+}
+a_str a_file_readline_delim_str(FILE *fp, const char *delim, a_str str)
+{
+    struct a_header *h;
+    size_t dsize;
+    char last;
+    int c, got = 0;
+    assert(fp != NULL && delim != NULL && *delim);
+    PASSTHROUGH_ON_FAIL(fp != NULL && delim != NULL && *delim, NULL);
+
+    if (!(str = str ? a_clear(str) : a_new_mem(A_MIN_STR_SIZE)))
+        return NULL;
+    dsize = strlen(delim);
+    last = delim[dsize - 1];
+
+    A_FILE_LOCK(fp);
+    while ((c = A_FILE_GETC(fp)) != EOF)
+    {
+        got = 1;
+        h = a_header(str);
+        if (h->size + 1 >= h->mem && !(str = a_reserve(str, h->mem)))
+            break;
+        h = a_header(str);
+        str[h->size++] = (char)c;
+        if ((char)c == last && h->size >= dsize
+                && !memcmp(str + h->size - dsize, delim, dsize))
+        {
+            h->size -= dsize;
+            break;
+        }
+    }
+    A_FILE_UNLOCK(fp);
+
+    if (!str)
+        return NULL;
+    if (!got || ferror(fp))
+    {
+        a_free(str);
+        return NULL;
+    }
+    h = a_header(str);
+    str[h->size] = '\0';
+    h->len = a_internal_count_cp(str, h->size);
+    return str;
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+/* a_reader::enc of readers that pass bytes through as they are */
+#define A_READER_RAW -1
+
+struct a_reader
+{
+    FILE *fp;
+    size_t pos;
+    size_t end;
+    int eof;
+    int enc;           /* input encoding, or A_READER_RAW */
+    int started;       /* whether the BOM was looked for  */
+    size_t rawend;     /* undecoded bytes in raw          */
+    char buf[A_READER_SIZE];
+    char raw[A_READER_SIZE / 4];
+};
+
+/*
+ * Moves what's left of the buffer to its start and refills the rest with
+ * a single fread(), decoding it on the way when needed. Returns the number
+ * of bytes added.
+ */
+static size_t a_reader_internal_fill(a_reader r)
+{
+    size_t n, used, room;
+
+    if (r->pos)
+    {
+        memmove(r->buf, r->buf + r->pos, r->end - r->pos);
+        r->end -= r->pos;
+        r->pos = 0;
+    }
+    if (r->enc == A_READER_RAW)
+    {
+        if (!(n = fread(r->buf + r->end, 1, sizeof r->buf - r->end, r->fp)))
+            r->eof = 1;
+        r->end += n;
+        return n;
+    }
+
+    do
+    {
+        room = (sizeof r->buf - r->end) / A_ENCODING_MAX_GROWTH;
+        if (room > sizeof r->raw)
+            room = sizeof r->raw;
+        if (room <= r->rawend || !(n = fread(r->raw + r->rawend, 1, room - r->rawend, r->fp)))
+            r->eof = 1, n = 0;
+        r->rawend += n;
+        if (!r->started)
+        {
+            size_t bom = a_encoding_internal_start(r->raw, r->rawend, &r->enc);
+            memmove(r->raw, r->raw + bom, r->rawend -= bom);
+            r->started = 1;
+        }
+
+        n = a_encoding_internal_decode(r->enc, r->raw, r->rawend, r->buf + r->end, &used, r->eof);
+        memmove(r->raw, r->raw + used, r->rawend -= used);
+        r->end += n;
+    } while (!n && !r->eof);
+    return n;
+}
+
+a_reader a_reader_new(FILE *fp)
+{
+    a_reader r;
+    assert(fp != NULL);
+    PASSTHROUGH_ON_FAIL(fp != NULL, NULL);
+
+    if ((r = A_MALLOC(sizeof *r)))
+    {
+        r->fp = fp;
+        r->pos = r->end = r->rawend = 0;
+        r->eof = r->started = 0;
+        r->enc = A_READER_RAW;
+    }
+    return r;
+}
+a_reader a_reader_new_enc(FILE *fp, int enc)
+{
+    a_reader r;
+
+    if ((r = a_reader_new(fp)))
+        r->enc = enc;
+    return r;
+}
+int a_reader_encoding(a_reader r)
+{
+    assert(r != NULL);
+    PASSTHROUGH_ON_FAIL(r != NULL, a_encoding_detect);
+
+    if (r->enc == A_READER_RAW)
+        return a_encoding_utf8;
+    if (!r->started)
+        a_reader_internal_fill(r);
+    return r->enc;
+}
+void a_reader_free(a_reader r)
+{
+    A_FREE(r);
+}
+a_str a_reader_line(a_reader r, const char *delim, a_str str)
+{
+    size_t dsize, avail, keep, at;
+    int got = 0;
+    assert(r != NULL && delim != NULL && *delim);
+    PASSTHROUGH_ON_FAIL(r != NULL && delim != NULL && *delim, NULL);
+
+    if (!(str = str ? a_clear(str) : a_new_mem(A_MIN_STR_SIZE)))
+        return NULL;
+    dsize = strlen(delim);
+
+    for (;;)
+    {
+        avail = r->end - r->pos;
+        if (avail)
+            got = 1;
+        if (avail >= dsize)
+        {
+            const char *p = r->buf + r->pos;
+
+            if (dsize == 1)
+                at = (p = memchr(p, *delim, avail)) ? (size_t)(p - r->buf) - r->pos : A_EOS;
+            else
+                at = a_find_offset_internal(p, delim, avail, dsize, 0);
+            if (at != A_EOS)
+            {
+                str = a_file_internal_append(str, r->buf + r->pos, at);
+                r->pos += at + dsize;
+                break;
+            }
+        }
+
+        /* no delimiter, keep what could be the start of one */
+        keep = r->eof ? 0 : avail < dsize - 1 ? avail : dsize - 1;
+        if (!(str = a_file_internal_append(str, r->buf + r->pos, avail - keep)))
+            return NULL;
+        r->pos += avail - keep;
+        if (r->eof || (!a_reader_internal_fill(r) && !keep))
+            break;
+    }
+
+    if (!str)
+        return NULL;
+    if (!got)
+    {
+        a_free(str);
+        return NULL;
+    }
+    str[a_size(str)] = '\0';
+    return str;
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+#if A_HAVE_WRITEV == 1
+/* iovecs handed to writev() at once, well below any IOV_MAX */
+#define A_WRITE_BATCH 64
+
+/* writes all of iov[0..n), resuming after partial writes; iov gets modified */
+static int a_write_internal_iov(int fd, struct iovec *iov, size_t n)
+{
+    while (n)
+    {
+        ssize_t w = writev(fd, iov, (int)n);
+
+        if (w < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return 0;
+        }
+        for (; n && (size_t)w >= iov->iov_len; --n, ++iov)
+            w -= (ssize_t)iov->iov_len;
+        if (n)
+        {
+            iov->iov_base = (char*)iov->iov_base + w;
+            iov->iov_len -= (size_t)w;
+        }
+    }
+    return 1;
+}
+
+int a_write_size_vec(int fd, const char *const *ptrs, const size_t *sizes, size_t count)
+{
+    struct iovec iov[A_WRITE_BATCH];
+    size_t i, n = 0;
+    assert(ptrs != NULL && sizes != NULL);
+    PASSTHROUGH_ON_FAIL(ptrs != NULL && sizes != NULL, 0);
+
+    for (i = 0; i < count; ++i)
+    {
+        if (!sizes[i])
+            continue;
+        iov[n].iov_base = (void*)ptrs[i];
+        iov[n].iov_len = sizes[i];
+        if (++n == A_WRITE_BATCH)
+        {
+            if (!a_write_internal_iov(fd, iov, n))
+                return 0;
+            n = 0;
+        }
+    }
+    return a_write_internal_iov(fd, iov, n);
+}
+int a_write_vec(int fd, const a_cstr *strs, size_t count)
+{
+    struct iovec iov[A_WRITE_BATCH];
+    size_t i, n = 0;
+    assert(strs != NULL);
+    PASSTHROUGH_ON_FAIL(strs != NULL, 0);
+
+    for (i = 0; i < count; ++i)
+    {
+        if (!a_size(strs[i]))
+            continue;
+        iov[n].iov_base = (void*)strs[i];
+        iov[n].iov_len = a_size(strs[i]);
+        if (++n == A_WRITE_BATCH)
+        {
+            if (!a_write_internal_iov(fd, iov, n))
+                return 0;
+            n = 0;
+        }
+    }
+    return a_write_internal_iov(fd, iov, n);
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+/* pieces at least that big are written in place rather than buffered */
+#define A_WRITER_DIRECT (A_WRITER_SIZE / 8)
+
+struct a_writer
+{
+    int fd;
+    size_t used;
+    char buf[A_WRITER_SIZE];
+};
+
+a_writer a_writer_new(int fd)
+{
+    a_writer w;
+
+    if ((w = A_MALLOC(sizeof *w)))
+    {
+        w->fd = fd;
+        w->used = 0;
+    }
+    return w;
+}
+int a_writer_put(a_writer w, a_cstr str)
+{
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, 0);
+    return a_writer_put_size(w, str, a_size(str));
+}
+int a_writer_put_cstr(a_writer w, const char *str)
+{
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, 0);
+    return a_writer_put_size(w, str, strlen(str));
+}
+int a_writer_put_size(a_writer w, const char *str, size_t size)
+{
+    assert(w != NULL && str != NULL);
+    PASSTHROUGH_ON_FAIL(w != NULL && str != NULL, 0);
+
+    if (size >= A_WRITER_DIRECT)
+    {
+        struct iovec iov[2];
+
+        iov[0].iov_base = w->buf;
+        iov[0].iov_len = w->used;
+        iov[1].iov_base = (void*)str;
+        iov[1].iov_len = size;
+        w->used = 0;
+        return a_write_internal_iov(w->fd, iov[0].iov_len ? iov : iov + 1, iov[0].iov_len ? 2 : 1);
+    }
+    if (size > sizeof w->buf - w->used && !a_writer_flush(w))
+        return 0;
+    memcpy(w->buf + w->used, str, size);
+    w->used += size;
+    return 1;
+}
+int a_writer_flush(a_writer w)
+{
+    struct iovec iov;
+    assert(w != NULL);
+    PASSTHROUGH_ON_FAIL(w != NULL, 0);
+
+    iov.iov_base = w->buf;
+    iov.iov_len = w->used;
+    w->used = 0;
+    return a_write_internal_iov(w->fd, &iov, iov.iov_len ? 1 : 0);
+}
+int a_writer_free(a_writer w)
+{
+    int ok;
+
+    if (!w)
+        return 1;
+    ok = a_writer_flush(w);
+    A_FREE(w);
+    return ok;
+}
+#endif
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+#if A_HAVE_MMAP
+static size_t a_file_internal_page(void)
+{
+    static size_t page;
+
+    if (!page)
+    {
+        long p = sysconf(_SC_PAGESIZE);
+        page = p > 0 ? (size_t)p : 4096;
+    }
+    return page;
+}
+
+/*
+ * A mapping is laid out as [ page holding the header | file | zeroes ],
+ * reserved as a single anonymous region the file is then mapped over.
+ * The zero page(s) past the end of the file give the string its NUL.
+ */
+static size_t a_file_internal_span(size_t size)
+{
+    size_t page = a_file_internal_page();
+    return page + (size / page + 1) * page;
+}
+
+a_cstr a_file_map_fd(int fd, int opts)
+{
+    struct stat st;
+    struct a_header *h;
+    size_t size, page = a_file_internal_page();
+    char *base;
+
+    if (fstat(fd, &st) || !S_ISREG(st.st_mode) || st.st_size < 0)
+        return NULL;
+    size = (size_t)st.st_size;
+    if ((off_t)size != st.st_size || size > A_EOS / 2 - 2 * page)
+        return NULL;
+
+    base = mmap(NULL, a_file_internal_span(size), PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)
+        return NULL;
+    if (size && mmap(base + page, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED)
+    {
+        munmap(base, a_file_internal_span(size));
+        return NULL;
+    }
+
+    h = (struct a_header*)(base + page) - 1;
+    h->size = size;
+    h->len = A_EOS; /* counted by a_len() when first needed */
+    h->mem = 0;     /* not ours to realloc or free() */
+
+    if ((opts & a_file_map_validate)
+            && a_internal_valid_utf8_size(base + page, size) != size)
+    {
+        munmap(base, a_file_internal_span(size));
+        return NULL;
+    }
+    return base + page;
+}
+a_cstr a_file_map(const char *path, int opts)
+{
+    a_cstr str;
+    int fd;
+    assert(path != NULL);
+    PASSTHROUGH_ON_FAIL(path != NULL, NULL);
+
+    if ((fd = open(path, O_RDONLY)) < 0)
+        return NULL;
+    str = a_file_map_fd(fd, opts);
+    close(fd); /* the mapping keeps its own reference */
+    return str;
+}
+void a_file_unmap(a_cstr str)
+{
+    PASSTHROUGH_ON_FAIL(str != NULL, ;);
+    assert(a_header(str)->mem == 0);
+
+    munmap((char*)str - a_file_internal_page(), a_file_internal_span(a_size(str)));
+}
+#else
+/* no mmap() here, fall back to reading the file into a regular string */
+a_cstr a_file_map(const char *path, int opts)
+{
+    FILE *fp;
+    a_str str;
+    assert(path != NULL);
+    PASSTHROUGH_ON_FAIL(path != NULL, NULL);
+
+    if (!(fp = fopen(path, "rb")))
+        return NULL;
+    str = a_file_read(fp);
+    fclose(fp);
+    if (str && (opts & a_file_map_validate)
+            && a_internal_valid_utf8_size(str, a_size(str)) != a_size(str))
+    {
+        a_free(str);
+        return NULL;
+    }
+    return str;
+}
+void a_file_unmap(a_cstr str)
+{
+    PASSTHROUGH_ON_FAIL(str != NULL, ;);
+    free(a_header(str));
+}
+#endif
+
+#endif
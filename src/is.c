@@ -4,6 +4,20 @@
  * License: MIT
  */
 const char *a_is_valid_utf8(const char *s)
+{
+    size_t size, valid;
+    assert(s != NULL);
+    PASSTHROUGH_ON_FAIL(s != NULL, NULL);
+    
+    size = strlen(s);
+    valid = a_internal_valid_utf8_size(s, size);
+    return valid == size ? NULL : s + valid;
+}
+/*
+ * Returns the size of the longest prefix of s that is made of complete,
+ * well-formed UTF-8 sequences.
+ */
+static size_t a_is_internal_valid_utf8_seq(const char *s, size_t size)
 {
     /*
      * EBNF made based on table 3-7 "Well-Formed UTF-8 Byte Sequences"
@@ -24,13 +38,24 @@ const char *a_is_valid_utf8(const char *s)
      * 
      * 
      */
-    const unsigned char *p;
+    const unsigned char *p, *end;
     unsigned char c;
-    assert(s != NULL);
-    PASSTHROUGH_ON_FAIL(s != NULL, NULL);
     
-    for (p = (const unsigned char*)s; *p; ++p)
+    for (p = (const unsigned char*)s, end = p + size; p < end; ++p)
     {
+        /* skip ASCII a word at a time */
+        while ((size_t)(end - p) >= sizeof (size_t))
+        {
+            size_t w;
+            
+            memcpy(&w, p, sizeof w);
+            if (w & A_SWAR_HIGHS)
+                break;
+            p += sizeof (size_t);
+        }
+        if (p == end)
+            break;
+        
         c = *p;
         
         if (c < 0x80)
@@ -38,21 +63,23 @@ const char *a_is_valid_utf8(const char *s)
         
         if ((c & 0xe0) == 0xc0)
         {
-            if ((p[1] & 0xc0) != 0x80 /* not continuation */
+            if (end - p < 2
+                || (p[1] & 0xc0) != 0x80 /* not continuation */
                 || (c & 0xfe) == 0xc0) /* overlong */
-                return (const char*)p;
+                break;
             ++p;
             continue;
         }
         
         if ((c & 0xf0) == 0xe0)
         {
-            if ((p[1] & 0xc0) != 0x80 /* not continuation */
+            if (end - p < 3
+                || (p[1] & 0xc0) != 0x80 /* not continuation */
                 || (p[2] & 0xc0) != 0x80 /* not continuation */
                 || (c == 0xe0 && (p[1] & 0xe0) == 0x80) /* overlong */
                 || (c == 0xed && (p[1] & 0xe0) == 0xa0) /* surrogate */
                 || (c == 0xef && p[1] == 0xbf && (p[2] & 0xfe) == 0xbe))
-                return (const char*)p;
+                break;
             
             p += 2;
             continue;
@@ -60,18 +87,54 @@ const char *a_is_valid_utf8(const char *s)
         
         if ((c & 0xf8) == 0xf0)
         {
-            if ((p[1] & 0xc0) != 0x80 /* not continuation */
+            if (end - p < 4
+                || (p[1] & 0xc0) != 0x80 /* not continuation */
                 || (p[2] & 0xc0) != 0x80 /* '' */
                 || (p[3] & 0xc0) != 0x80 /* '' */
                 || (c == 0xf0 && (p[1] & 0xf0) == 0x80) /* overlong */
                 || (c == 0xf4 && p[1] > 0x8f)
                 || c > 0xf4) /* > U+10FFFF */
-                return (const char*)p;
+                break;
             
             p += 3;
             continue;
         }
-        return (const char*)p;
+        break;
     }
-    return NULL;
-}
\ No newline at end of file
+    return (size_t)(p - (const unsigned char*)s);
+}
+
+struct a_is_valid_job
+{
+    const char *s;
+    size_t at[A_MAX_THREADS + 1];
+    size_t valid[A_MAX_THREADS];
+};
+
+static void a_is_internal_valid_job(void *ctx, size_t i)
+{
+    struct a_is_valid_job *job = ctx;
+    job->valid[i] = a_is_internal_valid_utf8_seq(job->s + job->at[i], job->at[i+1] - job->at[i]);
+}
+
+/*
+ * Large strings are checked a chunk per thread. A chunk only starts on
+ * a code point if all of the ones before it are valid, but then only the
+ * first invalid chunk matters anyway.
+ */
+static size_t a_internal_valid_utf8_size(const char *s, size_t size)
+{
+    struct a_is_valid_job job;
+    size_t n = a_internal_threads(size, 0), i;
+
+    if (n == 1)
+        return a_is_internal_valid_utf8_seq(s, size);
+
+    job.s = s;
+    a_internal_split(s, size, n, job.at);
+    a_internal_parallel(n, a_is_internal_valid_job, &job);
+    for (i = 0; i < n; ++i)
+        if (job.valid[i] != job.at[i+1] - job.at[i])
+            return job.at[i] + job.valid[i];
+    return size;
+}
@@ -5,13 +5,10 @@
  */
 size_t a_len_cstr(const char *s)
 {
-    size_t size = 0;
     assert(s != NULL);
     PASSTHROUGH_ON_FAIL(s != NULL, 0);
     
-    while (*s)
-        s = a_next_chr(s), ++size;
-    return size;
+    return a_internal_count_cp(s, strlen(s));
 }
 size_t a_glen(a_cstr str)
 {
@@ -28,6 +25,57 @@ size_t a_glen_cstr(const char *s)
         a_gnext_cstr(&s), ++size;
     return size;
 }
+
+/* binary search over a table of sorted [first, last] ranges */
+static int a_width_internal_in(a_cp cp, const a_cp (*tbl)[2], size_t n)
+{
+    size_t lo = 0, hi = n;
+    
+    if (cp < tbl[0][0] || cp > tbl[n-1][1])
+        return 0;
+    while (lo < hi)
+    {
+        size_t mid = (lo + hi) / 2;
+        if (cp > tbl[mid][1])
+            lo = mid + 1;
+        else if (cp < tbl[mid][0])
+            hi = mid;
+        else
+            return 1;
+    }
+    return 0;
+}
+/* display columns of a single code point: 0, 1 or 2 */
+static size_t a_width_internal_cp(a_cp cp)
+{
+    if (cp >= 0x20 && cp < 0x7F)
+        return 1;
+    if (a_width_internal_in(cp, a_width_zero, A_MAX_WIDTH_ZERO))
+        return 0;
+    return 1 + (size_t)a_width_internal_in(cp, a_width_wide, A_MAX_WIDTH_WIDE);
+}
+size_t a_width(a_cstr str)
+{
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, 0);
+    
+    return a_width_cstr(str);
+}
+size_t a_width_cstr(const char *s)
+{
+    size_t width = 0;
+    assert(s != NULL);
+    PASSTHROUGH_ON_FAIL(s != NULL, 0);
+    
+    while (*s)
+    {
+        if ((unsigned char)*s < 0x80)
+            width += (*s >= 0x20 && *s != 0x7F), ++s;
+        else
+            width += a_width_internal_cp(a_internal_to_next_cp(&s));
+    }
+    return width;
+}
 size_t a_len_cstr_max(const char *s, size_t max)
 {
     size_t size = 0;
@@ -40,9 +88,24 @@ size_t a_len_cstr_max(const char *s, size_t max)
 }
 size_t a_len(a_cstr s)
 {
+    struct a_header *h;
+    size_t len;
     assert(s != NULL);
     PASSTHROUGH_ON_FAIL(s != NULL, 0);
-    return a_header(s)->len;
+    
+    /*
+     * mapped files count their code points on first use; threads sharing
+     * one may all count it, they store the same number
+     */
+    h = a_header(s);
+#if A_ATOMICS
+    if ((len = __atomic_load_n(&h->len, __ATOMIC_RELAXED)) == A_EOS)
+        __atomic_store_n(&h->len, len = a_internal_count_cp(s, h->size), __ATOMIC_RELAXED);
+#else
+    if ((len = h->len) == A_EOS)
+        h->len = len = a_internal_count_cp(s, h->size);
+#endif
+    return len;
 }
 size_t a_size(a_cstr s)
 {
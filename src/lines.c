@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC
+ *
+ * License: MIT
+ */
+
+/*
+ * Line Counting and Indexing
+ *
+ * A line starts at offset 0 and after every '\n' that isn't the last byte,
+ * i.e. a final line without a terminating '\n' still counts as a line.
+ */
+
+struct a_line_index
+{
+    size_t every;    /* the offset of every this many lines is kept */
+    size_t lines;    /* number of lines in the indexed text         */
+    size_t size;     /* size of the indexed text                    */
+    size_t count;    /* number of entries in offsets                */
+    size_t *offsets; /* offsets[i] is where line i * every starts   */
+};
+
+/* counts the '\n' in [s, s+size), a word at a time */
+static size_t a_internal_count_nl(const char *s, size_t size)
+{
+    const char *end = s + size;
+    size_t count = 0;
+
+    while ((size_t)(end - s) >= sizeof (size_t))
+    {
+        size_t acc = 0, i;
+
+        /* per-byte counters, flushed before any of them can wrap */
+        for (i = 0; i < 255 && (size_t)(end - s) >= sizeof (size_t); ++i, s += sizeof (size_t))
+        {
+            size_t w, t;
+
+            memcpy(&w, s, sizeof w);
+            w ^= A_SWAR_ONES * '\n';
+            t = ((w & ~A_SWAR_HIGHS) + ~A_SWAR_HIGHS) | w; /* high bit set for non-zero bytes */
+            acc += (~t & A_SWAR_HIGHS) >> 7;
+        }
+        acc = (acc & (A_SWAR_ONES / 0x101 * 0xFF)) + ((acc >> 8) & (A_SWAR_ONES / 0x101 * 0xFF));
+        count += (acc * (A_SWAR_ONES / 0x101)) >> ((sizeof (size_t) - 2) * CHAR_BIT);
+    }
+    for (; s < end; ++s)
+        count += *s == '\n';
+    return count;
+}
+
+struct a_lines_job
+{
+    const char *s;
+    size_t size;
+    size_t n;                       /* number of chunks                */
+    size_t counts[A_MAX_THREADS];   /* '\n' in every chunk             */
+    struct a_line_index *idx;       /* NULL when only counting         */
+};
+
+static void a_lines_internal_bounds(struct a_lines_job *job, size_t i, size_t *start, size_t *end)
+{
+    *start = job->size / job->n * i;
+    *end = i + 1 == job->n ? job->size : job->size / job->n * (i + 1);
+}
+static void a_lines_internal_count_job(void *ctx, size_t i)
+{
+    struct a_lines_job *job = ctx;
+    size_t start, end;
+
+    a_lines_internal_bounds(job, i, &start, &end);
+    job->counts[i] = a_internal_count_nl(job->s + start, end - start);
+}
+/* records the start of every idx->every-th line of chunk i, counts[i] holds its first line */
+static void a_lines_internal_index_job(void *ctx, size_t i)
+{
+    struct a_lines_job *job = ctx;
+    struct a_line_index *idx = job->idx;
+    const char *p, *end, *s = job->s;
+    size_t start, stop, line = job->counts[i];
+
+    a_lines_internal_bounds(job, i, &start, &stop);
+    end = s + stop;
+    for (p = s + start; (p = memchr(p, '\n', (size_t)(end - p))); )
+    {
+        ++p;
+        if (++line % idx->every == 0 && p < s + job->size)
+            idx->offsets[line / idx->every] = (size_t)(p - s);
+    }
+    job->counts[i] = line - job->counts[i];
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+size_t a_line_count(const char *s, size_t size)
+{
+    struct a_lines_job job;
+    size_t i, count = 0;
+    assert(s != NULL);
+    PASSTHROUGH_ON_FAIL(s != NULL, 0);
+
+    job.s = s;
+    job.size = size;
+    job.n = a_internal_threads(size, 0);
+    job.idx = NULL;
+    a_internal_parallel(job.n, a_lines_internal_count_job, &job);
+
+    for (i = 0; i < job.n; ++i)
+        count += job.counts[i];
+    return count + (size && s[size - 1] != '\n');
+}
+
+a_line_index a_line_index_new(const char *s, size_t size, size_t every)
+{
+    struct a_lines_job job;
+    a_line_index idx;
+    size_t i, lines;
+    assert(s != NULL && every > 0);
+    PASSTHROUGH_ON_FAIL(s != NULL && every > 0, NULL);
+
+    job.s = s;
+    job.size = size;
+    job.n = a_internal_threads(size, 0);
+
+    /* the chunks need to know which line they start with first */
+    lines = 0;
+    if (job.n > 1)
+    {
+        job.idx = NULL;
+        a_internal_parallel(job.n, a_lines_internal_count_job, &job);
+        for (i = 0; i < job.n; ++i)
+            lines += job.counts[i];
+    }
+    else
+        lines = job.counts[0] = a_internal_count_nl(s, size);
+    lines += size && s[size - 1] != '\n';
+
+    if (!(idx = A_MALLOC(sizeof *idx)))
+        return NULL;
+    idx->every = every;
+    idx->lines = lines;
+    idx->size = size;
+    idx->count = lines ? (lines - 1) / every + 1 : 1;
+    if (!(idx->offsets = A_MALLOC(idx->count * sizeof *idx->offsets)))
+    {
+        A_FREE(idx);
+        return NULL;
+    }
+    idx->offsets[0] = 0;
+
+    for (i = 0, lines = 0; i < job.n; ++i)
+    {
+        size_t n = job.counts[i];
+        job.counts[i] = lines;
+        lines += n;
+    }
+    job.idx = idx;
+    a_internal_parallel(job.n, a_lines_internal_index_job, &job);
+    return idx;
+}
+void a_line_index_free(a_line_index idx)
+{
+    if (idx)
+        A_FREE(idx->offsets);
+    A_FREE(idx);
+}
+size_t a_line_index_lines(a_line_index idx)
+{
+    assert(idx != NULL);
+    PASSTHROUGH_ON_FAIL(idx != NULL, 0);
+    return idx->lines;
+}
+size_t a_line_index_offset(a_line_index idx, const char *s, size_t line)
+{
+    const char *p, *end;
+    size_t skip;
+    assert(idx != NULL && s != NULL);
+    PASSTHROUGH_ON_FAIL(idx != NULL && s != NULL, A_EOS);
+
+    if (line >= idx->lines)
+        return A_EOS;
+    p = s + idx->offsets[line / idx->every];
+    end = s + idx->size;
+    for (skip = line % idx->every; skip--; )
+        p = (const char*)memchr(p, '\n', (size_t)(end - p)) + 1;
+    return (size_t)(p - s);
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+#if A_INCLUDE_IO == 1
+/*
+ * The saved format is the magic, a marker (which also catches a different
+ * size_t width or byte order), the header fields and the offsets, all as
+ * native size_t.
+ */
+static const char a_line_index_magic[4] = { 'A', 'L', 'I', 'X' };
+#define A_LINE_INDEX_MARKER ((size_t)0x01020304UL)
+
+int a_line_index_write(a_line_index idx, FILE *fp)
+{
+    size_t h[5];
+    assert(idx != NULL && fp != NULL);
+    PASSTHROUGH_ON_FAIL(idx != NULL && fp != NULL, 0);
+
+    h[0] = A_LINE_INDEX_MARKER;
+    h[1] = idx->every;
+    h[2] = idx->lines;
+    h[3] = idx->size;
+    h[4] = idx->count;
+    return fwrite(a_line_index_magic, sizeof a_line_index_magic, 1, fp) == 1
+        && fwrite(h, sizeof h, 1, fp) == 1
+        && fwrite(idx->offsets, sizeof *idx->offsets, idx->count, fp) == idx->count;
+}
+a_line_index a_line_index_read(FILE *fp, size_t size)
+{
+    char magic[sizeof a_line_index_magic];
+    size_t h[5], i;
+    a_line_index idx;
+    assert(fp != NULL);
+    PASSTHROUGH_ON_FAIL(fp != NULL, NULL);
+
+    if (fread(magic, sizeof magic, 1, fp) != 1 || memcmp(magic, a_line_index_magic, sizeof magic)
+            || fread(h, sizeof h, 1, fp) != 1 || h[0] != A_LINE_INDEX_MARKER
+            || !h[1] || h[3] != size || h[4] != (h[2] ? (h[2] - 1) / h[1] + 1 : 1))
+        return NULL;
+
+    if (!(idx = A_MALLOC(sizeof *idx)))
+        return NULL;
+    idx->every = h[1];
+    idx->lines = h[2];
+    idx->size = h[3];
+    idx->count = h[4];
+    if (!(idx->offsets = A_MALLOC(idx->count * sizeof *idx->offsets))
+            || fread(idx->offsets, sizeof *idx->offsets, idx->count, fp) != idx->count)
+    {
+        a_line_index_free(idx);
+        return NULL;
+    }
+    /* an index for some other text of the same size is caught here at best */
+    for (i = 1; i < idx->count; ++i)
+        if (idx->offsets[i] <= idx->offsets[i - 1] || idx->offsets[i] >= size)
+        {
+            a_line_index_free(idx);
+            return NULL;
+        }
+    return idx;
+}
+#endif
@@ -0,0 +1,478 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC
+ *
+ * License: MIT
+ */
+
+/*
+ * String Maps
+ *
+ * Open addressing in the manner of Swiss tables: a control byte per slot
+ * holds the low 7 bits of the hash of its key (or marks the slot empty
+ * or deleted), and probing goes a group of control bytes at a time,
+ * with one SSE2 compare where available. The control bytes of the first
+ * group are mirrored past the end, so that a group can start at any
+ * slot. A probe only looks at the keys whose control byte matches, and
+ * only compares the bytes of those whose size and full hash match too.
+ * Hashes are kept with the entries, growing never rehashes a key.
+ *
+ * Keys are copied into blocks owned by the map, with a header of their
+ * own, and only given back when the map is freed.
+ */
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#   define A_MAP_GROUP 16
+#else
+#   define A_MAP_GROUP 8
+#endif
+
+#define A_MAP_EMPTY   0x80
+#define A_MAP_DELETED 0xFE
+#define A_MAP_MIN_SLOTS 16          /* no less than A_MAP_GROUP        */
+#define A_MAP_BLOCK_SIZE (16 * 1024)
+
+struct a_map_entry
+{
+    a_cstr key;
+    unsigned long hash;
+    void *value;
+};
+
+struct a_map_block
+{
+    struct a_map_block *next;
+    size_t used;
+    size_t size;
+    /* followed by the keys */
+};
+
+struct a_map
+{
+    unsigned char *ctrl;            /* mask + 1 + A_MAP_GROUP bytes    */
+    struct a_map_entry *entries;
+    size_t mask;                    /* number of slots - 1             */
+    size_t count;
+    size_t deleted;
+    int icase;
+    struct a_map_block *blocks;
+};
+
+/**************************************************/
+
+static unsigned int a_map_internal_ctz(unsigned int m)
+{
+#if defined(__GNUC__)
+    return (unsigned int)__builtin_ctz(m);
+#else
+    unsigned int i = 0;
+
+    for (; !(m & 1); m >>= 1)
+        ++i;
+    return i;
+#endif
+}
+
+/* bit i is set for the control bytes of the group at g equal to c */
+static unsigned int a_map_internal_match(const unsigned char *g, unsigned char c)
+{
+#if defined(__SSE2__)
+    __m128i v = _mm_loadu_si128((const __m128i*)g);
+    return (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8((char)c)));
+#else
+    unsigned int m = 0, i;
+
+    for (i = 0; i < A_MAP_GROUP; ++i)
+        m |= (unsigned int)(g[i] == c) << i;
+    return m;
+#endif
+}
+/* same, for the empty and deleted slots (both have the high bit set) */
+static unsigned int a_map_internal_match_free(const unsigned char *g)
+{
+#if defined(__SSE2__)
+    return (unsigned int)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)g));
+#else
+    unsigned int m = 0, i;
+
+    for (i = 0; i < A_MAP_GROUP; ++i)
+        m |= (unsigned int)(g[i] >> 7) << i;
+    return m;
+#endif
+}
+
+static void a_map_internal_set_ctrl(a_map m, size_t i, unsigned char c)
+{
+    m->ctrl[i] = c;
+    if (i < A_MAP_GROUP)
+        m->ctrl[m->mask + 1 + i] = c;
+}
+
+/* the control byte and the first slot of a hash */
+#define a_map_h2(hash) ((unsigned char)((hash) & 0x7F))
+#define a_map_h1(hash) ((size_t)((hash) >> 7))
+
+/**************************************************/
+
+/* the next code point of a folded key, -1 at the end */
+struct a_map_fold
+{
+    const char *at;
+    const char *end;
+    a_cp b[A_MAX_CASE_FOLD_SIZE + 1];
+    size_t i;
+};
+
+static void a_map_internal_fold_init(struct a_map_fold *f, const char *s, size_t size)
+{
+    f->at = s;
+    f->end = s + size;
+    f->b[0] = 0;
+    f->i = 0;
+}
+static a_cp a_map_internal_fold_next(struct a_map_fold *f)
+{
+    while (!f->b[f->i])
+    {
+        if (f->at >= f->end)
+            return (a_cp)-1;
+        f->b[1] = 0;
+        a_to_fold_cp_cp(a_internal_to_next_cp(&f->at), f->b);
+        f->i = 0;
+        if (!f->b[0])
+            return 0;
+    }
+    return f->b[f->i++];
+}
+
+/* the hash of a key: the bytes, or the folded code points in icase maps */
+static unsigned long a_map_internal_hash(a_map m, const char *s, size_t size)
+{
+    struct a_map_fold f;
+    unsigned long h = A_HASH_BASIS;
+    a_cp cp;
+
+    if (!m->icase)
+        return a_hash_internal(s, size);
+    a_map_internal_fold_init(&f, s, size);
+    while ((cp = a_map_internal_fold_next(&f)) != (a_cp)-1)
+        h = (h ^ cp) * A_HASH_PRIME;
+    return h;
+}
+/* compares an entry to a key, like a_cmp() or a_icmp() */
+static int a_map_internal_equal(a_map m, const struct a_map_entry *e, unsigned long hash,
+                                const char *s, size_t size)
+{
+    struct a_map_fold a, b;
+    a_cp cp;
+
+    if (e->hash != hash)
+        return 0;
+    if (!m->icase)
+        return a_size(e->key) == size && !memcmp(e->key, s, size);
+    a_map_internal_fold_init(&a, e->key, a_size(e->key));
+    a_map_internal_fold_init(&b, s, size);
+    do
+        if ((cp = a_map_internal_fold_next(&a)) != a_map_internal_fold_next(&b))
+            return 0;
+    while (cp != (a_cp)-1);
+    return 1;
+}
+
+/* the slot of a key, or A_EOS */
+static size_t a_map_internal_find(a_map m, const char *s, size_t size, unsigned long hash)
+{
+    size_t pos = a_map_h1(hash), stride = 0, i;
+    unsigned int match;
+
+    if (!m->count)
+        return A_EOS;
+    for (;;)
+    {
+        pos &= m->mask;
+        for (match = a_map_internal_match(m->ctrl + pos, a_map_h2(hash)); match; match &= match - 1)
+        {
+            i = (pos + a_map_internal_ctz(match)) & m->mask;
+            if (a_map_internal_equal(m, &m->entries[i], hash, s, size))
+                return i;
+        }
+        if (a_map_internal_match(m->ctrl + pos, A_MAP_EMPTY))
+            return A_EOS;
+        stride += A_MAP_GROUP;
+        pos += stride;
+    }
+}
+/* the first empty or deleted slot along the probe of a hash */
+static size_t a_map_internal_free_slot(a_map m, unsigned long hash)
+{
+    size_t pos = a_map_h1(hash), stride = 0;
+    unsigned int match;
+
+    for (;;)
+    {
+        pos &= m->mask;
+        if ((match = a_map_internal_match_free(m->ctrl + pos)))
+            return (pos + a_map_internal_ctz(match)) & m->mask;
+        stride += A_MAP_GROUP;
+        pos += stride;
+    }
+}
+
+/* reallocates the slots to hold at least count entries, dropping the deleted ones */
+static int a_map_internal_resize(a_map m, size_t count)
+{
+    unsigned char *ctrl = m->ctrl;
+    struct a_map_entry *entries = m->entries;
+    size_t slots = A_MAP_MIN_SLOTS, old = m->ctrl ? m->mask + 1 : 0, i, j;
+
+    /* at most 7/8 full */
+    while (slots - slots / 8 <= count)
+        slots *= 2;
+    if (!(m->ctrl = A_MALLOC(slots + A_MAP_GROUP)))
+    {
+        m->ctrl = ctrl;
+        return 0;
+    }
+    if (!(m->entries = A_MALLOC(slots * sizeof *m->entries)))
+    {
+        A_FREE(m->ctrl);
+        m->ctrl = ctrl;
+        m->entries = entries;
+        return 0;
+    }
+    memset(m->ctrl, A_MAP_EMPTY, slots + A_MAP_GROUP);
+    m->mask = slots - 1;
+    m->deleted = 0;
+    for (i = 0; i < old; ++i)
+    {
+        if (ctrl[i] & 0x80)
+            continue;
+        j = a_map_internal_free_slot(m, entries[i].hash);
+        a_map_internal_set_ctrl(m, j, ctrl[i]);
+        m->entries[j] = entries[i];
+    }
+    A_FREE(ctrl);
+    A_FREE(entries);
+    return 1;
+}
+
+/* copies a key into the blocks of the map */
+static a_cstr a_map_internal_key(a_map m, const char *s, size_t size)
+{
+    struct a_map_block *b = m->blocks;
+    size_t need = sizeof (struct a_header) + size + 1, mem;
+    struct a_header *h;
+
+    /* keep the headers aligned */
+    need = (need + sizeof (size_t) - 1) / sizeof (size_t) * sizeof (size_t);
+    if (!b || b->size - b->used < need)
+    {
+        mem = need > A_MAP_BLOCK_SIZE / 4 ? need : A_MAP_BLOCK_SIZE;
+        if (!(b = A_MALLOC(sizeof *b + mem)))
+            return NULL;
+        b->used = 0;
+        b->size = mem;
+        /* a key of its own doesn't end the current block */
+        if (mem == need && m->blocks)
+        {
+            b->next = m->blocks->next;
+            m->blocks->next = b;
+        }
+        else
+        {
+            b->next = m->blocks;
+            m->blocks = b;
+        }
+    }
+    h = (struct a_header*)((char*)(b + 1) + b->used);
+    b->used += need;
+    h->size = size;
+    h->len = a_internal_count_cp_seq(s, size);
+    h->mem = size + 1;
+    memcpy(a_buff(h), s, size);
+    a_buff(h)[size] = '\0';
+    return a_buff(h);
+}
+
+static a_map a_map_internal_new(int icase)
+{
+    a_map m;
+
+    if (!(m = A_MALLOC(sizeof *m)))
+        return NULL;
+    m->ctrl = NULL;
+    m->entries = NULL;
+    m->mask = 0;
+    m->count = 0;
+    m->deleted = 0;
+    m->icase = icase;
+    m->blocks = NULL;
+    return m;
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+a_map a_map_new(void)
+{
+    return a_map_internal_new(0);
+}
+a_map a_map_new_icase(void)
+{
+    return a_map_internal_new(1);
+}
+void a_map_free(a_map m)
+{
+    struct a_map_block *b, *next;
+
+    if (!m)
+        return;
+    for (b = m->blocks; b; b = next)
+    {
+        next = b->next;
+        A_FREE(b);
+    }
+    A_FREE(m->ctrl);
+    A_FREE(m->entries);
+    A_FREE(m);
+}
+size_t a_map_count(a_map m)
+{
+    assert(m != NULL);
+    PASSTHROUGH_ON_FAIL(m != NULL, 0);
+    return m->count;
+}
+
+int a_map_set(a_map m, a_cstr key, void *value)
+{
+    assert(key != NULL);
+    PASSTHROUGH_ON_FAIL(key != NULL, 0);
+    return a_map_set_size(m, key, a_size(key), value);
+}
+int a_map_set_cstr(a_map m, const char *key, void *value)
+{
+    assert(key != NULL);
+    PASSTHROUGH_ON_FAIL(key != NULL, 0);
+    return a_map_set_size(m, key, strlen(key), value);
+}
+int a_map_set_size(a_map m, const char *key, size_t size, void *value)
+{
+    unsigned long hash;
+    size_t i;
+    a_cstr copy;
+    assert(m != NULL && key != NULL);
+    PASSTHROUGH_ON_FAIL(m != NULL && key != NULL, 0);
+
+    hash = a_map_internal_hash(m, key, size);
+    if ((i = a_map_internal_find(m, key, size, hash)) != A_EOS)
+    {
+        m->entries[i].value = value;
+        return 1;
+    }
+    if (!m->ctrl || m->count + m->deleted + 1 > (m->mask + 1) - (m->mask + 1) / 8)
+        if (!a_map_internal_resize(m, m->count + 1))
+            return 0;
+    if (!(copy = a_map_internal_key(m, key, size)))
+        return 0;
+
+    i = a_map_internal_free_slot(m, hash);
+    if (m->ctrl[i] == A_MAP_DELETED)
+        --m->deleted;
+    a_map_internal_set_ctrl(m, i, a_map_h2(hash));
+    m->entries[i].key = copy;
+    m->entries[i].hash = hash;
+    m->entries[i].value = value;
+    ++m->count;
+    return 1;
+}
+
+void *a_map_get(a_map m, a_cstr key)
+{
+    assert(key != NULL);
+    PASSTHROUGH_ON_FAIL(key != NULL, NULL);
+    return a_map_get_size(m, key, a_size(key));
+}
+void *a_map_get_cstr(a_map m, const char *key)
+{
+    assert(key != NULL);
+    PASSTHROUGH_ON_FAIL(key != NULL, NULL);
+    return a_map_get_size(m, key, strlen(key));
+}
+void *a_map_get_size(a_map m, const char *key, size_t size)
+{
+    size_t i;
+    assert(m != NULL && key != NULL);
+    PASSTHROUGH_ON_FAIL(m != NULL && key != NULL, NULL);
+
+    i = a_map_internal_find(m, key, size, a_map_internal_hash(m, key, size));
+    return i == A_EOS ? NULL : m->entries[i].value;
+}
+
+a_cstr a_map_key(a_map m, a_cstr key)
+{
+    assert(key != NULL);
+    PASSTHROUGH_ON_FAIL(key != NULL, NULL);
+    return a_map_key_size(m, key, a_size(key));
+}
+a_cstr a_map_key_cstr(a_map m, const char *key)
+{
+    assert(key != NULL);
+    PASSTHROUGH_ON_FAIL(key != NULL, NULL);
+    return a_map_key_size(m, key, strlen(key));
+}
+a_cstr a_map_key_size(a_map m, const char *key, size_t size)
+{
+    size_t i;
+    assert(m != NULL && key != NULL);
+    PASSTHROUGH_ON_FAIL(m != NULL && key != NULL, NULL);
+
+    i = a_map_internal_find(m, key, size, a_map_internal_hash(m, key, size));
+    return i == A_EOS ? NULL : m->entries[i].key;
+}
+
+int a_map_remove(a_map m, a_cstr key)
+{
+    assert(key != NULL);
+    PASSTHROUGH_ON_FAIL(key != NULL, 0);
+    return a_map_remove_size(m, key, a_size(key));
+}
+int a_map_remove_cstr(a_map m, const char *key)
+{
+    assert(key != NULL);
+    PASSTHROUGH_ON_FAIL(key != NULL, 0);
+    return a_map_remove_size(m, key, strlen(key));
+}
+int a_map_remove_size(a_map m, const char *key, size_t size)
+{
+    size_t i;
+    assert(m != NULL && key != NULL);
+    PASSTHROUGH_ON_FAIL(m != NULL && key != NULL, 0);
+
+    if ((i = a_map_internal_find(m, key, size, a_map_internal_hash(m, key, size))) == A_EOS)
+        return 0;
+    a_map_internal_set_ctrl(m, i, A_MAP_DELETED);
+    --m->count;
+    ++m->deleted;
+    return 1;
+}
+
+int a_map_next(a_map m, size_t *iter, a_cstr *key, void **value)
+{
+    size_t i;
+    assert(m != NULL && iter != NULL);
+    PASSTHROUGH_ON_FAIL(m != NULL && iter != NULL, 0);
+
+    for (i = *iter; m->ctrl && i <= m->mask; ++i)
+    {
+        if (m->ctrl[i] & 0x80)
+            continue;
+        if (key)
+            *key = m->entries[i].key;
+        if (value)
+            *value = m->entries[i].value;
+        *iter = i + 1;
+        return 1;
+    }
+    *iter = i;
+    return 0;
+}
@@ -4,6 +4,10 @@
  * License: MIT
  */
 #if A_INCLUDE_MEM == 1
+#if A_INCLUDE_THREADS == 1
+#include <pthread.h>
+#endif
+
 struct a_pool
 {
     size_t size;
@@ -51,4 +55,184 @@ a_str a_gc_collect(a_pool *pool, a_str str)
     return str;
 }
 
-#endif
\ No newline at end of file
+/*
+ * Shared pools
+ *
+ * A plain pool behind a lock, for strings collected from several threads.
+ */
+struct a_shared_pool
+{
+#if A_INCLUDE_THREADS == 1
+    pthread_mutex_t lock;
+#endif
+    a_pool pool;
+};
+
+a_shared_pool a_gc_shared_new(void)
+{
+    a_shared_pool pool;
+
+    if (!(pool = malloc(sizeof *pool)))
+        return NULL;
+    if (!(pool->pool = a_gc_new()))
+    {
+        free(pool);
+        return NULL;
+    }
+#if A_INCLUDE_THREADS == 1
+    pthread_mutex_init(&pool->lock, NULL);
+#endif
+    return pool;
+}
+void a_gc_shared_free(a_shared_pool pool)
+{
+    PASSTHROUGH_ON_FAIL(pool != NULL, ;);
+#if A_INCLUDE_THREADS == 1
+    pthread_mutex_destroy(&pool->lock);
+#endif
+    a_gc_free(pool->pool);
+    free(pool);
+}
+a_str a_gc_shared_collect(a_shared_pool pool, a_str str)
+{
+    assert(pool != NULL);
+    PASSTHROUGH_ON_FAIL(pool != NULL, NULL);
+#if A_INCLUDE_THREADS == 1
+    pthread_mutex_lock(&pool->lock);
+    str = a_gc_collect(&pool->pool, str);
+    pthread_mutex_unlock(&pool->lock);
+    return str;
+#else
+    return a_gc_collect(&pool->pool, str);
+#endif
+}
+
+/*
+ * Free queues
+ *
+ * A multiple producer, single consumer stack of strings waiting to be
+ * freed by the thread that owns the queue. A queued string is dead, so
+ * the link to the next one is kept in its own buffer (at least
+ * A_MIN_STR_SIZE bytes, which has to hold a pointer) and queueing never
+ * allocates. Producers push a whole chain with a single compare and swap,
+ * the owner takes the whole stack with a single exchange, which leaves no
+ * room for ABA.
+ */
+/* fails to compile if A_MIN_STR_SIZE is defined too small for the link */
+typedef char a_free_queue_link_fits[A_MIN_STR_SIZE >= sizeof (a_str) ? 1 : -1];
+struct a_free_queue
+{
+    a_str head;
+#if A_INCLUDE_THREADS == 1 && !A_ATOMICS
+    pthread_mutex_t lock;
+#endif
+};
+
+static a_str a_free_queue_internal_next(a_str str)
+{
+    a_str next;
+    memcpy(&next, str, sizeof next);
+    return next;
+}
+
+/* pushes the chain first .. last, already linked */
+static void a_free_queue_internal_push(a_free_queue q, a_str first, a_str last)
+{
+#if A_ATOMICS
+    a_str head = __atomic_load_n(&q->head, __ATOMIC_RELAXED);
+
+    do
+        memcpy(last, &head, sizeof head);
+    while (!__atomic_compare_exchange_n(&q->head, &head, first, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+#else
+#   if A_INCLUDE_THREADS == 1
+    pthread_mutex_lock(&q->lock);
+#   endif
+    memcpy(last, &q->head, sizeof q->head);
+    q->head = first;
+#   if A_INCLUDE_THREADS == 1
+    pthread_mutex_unlock(&q->lock);
+#   endif
+#endif
+}
+
+a_free_queue a_free_queue_new(void)
+{
+    a_free_queue q;
+
+    if (!(q = malloc(sizeof *q)))
+        return NULL;
+    q->head = NULL;
+#if A_INCLUDE_THREADS == 1 && !A_ATOMICS
+    pthread_mutex_init(&q->lock, NULL);
+#endif
+    return q;
+}
+void a_free_queue_free(a_free_queue q)
+{
+    PASSTHROUGH_ON_FAIL(q != NULL, ;);
+    a_free_queue_drain(q);
+#if A_INCLUDE_THREADS == 1 && !A_ATOMICS
+    pthread_mutex_destroy(&q->lock);
+#endif
+    free(q);
+}
+void a_free_queue_push(a_free_queue q, a_str str)
+{
+    assert(q != NULL && str != NULL);
+    PASSTHROUGH_ON_FAIL(q != NULL && str != NULL, ;);
+    a_free_queue_push_vec(q, &str, 1);
+}
+void a_free_queue_push_vec(a_free_queue q, a_str *strv, size_t count)
+{
+    a_str first = NULL, last = NULL;
+    size_t i;
+    assert(q != NULL && (strv != NULL || !count));
+    PASSTHROUGH_ON_FAIL(q != NULL && (strv != NULL || !count), ;);
+
+    for (i = count; i--;)
+    {
+        if (!strv[i])
+            continue;
+        /* mapped files have no buffer to link through, nothing to give back either */
+        if (!a_header(strv[i])->mem)
+        {
+            a_free(strv[i]);
+            continue;
+        }
+        memcpy(strv[i], &first, sizeof first);
+        first = strv[i];
+        if (!last)
+            last = first;
+    }
+    if (first)
+        a_free_queue_internal_push(q, first, last);
+}
+size_t a_free_queue_drain(a_free_queue q)
+{
+    a_str s, next;
+    size_t count = 0;
+    assert(q != NULL);
+    PASSTHROUGH_ON_FAIL(q != NULL, 0);
+
+#if A_ATOMICS
+    s = __atomic_exchange_n(&q->head, NULL, __ATOMIC_ACQUIRE);
+#else
+#   if A_INCLUDE_THREADS == 1
+    pthread_mutex_lock(&q->lock);
+#   endif
+    s = q->head;
+    q->head = NULL;
+#   if A_INCLUDE_THREADS == 1
+    pthread_mutex_unlock(&q->lock);
+#   endif
+#endif
+    for (; s; s = next, ++count)
+    {
+        next = a_free_queue_internal_next(s);
+        a_free(s);
+    }
+    return count;
+}
+
+#endif
@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC
+ *
+ * License: MIT
+ */
+
+/*
+ * Normalization
+ *
+ * Streaming: every code point is decomposed as it is read and added to a
+ * buffer that holds the current segment, a starter and the non-starters
+ * after it, kept in canonical order as they are inserted. The next
+ * starter closes the segment, which is then composed (for the C forms)
+ * and emitted; a starter left alone may still compose with the one
+ * closing it (Hangul LV + T, and a few others), in which case the segment
+ * goes on. Each code point emitted carries the byte range of the input
+ * it came from, so callers can map results back to the original text.
+ */
+
+#define A_HANGUL_S          0xAC00
+#define A_HANGUL_L          0x1100
+#define A_HANGUL_V          0x1161
+#define A_HANGUL_T          0x11A7
+#define A_HANGUL_V_COUNT    21
+#define A_HANGUL_T_COUNT    28
+#define A_HANGUL_N_COUNT    (A_HANGUL_V_COUNT * A_HANGUL_T_COUNT)
+#define A_HANGUL_L_COUNT    19
+#define A_HANGUL_S_COUNT    (A_HANGUL_L_COUNT * A_HANGUL_N_COUNT)
+#define A_NORM_SMALL        32
+
+struct a_norm_item
+{
+    a_cp cp;
+    unsigned char ccc;
+    size_t start, end;              /* the bytes of the input it came from */
+};
+
+struct a_norm
+{
+    int compose;
+    int failed;
+    struct a_norm_item *buf;
+    size_t count, mem;
+    void (*emit)(void *ctx, a_cp cp, size_t start, size_t end);
+    void *ctx;
+    struct a_norm_item small[A_NORM_SMALL];
+};
+
+/* stores the full decomposition of cp to b, returns its size */
+static size_t a_norm_internal_decompose(a_cp cp, int compat, a_cp *b)
+{
+    const struct a_norm_rec *r;
+    unsigned long s = (unsigned long)cp - A_HANGUL_S;
+
+    if (cp >= A_HANGUL_S && s < A_HANGUL_S_COUNT)
+    {
+        b[0] = A_HANGUL_L + s / A_HANGUL_N_COUNT;
+        b[1] = A_HANGUL_V + (s % A_HANGUL_N_COUNT) / A_HANGUL_T_COUNT;
+        if (!(s % A_HANGUL_T_COUNT))
+            return 2;
+        b[2] = A_HANGUL_T + s % A_HANGUL_T_COUNT;
+        return 3;
+    }
+    if (cp < 0 || cp > 0x10FFFF)
+    {
+        b[0] = cp;
+        return 1;
+    }
+    r = &A_NORM_RECORD(cp);
+    if (compat && r->klen)
+    {
+        memcpy(b, a_norm_data + r->kat, r->klen * sizeof *b);
+        return r->klen;
+    }
+    if (r->len)
+    {
+        memcpy(b, a_norm_data + r->at, r->len * sizeof *b);
+        return r->len;
+    }
+    b[0] = cp;
+    return 1;
+}
+
+static unsigned char a_norm_internal_ccc(a_cp cp)
+{
+    return cp < 0 || cp > 0x10FFFF ? 0 : A_CCC(cp);
+}
+
+/* the primary composite of a and b, 0 if there is none */
+static a_cp a_norm_internal_compose(a_cp a, a_cp b)
+{
+    size_t lo = 0, hi = A_MAX_COMPOSITIONS, mid;
+
+    if (a >= A_HANGUL_L && a < A_HANGUL_L + A_HANGUL_L_COUNT
+            && b >= A_HANGUL_V && b < A_HANGUL_V + A_HANGUL_V_COUNT)
+        return A_HANGUL_S + ((a - A_HANGUL_L) * A_HANGUL_V_COUNT + b - A_HANGUL_V) * A_HANGUL_T_COUNT;
+    if (a >= A_HANGUL_S && a < A_HANGUL_S + A_HANGUL_S_COUNT && !((a - A_HANGUL_S) % A_HANGUL_T_COUNT)
+            && b > A_HANGUL_T && b < A_HANGUL_T + A_HANGUL_T_COUNT)
+        return a + b - A_HANGUL_T;
+
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+        if (a_norm_compositions[mid][0] < a
+                || (a_norm_compositions[mid][0] == a && a_norm_compositions[mid][1] < b))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo < A_MAX_COMPOSITIONS && a_norm_compositions[lo][0] == a && a_norm_compositions[lo][1] == b)
+        return a_norm_compositions[lo][2];
+    return 0;
+}
+
+static void a_norm_internal_init(struct a_norm *n, int compose,
+                                 void (*emit)(void *ctx, a_cp cp, size_t start, size_t end), void *ctx)
+{
+    n->compose = compose;
+    n->failed = 0;
+    n->buf = n->small;
+    n->count = 0;
+    n->mem = A_NORM_SMALL;
+    n->emit = emit;
+    n->ctx = ctx;
+}
+static void a_norm_internal_free(struct a_norm *n)
+{
+    if (n->buf != n->small)
+        A_FREE(n->buf);
+}
+
+/* composes the segment in the buffer, if it starts with a starter */
+static void a_norm_internal_compose_segment(struct a_norm *n)
+{
+    struct a_norm_item *b = n->buf;
+    size_t i, out = 1;
+    int last = -1;              /* combining class of the last one kept after the starter */
+    a_cp c;
+
+    if (!n->count || b[0].ccc)
+        return;
+    for (i = 1; i < n->count; ++i)
+    {
+        /* the buffer is in canonical order: blocked only by an equal class */
+        if (last != b[i].ccc && (c = a_norm_internal_compose(b[0].cp, b[i].cp)))
+        {
+            b[0].cp = c;
+            if (b[i].start < b[0].start)
+                b[0].start = b[i].start;
+            if (b[i].end > b[0].end)
+                b[0].end = b[i].end;
+            continue;
+        }
+        last = b[i].ccc;
+        b[out++] = b[i];
+    }
+    n->count = out;
+}
+
+static void a_norm_internal_emit_all(struct a_norm *n)
+{
+    size_t i;
+
+    for (i = 0; i < n->count; ++i)
+        n->emit(n->ctx, n->buf[i].cp, n->buf[i].start, n->buf[i].end);
+    n->count = 0;
+}
+/* ends the segment, emits all of the buffer */
+static void a_norm_internal_flush(struct a_norm *n)
+{
+    if (n->compose)
+        a_norm_internal_compose_segment(n);
+    a_norm_internal_emit_all(n);
+}
+
+/* adds a code point that is already fully decomposed */
+static void a_norm_internal_add(struct a_norm *n, a_cp cp, size_t start, size_t end)
+{
+    struct a_norm_item *grown;
+    unsigned char ccc = a_norm_internal_ccc(cp);
+    size_t at;
+    a_cp c;
+
+    if (!ccc && n->count)
+    {
+        if (n->compose)
+        {
+            a_norm_internal_compose_segment(n);
+            if (n->count == 1 && !n->buf[0].ccc && (c = a_norm_internal_compose(n->buf[0].cp, cp)))
+            {
+                n->buf[0].cp = c;
+                if (end > n->buf[0].end)
+                    n->buf[0].end = end;
+                return;
+            }
+        }
+        a_norm_internal_emit_all(n);
+    }
+
+    if (n->count == n->mem)
+    {
+        if (n->buf == n->small)
+        {
+            if ((grown = A_MALLOC(n->mem * 2 * sizeof *grown)))
+                memcpy(grown, n->small, n->count * sizeof *grown);
+        }
+        else
+            grown = A_REALLOC(n->buf, n->mem * 2 * sizeof *grown);
+        if (!grown)
+        {
+            n->failed = 1;
+            return;
+        }
+        n->buf = grown;
+        n->mem *= 2;
+    }
+
+    /* canonical ordering: a stable insertion by combining class, never past a starter */
+    for (at = n->count; ccc && at && n->buf[at-1].ccc > ccc; --at)
+        n->buf[at] = n->buf[at-1];
+    n->buf[at].cp = cp;
+    n->buf[at].ccc = ccc;
+    n->buf[at].start = start;
+    n->buf[at].end = end;
+    ++n->count;
+}
+
+/* the string being built by a_normalize() */
+struct a_norm_out
+{
+    a_str str;
+};
+
+static void a_norm_internal_emit_str(void *ctx, a_cp cp, size_t start, size_t end)
+{
+    struct a_norm_out *o = ctx;
+    char b[8];
+    size_t size;
+
+    (void)start, (void)end;
+    if (!o->str)
+        return;
+    size = cp < 0x80 ? (b[0] = (char)cp, 1) : strlen(a_internal_cp_to_char(cp, b));
+    if (!(o->str = a_ensure(o->str, size)))
+        return;
+    memcpy(o->str + a_size(o->str), b, size);
+    a_header(o->str)->size += size;
+    a_header(o->str)->len++;
+    o->str[a_size(o->str)] = '\0';
+}
+
+static a_str a_normalize_internal(const char *s, size_t size, int mode)
+{
+    const int compat = mode == a_norm_nfkc || mode == a_norm_nfkd;
+    struct a_norm n;
+    struct a_norm_out o;
+    const char *at = s, *end = s + size, *from;
+    a_cp d[A_MAX_DECOMPOSITION_SIZE];
+    size_t i, count;
+
+    if (!(o.str = a_new_mem_raw(size)))
+        return NULL;
+    *o.str = '\0';
+    a_header(o.str)->size = a_header(o.str)->len = 0;
+    a_norm_internal_init(&n, mode == a_norm_nfc || mode == a_norm_nfkc, a_norm_internal_emit_str, &o);
+
+    while (at < end && o.str && !n.failed)
+    {
+        /* ASCII never composes with ASCII: a run of it passes through as is */
+        if ((unsigned char)*at < 0x80 && (at + 1 == end || (unsigned char)at[1] < 0x80))
+        {
+            a_norm_internal_flush(&n);
+            a_norm_internal_emit_str(&o, (unsigned char)*at, 0, 0);
+            ++at;
+            continue;
+        }
+        from = at;
+        count = a_norm_internal_decompose(a_internal_to_next_cp(&at), compat, d);
+        for (i = 0; i < count; ++i)
+            a_norm_internal_add(&n, d[i], (size_t)(from - s), (size_t)(at - s));
+    }
+    if (!n.failed)
+        a_norm_internal_flush(&n);
+    a_norm_internal_free(&n);
+    if (n.failed && o.str)
+    {
+        a_free(o.str);
+        return NULL;
+    }
+    return o.str;
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+a_str a_normalize(a_str str, int mode)
+{
+    a_str new;
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+
+    new = a_normalize_internal(str, a_size(str), mode);
+    a_free(str);
+    return new;
+}
+a_str a_normalize_cstr(const char *str, int mode)
+{
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+    return a_normalize_internal(str, strlen(str), mode);
+}
+a_str a_new_normalize(a_cstr str, int mode)
+{
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+    return a_normalize_internal(str, a_size(str), mode);
+}
+int a_is_quick_normalized(a_str str, int mode)
+{
+    a_str n;
+    int same;
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, a_norm_maybe);
+
+    if (!(n = a_normalize_internal(str, a_size(str), mode)))
+        return a_norm_maybe;
+    same = a_size(n) == a_size(str) && !memcmp(n, str, a_size(n));
+    a_free(n);
+    return same ? a_norm_yes : a_norm_no;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC
+ *
+ * License: MIT
+ */
+
+/*
+ * Padding and Repetition
+ */
+
+enum { a_pad_internal_left, a_pad_internal_right, a_pad_internal_center };
+
+/* measures str in the units given by opts */
+static size_t a_pad_internal_measure(a_cstr str, int opts)
+{
+    switch (opts)
+    {
+        case a_pad_grapheme:
+            return a_glen(str);
+        case a_pad_columns:
+            return a_width(str);
+        default:
+            return a_len(str);
+    }
+}
+
+static a_str a_pad_internal(a_str str, size_t width, const char *chr, int opts, int where)
+{
+    struct a_header *h;
+    size_t csize, cwidth = 1, have, count, left, size;
+    assert(str != NULL && chr != NULL && *chr);
+    PASSTHROUGH_ON_FAIL(str != NULL && chr != NULL && *chr, NULL);
+
+    if ((have = a_pad_internal_measure(str, opts)) >= width)
+        return str;
+
+    csize = a_size_chr_cstr(chr);
+    if (opts == a_pad_columns && !(cwidth = a_width_internal_cp(a_internal_char_to_cp(chr))))
+        cwidth = 1;
+    count = (width - have) / cwidth;
+    if (count > (A_EOS - 1 - a_size(str)) / csize)
+    {
+        a_free(str);
+        return NULL;
+    }
+    size = a_size(str) + count * csize;
+    if (!(str = a_reserve(str, size)))
+        return NULL;
+
+    left = where == a_pad_internal_left ? count : where == a_pad_internal_center ? count / 2 : 0;
+    h = a_header(str);
+    if (left)
+        memmove(str + left * csize, str, h->size);
+    a_internal_fill(str, chr, csize, left);
+    a_internal_fill(str + left * csize + h->size, chr, csize, count - left);
+    str[size] = '\0';
+    h->size = size;
+    h->len += count;
+    return str;
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+a_str a_pad_left(a_str str, size_t width, const char *chr, int opts)
+{
+    return a_pad_internal(str, width, chr, opts, a_pad_internal_left);
+}
+a_str a_pad_right(a_str str, size_t width, const char *chr, int opts)
+{
+    return a_pad_internal(str, width, chr, opts, a_pad_internal_right);
+}
+a_str a_center(a_str str, size_t width, const char *chr, int opts)
+{
+    return a_pad_internal(str, width, chr, opts, a_pad_internal_center);
+}
+a_str a_repeat(a_str str, size_t count)
+{
+    struct a_header *h;
+    size_t size, n;
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+
+    size = a_size(str);
+    if (!count || !size)
+        return a_clear(str);
+    if (count > (A_EOS - 1) / size)
+    {
+        a_free(str);
+        return NULL;
+    }
+    if (!(str = a_reserve(str, size * count)))
+        return NULL;
+
+    /* the string is its own source, doubling the copied part each time */
+    for (n = size; n < size * count; n <<= 1)
+        memcpy(str + n, str, n < size * count - n ? n : size * count - n);
+    h = a_header(str);
+    str[size * count] = '\0';
+    h->size = size * count;
+    h->len *= count;
+    return str;
+}
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC
+ *
+ * License: MIT
+ */
+
+/*
+ * Splitting work across threads
+ *
+ * a_internal_parallel() runs fn(ctx, i) for every i in [0, n). The jobs
+ * are handed to a small pool of worker threads, started the first time
+ * they're needed and kept around; the calling thread takes jobs as well
+ * and returns once they're all done. Only one batch runs at a time, a
+ * call made while another one is running (from another thread or from
+ * within a job) just runs its jobs itself.
+ *
+ * Without A_INCLUDE_THREADS the jobs simply run one after the other on
+ * the calling thread.
+ */
+#if A_INCLUDE_THREADS == 1
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+static size_t a_threads_max;                        /* 0 is one per CPU         */
+static size_t a_threads_min_size = A_THREADS_MIN_SIZE;
+
+#if A_INCLUDE_THREADS == 1
+static pthread_mutex_t a_pool_busy = PTHREAD_MUTEX_INITIALIZER; /* held for a whole batch */
+static pthread_mutex_t a_pool_lock = PTHREAD_MUTEX_INITIALIZER; /* guards everything below */
+static pthread_cond_t  a_pool_wake = PTHREAD_COND_INITIALIZER;  /* a batch was posted      */
+static pthread_cond_t  a_pool_done = PTHREAD_COND_INITIALIZER;  /* its last job finished   */
+static pthread_t       a_pool_threads[A_MAX_THREADS];
+static size_t          a_pool_started;
+static unsigned long   a_pool_batch;
+static int             a_pool_quit;
+static void          (*a_pool_fn)(void *ctx, size_t i);
+static void           *a_pool_ctx;
+static size_t          a_pool_n, a_pool_next, a_pool_left;
+static pthread_once_t  a_pool_once = PTHREAD_ONCE_INIT;
+static size_t          a_pool_cpus;                 /* a_threads_max of 0 means this */
+
+static void a_pool_internal_cpus(void)
+{
+    long c = sysconf(_SC_NPROCESSORS_ONLN);
+    a_pool_cpus = c < 1 ? 1 : c > A_MAX_THREADS ? A_MAX_THREADS : (size_t)c;
+}
+
+/* runs jobs of the current batch until there are none left, a_pool_lock held */
+static void a_pool_internal_drain(void)
+{
+    while (a_pool_next < a_pool_n)
+    {
+        size_t i = a_pool_next++;
+
+        pthread_mutex_unlock(&a_pool_lock);
+        a_pool_fn(a_pool_ctx, i);
+        pthread_mutex_lock(&a_pool_lock);
+        if (!--a_pool_left)
+            pthread_cond_signal(&a_pool_done);
+    }
+}
+
+static void *a_pool_internal_worker(void *arg)
+{
+    unsigned long seen = 0;
+
+    (void)arg;
+    pthread_mutex_lock(&a_pool_lock);
+    for (;;)
+    {
+        while (seen == a_pool_batch && !a_pool_quit)
+            pthread_cond_wait(&a_pool_wake, &a_pool_lock);
+        if (a_pool_quit)
+            break;
+        seen = a_pool_batch;
+        a_pool_internal_drain();
+    }
+    pthread_mutex_unlock(&a_pool_lock);
+    return NULL;
+}
+
+/* joins all the workers, a_pool_busy held */
+static void a_pool_internal_stop(void)
+{
+    size_t i;
+
+    pthread_mutex_lock(&a_pool_lock);
+    a_pool_quit = 1;
+    pthread_cond_broadcast(&a_pool_wake);
+    pthread_mutex_unlock(&a_pool_lock);
+    for (i = 0; i < a_pool_started; ++i)
+        pthread_join(a_pool_threads[i], NULL);
+    a_pool_started = 0;
+    a_pool_quit = 0;
+}
+#endif
+
+/*
+ * Number of jobs worth splitting size bytes into, at least min_size (and
+ * the size set by a_threads_set()) bytes each. Anything too small to be
+ * split returns 1 right away.
+ */
+static size_t a_internal_threads(size_t size, size_t min_size)
+{
+#if A_INCLUDE_THREADS == 1
+    size_t n, max = a_threads_max;
+
+    if (min_size < a_threads_min_size)
+        min_size = a_threads_min_size;
+    if (size / 2 < min_size || max == 1)
+        return 1;
+    if (!max)
+    {
+        pthread_once(&a_pool_once, a_pool_internal_cpus);
+        max = a_pool_cpus;
+    }
+    n = size / (min_size ? min_size : 1);
+    return n > max ? max : n;
+#else
+    (void)size, (void)min_size;
+    return 1;
+#endif
+}
+
+/*
+ * Fills at[0..n] with the bounds of n chunks of about the same size over
+ * [s, s+size), chunk i being [at[i], at[i+1]). Bounds are moved forward
+ * past continuation bytes, so that every chunk starts with a code point.
+ */
+static void a_internal_split(const char *s, size_t size, size_t n, size_t *at)
+{
+    size_t i, k, b;
+
+    at[0] = 0;
+    for (i = 1; i < n; ++i)
+    {
+        b = size / n * i;
+        for (k = 0; k < 3 && b < size && ((unsigned char)s[b] & 0xC0) == 0x80; ++k)
+            ++b;
+        at[i] = b < at[i-1] ? at[i-1] : b;
+    }
+    at[n] = size;
+}
+
+static void a_internal_parallel(size_t n, void (*fn)(void *ctx, size_t i), void *ctx)
+{
+    size_t i;
+
+#if A_INCLUDE_THREADS == 1
+    assert(n <= A_MAX_THREADS);
+    if (n > 1 && !pthread_mutex_trylock(&a_pool_busy))
+    {
+        pthread_mutex_lock(&a_pool_lock);
+        /* the calling thread is one of the n, any worker that fails to start is made up for by it */
+        while (a_pool_started < n - 1
+                && !pthread_create(&a_pool_threads[a_pool_started], NULL, a_pool_internal_worker, NULL))
+            ++a_pool_started;
+
+        a_pool_fn = fn;
+        a_pool_ctx = ctx;
+        a_pool_n = a_pool_left = n;
+        a_pool_next = 0;
+        ++a_pool_batch;
+        pthread_cond_broadcast(&a_pool_wake);
+
+        a_pool_internal_drain();
+        while (a_pool_left)
+            pthread_cond_wait(&a_pool_done, &a_pool_lock);
+        pthread_mutex_unlock(&a_pool_lock);
+        pthread_mutex_unlock(&a_pool_busy);
+        return;
+    }
+#endif
+    for (i = 0; i < n; ++i)
+        fn(ctx, i);
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+void a_threads_set(size_t count, size_t min_size)
+{
+#if A_INCLUDE_THREADS == 1
+    pthread_mutex_lock(&a_pool_busy);
+    a_pool_internal_stop();
+    a_threads_max = count > A_MAX_THREADS ? A_MAX_THREADS : count;
+    a_threads_min_size = min_size ? min_size : A_THREADS_MIN_SIZE;
+    pthread_mutex_unlock(&a_pool_busy);
+#else
+    a_threads_max = count;
+    a_threads_min_size = min_size ? min_size : A_THREADS_MIN_SIZE;
+#endif
+}
@@ -0,0 +1,288 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC
+ *
+ * License: MIT
+ */
+
+/*
+ * Number Parsing
+ *
+ * Digits can be ASCII or any other decimal digit (General_Category=Nd),
+ * but all the digits of a single number must come from the same set of
+ * ten, so that scripts can't be mixed within a number.
+ */
+
+/* number of significant digits handed to strtod(), enough to round right */
+#define A_PARSE_MAX_DIGITS 800
+
+static const double a_parse_pow10[] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/*
+ * Returns the value of the digit at s, or -1 if it isn't a digit of the
+ * same set as *zero (0 if not known yet). *size receives its byte size.
+ */
+static int a_parse_internal_digit(const char *s, const char *end, a_cp *zero, size_t *size)
+{
+    unsigned char c = (unsigned char)*s;
+    size_t lo = 0, hi = A_MAX_DIGIT_ZEROS;
+    a_cp cp;
+
+    if ((unsigned)(c - '0') < 10u)
+    {
+        if (*zero && *zero != '0')
+            return -1;
+        *zero = '0';
+        *size = 1;
+        return c - '0';
+    }
+    if (c < 0xC0 || (size_t)(end - s) < (size_t)a_next_char_size[c])
+        return -1;
+
+    cp = a_internal_char_to_cp(s);
+    while (lo < hi)
+    {
+        size_t mid = (lo + hi) / 2;
+        if (a_digit_zeros[mid] <= cp)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (!lo || cp - a_digit_zeros[lo-1] >= 10 || (*zero && *zero != a_digit_zeros[lo-1]))
+        return -1;
+    *zero = a_digit_zeros[lo-1];
+    *size = (size_t)a_next_char_size[c];
+    return (int)(cp - *zero);
+}
+
+/*
+ * Converts 8 ASCII digits at once. Only done on 64-bit little-endian
+ * targets, returns 0 if any of the 8 bytes isn't an ASCII digit.
+ */
+static int a_parse_internal_eight(const char *s, size_t *val)
+{
+    static const unsigned one = 1;
+    size_t w;
+
+    if (sizeof w != 8 || !*(const unsigned char*)&one)
+        return 0;
+
+    memcpy(&w, s, sizeof w);
+    if (((w & (A_SWAR_ONES * 0xF0)) | (((w + A_SWAR_ONES * 0x06) & (A_SWAR_ONES * 0xF0)) >> 4))
+            != A_SWAR_ONES * 0x33)
+        return 0;
+
+    w -= A_SWAR_ONES * '0';
+    w = (w * 10 + (w >> 8)) & (A_SWAR_ONES / 0x101 * 0xFF);           /* 2 digits per 16 bits */
+    w = (w * 100 + (w >> 16)) & (A_SWAR_ONES / 0x1010101 * 0xFFFF);   /* 4 digits per 32 bits */
+    *val = (w * 10000 + (w >> 16 >> 16)) & 0xFFFFFFFFUL;               /* 8 digits */
+    return 1;
+}
+
+/*
+ * Parses a run of digits into *val. Returns the number of bytes consumed
+ * and sets *overflow if the value doesn't fit.
+ */
+static size_t a_parse_internal_ulong(const char *s, const char *end, unsigned long *val, int *overflow)
+{
+    const char *start = s;
+    unsigned long v = 0;
+    a_cp zero = 0;
+    size_t size, chunk;
+    int d;
+
+    *overflow = 0;
+    while (s < end)
+    {
+        if (zero != '0' && zero)
+            ;
+        else if ((size_t)(end - s) >= 8 && a_parse_internal_eight(s, &chunk))
+        {
+            if (v > (ULONG_MAX - chunk) / 100000000UL)
+                *overflow = 1;
+            else
+                v = v * 100000000UL + chunk;
+            zero = '0';
+            s += 8;
+            continue;
+        }
+
+        if ((d = a_parse_internal_digit(s, end, &zero, &size)) < 0)
+            break;
+        if (v > (ULONG_MAX - (unsigned long)d) / 10)
+            *overflow = 1;
+        else
+            v = v * 10 + (unsigned long)d;
+        s += size;
+    }
+    *val = *overflow ? ULONG_MAX : v;
+    return (size_t)(s - start);
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+size_t a_parse_ulong(const char *str, size_t size, unsigned long *val)
+{
+    const char *s = str, *end = str + size;
+    size_t n;
+    int overflow;
+    assert(str != NULL && val != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL && val != NULL, 0);
+
+    if (s < end && *s == '+')
+        ++s;
+    if (!(n = a_parse_internal_ulong(s, end, val, &overflow)))
+        return 0;
+    return overflow ? A_EOS : (size_t)(s + n - str);
+}
+size_t a_parse_long(const char *str, size_t size, long *val)
+{
+    const char *s = str, *end = str + size;
+    unsigned long v;
+    size_t n;
+    int overflow, neg = 0;
+    assert(str != NULL && val != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL && val != NULL, 0);
+
+    if (s < end && (*s == '+' || *s == '-'))
+        neg = *s++ == '-';
+    if (!(n = a_parse_internal_ulong(s, end, &v, &overflow)))
+        return 0;
+
+    if (neg)
+    {
+        if (overflow || v > (unsigned long)LONG_MAX + 1)
+            overflow = 1, *val = LONG_MIN;
+        else
+            *val = v == (unsigned long)LONG_MAX + 1 ? LONG_MIN : -(long)v;
+    }
+    else if (overflow || v > (unsigned long)LONG_MAX)
+        overflow = 1, *val = LONG_MAX;
+    else
+        *val = (long)v;
+    return overflow ? A_EOS : (size_t)(s + n - str);
+}
+
+/* case-insensitive match of an ASCII keyword */
+static size_t a_parse_internal_word(const char *s, const char *end, const char *word)
+{
+    size_t n = strlen(word), i;
+
+    if ((size_t)(end - s) < n)
+        return 0;
+    for (i = 0; i < n; ++i)
+        if ((s[i] | 0x20) != word[i])
+            return 0;
+    return n;
+}
+
+size_t a_parse_double(const char *str, size_t size, double *val)
+{
+    char b[A_PARSE_MAX_DIGITS + 32], *w = b;
+    const char *s = str, *end = str + size, *mark;
+    a_cp zero = 0, ezero = 0;
+    size_t n, ndigits = 0, any = 0;
+    long e10 = 0, exp = 0;
+    double fast = 0;
+    int d, neg = 0, sticky = 0, frac = 0;
+    assert(str != NULL && val != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL && val != NULL, 0);
+
+    if (s < end && (*s == '+' || *s == '-'))
+        neg = *s++ == '-';
+    if (neg)
+        *w++ = '-';
+
+    if ((n = a_parse_internal_word(s, end, "infinity")) || (n = a_parse_internal_word(s, end, "inf"))
+            || (n = a_parse_internal_word(s, end, "nan")))
+    {
+        memcpy(w, s, 3);
+        w[3] = '\0';
+        *val = strtod(b, NULL);
+        return (size_t)(s + n - str);
+    }
+
+    /* significant digits go to b, the position of the point to e10 */
+    for (; s < end; s += n)
+    {
+        if (*s == '.' && !frac)
+        {
+            frac = 1, n = 1;
+            continue;
+        }
+        if ((d = a_parse_internal_digit(s, end, &zero, &n)) < 0)
+            break;
+        ++any;
+        if (!d && !ndigits)
+        {
+            e10 -= frac;
+            continue;
+        }
+        if (ndigits < A_PARSE_MAX_DIGITS)
+        {
+            *w++ = (char)('0' + d);
+            fast = fast * 10 + d;
+            ++ndigits;
+            e10 -= frac;
+        }
+        else
+        {
+            sticky |= d;
+            e10 += !frac;
+        }
+    }
+    if (!any)
+        return 0;
+
+    /* an exponent only counts if it has digits */
+    if (s < end && (*s | 0x20) == 'e')
+    {
+        unsigned long v;
+        int eneg = 0, overflow;
+
+        mark = s++;
+        if (s < end && (*s == '+' || *s == '-'))
+            eneg = *s++ == '-';
+        if (s < end && a_parse_internal_digit(s, end, &ezero, &n) >= 0)
+        {
+            s += a_parse_internal_ulong(s, end, &v, &overflow);
+            if (overflow || v > 100000)
+                v = 100000;
+            exp = eneg ? -(long)v : (long)v;
+        }
+        else
+            s = mark;
+    }
+
+    if (!ndigits)
+        *val = neg ? -0.0 : 0.0;
+    else if (!sticky && ndigits <= 15 && -22 <= e10 + exp && e10 + exp <= 22)
+    {
+        /* exact operands, a single rounding */
+        e10 += exp;
+        fast = e10 < 0 ? fast / a_parse_pow10[-e10] : fast * a_parse_pow10[e10];
+        *val = neg ? -fast : fast;
+    }
+    else
+    {
+        /* "<digits>e<exp>" has no decimal point, so the locale doesn't matter */
+        char e[24], *p;
+
+        if (sticky)
+            *w++ = '1', --e10;
+        e10 += exp;
+        *w++ = 'e';
+        if (e10 < 0)
+            *w++ = '-', e10 = -e10;
+        p = a_cat_internal_ulong(e + sizeof e, (unsigned long)e10);
+        memcpy(w, p, (size_t)(e + sizeof e - p));
+        w[e + sizeof e - p] = '\0';
+        *val = strtod(b, NULL);
+    }
+    return (size_t)(s - str);
+}
@@ -0,0 +1,378 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC
+ *
+ * License: MIT
+ */
+
+/*
+ * Pipelines
+ *
+ * The stages run as one pass over the document, a code point at a time:
+ * decomposed (for a normalization form or to strip marks), case folded
+ * and decomposed again, filtered by category, then reordered and composed
+ * by the streaming normalizer, and finally handed to the word segmenter,
+ * which appends the code points of the current token to a buffer reused
+ * for every token. What a pipeline does to each ASCII byte is worked out
+ * when it is created, runs of ASCII skip all of the stages but the last.
+ *
+ * Words follow the default rules of UAX #29 for the common cases: letters
+ * and numbers join, marks extend what they follow, apostrophes, periods
+ * and the like stay inside words between letters (or between digits for
+ * commas and periods) and ideographs are words of their own.
+ */
+
+#define A_PIPELINE_SMALL 256
+
+enum a_pipeline_class
+{
+    a_pipeline_other,
+    a_pipeline_letter,
+    a_pipeline_number,
+    a_pipeline_extend,
+    a_pipeline_mid_letter,
+    a_pipeline_mid_num,
+    a_pipeline_mid_num_letter,
+    a_pipeline_ideograph
+};
+
+struct a_pipeline
+{
+    int stages;
+    int drop;
+    int compat;                         /* decompose with compatibility mappings */
+    int decompose;
+    signed char ascii[128];             /* what each ASCII byte turns into, -1 if dropped,
+                                           -2 if it leaves ASCII */
+    unsigned char ascii_class[128];
+};
+
+struct a_pipeline_run
+{
+    a_pipeline p;
+    struct a_norm norm;
+    int (*fn)(const char *token, size_t size, size_t start, size_t end, void *ctx);
+    void *ctx;
+    size_t count;
+    int stop;
+    int failed;
+    char *token;                        /* the current token, small or on the heap */
+    size_t size, mem;
+    size_t start, end;
+    int in_token;
+    int last;                           /* class of the last letter or number in it */
+    char pending[64];                   /* a mid word character (and its marks) */
+    size_t pending_size, pending_end;
+    int pending_class;
+    char small[A_PIPELINE_SMALL];
+};
+
+static int a_pipeline_internal_class(a_cp cp)
+{
+    const unsigned int mask = A_CATEGORY_MASK(cp);
+
+    switch (cp)
+    {
+        case 0x003A: case 0x00B7: case 0x0387: case 0x05F4: case 0x2027:
+        case 0xFE13: case 0xFE55: case 0xFF1A:
+            return a_pipeline_mid_letter;
+        case 0x002C: case 0x003B: case 0x037E: case 0x0589: case 0x060C:
+        case 0x060D: case 0x066C: case 0x07F8: case 0x2044: case 0xFE10:
+        case 0xFE14: case 0xFE50: case 0xFE54: case 0xFF0C: case 0xFF1B:
+            return a_pipeline_mid_num;
+        case 0x0027: case 0x002E: case 0x2018: case 0x2019: case 0x2024:
+        case 0xFE52: case 0xFF07: case 0xFF0E:
+            return a_pipeline_mid_num_letter;
+        default:
+            break;
+    }
+    if ((cp >= 0x3040 && cp <= 0x309F) || (cp >= 0x3400 && cp <= 0x4DBF) || (cp >= 0x4E00 && cp <= 0x9FFF)
+            || (cp >= 0xF900 && cp <= 0xFAFF) || (cp >= 0x20000 && cp <= 0x2FFFF))
+        return a_pipeline_ideograph;
+    if (mask & (a_gc_mn | a_gc_mc | a_gc_me))
+        return a_pipeline_extend;
+    if (mask & (a_gc_lu | a_gc_ll | a_gc_lt | a_gc_lm | a_gc_lo | a_gc_pc))
+        return a_pipeline_letter;
+    if (mask & (a_gc_nd | a_gc_nl | a_gc_no))
+        return a_pipeline_number;
+    return a_pipeline_other;
+}
+
+/* appends bytes to the token, keeping room for the '\0' */
+static void a_pipeline_internal_append(struct a_pipeline_run *r, const char *b, size_t size)
+{
+    char *grown;
+
+    while (r->size + size >= r->mem)
+    {
+        if (r->token == r->small)
+        {
+            if ((grown = A_MALLOC(r->mem * 2)))
+                memcpy(grown, r->small, r->size);
+        }
+        else
+            grown = A_REALLOC(r->token, r->mem * 2);
+        if (!grown)
+        {
+            r->failed = r->stop = 1;
+            return;
+        }
+        r->token = grown;
+        r->mem *= 2;
+    }
+    memcpy(r->token + r->size, b, size);
+    r->size += size;
+}
+
+static void a_pipeline_internal_emit(struct a_pipeline_run *r)
+{
+    if (r->in_token && !r->stop)
+    {
+        r->token[r->size] = '\0';
+        ++r->count;
+        if (!r->fn(r->token, r->size, r->start, r->end, r->ctx))
+            r->stop = 1;
+    }
+    r->in_token = 0;
+    r->size = 0;
+    r->pending_size = 0;
+}
+
+/* the last stage: a code point of the normalized text and the bytes it came from */
+static void a_pipeline_internal_word(struct a_pipeline_run *r, a_cp cp, int cls, size_t start, size_t end)
+{
+    char b[8];
+    size_t size;
+
+    if (r->stop)
+        return;
+    size = cp < 0x80 ? (b[0] = (char)cp, 1) : strlen(a_internal_cp_to_char(cp, b));
+
+    if (!(r->p->stages & a_pipeline_words))
+    {
+        if (!r->in_token)
+            r->start = start, r->in_token = 1;
+        if (start < r->start)
+            r->start = start;
+        if (end > r->end)
+            r->end = end;
+        a_pipeline_internal_append(r, b, size);
+        return;
+    }
+
+    switch (cls)
+    {
+        case a_pipeline_extend:
+            if (!r->in_token)
+                return;
+            if (r->pending_size)
+            {
+                if (r->pending_size + size < sizeof r->pending)
+                    memcpy(r->pending + r->pending_size, b, size), r->pending_size += size;
+                r->pending_end = end;
+                return;
+            }
+            break;
+        case a_pipeline_letter:
+        case a_pipeline_number:
+            if (r->pending_size)
+            {
+                /* a mid word character stays when the same kind is on both sides */
+                if (cls == r->last && (r->pending_class == a_pipeline_mid_num_letter
+                        || r->pending_class == (cls == a_pipeline_letter ? a_pipeline_mid_letter : a_pipeline_mid_num)))
+                {
+                    a_pipeline_internal_append(r, r->pending, r->pending_size);
+                    r->end = r->pending_end;
+                    r->pending_size = 0;
+                }
+                else
+                    a_pipeline_internal_emit(r);
+            }
+            if (!r->in_token)
+            {
+                r->in_token = 1;
+                r->start = start;
+                r->end = end;
+            }
+            r->last = cls;
+            break;
+        case a_pipeline_mid_letter:
+        case a_pipeline_mid_num:
+        case a_pipeline_mid_num_letter:
+            if (r->in_token && !r->pending_size)
+            {
+                memcpy(r->pending, b, size);
+                r->pending_size = size;
+                r->pending_end = end;
+                r->pending_class = cls;
+                return;
+            }
+            a_pipeline_internal_emit(r);
+            return;
+        case a_pipeline_ideograph:
+            a_pipeline_internal_emit(r);
+            r->in_token = 1;
+            r->start = start;
+            r->end = end;
+            a_pipeline_internal_append(r, b, size);
+            a_pipeline_internal_emit(r);
+            return;
+        default:
+            a_pipeline_internal_emit(r);
+            return;
+    }
+    if (start < r->start)
+        r->start = start;
+    if (end > r->end)
+        r->end = end;
+    a_pipeline_internal_append(r, b, size);
+}
+
+static void a_pipeline_internal_normalized(void *ctx, a_cp cp, size_t start, size_t end)
+{
+    struct a_pipeline_run *r = ctx;
+
+    a_pipeline_internal_word(r, cp, a_pipeline_internal_class(cp), start, end);
+}
+
+/* a code point after decomposition and folding */
+static void a_pipeline_internal_filter(struct a_pipeline_run *r, a_cp cp, size_t start, size_t end)
+{
+    if ((unsigned int)r->p->drop & A_CATEGORY_MASK(cp))
+        return;
+    if (r->p->decompose)
+        a_norm_internal_add(&r->norm, cp, start, end);
+    else
+        a_pipeline_internal_normalized(r, cp, start, end);
+}
+
+/* a code point of the input: the first stages */
+static void a_pipeline_internal_cp(struct a_pipeline_run *r, a_cp cp, size_t start, size_t end)
+{
+    const a_pipeline p = r->p;
+    a_cp d[A_MAX_DECOMPOSITION_SIZE], f[A_MAX_CASE_FOLD_SIZE + 1], g[A_MAX_DECOMPOSITION_SIZE];
+    size_t i, j, k, count, gcount;
+
+    count = p->decompose ? a_norm_internal_decompose(cp, p->compat, d) : (d[0] = cp, 1);
+    for (i = 0; i < count; ++i)
+    {
+        if (!(p->stages & a_pipeline_fold))
+        {
+            a_pipeline_internal_filter(r, d[i], start, end);
+            continue;
+        }
+        f[1] = 0;
+        a_to_fold_cp_cp(d[i], f);
+        for (j = 0; j < A_MAX_CASE_FOLD_SIZE && f[j]; ++j)
+        {
+            gcount = p->decompose ? a_norm_internal_decompose(f[j], p->compat, g) : (g[0] = f[j], 1);
+            for (k = 0; k < gcount; ++k)
+                a_pipeline_internal_filter(r, g[k], start, end);
+        }
+    }
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+a_pipeline a_pipeline_new(int stages, int drop)
+{
+    a_pipeline p;
+    a_cp f[A_MAX_CASE_FOLD_SIZE + 1];
+    int c;
+
+    if (!(p = A_MALLOC(sizeof *p)))
+        return NULL;
+    if (stages & a_pipeline_strip_marks)
+        drop |= a_gc_mn;
+    p->stages = stages;
+    p->drop = drop;
+    p->compat = (stages & a_pipeline_nfkc) != 0;
+    p->decompose = (stages & (a_pipeline_nfc | a_pipeline_nfkc | a_pipeline_strip_marks)) != 0;
+
+    for (c = 0; c < 128; ++c)
+    {
+        f[0] = c;
+        f[1] = 0;
+        if (stages & a_pipeline_fold)
+            a_to_fold_cp_cp(c, f);
+        /* ASCII folds to ASCII, save for the Turkish dotless i */
+        if (f[0] >= 0x80 || f[1])
+            p->ascii[c] = -2;
+        else
+            p->ascii[c] = (unsigned int)drop & A_CATEGORY_MASK(f[0]) ? -1 : (signed char)f[0];
+        p->ascii_class[c] = (unsigned char)a_pipeline_internal_class(f[0]);
+    }
+    return p;
+}
+void a_pipeline_free(a_pipeline p)
+{
+    A_FREE(p);
+}
+
+size_t a_pipeline_run(a_pipeline p, a_cstr str,
+                      int (*fn)(const char *token, size_t size, size_t start, size_t end, void *ctx), void *ctx)
+{
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, A_EOS);
+    return a_pipeline_run_size(p, str, a_size(str), fn, ctx);
+}
+size_t a_pipeline_run_cstr(a_pipeline p, const char *str,
+                           int (*fn)(const char *token, size_t size, size_t start, size_t end, void *ctx), void *ctx)
+{
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, A_EOS);
+    return a_pipeline_run_size(p, str, strlen(str), fn, ctx);
+}
+size_t a_pipeline_run_size(a_pipeline p, const char *str, size_t size,
+                           int (*fn)(const char *token, size_t size, size_t start, size_t end, void *ctx), void *ctx)
+{
+    struct a_pipeline_run r;
+    const char *at = str, *end = str + size, *from;
+    unsigned char c;
+    a_cp cp;
+    assert(p != NULL && str != NULL && fn != NULL);
+    PASSTHROUGH_ON_FAIL(p != NULL && str != NULL && fn != NULL, A_EOS);
+
+    r.p = p;
+    r.fn = fn;
+    r.ctx = ctx;
+    r.count = 0;
+    r.stop = r.failed = 0;
+    r.token = r.small;
+    r.size = 0;
+    r.mem = A_PIPELINE_SMALL;
+    r.start = r.end = 0;
+    r.in_token = 0;
+    r.last = a_pipeline_other;
+    r.pending_size = 0;
+    a_norm_internal_init(&r.norm, p->stages & (a_pipeline_nfc | a_pipeline_nfkc | a_pipeline_strip_marks),
+                         a_pipeline_internal_normalized, &r);
+
+    while (at < end && !r.stop)
+    {
+        c = (unsigned char)*at;
+        /* ASCII followed by ASCII composes with nothing */
+        if (c < 0x80 && p->ascii[c] != -2 && (at + 1 == end || (unsigned char)at[1] < 0x80))
+        {
+            if (r.norm.count)
+                a_norm_internal_flush(&r.norm);
+            if (p->ascii[c] >= 0)
+                a_pipeline_internal_word(&r, p->ascii[c], p->ascii_class[c], (size_t)(at - str), (size_t)(at - str) + 1);
+            ++at;
+            continue;
+        }
+        from = at;
+        cp = a_internal_to_next_cp(&at);
+        a_pipeline_internal_cp(&r, cp, (size_t)(from - str), (size_t)(at - str));
+        if (r.norm.failed)
+            r.failed = r.stop = 1;
+    }
+    a_norm_internal_flush(&r.norm);
+    a_pipeline_internal_emit(&r);
+
+    a_norm_internal_free(&r.norm);
+    if (r.token != r.small)
+        A_FREE(r.token);
+    return r.failed ? A_EOS : r.count;
+}
@@ -63,7 +63,7 @@ a_str a_reverse_str(a_cstr str, a_str output)
     
     out_h = a_header(output);
     output[at] = '\0';
-    out_h->len = in_h->len;
+    out_h->len = a_len(str);
     out_h->size = in_h->size;
     while (*str)
     {
@@ -116,7 +116,7 @@ a_str a_greverse_str(a_cstr str, a_str output)
     
     out_h = a_header(output);
     output[at] = '\0';
-    out_h->len = in_h->len;
+    out_h->len = a_len(str);
     out_h->size = in_h->size;
     while (*str)
     {
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC
+ *
+ * License: MIT
+ */
+
+/*
+ * Similarity Sketches
+ *
+ * A single pass over the string: every unit (a code point, or a grapheme
+ * cluster) is checked against the categories to skip, folded if asked
+ * and hashed as it is read, and the hashes of the last n units are
+ * combined into a polynomial hash that is rolled forward one unit at a
+ * time. Only the hash of each n-gram reaches the sketch; the text is
+ * never copied.
+ */
+
+#if ULONG_MAX > 0xFFFFFFFFUL
+#   define A_SHINGLE_BASE   0x100000001B3UL
+#   define A_SHINGLE_GOLDEN 0x9E3779B97F4A7C15UL
+#else
+#   define A_SHINGLE_BASE   0x01000193UL
+#   define A_SHINGLE_GOLDEN 0x9E3779B9UL
+#endif
+#define A_SHINGLE_BITS (sizeof (unsigned long) * CHAR_BIT)
+#define A_SHINGLE_RING 16
+
+/* spreads the bits of h (the finalizer of MurmurHash3) */
+static unsigned long a_shingle_internal_mix(unsigned long h)
+{
+#if ULONG_MAX > 0xFFFFFFFFUL
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDUL;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53UL;
+    h ^= h >> 33;
+#else
+    h ^= h >> 16;
+    h *= 0x85EBCA6BUL;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35UL;
+    h ^= h >> 16;
+#endif
+    return h;
+}
+
+/*
+ * Hashes the n-grams of s and hands each to emit, returns their number.
+ * A string of fewer than n units (but at least one) is one n-gram.
+ */
+static size_t a_shingle_internal_run(const char *s, size_t size, size_t n, int options, int skip,
+                                     void (*emit)(void *ctx, unsigned long h), void *ctx)
+{
+    unsigned long stack[A_SHINGLE_RING], *ring = stack, h = 0, bn = 1, u;
+    const char *at = s, *end = s + size;
+    a_cp cp, b[A_MAX_CASE_FOLD_SIZE + 1];
+    size_t units = 0, count = 0, i;
+    int skipped;
+
+    if (!n)
+        n = 1;
+    if (n > A_SHINGLE_RING && !(ring = A_MALLOC(n * sizeof *ring)))
+        return 0;
+    for (i = 0; i < n; ++i)
+        bn *= A_SHINGLE_BASE;
+
+    while (at < end)
+    {
+        u = A_HASH_BASIS;
+        cp = a_internal_to_next_cp(&at);
+        skipped = (A_CATEGORY_MASK(cp) & (unsigned int)skip) != 0;
+        for (;;)
+        {
+            if (!skipped && !(options & a_shingle_fold))
+                u = (u ^ cp) * A_HASH_PRIME;
+            else if (!skipped)
+            {
+                b[1] = 0;
+                a_to_fold_cp_cp(cp, b);
+                for (i = 0; i < A_MAX_CASE_FOLD_SIZE && b[i]; ++i)
+                    u = (u ^ b[i]) * A_HASH_PRIME;
+            }
+            /* the rest of a grapheme cluster goes with its first code point */
+            if (!(options & a_shingle_grapheme) || at >= end
+                    || a_grapheme_break_table[A_GCB(cp)][A_GCB(a_internal_char_to_cp(at))])
+                break;
+            cp = a_internal_to_next_cp(&at);
+        }
+        if (skipped)
+            continue;
+
+        h = h * A_SHINGLE_BASE + u;
+        if (units >= n)
+            h -= ring[units % n] * bn;
+        ring[units % n] = u;
+        if (++units >= n)
+            emit(ctx, a_shingle_internal_mix(h)), ++count;
+    }
+    if (units && units < n)
+        emit(ctx, a_shingle_internal_mix(h)), ++count;
+    if (ring != stack)
+        A_FREE(ring);
+    return count;
+}
+
+struct a_minhash_sig
+{
+    unsigned long *sig;
+    size_t k;
+};
+
+static void a_shingle_internal_minhash(void *ctx, unsigned long h)
+{
+    struct a_minhash_sig *m = ctx;
+    unsigned long v, seed = 0;
+    size_t i;
+
+    /* k hash functions, each mixing in a seed of its own */
+    for (i = 0; i < m->k; ++i)
+    {
+        seed += A_SHINGLE_GOLDEN;
+        if ((v = a_shingle_internal_mix(h ^ seed)) < m->sig[i])
+            m->sig[i] = v;
+    }
+}
+
+static void a_shingle_internal_simhash(void *ctx, unsigned long h)
+{
+    long *weights = ctx;
+    size_t i;
+
+    for (i = 0; i < A_SHINGLE_BITS; ++i, h >>= 1)
+        weights[i] += h & 1 ? 1 : -1;
+}
+
+static size_t a_minhash_internal(const char *s, size_t size, size_t n, int options, int skip,
+                                 unsigned long *sig, size_t k)
+{
+    struct a_minhash_sig m;
+    size_t i;
+
+    for (i = 0; i < k; ++i)
+        sig[i] = ULONG_MAX;
+    m.sig = sig;
+    m.k = k;
+    return a_shingle_internal_run(s, size, n, options, skip, a_shingle_internal_minhash, &m);
+}
+
+static unsigned long a_simhash_internal(const char *s, size_t size, size_t n, int options, int skip)
+{
+    long weights[A_SHINGLE_BITS];
+    unsigned long h = 0;
+    size_t i;
+
+    for (i = 0; i < A_SHINGLE_BITS; ++i)
+        weights[i] = 0;
+    a_shingle_internal_run(s, size, n, options, skip, a_shingle_internal_simhash, weights);
+    for (i = A_SHINGLE_BITS; i--;)
+        h = h << 1 | (weights[i] > 0);
+    return h;
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+size_t a_minhash(a_cstr str, size_t n, int options, int skip, unsigned long *sig, size_t k)
+{
+    assert(str != NULL && (sig != NULL || !k));
+    PASSTHROUGH_ON_FAIL(str != NULL && (sig != NULL || !k), 0);
+    return a_minhash_internal(str, a_size(str), n, options, skip, sig, k);
+}
+size_t a_minhash_cstr(const char *str, size_t n, int options, int skip, unsigned long *sig, size_t k)
+{
+    assert(str != NULL && (sig != NULL || !k));
+    PASSTHROUGH_ON_FAIL(str != NULL && (sig != NULL || !k), 0);
+    return a_minhash_internal(str, strlen(str), n, options, skip, sig, k);
+}
+double a_minhash_similarity(const unsigned long *sig1, const unsigned long *sig2, size_t k)
+{
+    size_t i, same = 0;
+    assert((sig1 != NULL && sig2 != NULL) || !k);
+    PASSTHROUGH_ON_FAIL((sig1 != NULL && sig2 != NULL) || !k, 0);
+
+    for (i = 0; i < k; ++i)
+        same += sig1[i] == sig2[i];
+    return k ? (double)same / (double)k : 0;
+}
+
+unsigned long a_simhash(a_cstr str, size_t n, int options, int skip)
+{
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, 0);
+    return a_simhash_internal(str, a_size(str), n, options, skip);
+}
+unsigned long a_simhash_cstr(const char *str, size_t n, int options, int skip)
+{
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, 0);
+    return a_simhash_internal(str, strlen(str), n, options, skip);
+}
+int a_simhash_distance(unsigned long hash1, unsigned long hash2)
+{
+    unsigned long x = hash1 ^ hash2;
+    int bits = 0;
+
+    for (; x; x &= x - 1)
+        ++bits;
+    return bits;
+}
@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC
+ *
+ * License: MIT
+ */
+
+/*
+ * Substring Extraction
+ *
+ * start/length follow the usual conventions: a negative start counts
+ * from the end of the string, a negative length leaves that many units
+ * off the end. Out of range values are clamped and yield an empty string.
+ */
+
+/* resolves start/length against a string of total units into [*s, *e) */
+static void a_substr_internal_range(size_t total, long start, long length,
+                                    size_t *s, size_t *e)
+{
+    size_t from, to, back;
+
+    /* negated as unsigned, which LONG_MIN survives */
+    if (start < 0)
+    {
+        back = (size_t)(0UL - (unsigned long)start);
+        from = (back >= total) ? 0 : total - back;
+    }
+    else
+        from = ((size_t)start >= total) ? total : (size_t)start;
+
+    if (length < 0)
+    {
+        back = (size_t)(0UL - (unsigned long)length);
+        to = (back >= total - from) ? from : total - back;
+    }
+    else
+        to = ((size_t)length >= total - from) ? total : from + (size_t)length;
+
+    *s = from;
+    *e = to;
+}
+
+/* index -> offset, walking from whichever end of the string is closer */
+static size_t a_substr_internal_offset(a_cstr str, size_t index)
+{
+    size_t len = a_len(str), size = a_size(str);
+
+    if (len == size)
+        return index;
+    if (index <= len / 2)
+        return a_internal_index_to_offset(str, index);
+    return a_internal_index_to_offset_rev_end(str, str + size, len - index);
+}
+
+/* code points in [offset, offset+size), counting the smaller side */
+static size_t a_substr_internal_len(a_cstr str, size_t offset, size_t size)
+{
+    size_t len = a_len(str), total = a_size(str);
+
+    if (len == total)
+        return size;
+    if (size <= total / 2)
+        return a_internal_count_cp(str + offset, size);
+    return len - a_internal_count_cp(str, offset)
+               - a_internal_count_cp(str + offset + size, total - offset - size);
+}
+
+static a_str a_substr_internal_new(const char *s, size_t size, size_t len)
+{
+    a_str str;
+
+    if ((str = a_new_mem_raw(size)))
+    {
+        struct a_header *h = a_header(str);
+        memcpy(str, s, size);
+        str[size] = '\0';
+        h->size = size;
+        h->len = len;
+    }
+    return str;
+}
+
+static a_str a_substr_internal_inplace(a_str str, size_t offset, size_t size, size_t len)
+{
+    struct a_header *h = a_header(str);
+
+    if (offset)
+        memmove(str, str + offset, size);
+    str[size] = '\0';
+    h->size = size;
+    h->len = len;
+    return str;
+}
+
+/* finds the [offset, offset+size) range between sub1 and sub2 */
+static int a_substr_internal_between(a_cstr str, const char *sub1, const char *sub2,
+                                     int inclusive, size_t *offset, size_t *size)
+{
+    size_t size1 = strlen(sub1), size2 = strlen(sub2);
+    size_t s, e;
+
+    if ((s = a_find_offset_internal(str, sub1, a_size(str), size1, 0)) == A_EOS)
+        return 0;
+    if ((e = a_find_offset_internal(str, sub2, a_size(str), size2, s + size1)) == A_EOS)
+        return 0;
+
+    if (inclusive)
+        e += size2;
+    else
+        s += size1;
+
+    *offset = s;
+    *size = e - s;
+    return 1;
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+a_str a_substr(a_cstr str, long start, long length)
+{
+    size_t s, e, so, eo;
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+
+    a_substr_internal_range(a_len(str), start, length, &s, &e);
+    so = a_substr_internal_offset(str, s);
+    if (a_len(str) == a_size(str))
+        eo = e;
+    else if (e - s <= a_len(str) - e)
+        eo = so + a_internal_index_to_offset(str + so, e - s);
+    else
+        eo = a_internal_index_to_offset_rev_end(str, str + a_size(str), a_len(str) - e);
+
+    return a_substr_internal_new(str + so, eo - so, e - s);
+}
+a_str a_substr_inplace(a_str str, long start, long length)
+{
+    size_t s, e, so, eo;
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+
+    a_substr_internal_range(a_len(str), start, length, &s, &e);
+    so = a_substr_internal_offset(str, s);
+    if (a_len(str) == a_size(str))
+        eo = e;
+    else if (e - s <= a_len(str) - e)
+        eo = so + a_internal_index_to_offset(str + so, e - s);
+    else
+        eo = a_internal_index_to_offset_rev_end(str, str + a_size(str), a_len(str) - e);
+
+    return a_substr_internal_inplace(str, so, eo - so, e - s);
+}
+a_str a_substr_offset(a_cstr str, long start, long length)
+{
+    size_t s, e;
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+
+    a_substr_internal_range(a_size(str), start, length, &s, &e);
+    A_ASSERT_CODEPOINT_BOUNDARY(str[s]);
+    A_ASSERT_CODEPOINT_BOUNDARY(str[e]);
+
+    return a_substr_internal_new(str + s, e - s, a_substr_internal_len(str, s, e - s));
+}
+a_str a_substr_offset_inplace(a_str str, long start, long length)
+{
+    size_t s, e;
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+
+    a_substr_internal_range(a_size(str), start, length, &s, &e);
+    A_ASSERT_CODEPOINT_BOUNDARY(str[s]);
+    A_ASSERT_CODEPOINT_BOUNDARY(str[e]);
+
+    return a_substr_internal_inplace(str, s, e - s, a_substr_internal_len(str, s, e - s));
+}
+a_str a_substr_between_cstr(a_cstr str, const char *sub1, const char *sub2, int inclusive)
+{
+    size_t offset, size;
+    assert(str != NULL && sub1 != NULL && sub2 != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL && sub1 != NULL && sub2 != NULL, NULL);
+
+    if (!a_substr_internal_between(str, sub1, sub2, inclusive, &offset, &size))
+        return a_new_mem(0);
+    return a_substr_internal_new(str + offset, size, a_substr_internal_len(str, offset, size));
+}
+a_str a_substr_between_cstr_inplace(a_str str, const char *sub1, const char *sub2, int inclusive)
+{
+    size_t offset, size;
+    assert(str != NULL && sub1 != NULL && sub2 != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL && sub1 != NULL && sub2 != NULL, NULL);
+
+    if (!a_substr_internal_between(str, sub1, sub2, inclusive, &offset, &size))
+        return a_clear(str);
+    return a_substr_internal_inplace(str, offset, size, a_substr_internal_len(str, offset, size));
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+a_str a_left(a_cstr str, size_t length)
+{
+    size_t size;
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+
+    if (length >= a_len(str))
+        return a_new_dup(str);
+
+    size = a_substr_internal_offset(str, length);
+    return a_substr_internal_new(str, size, length);
+}
+a_str a_left_offset(a_cstr str, size_t length)
+{
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+
+    if (length >= a_size(str))
+        return a_new_dup(str);
+
+    A_ASSERT_CODEPOINT_BOUNDARY(str[length]);
+    return a_substr_internal_new(str, length, a_substr_internal_len(str, 0, length));
+}
+a_str a_left_offset_inplace(a_str str, size_t length)
+{
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+
+    if (length >= a_size(str))
+        return str;
+
+    A_ASSERT_CODEPOINT_BOUNDARY(str[length]);
+    return a_substr_internal_inplace(str, 0, length, a_substr_internal_len(str, 0, length));
+}
+a_str a_right(a_cstr str, size_t length)
+{
+    size_t offset;
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+
+    if (length >= a_len(str))
+        return a_new_dup(str);
+
+    offset = a_substr_internal_offset(str, a_len(str) - length);
+    return a_substr_internal_new(str + offset, a_size(str) - offset, length);
+}
+a_str a_right_offset(a_cstr str, size_t length)
+{
+    size_t offset;
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+
+    if (length >= a_size(str))
+        return a_new_dup(str);
+
+    offset = a_size(str) - length;
+    A_ASSERT_CODEPOINT_BOUNDARY(str[offset]);
+    return a_substr_internal_new(str + offset, length, a_substr_internal_len(str, offset, length));
+}
+a_str a_right_offset_inplace(a_str str, size_t length)
+{
+    size_t offset;
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+
+    if (length >= a_size(str))
+        return str;
+
+    offset = a_size(str) - length;
+    A_ASSERT_CODEPOINT_BOUNDARY(str[offset]);
+    return a_substr_internal_inplace(str, offset, length, a_substr_internal_len(str, offset, length));
+}
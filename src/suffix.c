@@ -0,0 +1,558 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC
+ *
+ * License: MIT
+ */
+
+/*
+ * Suffix Indexes
+ *
+ * A suffix array over a copy of the documents, each followed by a '\0'.
+ * It is built by prefix doubling: suffixes are bucketed by their first
+ * byte, then every round sorts the groups of suffixes still tied by the
+ * rank of the suffix h bytes further, doubling h. A rank is the index of
+ * the first suffix of its group, so that groups stay comparable while
+ * they split. The groups of a round are independent of one another: they
+ * are sorted a range of them per thread, and ranked again once all are.
+ *
+ * Lookups are binary searches that skip the bytes the pattern is known to
+ * share with both bounds, which makes a step cheap in practice though
+ * one may still compare the whole pattern. The first occurrence is the
+ * smallest offset in the range found: the minima of blocks of the suffix
+ * array are kept in a sparse table, so only the two partial blocks at
+ * the ends of the range are scanned. A case insensitive index holds the UTF-8 of the
+ * folded code points; wherever folding changes the size of a code point,
+ * a pair of checkpoints maps offsets back to the documents given.
+ */
+
+#define A_SUFFIX_SMALL 16
+#define A_SUFFIX_BLOCK 256
+
+struct a_suffix_index
+{
+    char *text;
+    size_t size;
+    size_t *sa;
+    size_t *mins;                   /* level j: min of 2^j blocks of sa     */
+    size_t blocks;
+    size_t docs;
+    size_t *starts;                 /* of each document, in the originals  */
+    size_t *fold_at;                /* checkpoints, in pairs: the start    */
+    size_t *orig_at;                /* and the end of a resized code point */
+    size_t checkpoints;
+    int icase;
+};
+
+/**************************************************/
+
+/* sorts sa[0..n) by key[0..n), three ways since keys repeat a lot */
+static void a_suffix_internal_sort(size_t *sa, size_t *key, size_t n)
+{
+    size_t lt, gt, i, j, pivot, a, b, c, t;
+
+#define A_SUFFIX_SWAP(x, y) (t = sa[x], sa[x] = sa[y], sa[y] = t, t = key[x], key[x] = key[y], key[y] = t)
+    while (n > A_SUFFIX_SMALL)
+    {
+        a = key[0], b = key[n/2], c = key[n-1];
+        pivot = a < b ? (b < c ? b : a < c ? c : a) : (a < c ? a : b < c ? c : b);
+        for (lt = i = 0, gt = n; i < gt;)
+        {
+            if (key[i] < pivot)
+                A_SUFFIX_SWAP(lt, i), ++lt, ++i;
+            else if (key[i] > pivot)
+                --gt, A_SUFFIX_SWAP(i, gt);
+            else
+                ++i;
+        }
+        /* the smaller side first, then the larger without recursing */
+        if (lt < n - gt)
+        {
+            a_suffix_internal_sort(sa, key, lt);
+            sa += gt, key += gt, n -= gt;
+        }
+        else
+        {
+            a_suffix_internal_sort(sa + gt, key + gt, n - gt);
+            n = lt;
+        }
+    }
+    for (i = 1; i < n; ++i)
+        for (j = i; j && key[j-1] > key[j]; --j)
+            A_SUFFIX_SWAP(j - 1, j);
+#undef A_SUFFIX_SWAP
+}
+
+struct a_suffix_job
+{
+    size_t n;
+    size_t *sa;
+    size_t *rank;
+    size_t *key;
+    size_t h;
+    int ranking;                    /* which half of the round          */
+    size_t at[A_MAX_THREADS + 1];   /* job i does the groups in [at[i], at[i+1]) */
+    size_t left[A_MAX_THREADS];     /* suffixes still tied after it     */
+};
+
+/* the end of the group starting at j */
+static size_t a_suffix_internal_group(const struct a_suffix_job *job, size_t j, size_t end)
+{
+    size_t r = job->rank[job->sa[j]];
+
+    while (++j < end && job->rank[job->sa[j]] == r)
+        ;
+    return j;
+}
+
+static void a_suffix_internal_job(void *ctx, size_t i)
+{
+    struct a_suffix_job *job = ctx;
+    size_t *sa = job->sa, *rank = job->rank, *key = job->key;
+    size_t j, e, k, head;
+
+    job->left[i] = 0;
+    for (j = job->at[i]; j < job->at[i+1]; j = e)
+    {
+        if ((e = a_suffix_internal_group(job, j, job->at[i+1])) - j == 1)
+            continue;
+        if (!job->ranking)
+        {
+            /* ranks are only read in this half, suffixes past the end come first */
+            for (k = j; k < e; ++k)
+                key[k] = sa[k] + job->h < job->n ? rank[sa[k] + job->h] + 1 : 0;
+            a_suffix_internal_sort(sa + j, key + j, e - j);
+            continue;
+        }
+        for (k = head = j; k < e; ++k)
+        {
+            if (key[k] != key[head])
+            {
+                job->left[i] += k - head > 1 ? k - head : 0;
+                head = k;
+            }
+            rank[sa[k]] = head;
+        }
+        job->left[i] += e - head > 1 ? e - head : 0;
+    }
+}
+
+/* sorts the suffixes of text, returns the array or NULL */
+static size_t *a_suffix_internal_build(const unsigned char *text, size_t n)
+{
+    struct a_suffix_job job;
+    size_t count[257], next[256], i, t, b, left = 0;
+
+    job.n = n;
+    job.sa = A_MALLOC((n ? n : 1) * sizeof *job.sa);
+    job.rank = A_MALLOC((n ? n : 1) * sizeof *job.rank);
+    job.key = A_MALLOC((n ? n : 1) * sizeof *job.key);
+    if (!job.sa || !job.rank || !job.key)
+    {
+        A_FREE(job.sa);
+        A_FREE(job.rank);
+        A_FREE(job.key);
+        return NULL;
+    }
+
+    /* bucketed by the first byte */
+    for (i = 0; i < 257; ++i)
+        count[i] = 0;
+    for (i = 0; i < n; ++i)
+        ++count[text[i] + 1];
+    for (i = 1; i < 257; ++i)
+    {
+        left += count[i] > 1 ? count[i] : 0;
+        count[i] += count[i-1];
+    }
+    for (i = 0; i < 256; ++i)
+        next[i] = count[i];
+    for (i = 0; i < n; ++i)
+    {
+        job.rank[i] = count[text[i]];
+        job.sa[next[text[i]]++] = i;
+    }
+
+    for (job.h = 1; left; job.h *= 2)
+    {
+        t = a_internal_threads(n, 0);
+        job.at[0] = 0;
+        for (i = 1; i < t; ++i)
+        {
+            /* on the start of a group */
+            for (b = n / t * i; b < n && job.rank[job.sa[b]] != b; ++b)
+                ;
+            job.at[i] = b < job.at[i-1] ? job.at[i-1] : b;
+        }
+        job.at[t] = n;
+        job.ranking = 0;
+        a_internal_parallel(t, a_suffix_internal_job, &job);
+        job.ranking = 1;
+        a_internal_parallel(t, a_suffix_internal_job, &job);
+        for (i = 0, left = 0; i < t; ++i)
+            left += job.left[i];
+    }
+    A_FREE(job.rank);
+    A_FREE(job.key);
+    return job.sa;
+}
+
+/* builds the sparse table over the minima of the blocks of sa */
+static int a_suffix_internal_mins(struct a_suffix_index *idx)
+{
+    size_t levels = 1, j, b, i, end, *prev, *cur;
+
+    idx->blocks = (idx->size + A_SUFFIX_BLOCK - 1) / A_SUFFIX_BLOCK;
+    while ((size_t)1 << levels <= idx->blocks)
+        ++levels;
+    if (!(idx->mins = A_MALLOC((idx->blocks ? idx->blocks * levels : 1) * sizeof *idx->mins)))
+        return 0;
+    for (b = 0; b < idx->blocks; ++b)
+    {
+        end = (b + 1) * A_SUFFIX_BLOCK < idx->size ? (b + 1) * A_SUFFIX_BLOCK : idx->size;
+        for (idx->mins[b] = idx->sa[i = b * A_SUFFIX_BLOCK]; ++i < end;)
+            if (idx->sa[i] < idx->mins[b])
+                idx->mins[b] = idx->sa[i];
+    }
+    for (j = 1; j < levels; ++j)
+    {
+        prev = idx->mins + (j - 1) * idx->blocks;
+        cur = idx->mins + j * idx->blocks;
+        for (b = 0; b + ((size_t)1 << j) <= idx->blocks; ++b)
+            cur[b] = prev[b] < prev[b + ((size_t)1 << (j - 1))] ? prev[b] : prev[b + ((size_t)1 << (j - 1))];
+    }
+    return 1;
+}
+
+/* the smallest of sa[lo..hi), hi > lo */
+static size_t a_suffix_internal_min(a_suffix_index idx, size_t lo, size_t hi)
+{
+    size_t first = lo / A_SUFFIX_BLOCK + 1, last = (hi - 1) / A_SUFFIX_BLOCK, j = 0, min = A_EOS, *level;
+
+    /* whole blocks in [first, last) */
+    if (first < last)
+    {
+        while ((size_t)2 << j <= last - first)
+            ++j;
+        level = idx->mins + j * idx->blocks;
+        min = level[first] < level[last - ((size_t)1 << j)] ? level[first] : level[last - ((size_t)1 << j)];
+        for (; lo < first * A_SUFFIX_BLOCK; ++lo)
+            if (idx->sa[lo] < min)
+                min = idx->sa[lo];
+        lo = last * A_SUFFIX_BLOCK;
+    }
+    for (; lo < hi; ++lo)
+        if (idx->sa[lo] < min)
+            min = idx->sa[lo];
+    return min;
+}
+
+/**************************************************/
+
+/*
+ * Appends the UTF-8 of the folded code points of s to *buf, recording
+ * the code points whose size changes to the checkpoints of idx if any.
+ */
+static int a_suffix_internal_fold(const char *s, size_t size, char **buf, size_t *used, size_t *mem,
+                                  struct a_suffix_index *idx, size_t base)
+{
+    const char *at = s, *end = s + size, *from;
+    a_cp b[A_MAX_CASE_FOLD_SIZE + 1];
+    size_t start, k, *grown;
+    char *more;
+
+    /* leaves room for a code point past the end too */
+    for (;;)
+    {
+        if (*mem - *used < 4 * A_MAX_CASE_FOLD_SIZE + 1)
+        {
+            if (!(more = A_REALLOC(*buf, *mem * 2 + 64)))
+                return 0;
+            *buf = more;
+            *mem = *mem * 2 + 64;
+        }
+        if (at >= end)
+            break;
+        from = at;
+        start = *used;
+        b[1] = 0;
+        a_to_fold_cp_cp(a_internal_to_next_cp(&at), b);
+        if (!b[0])
+            (*buf)[(*used)++] = '\0';
+        for (k = 0; k < A_MAX_CASE_FOLD_SIZE && b[k]; ++k)
+        {
+            a_internal_cp_to_char(b[k], *buf + *used);
+            *used += strlen(*buf + *used);
+        }
+        if (!idx || *used - start == (size_t)(at - from))
+            continue;
+        if (!(idx->checkpoints & 63))
+        {
+            if (!(grown = A_REALLOC(idx->fold_at, (idx->checkpoints + 64) * sizeof *grown)))
+                return 0;
+            idx->fold_at = grown;
+            if (!(grown = A_REALLOC(idx->orig_at, (idx->checkpoints + 64) * sizeof *grown)))
+                return 0;
+            idx->orig_at = grown;
+        }
+        idx->fold_at[idx->checkpoints] = start;
+        idx->orig_at[idx->checkpoints++] = base + (size_t)(from - s);
+        idx->fold_at[idx->checkpoints] = *used;
+        idx->orig_at[idx->checkpoints++] = base + (size_t)(at - s);
+    }
+    return 1;
+}
+
+/* maps an offset of the index back to the documents */
+static size_t a_suffix_internal_orig(a_suffix_index idx, size_t offset)
+{
+    size_t lo = 0, hi = idx->checkpoints, mid;
+
+    /* the last checkpoint at or before offset */
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+        if (idx->fold_at[mid] <= offset)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (!lo)
+        return offset;
+    /* inside (or at) a resized code point: its start */
+    if (!((lo - 1) & 1))
+        return idx->orig_at[lo-1];
+    return idx->orig_at[lo-1] + offset - idx->fold_at[lo-1];
+}
+
+/*
+ * The first suffix having p as a prefix (or, with upper, the first one
+ * past them). l and r are how much p shares with the suffixes just
+ * outside [lo, hi), the suffixes in between share at least the least.
+ */
+static size_t a_suffix_internal_bound(a_suffix_index idx, const unsigned char *p, size_t m, int upper)
+{
+    const unsigned char *s;
+    size_t lo = 0, hi = idx->size, l = 0, r = 0, mid, k, len;
+
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo) / 2;
+        s = (const unsigned char*)idx->text + idx->sa[mid];
+        len = idx->size - idx->sa[mid];
+        for (k = l < r ? l : r; k < m && k < len && s[k] == p[k]; ++k)
+            ;
+        if (k == m ? upper : k == len || s[k] < p[k])
+            lo = mid + 1, l = k;
+        else
+            hi = mid, r = k;
+    }
+    return lo;
+}
+
+/* the range of the suffixes starting with a pattern, 0 if there are none */
+static size_t a_suffix_internal_range(a_suffix_index idx, const char *p, size_t m, size_t *lo)
+{
+    char *folded = NULL;
+    size_t used = 0, mem = 0, hi;
+
+    /* like a_count_substr(), nothing is found of an empty pattern */
+    if (!m)
+        return 0;
+    if (idx->icase)
+    {
+        if (!a_suffix_internal_fold(p, m, &folded, &used, &mem, NULL, 0))
+        {
+            A_FREE(folded);
+            return 0;
+        }
+        p = folded;
+        m = used;
+    }
+    *lo = a_suffix_internal_bound(idx, (const unsigned char*)p, m, 0);
+    hi = a_suffix_internal_bound(idx, (const unsigned char*)p, m, 1);
+    A_FREE(folded);
+    return hi - *lo;
+}
+
+static int a_suffix_internal_cmp(const void *a, const void *b)
+{
+    size_t x = *(const size_t*)a, y = *(const size_t*)b;
+    return x < y ? -1 : x > y;
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+a_suffix_index a_suffix_index_new(a_cstr str, int options)
+{
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+    return a_suffix_index_new_vec(&str, 1, options);
+}
+a_suffix_index a_suffix_index_new_vec(const a_cstr *strv, size_t count, int options)
+{
+    a_suffix_index idx;
+    size_t i, mem = 0, base = 0;
+    assert(strv != NULL || !count);
+    PASSTHROUGH_ON_FAIL(strv != NULL || !count, NULL);
+
+    if (!(idx = A_MALLOC(sizeof *idx)))
+        return NULL;
+    idx->text = NULL;
+    idx->size = 0;
+    idx->sa = NULL;
+    idx->mins = NULL;
+    idx->blocks = 0;
+    idx->docs = count;
+    idx->fold_at = NULL;
+    idx->orig_at = NULL;
+    idx->checkpoints = 0;
+    idx->icase = (options & a_suffix_index_icase) != 0;
+    if (!(idx->starts = A_MALLOC((count + 1) * sizeof *idx->starts)))
+        goto fail;
+
+    for (i = 0; i < count; ++i)
+    {
+        idx->starts[i] = base;
+        base += a_size(strv[i]) + 1;
+    }
+    idx->starts[count] = base;
+    if (!idx->icase)
+    {
+        if (!(idx->text = A_MALLOC(base ? base : 1)))
+            goto fail;
+        for (i = 0; i < count; ++i)
+        {
+            memcpy(idx->text + idx->starts[i], strv[i], a_size(strv[i]));
+            idx->text[idx->starts[i] + a_size(strv[i])] = '\0';
+        }
+        idx->size = base;
+    }
+    else
+    {
+        for (i = 0; i < count; ++i)
+        {
+            if (!a_suffix_internal_fold(strv[i], a_size(strv[i]), &idx->text, &idx->size, &mem,
+                                        idx, idx->starts[i]))
+                goto fail;
+            idx->text[idx->size++] = '\0';
+        }
+    }
+    if (!(idx->sa = a_suffix_internal_build((const unsigned char*)idx->text, idx->size))
+            || !a_suffix_internal_mins(idx))
+        goto fail;
+    return idx;
+
+fail:
+    a_suffix_index_free(idx);
+    return NULL;
+}
+void a_suffix_index_free(a_suffix_index idx)
+{
+    if (!idx)
+        return;
+    A_FREE(idx->text);
+    A_FREE(idx->sa);
+    A_FREE(idx->mins);
+    A_FREE(idx->starts);
+    A_FREE(idx->fold_at);
+    A_FREE(idx->orig_at);
+    A_FREE(idx);
+}
+
+size_t a_suffix_index_find(a_suffix_index idx, a_cstr pattern)
+{
+    assert(pattern != NULL);
+    PASSTHROUGH_ON_FAIL(pattern != NULL, A_EOS);
+    return a_suffix_index_find_size(idx, pattern, a_size(pattern));
+}
+size_t a_suffix_index_find_cstr(a_suffix_index idx, const char *pattern)
+{
+    assert(pattern != NULL);
+    PASSTHROUGH_ON_FAIL(pattern != NULL, A_EOS);
+    return a_suffix_index_find_size(idx, pattern, strlen(pattern));
+}
+size_t a_suffix_index_find_size(a_suffix_index idx, const char *pattern, size_t size)
+{
+    size_t lo, n;
+    assert(idx != NULL && pattern != NULL);
+    PASSTHROUGH_ON_FAIL(idx != NULL && pattern != NULL, A_EOS);
+
+    if (!(n = a_suffix_internal_range(idx, pattern, size, &lo)))
+        return A_EOS;
+    return a_suffix_internal_orig(idx, a_suffix_internal_min(idx, lo, lo + n));
+}
+
+size_t a_suffix_index_count(a_suffix_index idx, a_cstr pattern)
+{
+    assert(pattern != NULL);
+    PASSTHROUGH_ON_FAIL(pattern != NULL, 0);
+    return a_suffix_index_count_size(idx, pattern, a_size(pattern));
+}
+size_t a_suffix_index_count_cstr(a_suffix_index idx, const char *pattern)
+{
+    assert(pattern != NULL);
+    PASSTHROUGH_ON_FAIL(pattern != NULL, 0);
+    return a_suffix_index_count_size(idx, pattern, strlen(pattern));
+}
+size_t a_suffix_index_count_size(a_suffix_index idx, const char *pattern, size_t size)
+{
+    size_t lo;
+    assert(idx != NULL && pattern != NULL);
+    PASSTHROUGH_ON_FAIL(idx != NULL && pattern != NULL, 0);
+    return a_suffix_internal_range(idx, pattern, size, &lo);
+}
+
+size_t a_suffix_index_locate(a_suffix_index idx, a_cstr pattern, size_t *offsets, size_t max)
+{
+    assert(pattern != NULL);
+    PASSTHROUGH_ON_FAIL(pattern != NULL, 0);
+    return a_suffix_index_locate_size(idx, pattern, a_size(pattern), offsets, max);
+}
+size_t a_suffix_index_locate_cstr(a_suffix_index idx, const char *pattern, size_t *offsets, size_t max)
+{
+    assert(pattern != NULL);
+    PASSTHROUGH_ON_FAIL(pattern != NULL, 0);
+    return a_suffix_index_locate_size(idx, pattern, strlen(pattern), offsets, max);
+}
+size_t a_suffix_index_locate_size(a_suffix_index idx, const char *pattern, size_t size,
+                                  size_t *offsets, size_t max)
+{
+    size_t lo, n, i;
+    assert(idx != NULL && pattern != NULL && (offsets != NULL || !max));
+    PASSTHROUGH_ON_FAIL(idx != NULL && pattern != NULL && (offsets != NULL || !max), 0);
+
+    n = a_suffix_internal_range(idx, pattern, size, &lo);
+    if (max > n)
+        max = n;
+    for (i = 0; i < max; ++i)
+        offsets[i] = idx->sa[lo + i];
+    if (max > 1)
+        qsort(offsets, max, sizeof *offsets, a_suffix_internal_cmp);
+    for (i = 0; i < max; ++i)
+        offsets[i] = a_suffix_internal_orig(idx, offsets[i]);
+    return n;
+}
+
+size_t a_suffix_index_doc(a_suffix_index idx, size_t offset, size_t *doc_offset)
+{
+    size_t lo = 0, hi, mid;
+    assert(idx != NULL);
+    PASSTHROUGH_ON_FAIL(idx != NULL, A_EOS);
+
+    if (offset >= idx->starts[idx->docs])
+        return A_EOS;
+    /* the last document starting at or before offset */
+    for (hi = idx->docs; hi - lo > 1;)
+    {
+        mid = lo + (hi - lo) / 2;
+        if (idx->starts[mid] <= offset)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    if (doc_offset)
+        *doc_offset = offset - idx->starts[lo];
+    return lo;
+}
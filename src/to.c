@@ -270,15 +270,87 @@ a_cp a_to_fold_simple_chr_cp(a_cp cp)
  *      Lowercase_Mapping(C).
  * 
  */
+struct a_to_job
+{
+    const char *s;
+    char *(*fn)(a_cp cp, char *b);
+    size_t at[A_MAX_THREADS + 1];
+    size_t size[A_MAX_THREADS];     /* mapped size of every chunk       */
+    size_t len[A_MAX_THREADS];      /* code points in every mapped chunk */
+    char *out;                      /* NULL while precounting           */
+    size_t base[A_MAX_THREADS];     /* where every chunk goes in out    */
+};
+
+/* precounts or maps a single chunk */
+static void a_to_internal_job(void *ctx, size_t i)
+{
+    struct a_to_job *job = ctx;
+    char buff[A_MAX_UPPER_UTF8_BUFFER_SIZE + A_MAX_LOWER_UTF8_BUFFER_SIZE];
+    const char *at = job->s + job->at[i], *end = job->s + job->at[i+1], *m;
+    char *w = job->out ? job->out + job->base[i] : NULL;
+    size_t size = 0, len = 0, n;
+    
+    while (at < end)
+    {
+        m = job->fn(a_internal_to_next_cp(&at), buff);
+        n = strlen(m);
+        if (w)
+            memcpy(w, m, n), w += n;
+        size += n;
+        len += a_internal_count_cp_seq(m, n);
+    }
+    job->size[i] = size;
+    job->len[i] = len;
+}
+
+/*
+ * Maps every code point of a large string with fn, a chunk per thread:
+ * the chunks are precounted, then mapped straight to their place in the
+ * result.
+ */
+static a_str a_to_internal_map(a_str str, size_t n, char *(*fn)(a_cp cp, char *b))
+{
+    struct a_to_job job;
+    a_str new;
+    size_t i, size = 0, len = 0;
+    
+    job.s = str;
+    job.fn = fn;
+    job.out = NULL;
+    a_internal_split(str, a_size(str), n, job.at);
+    a_internal_parallel(n, a_to_internal_job, &job);
+    for (i = 0; i < n; ++i)
+    {
+        job.base[i] = size;
+        size += job.size[i];
+        len += job.len[i];
+    }
+    
+    if ((new = a_new_mem_raw(size)))
+    {
+        job.out = new;
+        a_internal_parallel(n, a_to_internal_job, &job);
+        new[size] = '\0';
+        a_header(new)->size = size;
+        a_header(new)->len = len;
+    }
+    a_free(str);
+    return new;
+}
+
 a_str a_to_upper(a_str str)
 {
     a_str new;
     char *at, *start;
     char buff[A_MAX_UPPER_UTF8_BUFFER_SIZE];
+    size_t n;
     
     assert(str != NULL);
     PASSTHROUGH_ON_FAIL(str != NULL, NULL);
     
+    if ((n = a_internal_threads(a_size(str), 0)) > 1)
+        return a_to_internal_map(str, n, a_to_upper_cp);
+    
     for (start = at = str; *at; start = at)
         if (!a_is_upper_cp(a_internal_to_next_cp((const char **)&at)))
             goto to_upper;
@@ -480,11 +552,15 @@ a_str a_to_lower(a_str str)
 {
     a_str new;
     char *at, *start;
-    char buff[A_MAX_LOWER_UTF8_BUFFER_SIZE];
+    char buff[A_MAX_LOWER_UTF8_BUFFER_SIZE + 1]; /* 4 bytes and the '\0' */
+    size_t n;
     
     assert(str != NULL);
     PASSTHROUGH_ON_FAIL(str != NULL, NULL);
     
+    if ((n = a_internal_threads(a_size(str), 0)) > 1)
+        return a_to_internal_map(str, n, a_to_lower_cp);
+    
     for (start = at = str; *at; start = at)
         if (!a_is_lower_cp(a_internal_to_next_cp((const char **)&at)))
             goto to_lower;
@@ -505,6 +581,30 @@ to_lower:
     a_free(str);
     return new;
 }
+a_str a_to_fold(a_str str)
+{
+    a_str new;
+    const char *at;
+    char buff[A_MAX_FOLD_UTF8_BUFFER_SIZE];
+    size_t n;
+    
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+    
+    if ((n = a_internal_threads(a_size(str), 0)) > 1)
+        return a_to_internal_map(str, n, a_to_fold_cp);
+    
+    if ((new = a_new_mem_raw(a_size(str))))
+    {
+        *new = '\0';
+        a_header(new)->size = a_header(new)->len = 0;
+    }
+    for (at = str; *at && new;)
+        new = a_cat_cstr(new, a_to_fold_cp(a_internal_to_next_cp(&at), buff));
+    
+    a_free(str);
+    return new;
+}
 
 char *a_to_lower_cp(a_cp cp, char *b)
 {
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC
+ *
+ * License: MIT
+ */
+
+/*
+ * ASCII Transliteration
+ *
+ * Two passes over the string. The first skips the runs of ASCII, sixteen
+ * bytes at a time with SSE2 where available (a word at a time otherwise),
+ * and adds up the size of the transliteration of everything in between;
+ * a string that is ASCII throughout ends here and is returned as is. The
+ * second pass writes the result to a string of exactly that size, the
+ * runs of ASCII copied whole.
+ */
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/* the number of ASCII bytes s starts with */
+static size_t a_ascii_internal_skip(const char *s, size_t size)
+{
+    size_t i = 0;
+#if defined(__SSE2__)
+    unsigned int m;
+
+    for (; i + 16 <= size; i += 16)
+        if ((m = (unsigned int)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(s + i)))))
+        {
+            for (; !(m & 1); m >>= 1)
+                ++i;
+            return i;
+        }
+#else
+    unsigned long w, high = ULONG_MAX / 0xFF * 0x80;
+
+    for (; i + sizeof w <= size; i += sizeof w)
+    {
+        memcpy(&w, s + i, sizeof w);
+        if (w & high)
+            break;
+    }
+#endif
+    while (i < size && !((unsigned char)s[i] & 0x80))
+        ++i;
+    return i;
+}
+
+static const struct a_ascii_rec *a_ascii_internal_record(a_cp cp)
+{
+    return cp < 0 || cp > A_MAX_CP ? &a_ascii_record[0] : &A_ASCII_RECORD(cp);
+}
+
+/*
+ * Moves *at past the next code point and returns its record. A sequence
+ * cut off by end is not decoded, it is dropped like anything else with no
+ * transliteration.
+ */
+static const struct a_ascii_rec *a_ascii_internal_next(const char **at, const char *end)
+{
+    if ((size_t)a_next_char_size[(unsigned char)**at] > (size_t)(end - *at))
+    {
+        *at = end;
+        return &a_ascii_record[0];
+    }
+    return a_ascii_internal_record(a_internal_to_next_cp(at));
+}
+
+/*
+ * Transliterates the size bytes of s to a new string, or returns same
+ * (which may be NULL) if they are all ASCII.
+ */
+static a_str a_to_ascii_internal(const char *s, size_t size, a_str same)
+{
+    const char *at = s, *end = s + size;
+    size_t out, n;
+    const struct a_ascii_rec *r;
+    a_str new;
+    char *w;
+
+    /* sizing: the transliteration of each non-ASCII code point */
+    out = a_ascii_internal_skip(s, size);
+    if (out == size && same)
+        return same;
+    for (at += out; at < end; at += n, out += n)
+    {
+        out += a_ascii_internal_next(&at, end)->len;
+        n = a_ascii_internal_skip(at, (size_t)(end - at));
+    }
+
+    if (!(new = a_new_mem_raw(out)))
+        return NULL;
+    for (at = s, w = new; at < end;)
+    {
+        n = a_ascii_internal_skip(at, (size_t)(end - at));
+        memcpy(w, at, n);
+        w += n;
+        if ((at += n) >= end)
+            break;
+        r = a_ascii_internal_next(&at, end);
+        memcpy(w, a_ascii_data + r->at, r->len);
+        w += r->len;
+    }
+    *w = '\0';
+    a_header(new)->size = a_header(new)->len = out;
+    return new;
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+a_str a_to_ascii(a_str str)
+{
+    a_str new;
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+
+    if ((new = a_to_ascii_internal(str, a_size(str), str)) != str)
+        a_free(str);
+    return new;
+}
+a_str a_to_ascii_cstr(const char *str)
+{
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+    return a_to_ascii_internal(str, strlen(str), NULL);
+}
+char *a_to_ascii_cp(a_cp cp, char *b)
+{
+    const struct a_ascii_rec *r;
+    assert(b != NULL);
+
+    if (cp >= 0 && cp < 0x80)
+    {
+        b[0] = (char)cp;
+        b[1] = '\0';
+        return b;
+    }
+    r = a_ascii_internal_record(cp);
+    memcpy(b, a_ascii_data + r->at, r->len);
+    b[r->len] = '\0';
+    return b;
+}
@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC
+ *
+ * License: MIT
+ */
+
+/*
+ * Tries
+ *
+ * A trie over the bytes of the keys, with nodes that adapt to their
+ * number of children: up to A_TRIE_SMALL of them are kept sorted by
+ * byte, more than that get a table of all 256. A case insensitive trie
+ * is built over the UTF-8 of the folded code points instead, and walked
+ * by folding the string looked up as it goes. A node where a key ends
+ * holds a copy of it as it was given.
+ */
+
+#define A_TRIE_SMALL 16
+
+struct a_trie_node
+{
+    a_str key;                      /* the key ending here, or NULL    */
+    void *value;
+    struct a_trie_node **kids;      /* A_TRIE_SMALL or 256 of them     */
+    unsigned char *bytes;           /* the sorted bytes of small nodes */
+    unsigned short count;
+    unsigned char big;
+    struct a_trie_node *all;        /* the node allocated before       */
+};
+
+struct a_trie
+{
+    struct a_trie_node *root;
+    struct a_trie_node *all;
+    size_t count;
+    int icase;
+};
+
+/* the bytes of a key: as they are, or those of its folded code points */
+struct a_trie_reader
+{
+    const char *s;
+    const char *at;
+    const char *end;
+    int icase;
+    struct a_map_fold f;
+    char b[8];
+    size_t i, n;
+};
+
+static void a_trie_internal_reader(struct a_trie_reader *r, a_trie t, const char *s, size_t size)
+{
+    r->s = r->at = s;
+    r->end = s + size;
+    r->icase = t->icase;
+    r->i = r->n = 0;
+    if (t->icase)
+        a_map_internal_fold_init(&r->f, s, size);
+}
+/* the next byte, -1 at the end */
+static int a_trie_internal_next(struct a_trie_reader *r)
+{
+    a_cp cp;
+
+    if (!r->icase)
+        return r->at < r->end ? (unsigned char)*r->at++ : -1;
+    if (r->i == r->n)
+    {
+        if ((cp = a_map_internal_fold_next(&r->f)) == (a_cp)-1)
+            return -1;
+        a_internal_cp_to_char(cp, r->b);
+        r->n = cp ? strlen(r->b) : 1;
+        r->i = 0;
+    }
+    return (unsigned char)r->b[r->i++];
+}
+/* the size of the string read so far, up to the code point being folded */
+static size_t a_trie_internal_offset(struct a_trie_reader *r)
+{
+    return (size_t)((r->icase ? r->f.at : r->at) - r->s);
+}
+
+static struct a_trie_node *a_trie_internal_node(a_trie t)
+{
+    struct a_trie_node *n;
+
+    if (!(n = A_MALLOC(sizeof *n)))
+        return NULL;
+    n->key = NULL;
+    n->value = NULL;
+    n->kids = NULL;
+    n->bytes = NULL;
+    n->count = 0;
+    n->big = 0;
+    n->all = t->all;
+    t->all = n;
+    return n;
+}
+
+static struct a_trie_node *a_trie_internal_kid(const struct a_trie_node *n, int c)
+{
+    const unsigned char *p;
+
+    if (n->big)
+        return n->kids[c];
+    if (!n->count || !(p = memchr(n->bytes, c, n->count)))
+        return NULL;
+    return n->kids[p - n->bytes];
+}
+static size_t a_trie_internal_kids(const struct a_trie_node *n)
+{
+    return n->big ? 256 : n->count;
+}
+
+/* adds a child for c to n, returns it */
+static struct a_trie_node *a_trie_internal_add_kid(a_trie t, struct a_trie_node *n, int c)
+{
+    struct a_trie_node *kid, **kids;
+    size_t i, at;
+
+    if (!n->big && n->count == A_TRIE_SMALL)
+    {
+        if (!(kids = A_MALLOC(256 * sizeof *kids)))
+            return NULL;
+        for (i = 0; i < 256; ++i)
+            kids[i] = NULL;
+        for (i = 0; i < n->count; ++i)
+            kids[n->bytes[i]] = n->kids[i];
+        A_FREE(n->kids);
+        n->kids = kids;
+        n->bytes = NULL;
+        n->big = 1;
+    }
+    else if (!n->big && !n->kids)
+    {
+        /* one block for both, the bytes after the pointers */
+        if (!(n->kids = A_MALLOC(A_TRIE_SMALL * (sizeof *n->kids + 1))))
+            return NULL;
+        n->bytes = (unsigned char*)(n->kids + A_TRIE_SMALL);
+    }
+    if (!(kid = a_trie_internal_node(t)))
+        return NULL;
+
+    if (n->big)
+        n->kids[c] = kid;
+    else
+    {
+        for (at = n->count; at && n->bytes[at-1] > c; --at)
+        {
+            n->bytes[at] = n->bytes[at-1];
+            n->kids[at] = n->kids[at-1];
+        }
+        n->bytes[at] = (unsigned char)c;
+        n->kids[at] = kid;
+    }
+    ++n->count;
+    return kid;
+}
+
+static a_trie a_trie_internal_new(int icase)
+{
+    a_trie t;
+
+    if (!(t = A_MALLOC(sizeof *t)))
+        return NULL;
+    t->all = NULL;
+    t->count = 0;
+    t->icase = icase;
+    if (!(t->root = a_trie_internal_node(t)))
+    {
+        A_FREE(t);
+        return NULL;
+    }
+    return t;
+}
+
+/* the node of a key, NULL if there is none */
+static struct a_trie_node *a_trie_internal_find(a_trie t, const char *s, size_t size)
+{
+    struct a_trie_reader r;
+    struct a_trie_node *n = t->root;
+    int c;
+
+    a_trie_internal_reader(&r, t, s, size);
+    while (n && (c = a_trie_internal_next(&r)) != -1)
+        n = a_trie_internal_kid(n, c);
+    return n;
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+a_trie a_trie_new(void)
+{
+    return a_trie_internal_new(0);
+}
+a_trie a_trie_new_icase(void)
+{
+    return a_trie_internal_new(1);
+}
+void a_trie_free(a_trie t)
+{
+    struct a_trie_node *n, *next;
+
+    if (!t)
+        return;
+    for (n = t->all; n; n = next)
+    {
+        next = n->all;
+        if (n->key)
+            a_free(n->key);
+        A_FREE(n->kids);
+        A_FREE(n);
+    }
+    A_FREE(t);
+}
+size_t a_trie_count(a_trie t)
+{
+    assert(t != NULL);
+    PASSTHROUGH_ON_FAIL(t != NULL, 0);
+    return t->count;
+}
+
+int a_trie_set(a_trie t, a_cstr key, void *value)
+{
+    assert(key != NULL);
+    PASSTHROUGH_ON_FAIL(key != NULL, 0);
+    return a_trie_set_size(t, key, a_size(key), value);
+}
+int a_trie_set_cstr(a_trie t, const char *key, void *value)
+{
+    assert(key != NULL);
+    PASSTHROUGH_ON_FAIL(key != NULL, 0);
+    return a_trie_set_size(t, key, strlen(key), value);
+}
+int a_trie_set_size(a_trie t, const char *key, size_t size, void *value)
+{
+    struct a_trie_reader r;
+    struct a_trie_node *n, *kid;
+    int c;
+    assert(t != NULL && key != NULL);
+    PASSTHROUGH_ON_FAIL(t != NULL && key != NULL, 0);
+
+    a_trie_internal_reader(&r, t, key, size);
+    for (n = t->root; (c = a_trie_internal_next(&r)) != -1; n = kid)
+        if (!(kid = a_trie_internal_kid(n, c)) && !(kid = a_trie_internal_add_kid(t, n, c)))
+            return 0;
+    if (!n->key)
+    {
+        if (!(n->key = a_new_size(key, size)))
+            return 0;
+        ++t->count;
+    }
+    n->value = value;
+    return 1;
+}
+
+void *a_trie_get(a_trie t, a_cstr key)
+{
+    assert(key != NULL);
+    PASSTHROUGH_ON_FAIL(key != NULL, NULL);
+    return a_trie_get_size(t, key, a_size(key));
+}
+void *a_trie_get_cstr(a_trie t, const char *key)
+{
+    assert(key != NULL);
+    PASSTHROUGH_ON_FAIL(key != NULL, NULL);
+    return a_trie_get_size(t, key, strlen(key));
+}
+void *a_trie_get_size(a_trie t, const char *key, size_t size)
+{
+    struct a_trie_node *n;
+    assert(t != NULL && key != NULL);
+    PASSTHROUGH_ON_FAIL(t != NULL && key != NULL, NULL);
+
+    n = a_trie_internal_find(t, key, size);
+    return n && n->key ? n->value : NULL;
+}
+
+size_t a_trie_longest_prefix(a_trie t, a_cstr str, a_cstr *key, void **value)
+{
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, A_EOS);
+    return a_trie_longest_prefix_size(t, str, a_size(str), key, value);
+}
+size_t a_trie_longest_prefix_cstr(a_trie t, const char *str, a_cstr *key, void **value)
+{
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, A_EOS);
+    return a_trie_longest_prefix_size(t, str, strlen(str), key, value);
+}
+size_t a_trie_longest_prefix_size(a_trie t, const char *str, size_t size, a_cstr *key, void **value)
+{
+    struct a_trie_reader r;
+    struct a_trie_node *n, *best;
+    size_t offset = 0;
+    int c;
+    assert(t != NULL && str != NULL);
+    PASSTHROUGH_ON_FAIL(t != NULL && str != NULL, A_EOS);
+
+    a_trie_internal_reader(&r, t, str, size);
+    best = t->root->key ? t->root : NULL;
+    for (n = t->root; (c = a_trie_internal_next(&r)) != -1 && (n = a_trie_internal_kid(n, c));)
+    {
+        /* keys only end after whole (folded) code points */
+        if (n->key)
+        {
+            best = n;
+            offset = a_trie_internal_offset(&r);
+        }
+    }
+    if (!best)
+        return A_EOS;
+    if (key)
+        *key = best->key;
+    if (value)
+        *value = best->value;
+    return offset;
+}
+
+size_t a_trie_each_prefixed(a_trie t, a_cstr prefix, int (*fn)(a_cstr key, void *value, void *ctx), void *ctx)
+{
+    assert(prefix != NULL);
+    PASSTHROUGH_ON_FAIL(prefix != NULL, 0);
+    return a_trie_each_prefixed_size(t, prefix, a_size(prefix), fn, ctx);
+}
+size_t a_trie_each_prefixed_cstr(a_trie t, const char *prefix, int (*fn)(a_cstr key, void *value, void *ctx), void *ctx)
+{
+    assert(prefix != NULL);
+    PASSTHROUGH_ON_FAIL(prefix != NULL, 0);
+    return a_trie_each_prefixed_size(t, prefix, strlen(prefix), fn, ctx);
+}
+size_t a_trie_each_prefixed_size(a_trie t, const char *prefix, size_t size,
+                                 int (*fn)(a_cstr key, void *value, void *ctx), void *ctx)
+{
+    struct a_trie_visit
+    {
+        struct a_trie_node *n;
+        size_t i;
+    } *stack = NULL, *grown;
+    struct a_trie_node *n;
+    size_t depth = 0, mem = 0, count = 0;
+    assert(t != NULL && prefix != NULL && fn != NULL);
+    PASSTHROUGH_ON_FAIL(t != NULL && prefix != NULL && fn != NULL, 0);
+
+    if (!(n = a_trie_internal_find(t, prefix, size)))
+        return 0;
+
+    /* depth first, a node before its children: shorter keys come first */
+    if (n->key && (++count, !fn(n->key, n->value, ctx)))
+        return count;
+    for (;;)
+    {
+        if (depth == mem)
+        {
+            if (!(grown = A_REALLOC(stack, (mem * 2 + 16) * sizeof *stack)))
+                break;
+            stack = grown;
+            mem = mem * 2 + 16;
+        }
+        stack[depth].n = n;
+        stack[depth++].i = 0;
+
+        /* the next child of the deepest node that has one left, gaps of big nodes are NULL */
+        for (n = NULL; depth && !n;)
+        {
+            struct a_trie_visit *v = &stack[depth-1];
+
+            if (v->i == a_trie_internal_kids(v->n))
+                --depth;
+            else
+                n = v->n->kids[v->i++];
+        }
+        if (!n)
+            break;
+        if (n->key && (++count, !fn(n->key, n->value, ctx)))
+            break;
+    }
+    A_FREE(stack);
+    return count;
+}
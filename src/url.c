@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC
+ *
+ * License: MIT
+ */
+
+/*
+ * URL Encoding/Decoding
+ */
+
+/*
+ * Characters that are left alone by each encoding mode, one bit per mode:
+ *  1 - unreserved characters (RFC 3986 2.3)
+ *  2 - path characters: unreserved, sub-delims, ':', '@' and '/'
+ *  4 - query characters: path characters and '?'
+ *  8 - application/x-www-form-urlencoded: alphanumerics and "*-._"
+ */
+static const unsigned char a_url_keep[256] =
+{
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  6,  0,  0,  6,  0,  6,  6,  6,  6, 14,  6,  6, 15, 15,  6,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15,  6,  6,  0,  6,  0,  4,
+     6, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,  0,  0,  0,  0, 15,
+     0, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,  0,  0,  0,  7,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0
+};
+
+#define A_URL_MODE_BIT(opts) (1 << ((opts) & 3))
+
+static int a_url_internal_hex(char c)
+{
+    if ('0' <= c && c <= '9')
+        return c - '0';
+    c |= 0x20;
+    if ('a' <= c && c <= 'f')
+        return c - 'a' + 10;
+    return -1;
+}
+
+/*
+ * Returns a pointer to the first byte in [s, end) that isn't kept as is
+ * by the given mode bit, or end. Eight bytes are checked at a time
+ * without branching on each of them.
+ */
+static const char *a_url_internal_skip(const char *s, const char *end, int bit)
+{
+    const unsigned char *p = (const unsigned char*)s, *e = (const unsigned char*)end;
+
+    for (; e - p >= 8; p += 8)
+        if (!(a_url_keep[p[0]] & a_url_keep[p[1]] & a_url_keep[p[2]] & a_url_keep[p[3]]
+                & a_url_keep[p[4]] & a_url_keep[p[5]] & a_url_keep[p[6]] & a_url_keep[p[7]] & bit))
+            break;
+    for (; p < e; ++p)
+        if (!(a_url_keep[*p] & bit))
+            break;
+    return (const char*)p;
+}
+
+/* finds the first '%' (or '+' if plus is set) a word at a time */
+static const char *a_url_internal_find(const char *s, const char *end, int plus)
+{
+    for (; (size_t)(end - s) >= sizeof (size_t); s += sizeof (size_t))
+    {
+        size_t w, t;
+
+        memcpy(&w, s, sizeof w);
+        t = w ^ (A_SWAR_ONES * '%');
+        t = (t - A_SWAR_ONES) & ~t;
+        if (plus)
+        {
+            size_t q = w ^ (A_SWAR_ONES * '+');
+            t |= (q - A_SWAR_ONES) & ~q;
+        }
+        if (t & A_SWAR_HIGHS)
+            break;
+    }
+    for (; s < end; ++s)
+        if (*s == '%' || (plus && *s == '+'))
+            break;
+    return s;
+}
+
+/*
+ * Validates the decoded bytes in [*checked, w). A trailing sequence that
+ * is merely incomplete is left for the next call unless final is set.
+ */
+static int a_url_internal_validate(const char **checked, const char *w, int final)
+{
+    size_t rest;
+
+    *checked += a_internal_valid_utf8_size(*checked, (size_t)(w - *checked));
+    rest = (size_t)(w - *checked);
+    if (!rest)
+        return 1;
+    return !final && rest < (size_t)a_next_char_size[(unsigned char)**checked];
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+a_str a_url_encode(a_str str, int opts)
+{
+    static const char hex[] = "0123456789ABCDEF";
+    const char *s, *run, *end;
+    size_t size, spaces;
+    char *w;
+    int bit = A_URL_MODE_BIT(opts), form = (opts & 3) == a_url_form;
+    a_str newstr;
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+
+    /* precount the exact output size */
+    end = str + a_size(str);
+    size = a_size(str);
+    for (s = str, spaces = 0; (s = a_url_internal_skip(s, end, bit)) != end; ++s)
+    {
+        if (form && *s == ' ')
+            ++spaces;
+        else
+            size += 2;
+    }
+
+    if (size == a_size(str))
+    {
+        /* at most some spaces to turn into '+' */
+        for (w = str; spaces; --spaces)
+            *(w = memchr(w, ' ', (size_t)(end - w))) = '+';
+        return str;
+    }
+
+    if (!(newstr = a_new_mem_raw(size)))
+    {
+        a_free(str);
+        return NULL;
+    }
+    for (s = str, w = newstr; ; ++s)
+    {
+        run = s;
+        s = a_url_internal_skip(s, end, bit);
+        memcpy(w, run, (size_t)(s - run));
+        w += s - run;
+        if (s == end)
+            break;
+        if (form && *s == ' ')
+            *w++ = '+';
+        else
+        {
+            *w++ = '%';
+            *w++ = hex[(unsigned char)*s >> 4];
+            *w++ = hex[*s & 0xF];
+        }
+    }
+    *w = '\0';
+    /* everything else got encoded, the result is plain ASCII */
+    a_header(newstr)->size = size;
+    a_header(newstr)->len = size;
+    a_free(str);
+    return newstr;
+}
+a_str a_url_decode(a_str str, int opts)
+{
+    struct a_header *h;
+    const char *r, *end, *next, *checked;
+    char *w;
+    int form = (opts & 3) == a_url_form, validate = opts & a_url_validate;
+    assert(str != NULL);
+    PASSTHROUGH_ON_FAIL(str != NULL, NULL);
+
+    h = a_header(str);
+    end = str + h->size;
+    checked = str;
+    for (r = w = str; (next = a_url_internal_find(r, end, form)) != end; )
+    {
+        int hi, lo;
+
+        if (w != r)
+            memmove(w, r, (size_t)(next - r));
+        w += next - r;
+        r = next + 1;
+
+        if (*next == '+')
+            *w++ = ' ';
+        else if (end - r >= 2 && (hi = a_url_internal_hex(r[0])) >= 0 && (lo = a_url_internal_hex(r[1])) >= 0)
+        {
+            *w++ = (char)(hi << 4 | lo);
+            r += 2;
+        }
+        else
+            *w++ = '%';
+
+        if (validate && !a_url_internal_validate(&checked, w, 0))
+        {
+            a_free(str);
+            return NULL;
+        }
+    }
+    if (w != r)
+        memmove(w, r, (size_t)(end - r));
+    w += end - r;
+
+    if (validate && !a_url_internal_validate(&checked, w, 1))
+    {
+        a_free(str);
+        return NULL;
+    }
+    *w = '\0';
+    h->size = (size_t)(w - str);
+    h->len = a_internal_count_cp(str, h->size);
+    return str;
+}
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (david@zigwap.com), ZigWap LLC
+ *
+ * License: MIT
+ */
+
+/*
+ * Vector Transforms
+ *
+ * The same transform applied to every string of a vector. Arguments and
+ * the locale are checked once for the whole vector, case mappings are
+ * built in a scratch buffer shared by all the strings of a thread and
+ * copied back in place, so a string is only reallocated if it grows past
+ * its buffer. Large vectors are split across threads, in runs of about
+ * the same number of bytes.
+ */
+
+/* the case mapping applied by a_vec_internal_map() to ASCII */
+enum a_vec_ascii
+{
+    a_vec_ascii_none,   /* go through fn, the locale has exceptions */
+    a_vec_ascii_lower,
+    a_vec_ascii_upper
+};
+
+struct a_vec_job
+{
+    a_str *strv;
+    size_t at[A_MAX_THREADS + 1];   /* job i does the strings [at[i], at[i+1]) */
+    int (*op)(struct a_vec_job *job, size_t i, char **buf, size_t *mem);
+    char *(*fn)(a_cp cp, char *b);  /* case mapping of a code point            */
+    int ascii;
+    void *out;                      /* results of the read only transforms     */
+    size_t failed[A_MAX_THREADS];
+};
+
+/* maps every code point of strv[i] with fn */
+static int a_vec_internal_map(struct a_vec_job *job, size_t i, char **buf, size_t *mem)
+{
+    char b[A_MAX_UPPER_UTF8_BUFFER_SIZE + A_MAX_FOLD_UTF8_BUFFER_SIZE];
+    a_str s = job->strv[i];
+    const char *at = s, *end = s + a_size(s), *m;
+    size_t used = 0, k;
+    unsigned char c;
+
+    while (at < end)
+    {
+        if (*mem - used < sizeof b)
+        {
+            char *grown = A_REALLOC(*buf, *mem * 2 + sizeof b);
+
+            if (!grown)
+                return 0;
+            *buf = grown;
+            *mem = *mem * 2 + sizeof b;
+        }
+        c = (unsigned char)*at;
+        if (c < 0x80 && job->ascii != a_vec_ascii_none)
+        {
+            if (job->ascii == a_vec_ascii_lower && (unsigned)(c - 'A') < 26u)
+                c += 'a' - 'A';
+            else if (job->ascii == a_vec_ascii_upper && (unsigned)(c - 'a') < 26u)
+                c -= 'a' - 'A';
+            (*buf)[used++] = (char)c;
+            ++at;
+            continue;
+        }
+        m = job->fn(a_internal_to_next_cp(&at), b);
+        k = strlen(m);
+        memcpy(*buf + used, m, k);
+        used += k;
+    }
+
+    if (used == a_size(s) && (!used || !memcmp(s, *buf, used)))
+        return 1;
+    /* mapped files have no buffer of their own to write into */
+    if (!a_header(s)->mem)
+    {
+        a_str copy = a_new_mem_raw(used);
+        a_free(s);
+        s = copy;
+    }
+    else
+        s = a_reserve(s, used);
+    if (!(job->strv[i] = s))
+        return 0;
+    memcpy(s, *buf, used);
+    s[used] = '\0';
+    a_header(s)->size = used;
+    a_header(s)->len = a_internal_count_cp_seq(s, used);
+    return 1;
+}
+
+static int a_vec_internal_trim(struct a_vec_job *job, size_t i, char **buf, size_t *mem)
+{
+    (void)buf, (void)mem;
+    job->strv[i] = a_trim(job->strv[i]);
+    return 1;
+}
+
+static int a_vec_internal_validate(struct a_vec_job *job, size_t i, char **buf, size_t *mem)
+{
+    size_t size = a_size(job->strv[i]), valid;
+
+    (void)buf, (void)mem;
+    valid = a_is_internal_valid_utf8_seq(job->strv[i], size);
+    if (job->out)
+        ((size_t*)job->out)[i] = valid == size ? A_EOS : valid;
+    return valid == size;
+}
+
+static int a_vec_internal_hash(struct a_vec_job *job, size_t i, char **buf, size_t *mem)
+{
+    (void)buf, (void)mem;
+    ((unsigned long*)job->out)[i] = a_hash_internal(job->strv[i], a_size(job->strv[i]));
+    return 1;
+}
+
+static void a_vec_internal_job(void *ctx, size_t n)
+{
+    struct a_vec_job *job = ctx;
+    char *buf = NULL;
+    size_t mem = 0, i;
+
+    job->failed[n] = 0;
+    for (i = job->at[n]; i < job->at[n+1]; ++i)
+        job->failed[n] += !job->op(job, i, &buf, &mem);
+    A_FREE(buf);
+}
+
+/* runs op over all the strings, returns the number it failed on */
+static size_t a_vec_internal_run(struct a_vec_job *job, size_t count)
+{
+    size_t i, j, n, total = 0, sum = 0, failed = 0;
+
+    /* every string counts for a byte more, so that empty ones weigh too */
+    for (i = 0; i < count; ++i)
+        total += a_size(job->strv[i]) + 1;
+    if ((n = a_internal_threads(total, 0)) > count)
+        n = count ? count : 1;
+
+    job->at[0] = 0;
+    for (i = 1, j = 0; i < n; ++i)
+    {
+        while (j < count && sum < total / n * i)
+            sum += a_size(job->strv[j++]) + 1;
+        job->at[i] = j;
+    }
+    job->at[n] = count;
+    a_internal_parallel(n, a_vec_internal_job, job);
+
+    for (i = 0; i < n; ++i)
+        failed += job->failed[i];
+    return failed;
+}
+
+static int a_vec_internal_case(a_str *strv, size_t count, char *(*fn)(a_cp cp, char *b), int ascii)
+{
+    struct a_vec_job job;
+    assert(strv != NULL || !count);
+    PASSTHROUGH_ON_FAIL(strv != NULL || !count, 0);
+
+#if A_INCLUDE_LOCALE == 1
+    /* the exceptions of Turkish and Lithuanian touch 'I' and 'i' */
+    if (a_locale_get()->exceptions)
+        ascii = a_vec_ascii_none;
+#endif
+    job.strv = strv;
+    job.op = a_vec_internal_map;
+    job.fn = fn;
+    job.ascii = ascii;
+    return !a_vec_internal_run(&job, count);
+}
+
+/**************************************************/
+/**************************************************/
+/**************************************************/
+
+int a_vec_to_lower(a_str *strv, size_t count)
+{
+    return a_vec_internal_case(strv, count, a_to_lower_cp, a_vec_ascii_lower);
+}
+int a_vec_to_upper(a_str *strv, size_t count)
+{
+    return a_vec_internal_case(strv, count, a_to_upper_cp, a_vec_ascii_upper);
+}
+int a_vec_to_fold(a_str *strv, size_t count)
+{
+    /* on ASCII, folding is lowercasing */
+    return a_vec_internal_case(strv, count, a_to_fold_cp, a_vec_ascii_lower);
+}
+int a_vec_trim(a_str *strv, size_t count)
+{
+    struct a_vec_job job;
+    assert(strv != NULL || !count);
+    PASSTHROUGH_ON_FAIL(strv != NULL || !count, 0);
+
+    job.strv = strv;
+    job.op = a_vec_internal_trim;
+    return !a_vec_internal_run(&job, count);
+}
+size_t a_vec_validate(a_str *strv, size_t count, size_t *offsets)
+{
+    struct a_vec_job job;
+    assert(strv != NULL || !count);
+    PASSTHROUGH_ON_FAIL(strv != NULL || !count, 0);
+
+    job.strv = strv;
+    job.op = a_vec_internal_validate;
+    job.out = offsets;
+    return a_vec_internal_run(&job, count);
+}
+void a_vec_hash(a_str *strv, size_t count, unsigned long *hashes)
+{
+    struct a_vec_job job;
+    assert((strv != NULL && hashes != NULL) || !count);
+    PASSTHROUGH_ON_FAIL((strv != NULL && hashes != NULL) || !count, ;);
+
+    job.strv = strv;
+    job.op = a_vec_internal_hash;
+    job.out = hashes;
+    a_vec_internal_run(&job, count);
+}
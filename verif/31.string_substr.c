@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (davidschor@zigwap.com), ZigWap LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "ctest.h"
+#include "aleph.h"
+
+CTEST(Substring, check_substr)
+{ 
+    a_str a;
+    a_gc;
+    
+    a = a_(a_substr(a_(a_new("Hello World")), 6, 5));
+    ASSERT_EQUAL(0, strcmp(a, "World"));
+    ASSERT_EQUAL(5, a_len(a));
+    
+    a = a_(a_substr(a_(a_new("Hello World")), -5, -2));
+    ASSERT_EQUAL(0, strcmp(a, "Wor"));
+    
+    a = a_(a_substr(a_(a_new("Hello World")), 20, 5));
+    ASSERT_EQUAL(0, a_len(a));
+    ASSERT_EQUAL(0, a_size(a));
+    
+    a = a_(a_substr(a_(a_new("ⒶⒷⒸⒹⒺⒻ")), 1, 2));
+    ASSERT_EQUAL(0, strcmp(a, "ⒷⒸ"));
+    ASSERT_EQUAL(2, a_len(a));
+    ASSERT_EQUAL(6, a_size(a));
+    
+    a = a_(a_substr(a_(a_new("ⒶⒷⒸⒹⒺⒻ")), -4, 3));
+    ASSERT_EQUAL(0, strcmp(a, "ⒸⒹⒺ"));
+    ASSERT_EQUAL(3, a_len(a));
+    
+    a = a_(a_substr(a_(a_new("aⒷcⒹeⒻ")), 1, -1));
+    ASSERT_EQUAL(0, strcmp(a, "ⒷcⒹe"));
+    ASSERT_EQUAL(4, a_len(a));
+    
+    a = a_(a_substr(a_(a_new("Hello World")), LONG_MIN, 5));
+    ASSERT_EQUAL(0, strcmp(a, "Hello"));
+    a = a_(a_substr(a_(a_new("Hello World")), 2, LONG_MIN));
+    ASSERT_EQUAL(0, a_size(a));
+    
+    a = a_substr_inplace(a_(a_new("aⒷcⒹeⒻ")), -3, 100);
+    ASSERT_EQUAL(0, strcmp(a, "ⒹeⒻ"));
+    ASSERT_EQUAL(3, a_len(a));
+    ASSERT_EQUAL(7, a_size(a));
+    
+    a_gc_done();
+}
+
+CTEST(Substring, check_substr_offset)
+{ 
+    a_str a;
+    a_gc;
+    
+    a = a_(a_substr_offset(a_(a_new("aⒷcⒹeⒻ")), 1, 3));
+    ASSERT_EQUAL(0, strcmp(a, "Ⓑ"));
+    ASSERT_EQUAL(1, a_len(a));
+    
+    a = a_(a_substr_offset(a_(a_new("aⒷcⒹeⒻ")), 1, -3));
+    ASSERT_EQUAL(0, strcmp(a, "ⒷcⒹe"));
+    ASSERT_EQUAL(4, a_len(a));
+    
+    a = a_substr_offset_inplace(a_(a_new("aⒷcⒹeⒻ")), -3, 3);
+    ASSERT_EQUAL(0, strcmp(a, "Ⓕ"));
+    ASSERT_EQUAL(1, a_len(a));
+    ASSERT_EQUAL(3, a_size(a));
+    
+    a_gc_done();
+}
+
+CTEST(Substring, check_substr_between)
+{ 
+    a_str a;
+    a_gc;
+    
+    a = a_(a_substr_between_cstr(a_(a_new("<<Ⓐ[Ⓑ]Ⓒ>>")), "[", "]", 0));
+    ASSERT_EQUAL(0, strcmp(a, "Ⓑ"));
+    ASSERT_EQUAL(1, a_len(a));
+    
+    a = a_(a_substr_between_cstr(a_(a_new("<<Ⓐ[Ⓑ]Ⓒ>>")), "<<", ">>", 1));
+    ASSERT_EQUAL(0, strcmp(a, "<<Ⓐ[Ⓑ]Ⓒ>>"));
+    ASSERT_EQUAL(9, a_len(a));
+    
+    a = a_(a_substr_between_cstr(a_(a_new("<<Ⓐ[Ⓑ]Ⓒ>>")), "]", "[", 0));
+    ASSERT_EQUAL(0, a_len(a));
+    
+    a = a_substr_between_cstr_inplace(a_(a_new("key=\"ⓥⓐⓛ\";")), "\"", "\"", 0);
+    ASSERT_EQUAL(0, strcmp(a, "ⓥⓐⓛ"));
+    ASSERT_EQUAL(3, a_len(a));
+    
+    a_gc_done();
+}
+
+CTEST(Substring, check_left_right)
+{ 
+    a_str a;
+    a_gc;
+    
+    a = a_(a_left(a_(a_new("ⒶⒷⒸⒹ")), 3));
+    ASSERT_EQUAL(0, strcmp(a, "ⒶⒷⒸ"));
+    ASSERT_EQUAL(3, a_len(a));
+    
+    a = a_(a_left(a_(a_new("ⒶⒷⒸⒹ")), 10));
+    ASSERT_EQUAL(0, strcmp(a, "ⒶⒷⒸⒹ"));
+    
+    a = a_(a_right(a_(a_new("ⒶⒷⒸⒹ")), 3));
+    ASSERT_EQUAL(0, strcmp(a, "ⒷⒸⒹ"));
+    ASSERT_EQUAL(3, a_len(a));
+    
+    a = a_(a_left_offset(a_(a_new("aⒷcⒹ")), 4));
+    ASSERT_EQUAL(0, strcmp(a, "aⒷ"));
+    ASSERT_EQUAL(2, a_len(a));
+    
+    a = a_(a_right_offset(a_(a_new("aⒷcⒹ")), 4));
+    ASSERT_EQUAL(0, strcmp(a, "cⒹ"));
+    ASSERT_EQUAL(2, a_len(a));
+    
+    a = a_left_offset_inplace(a_(a_new("aⒷcⒹ")), 1);
+    ASSERT_EQUAL(0, strcmp(a, "a"));
+    ASSERT_EQUAL(1, a_len(a));
+    
+    a = a_right_offset_inplace(a_(a_new("aⒷcⒹ")), 3);
+    ASSERT_EQUAL(0, strcmp(a, "Ⓓ"));
+    ASSERT_EQUAL(1, a_len(a));
+    
+    a_gc_done();
+}
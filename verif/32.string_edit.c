@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (davidschor@zigwap.com), ZigWap LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ctest.h"
+#include "aleph.h"
+
+CTEST(Deletion, check_del)
+{ 
+    a_str a;
+    a_gc;
+    
+    a = a_del(a_(a_new("ⒶⒷⒸⒹⒺ")), 1, 2);
+    ASSERT_EQUAL(0, strcmp(a, "ⒶⒹⒺ"));
+    ASSERT_EQUAL(3, a_len(a));
+    ASSERT_EQUAL(9, a_size(a));
+    
+    a = a_del_offset(a_(a_new("aⒷcⒹe")), 1, 4);
+    ASSERT_EQUAL(0, strcmp(a, "aⒹe"));
+    ASSERT_EQUAL(3, a_len(a));
+    
+    a_gc_done();
+}
+
+CTEST(Deletion, check_edit)
+{ 
+    a_str a;
+    struct a_edit shrink[] = {{0, 1, NULL}, {2, 2, "x"}, {5, 1, ""}};
+    struct a_edit grow[] = {{0, 0, "ⓐⓑ"}, {1, 1, "Ⓩ"}, {6, 0, "!"}};
+    struct a_edit mixed[] = {{0, 2, NULL}, {3, 1, "ⓧⓨⓩ"}};
+    struct a_edit bytes[] = {{0, 4, NULL}, {5, 3, "xyz"}};
+    a_gc;
+    
+    a = a_edit(a_(a_new("ⒶⒷⒸⒹⒺⒻ")), shrink, 3);
+    ASSERT_EQUAL(0, strcmp(a, "ⒷxⒺ"));
+    ASSERT_EQUAL(3, a_len(a));
+    ASSERT_EQUAL(7, a_size(a));
+    
+    a = a_edit(a_(a_new("abcdef")), shrink, 3);
+    ASSERT_EQUAL(0, strcmp(a, "bxe"));
+    ASSERT_EQUAL(3, a_len(a));
+    
+    a = a_edit(a_(a_new("ⒶⒷⒸⒹⒺⒻ")), grow, 3);
+    ASSERT_EQUAL(0, strcmp(a, "ⓐⓑⒶⓏⒸⒹⒺⒻ!"));
+    ASSERT_EQUAL(9, a_len(a));
+    ASSERT_EQUAL(25, a_size(a));
+    
+    a = a_(a_edit(a_new("abcdef"), mixed, 2));
+    ASSERT_EQUAL(0, strcmp(a, "cⓧⓨⓩef"));
+    ASSERT_EQUAL(6, a_len(a));
+    
+    a = a_edit_offset(a_(a_new("aⒷcⒹe")), shrink, 1);
+    ASSERT_EQUAL(0, strcmp(a, "ⒷcⒹe"));
+    ASSERT_EQUAL(4, a_len(a));
+    
+    a = a_(a_edit_offset(a_new("aⒷcⒹe"), bytes, 2));
+    ASSERT_EQUAL(0, strcmp(a, "cxyze"));
+    ASSERT_EQUAL(5, a_len(a));
+    
+    a_gc_done();
+}
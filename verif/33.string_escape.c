@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (davidschor@zigwap.com), ZigWap LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ctest.h"
+#include "aleph.h"
+
+CTEST(Escaping, check_escape)
+{ 
+    a_str a;
+    a_gc;
+    
+    a = a_(a_escape(a_new("plain text, nothing to do")));
+    ASSERT_EQUAL(0, strcmp(a, "plain text, nothing to do"));
+    
+    a = a_(a_escape(a_new("say \"hi\"\n\tⒶ\\\x01\x7F")));
+    ASSERT_EQUAL(0, strcmp(a, "say \\\"hi\\\"\\n\\tⒶ\\\\\\001\\177"));
+    ASSERT_EQUAL(a_len_cstr(a), a_len(a));
+    ASSERT_EQUAL(strlen(a), a_size(a));
+    
+    a = a_(a_escape_except(a_new("a\tb\nc"), "\t"));
+    ASSERT_EQUAL(0, strcmp(a, "a\tb\\nc"));
+    
+    a = a_(a_escape_opts(a_new("long line with a \"quote\" at the end\x1f\v"), NULL, a_escape_json));
+    ASSERT_EQUAL(0, strcmp(a, "long line with a \\\"quote\\\" at the end\\u001f\\u000b"));
+    
+    a = a_(a_escape_opts(a_new("é€😀\x7F"), NULL, a_escape_json | a_escape_ascii));
+    ASSERT_EQUAL(0, strcmp(a, "\\u00e9\\u20ac\\ud83d\\ude00\x7F"));
+    ASSERT_EQUAL(a_len_cstr(a), a_len(a));
+    ASSERT_EQUAL(strlen(a), a_size(a));
+    
+    a = a_(a_escape_opts(a_new("é😀"), NULL, a_escape_c | a_escape_ascii));
+    ASSERT_EQUAL(0, strcmp(a, "\\u00e9\\U0001f600"));
+    
+    a_gc_done();
+}
+
+CTEST(Escaping, check_escape_cut_off)
+{ 
+    a_str a;
+    a_gc;
+    
+    a = a_(a_escape_opts(a_new_size("ab\xF0", 3), NULL, a_escape_ascii));
+    ASSERT_EQUAL(0, strcmp(a, "ab\\360"));
+    ASSERT_EQUAL(a_len_cstr(a), a_len(a));
+    
+    a = a_(a_escape_opts(a_new_size("\"\xF0\x9F\x98", 4), NULL, a_escape_ascii));
+    ASSERT_EQUAL(0, strcmp(a, "\\\"\\360\\237\\230"));
+    ASSERT_EQUAL(a_len_cstr(a), a_len(a));
+    ASSERT_EQUAL(strlen(a), a_size(a));
+    
+    a = a_(a_escape_opts(a_new_size("\xC3\xA9\xE2\x82", 4), NULL, a_escape_json | a_escape_ascii));
+    ASSERT_EQUAL(0, strcmp(a, "\\u00e9\\ufffd"));
+    ASSERT_EQUAL(a_len_cstr(a), a_len(a));
+    
+    /* left as is unless non-ASCII is escaped */
+    a = a_(a_escape(a_new_size("a\n\xF0\x9F", 4)));
+    ASSERT_EQUAL(0, strcmp(a, "a\\n\xF0\x9F"));
+    
+    a_gc_done();
+}
+
+CTEST(Escaping, check_unescape)
+{ 
+    a_str a;
+    a_gc;
+    
+    a = a_(a_unescape(a_new("say \\\"hi\\\"\\n\\tⒶ\\\\\\001\\177")));
+    ASSERT_EQUAL(0, strcmp(a, "say \"hi\"\n\tⒶ\\\x01\x7F"));
+    ASSERT_EQUAL(a_len_cstr(a), a_len(a));
+    
+    a = a_(a_unescape(a_new("\\u00e9\\u20AC\\ud83d\\ude00\\U0001F600\\x41\\/")));
+    ASSERT_EQUAL(0, strcmp(a, "é€😀😀A/"));
+    ASSERT_EQUAL(6, a_len(a));
+    
+    a = a_(a_unescape(a_new("\\ud83d lone, bad \\u12 and trailing \\")));
+    ASSERT_EQUAL(0, strcmp(a, "\xEF\xBF\xBD lone, bad u12 and trailing \\"));
+    
+    /* out of range, even past what an a_cp holds */
+    a = a_(a_unescape(a_new("x\\UFFFFFFFFy\\U80000000\\U00110000")));
+    ASSERT_EQUAL(0, strcmp(a, "x\xEF\xBF\xBDy\xEF\xBF\xBD\xEF\xBF\xBD"));
+    ASSERT_EQUAL(5, a_len(a));
+    
+    a = a_(a_unescape(a_escape_opts(a_new("Ⓐ \"\x02\" 😀"), NULL, a_escape_json | a_escape_ascii)));
+    ASSERT_EQUAL(0, strcmp(a, "Ⓐ \"\x02\" 😀"));
+    
+    a_gc_done();
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (davidschor@zigwap.com), ZigWap LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ctest.h"
+#include "aleph.h"
+
+CTEST(URL, check_encode)
+{ 
+    a_str a;
+    a_gc;
+    
+    a = a_(a_url_encode(a_new("nothing-to_do.here~"), a_url_component));
+    ASSERT_EQUAL(0, strcmp(a, "nothing-to_do.here~"));
+    
+    a = a_(a_url_encode(a_new("a b&c=d/é"), a_url_component));
+    ASSERT_EQUAL(0, strcmp(a, "a%20b%26c%3Dd%2F%C3%A9"));
+    ASSERT_EQUAL(22, a_len(a));
+    ASSERT_EQUAL(22, a_size(a));
+    
+    a = a_(a_url_encode(a_new("/a b/c:d@e?f"), a_url_path));
+    ASSERT_EQUAL(0, strcmp(a, "/a%20b/c:d@e%3Ff"));
+    
+    a = a_(a_url_encode(a_new("/a b/c:d@e?f"), a_url_query));
+    ASSERT_EQUAL(0, strcmp(a, "/a%20b/c:d@e?f"));
+    
+    a = a_(a_url_encode(a_new("hello world and all"), a_url_form));
+    ASSERT_EQUAL(0, strcmp(a, "hello+world+and+all"));
+    
+    a = a_(a_url_encode(a_new("x=1 & y=Ⓐ"), a_url_form));
+    ASSERT_EQUAL(0, strcmp(a, "x%3D1+%26+y%3D%E2%92%B6"));
+    
+    a_gc_done();
+}
+
+CTEST(URL, check_decode)
+{ 
+    a_str a;
+    a_gc;
+    
+    a = a_(a_url_decode(a_new("a%20b%26c%3dd%2F%C3%A9+"), a_url_component));
+    ASSERT_EQUAL(0, strcmp(a, "a b&c=d/é+"));
+    ASSERT_EQUAL(10, a_len(a));
+    
+    a = a_(a_url_decode(a_new("x%3D1+%26+y%3D%E2%92%B6"), a_url_form | a_url_validate));
+    ASSERT_EQUAL(0, strcmp(a, "x=1 & y=Ⓐ"));
+    ASSERT_EQUAL(9, a_len(a));
+    
+    a = a_(a_url_decode(a_new("100% bad %zz %4"), a_url_component | a_url_validate));
+    ASSERT_EQUAL(0, strcmp(a, "100% bad %zz %4"));
+    
+    a = a_url_decode(a_new("bad %C3%28 utf-8"), a_url_component | a_url_validate);
+    ASSERT_TRUE(a == NULL);
+    
+    a = a_url_decode(a_new("truncated %E2%92"), a_url_component | a_url_validate);
+    ASSERT_TRUE(a == NULL);
+    
+    a = a_(a_url_decode(a_url_encode(a_new("Ⓐ b/😀?&"), a_url_form), a_url_form | a_url_validate));
+    ASSERT_EQUAL(0, strcmp(a, "Ⓐ b/😀?&"));
+    
+    a_gc_done();
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (davidschor@zigwap.com), ZigWap LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ctest.h"
+#include "aleph.h"
+#include <stdio.h>
+
+CTEST(Formatting, check_format_basic)
+{ 
+    a_str a;
+    char b[128];
+    a_gc;
+    
+    a = a_(a_format(a_new("old"), "%d|%5d|%-5d|%05d|%+d|% d|%.3d", 42, -42, 42, -42, 42, 42, 7));
+    snprintf(b, sizeof b, "%d|%5d|%-5d|%05d|%+d|% d|%.3d", 42, -42, 42, -42, 42, 42, 7);
+    ASSERT_STR(b, a);
+    ASSERT_EQUAL(strlen(b), a_len(a));
+    
+    a = a_(a_format(a_new(""), "%u %lu %llu %zu %hhu %x %#X %o %#o %#x %%", 3000000000u,
+                    (unsigned long)-1, (unsigned long long)-1, (size_t)12345, 300, 255, 255, 8, 8, 0));
+    snprintf(b, sizeof b, "%u %lu %llu %zu %hhu %x %#X %o %#o %#x %%", 3000000000u,
+             (unsigned long)-1, (unsigned long long)-1, (size_t)12345, (unsigned char)300, 255, 255, 8, 8, 0);
+    ASSERT_STR(b, a);
+    
+    a = a_(a_format(a_new(""), "%*d|%-*d|%.*d|%ld|%lld", 6, 1, -6, 2, 4, 3, -9223372036854775807L - 1, 123456789012345LL));
+    snprintf(b, sizeof b, "%*d|%-*d|%.*d|%ld|%lld", 6, 1, -6, 2, 4, 3, -9223372036854775807L - 1, 123456789012345LL);
+    ASSERT_STR(b, a);
+    
+    a = a_(a_format(a_new(""), "%f %.2f %10.3e %-10g| %+g %08.2f %G %.0f %#.0f %a", 3.14159, 2.5, 12345.678, 0.0001,
+                    1.5, -3.14159, 1e20, 2.5, 2.0, 1.0));
+    snprintf(b, sizeof b, "%f %.2f %10.3e %-10g| %+g %08.2f %G %.0f %#.0f %a", 3.14159, 2.5, 12345.678, 0.0001,
+             1.5, -3.14159, 1e20, 2.5, 2.0, 1.0);
+    ASSERT_STR(b, a);
+    ASSERT_EQUAL(strlen(b), a_len(a));
+    
+    a = a_(a_format(a_new(""), "%.400f", 1.0));
+    ASSERT_EQUAL(402, a_size(a));
+    
+    a = a_(a_format(a_new(""), "[%c%5c%-3c]", 'a', 'b', 'c'));
+    ASSERT_STR("[a    bc  ]", a);
+    
+    a_gc_done();
+}
+
+CTEST(Formatting, check_format_strings)
+{ 
+    a_str a, s;
+    a_gc;
+    
+    s = a_(a_new("ⒶⒷⒸ"));
+    a = a_(a_format(a_new(""), "[%s][%5s][%-5s][%.2s][%S][%.1S][%C]", "ⒶⒷ", "ⒶⒷ", "ⒶⒷ", "ⒶⒷⒸ", s, s, 0x24B6));
+    ASSERT_STR("[ⒶⒷ][   ⒶⒷ][ⒶⒷ   ][ⒶⒷ][ⒶⒷⒸ][Ⓐ][Ⓐ]", a);
+    ASSERT_EQUAL(a_len_cstr(a), a_len(a));
+    
+    /* e + combining acute is a single grapheme */
+    a = a_(a_format(a_new(""), "[%#4s][%4s][%#.1s]", "e\xCC\x81", "e\xCC\x81", "e\xCC\x81x"));
+    ASSERT_STR("[   e\xCC\x81][  e\xCC\x81][e\xCC\x81]", a);
+    ASSERT_EQUAL(a_len_cstr(a), a_len(a));
+    
+    a = a_(a_cat_format(a_new("log: "), "%s=%S%s", "key", s, "!"));
+    ASSERT_STR("log: key=ⒶⒷⒸ!", a);
+    ASSERT_EQUAL(13, a_len(a));
+    
+    a = a_(a_format(a_new(""), "100%! %s", "done"));
+    ASSERT_STR("100%! done", a);
+    
+    a_gc_done();
+}
+
+CTEST(Formatting, check_fmt_compiled)
+{ 
+    a_str a;
+    a_fmt fmt;
+    int i;
+    a_gc;
+    
+    fmt = a_fmt_new("[Ⓐ %s:%04d %.1f%%]");
+    a = a_new("");
+    for (i = 0; i < 3; ++i)
+        a = a_cat_fmt(a, fmt, "id", i, i / 2.0);
+    a_(a);
+    ASSERT_STR("[Ⓐ id:0000 0.0%][Ⓐ id:0001 0.5%][Ⓐ id:0002 1.0%]", a);
+    ASSERT_EQUAL(a_len_cstr(a), a_len(a));
+    a_fmt_free(fmt);
+    
+    fmt = a_fmt_new("no conversions at 100%");
+    a = a_(a_cat_fmt(a_new(""), fmt));
+    ASSERT_STR("no conversions at 100%", a);
+    a_fmt_free(fmt);
+    
+    a_gc_done();
+}
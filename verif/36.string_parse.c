@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (davidschor@zigwap.com), ZigWap LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include <unistd.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <stdio.h>
+#include "ctest.h"
+#include "aleph.h"
+
+CTEST(Parsing, check_parse_long)
+{
+    long v;
+    unsigned long u;
+    char b[64];
+    
+    ASSERT_EQUAL(3, a_parse_long("123abc", 6, &v));
+    ASSERT_EQUAL(123, v);
+    ASSERT_EQUAL(4, a_parse_long("-042", 4, &v));
+    ASSERT_EQUAL(-42, v);
+    ASSERT_EQUAL(2, a_parse_long("+7 ", 3, &v));
+    ASSERT_EQUAL(7, v);
+    ASSERT_EQUAL(0, a_parse_long("-x", 2, &v));
+    ASSERT_EQUAL(0, a_parse_long("", 0, &v));
+    /* size limits the input */
+    ASSERT_EQUAL(2, a_parse_long("12345", 2, &v));
+    ASSERT_EQUAL(12, v);
+    /* long runs go through the 8 digit path */
+    ASSERT_EQUAL(17, a_parse_long("00000000123456789x", 18, &v));
+    ASSERT_EQUAL(123456789, v);
+    ASSERT_EQUAL(11, a_parse_long("-1234567890", 11, &v));
+    ASSERT_EQUAL(-1234567890, v);
+    
+    snprintf(b, sizeof b, "%ld", LONG_MAX);
+    ASSERT_EQUAL(strlen(b), a_parse_long(b, strlen(b), &v));
+    ASSERT_TRUE(v == LONG_MAX);
+    snprintf(b, sizeof b, "%ld", LONG_MIN);
+    ASSERT_EQUAL(strlen(b), a_parse_long(b, strlen(b), &v));
+    ASSERT_TRUE(v == LONG_MIN);
+    snprintf(b, sizeof b, "%lu", ULONG_MAX);
+    ASSERT_EQUAL(strlen(b), a_parse_ulong(b, strlen(b), &u));
+    ASSERT_TRUE(u == ULONG_MAX);
+    
+    /* overflow */
+    ASSERT_TRUE(a_parse_long(b, strlen(b), &v) == A_EOS);
+    ASSERT_TRUE(v == LONG_MAX);
+    ASSERT_TRUE(a_parse_long("-99999999999999999999999", 24, &v) == A_EOS);
+    ASSERT_TRUE(v == LONG_MIN);
+    ASSERT_TRUE(a_parse_ulong("99999999999999999999999", 23, &u) == A_EOS);
+    ASSERT_TRUE(u == ULONG_MAX);
+    ASSERT_EQUAL(0, a_parse_ulong("-1", 2, &u));
+}
+
+CTEST(Parsing, check_parse_digits)
+{
+    long v;
+    const char *s;
+    
+    /* Arabic-Indic ١٢٣ */
+    s = "\xd9\xa1\xd9\xa2\xd9\xa3";
+    ASSERT_EQUAL(6, a_parse_long(s, strlen(s), &v));
+    ASSERT_EQUAL(123, v);
+    /* fullwidth -９０ */
+    s = "-\xef\xbc\x99\xef\xbc\x90!";
+    ASSERT_EQUAL(7, a_parse_long(s, strlen(s), &v));
+    ASSERT_EQUAL(-90, v);
+    /* mathematical bold 𝟒𝟐 */
+    s = "\xf0\x9d\x9f\x92\xf0\x9d\x9f\x90";
+    ASSERT_EQUAL(8, a_parse_long(s, strlen(s), &v));
+    ASSERT_EQUAL(42, v);
+    /* mixing sets stops the number */
+    s = "1\xd9\xa2";
+    ASSERT_EQUAL(1, a_parse_long(s, strlen(s), &v));
+    ASSERT_EQUAL(1, v);
+    s = "\xd9\xa1" "2";
+    ASSERT_EQUAL(2, a_parse_long(s, strlen(s), &v));
+    ASSERT_EQUAL(1, v);
+    /* truncated sequence */
+    ASSERT_EQUAL(0, a_parse_long(s, 1, &v));
+    /* not a digit: Arabic letter alef */
+    ASSERT_EQUAL(0, a_parse_long("\xd8\xa7", 2, &v));
+}
+
+CTEST(Parsing, check_parse_double)
+{
+    double d;
+    const char *s;
+    char b[64];
+    size_t i;
+    a_str a;
+    a_gc;
+    
+    ASSERT_EQUAL(3, a_parse_double("1.5x", 4, &d));
+    ASSERT_TRUE(d == 1.5);
+    ASSERT_EQUAL(6, a_parse_double("-.25e1", 6, &d));
+    ASSERT_TRUE(d == -2.5);
+    ASSERT_EQUAL(2, a_parse_double("3.e", 3, &d));
+    ASSERT_TRUE(d == 3);
+    ASSERT_EQUAL(1, a_parse_double("7e+", 3, &d));
+    ASSERT_TRUE(d == 7);
+    ASSERT_EQUAL(0, a_parse_double(".", 1, &d));
+    ASSERT_EQUAL(0, a_parse_double("-e5", 3, &d));
+    ASSERT_EQUAL(3, a_parse_double("0.0", 3, &d));
+    ASSERT_TRUE(d == 0);
+    ASSERT_EQUAL(8, a_parse_double("Infinity", 8, &d));
+    ASSERT_TRUE(d > 1e308);
+    ASSERT_EQUAL(4, a_parse_double("-inf", 4, &d));
+    ASSERT_TRUE(d < -1e308);
+    ASSERT_EQUAL(3, a_parse_double("NaN", 3, &d));
+    ASSERT_TRUE(d != d);
+    
+    /* Arabic-Indic ١.٥ */
+    s = "\xd9\xa1.\xd9\xa5";
+    ASSERT_EQUAL(5, a_parse_double(s, strlen(s), &d));
+    ASSERT_TRUE(d == 1.5);
+    
+    /* slow path against strtod */
+    {
+        static const char *const tests[] = {
+            "2.2250738585072011e-308", "4.9406564584124654e-324", "1.7976931348623157e308",
+            "1e400", "1e-400", "123456789012345678901234567890", "0.1", "9007199254740993",
+            "1.00000000000000011102230246251565404236316680908203125",
+            "1.00000000000000011102230246251565404236316680908203124",
+            "1.00000000000000011102230246251565404236316680908203126",
+        };
+        for (i = 0; i < sizeof tests / sizeof *tests; ++i)
+        {
+            ASSERT_EQUAL(strlen(tests[i]), a_parse_double(tests[i], strlen(tests[i]), &d));
+            ASSERT_TRUE(d == strtod(tests[i], NULL));
+        }
+    }
+    
+    /* more than the maximum number of digits still rounds right */
+    a = a_new("9007199254740993");
+    for (i = 0; i < 1000; ++i)
+        a = a_cat_cstr(a, "0");
+    a = a_(a_cat_cstr(a, "1e-1001"));
+    ASSERT_EQUAL(a_size(a), a_parse_double(a, a_size(a), &d));
+    ASSERT_TRUE(d == 9007199254740994.0);
+    
+    /* round trips */
+    for (i = 0; i < 1000; ++i)
+    {
+        double x = (double)rand() / RAND_MAX;
+        size_t j;
+        
+        for (j = 0; j < i % 40; ++j)
+            x *= i & 1 ? 10 : 0.1;
+        snprintf(b, sizeof b, "%.17g", x);
+        ASSERT_EQUAL(strlen(b), a_parse_double(b, strlen(b), &d));
+        ASSERT_TRUE(d == x);
+    }
+    
+    a_gc_done();
+}
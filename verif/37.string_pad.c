@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (davidschor@zigwap.com), ZigWap LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include <unistd.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ctest.h"
+#include "aleph.h"
+
+CTEST(Padding, check_pad)
+{ 
+    a_str a;
+    a_gc;
+    
+    a = a_(a_pad_left(a_new("abc"), 6, " ", a_pad_cp));
+    ASSERT_STR("   abc", a);
+    ASSERT_EQUAL(6, a_len(a));
+    ASSERT_EQUAL(6, a_size(a));
+    
+    a = a_(a_pad_right(a_new("abc"), 5, ".", a_pad_cp));
+    ASSERT_STR("abc..", a);
+    
+    a = a_(a_pad_left(a_new("abcdef"), 3, " ", a_pad_cp));
+    ASSERT_STR("abcdef", a);
+    
+    a = a_(a_center(a_new("ab"), 7, "*", a_pad_cp));
+    ASSERT_STR("**ab***", a);
+    
+    /* multi-byte fill and string */
+    a = a_(a_pad_left(a_new("\xc3\xa9t\xc3\xa9"), 5, "\xe2\x80\xa2", a_pad_cp));
+    ASSERT_STR("\xe2\x80\xa2\xe2\x80\xa2\xc3\xa9t\xc3\xa9", a);
+    ASSERT_EQUAL(5, a_len(a));
+    ASSERT_EQUAL(11, a_size(a));
+    
+    /* e + combining acute is one grapheme */
+    a = a_(a_pad_right(a_new("e\xcc\x81"), 3, "-", a_pad_grapheme));
+    ASSERT_STR("e\xcc\x81--", a);
+    a = a_(a_pad_right(a_new("e\xcc\x81"), 3, "-", a_pad_cp));
+    ASSERT_STR("e\xcc\x81-", a);
+    
+    /* long fills go through the doubling copy */
+    a = a_(a_pad_left(a_new("x"), 1000, "0", a_pad_cp));
+    ASSERT_EQUAL(1000, a_len(a));
+    ASSERT_EQUAL('0', a[998]);
+    ASSERT_EQUAL('x', a[999]);
+    ASSERT_EQUAL(999, strspn(a, "0"));
+    
+    a_gc_done();
+}
+
+CTEST(Padding, check_pad_columns)
+{ 
+    a_str a;
+    a_gc;
+    
+    /* 日本 is 4 columns wide */
+    ASSERT_EQUAL(4, a_width_cstr("\xe6\x97\xa5\xe6\x9c\xac"));
+    ASSERT_EQUAL(3, a_width_cstr("e\xcc\x81\tab"));
+    ASSERT_EQUAL(2, a_width_cstr("\xef\xbc\xa1"));
+    ASSERT_EQUAL(0, a_width_cstr(""));
+    
+    a = a_(a_pad_right(a_new("\xe6\x97\xa5\xe6\x9c\xac"), 6, " ", a_pad_columns));
+    ASSERT_STR("\xe6\x97\xa5\xe6\x9c\xac  ", a);
+    ASSERT_EQUAL(6, a_width(a));
+    
+    /* a wide fill never overshoots */
+    a = a_(a_center(a_new("ab"), 7, "\xe3\x80\x80", a_pad_columns));
+    ASSERT_STR("\xe3\x80\x80" "ab" "\xe3\x80\x80", a);
+    ASSERT_EQUAL(6, a_width(a));
+    
+    a_gc_done();
+}
+
+CTEST(Padding, check_repeat)
+{ 
+    a_str a;
+    a_gc;
+    
+    a = a_(a_repeat(a_new("ab"), 3));
+    ASSERT_STR("ababab", a);
+    ASSERT_EQUAL(6, a_len(a));
+    
+    a = a_(a_repeat(a_new("\xc3\xa9-"), 500));
+    ASSERT_EQUAL(1000, a_len(a));
+    ASSERT_EQUAL(1500, a_size(a));
+    ASSERT_TRUE(!memcmp(a + 1497, "\xc3\xa9-", 3));
+    
+    a = a_(a_repeat(a_new("ab"), 0));
+    ASSERT_STR("", a);
+    a = a_(a_repeat(a_new(""), 10));
+    ASSERT_STR("", a);
+    
+    a = a_(a_new_cp(0x263A, 100));
+    ASSERT_EQUAL(100, a_len(a));
+    ASSERT_EQUAL(300, a_size(a));
+    ASSERT_TRUE(!memcmp(a + 297, "\xe2\x98\xba", 3));
+    
+    a_gc_done();
+}
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (davidschor@zigwap.com), ZigWap LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include <unistd.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "ctest.h"
+#include "aleph.h"
+
+static void write_file(const char *path, const char *s, size_t size)
+{
+    FILE *fp = fopen(path, "wb");
+    fwrite(s, 1, size, fp);
+    fclose(fp);
+}
+
+CTEST(IO, check_file_read)
+{
+    char path[] = "/tmp/aleph_verif_XXXXXX";
+    FILE *fp;
+    a_str a;
+    a_gc;
+    
+    close(mkstemp(path));
+    write_file(path, "h\xc3\xa9llo\nw\xc3\xb6rld\n", 14);
+    
+    fp = fopen(path, "rb");
+    a = a_(a_file_read(fp));
+    fclose(fp);
+    ASSERT_STR("h\xc3\xa9llo\nw\xc3\xb6rld\n", a);
+    ASSERT_EQUAL(14, a_size(a));
+    ASSERT_EQUAL(12, a_len(a));
+    
+    /* from the current position on */
+    fp = fopen(path, "rb");
+    fseek(fp, 7, SEEK_SET);
+    a = a_(a_file_read(fp));
+    fclose(fp);
+    ASSERT_STR("w\xc3\xb6rld\n", a);
+    
+    unlink(path);
+    
+    a_gc_done();
+}
+
+CTEST(IO, check_file_readline)
+{
+    char path[] = "/tmp/aleph_verif_XXXXXX";
+    const char *delims[] = { "\n", "\r\n", "\xe2\x80\xa8" };
+    FILE *fp;
+    a_reader r;
+    a_str a, line, big;
+    size_t i, d, n;
+    a_gc;
+    
+    close(mkstemp(path));
+    write_file(path, "one\ntw\xc3\xb6\n\nlast", 14);
+    
+    fp = fopen(path, "rb");
+    a = a_(a_file_readline(fp));
+    ASSERT_STR("one", a);
+    line = a_file_readline_delim_str(fp, "\n", NULL);
+    ASSERT_STR("tw\xc3\xb6", line);
+    ASSERT_EQUAL(3, a_len(line));
+    line = a_file_readline_delim_str(fp, "\n", line);
+    ASSERT_STR("", line);
+    line = a_file_readline_delim_str(fp, "\n", line);
+    ASSERT_STR("last", line);
+    ASSERT_NULL(a_file_readline_delim_str(fp, "\n", line));
+    fclose(fp);
+    
+    /* lines spanning reader buffers, single and multi-byte delimiters */
+    for (d = 0; d < sizeof delims / sizeof *delims; ++d)
+    {
+        big = a_new_mem(0);
+        for (i = 0; i < 20000; ++i)
+        {
+            big = a_cat_ulong(big, i);
+            big = a_cat_cstr(big, i % 7 ? "\xc3\xa9" : "");
+            big = a_cat_cstr(big, delims[d]);
+        }
+        write_file(path, big, a_size(big));
+        a_free(big);
+        
+        fp = fopen(path, "rb");
+        r = a_reader_new(fp);
+        line = NULL;
+        for (n = 0; (line = a_reader_line(r, delims[d], line)); ++n)
+        {
+            char b[32];
+            sprintf(b, "%lu%s", (unsigned long)n, n % 7 ? "\xc3\xa9" : "");
+            ASSERT_STR(b, line);
+            ASSERT_EQUAL(a_len_cstr(b), a_len(line));
+        }
+        ASSERT_EQUAL(20000, n);
+        a_reader_free(r);
+        fclose(fp);
+    }
+    
+    /* no trailing delimiter, delimiter split at the end */
+    write_file(path, "a\r\nb\r", 6);
+    fp = fopen(path, "rb");
+    r = a_reader_new(fp);
+    line = a_reader_line(r, "\r\n", NULL);
+    ASSERT_STR("a", line);
+    line = a_reader_line(r, "\r\n", line);
+    ASSERT_STR("b\r", line);
+    ASSERT_NULL(a_reader_line(r, "\r\n", line));
+    a_reader_free(r);
+    fclose(fp);
+    
+    unlink(path);
+    
+    a_gc_done();
+}
+
+CTEST(IO, check_file_map)
+{
+    char path[] = "/tmp/aleph_verif_XXXXXX";
+    a_cstr m;
+    a_str a, big;
+    size_t i;
+    a_gc;
+    
+    close(mkstemp(path));
+    write_file(path, "abc \xe2\x82\xac def", 11);
+    
+    m = a_file_map(path, a_file_map_validate);
+    ASSERT_NOT_NULL(m);
+    ASSERT_STR("abc \xe2\x82\xac def", m);
+    ASSERT_EQUAL(11, a_size(m));
+    ASSERT_EQUAL(9, a_len(m));
+    
+    /* read-only use, copies are regular strings */
+    a = a_(a_substr(m, 4, 1));
+    ASSERT_STR("\xe2\x82\xac", a);
+    a = a_new_dup(m);
+    ASSERT_EQUAL(9, a_len(a));
+    a = a_(a_cat_str(a, (a_str)m));
+    ASSERT_EQUAL(18, a_len(a));
+    a_file_unmap(m);
+    
+    /* inserting a mapped string that hasn't been counted yet */
+    m = a_file_map(path, 0);
+    a = a_ins(a_new("<>"), m, 1);
+    ASSERT_EQUAL(11, a_len(a));
+    ASSERT_STR("<abc \xe2\x82\xac def>", a);
+    a_free(a);
+    a_file_unmap(m);
+    
+    /* reversing one, then appending to the result */
+    m = a_file_map(path, 0);
+    a = a_cat_cstr(a_reverse_str(m, a_new("")), "x");
+    ASSERT_EQUAL(10, a_len(a));
+    ASSERT_STR("fed \xe2\x82\xac cbax", a);
+    a_free(a);
+    a_file_unmap(m);
+    m = a_file_map(path, 0);
+    a = a_cat_cstr(a_greverse_str(m, a_new("")), "x");
+    ASSERT_EQUAL(10, a_len(a));
+    a_free(a);
+    a_file_unmap(m);
+    
+    /* validation */
+    write_file(path, "ab\xff", 3);
+    ASSERT_NULL(a_file_map(path, a_file_map_validate));
+    m = a_file_map(path, a_file_map_no_options);
+    ASSERT_NOT_NULL(m);
+    ASSERT_EQUAL(3, a_size(m));
+    a_free((a_str)m);
+    
+    /* empty file */
+    write_file(path, "", 0);
+    m = a_file_map(path, 0);
+    ASSERT_STR("", m);
+    ASSERT_EQUAL(0, a_len(m));
+    a_file_unmap(m);
+    
+    /* a whole number of pages still ends with a NUL */
+    big = a_new_mem(0);
+    for (i = 0; i < 8192; ++i)
+        big = a_cat_cstr(big, "x");
+    big = a_(big);
+    write_file(path, big, a_size(big));
+    m = a_file_map(path, 0);
+    ASSERT_EQUAL(8192, strlen(m));
+    ASSERT_EQUAL(8192, a_len(m));
+    a_file_unmap(m);
+    
+    ASSERT_NULL(a_file_map("/nonexistent/aleph", 0));
+    unlink(path);
+    
+    a_gc_done();
+}
+
+CTEST(IO, check_write_vec)
+{
+    char path[] = "/tmp/aleph_verif_XXXXXX";
+    a_str parts[300], expect, got, big;
+    const char *ptrs[3] = { "ab", "", "cde" };
+    size_t sizes[3] = { 2, 0, 3 }, i;
+    a_writer w;
+    FILE *fp;
+    int fd;
+    a_gc;
+    
+    fd = mkstemp(path);
+    expect = a_new_mem(0);
+    for (i = 0; i < 300; ++i)
+    {
+        parts[i] = a_new_ulong(i * 7919);
+        parts[i] = a_(a_cat_cstr(parts[i], i % 3 ? "," : ""));
+        expect = a_cat_str(expect, parts[i]);
+    }
+    /* more pieces than a single batch */
+    ASSERT_TRUE(a_write_vec(fd, (const a_cstr*)parts, 300));
+    ASSERT_TRUE(a_write_size_vec(fd, ptrs, sizes, 3));
+    expect = a_cat_cstr(expect, "abcde");
+    
+    /* buffered, with pieces bigger than what gets copied */
+    big = a_(a_new_chr("x", A_WRITER_SIZE / 4));
+    w = a_writer_new(fd);
+    for (i = 0; i < 2000; ++i)
+    {
+        ASSERT_TRUE(a_writer_put(w, parts[i % 300]));
+        expect = a_cat_str(expect, parts[i % 300]);
+        if (i % 500 == 0)
+        {
+            ASSERT_TRUE(a_writer_put(w, big));
+            expect = a_cat_str(expect, big);
+        }
+    }
+    ASSERT_TRUE(a_writer_put_cstr(w, "end"));
+    expect = a_(a_cat_cstr(expect, "end"));
+    ASSERT_TRUE(a_writer_free(w));
+    close(fd);
+    
+    fp = fopen(path, "rb");
+    got = a_(a_file_read(fp));
+    fclose(fp);
+    ASSERT_EQUAL(a_size(expect), a_size(got));
+    ASSERT_STR(expect, got);
+    unlink(path);
+    
+    a_gc_done();
+}
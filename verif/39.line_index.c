@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (davidschor@zigwap.com), ZigWap LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include <unistd.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "ctest.h"
+#include "aleph.h"
+
+/* lines of random lengths, every starting offset recorded */
+static char *make_text(size_t size, size_t **starts, size_t *lines)
+{
+    char *s = malloc(size);
+    size_t i, n = 0;
+    
+    *starts = malloc((size + 1) * sizeof **starts);
+    (*starts)[n++] = 0;
+    srand(42);
+    for (i = 0; i < size; ++i)
+    {
+        s[i] = rand() % 40 ? 'a' + i % 26 : '\n';
+        if (s[i] == '\n' && i + 1 < size)
+            (*starts)[n++] = i + 1;
+    }
+    *lines = size ? n : 0;
+    return s;
+}
+
+CTEST(Lines, check_line_count)
+{
+    size_t *starts, lines;
+    char *s;
+    
+    ASSERT_EQUAL(0, a_line_count("", 0));
+    ASSERT_EQUAL(1, a_line_count("a", 1));
+    ASSERT_EQUAL(1, a_line_count("a\n", 2));
+    ASSERT_EQUAL(2, a_line_count("a\n\n", 3));
+    ASSERT_EQUAL(3, a_line_count("\n\nb", 3));
+    
+    /* large enough to be split across threads */
+    s = make_text(24 * 1024 * 1024 + 13, &starts, &lines);
+    ASSERT_EQUAL(lines, a_line_count(s, 24 * 1024 * 1024 + 13));
+    s[24 * 1024 * 1024 + 12] = '\n';
+    ASSERT_EQUAL(lines, a_line_count(s, 24 * 1024 * 1024 + 13));
+    free(s);
+    free(starts);
+}
+
+CTEST(Lines, check_line_index)
+{
+    const size_t size = 20 * 1024 * 1024 + 7;
+    char path[] = "/tmp/aleph_verif_XXXXXX";
+    size_t *starts, lines, i, every;
+    a_line_index idx, idx2;
+    FILE *fp;
+    char *s;
+    
+    s = make_text(size, &starts, &lines);
+    for (every = 1; every <= 1000; every *= 10)
+    {
+        idx = a_line_index_new(s, size, every);
+        ASSERT_EQUAL(lines, a_line_index_lines(idx));
+        for (i = 0; i < lines; i += 1 + rand() % 997)
+            ASSERT_EQUAL(starts[i], a_line_index_offset(idx, s, i));
+        ASSERT_EQUAL(starts[lines - 1], a_line_index_offset(idx, s, lines - 1));
+        ASSERT_TRUE(a_line_index_offset(idx, s, lines) == A_EOS);
+        a_line_index_free(idx);
+    }
+    
+    /* persisted */
+    idx = a_line_index_new(s, size, 64);
+    close(mkstemp(path));
+    fp = fopen(path, "wb");
+    ASSERT_TRUE(a_line_index_write(idx, fp));
+    fclose(fp);
+    fp = fopen(path, "rb");
+    ASSERT_NULL(a_line_index_read(fp, size - 1));
+    rewind(fp);
+    idx2 = a_line_index_read(fp, size);
+    fclose(fp);
+    ASSERT_NOT_NULL(idx2);
+    ASSERT_EQUAL(lines, a_line_index_lines(idx2));
+    ASSERT_EQUAL(starts[12345], a_line_index_offset(idx2, s, 12345));
+    a_line_index_free(idx2);
+    a_line_index_free(idx);
+    
+    /* a_file_line_count, from the current position */
+    fp = fopen(path, "wb");
+    fwrite(s, 1, size, fp);
+    fclose(fp);
+    fp = fopen(path, "rb");
+    ASSERT_EQUAL(lines, a_file_line_count(fp));
+    fseek(fp, (long)starts[100], SEEK_SET);
+    ASSERT_EQUAL(lines - 100, a_file_line_count(fp));
+    fclose(fp);
+    
+    unlink(path);
+    free(s);
+    free(starts);
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (davidschor@zigwap.com), ZigWap LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include <unistd.h>
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "ctest.h"
+#include "aleph.h"
+
+static a_str read_as(const char *path, const char *s, size_t size, int *enc)
+{
+    FILE *fp = fopen(path, "wb");
+    a_str str;
+    
+    fwrite(s, 1, size, fp);
+    fclose(fp);
+    fp = fopen(path, "rb");
+    str = a_file_read_enc(fp, enc);
+    fclose(fp);
+    return str;
+}
+
+/* "hé\U0001F600\n" in every encoding */
+CTEST(Encoding, check_file_read_enc)
+{
+    char path[] = "/tmp/aleph_verif_XXXXXX";
+    const char *expect = "h\xc3\xa9\xf0\x9f\x98\x80\n";
+    a_str a;
+    int enc;
+    a_gc;
+    
+    close(mkstemp(path));
+    
+    enc = a_encoding_detect;
+    a = a_(read_as(path, "\xef\xbb\xbfh\xc3\xa9\xf0\x9f\x98\x80\n", 11, &enc));
+    ASSERT_STR(expect, a);
+    ASSERT_EQUAL(4, a_len(a));
+    ASSERT_EQUAL(a_encoding_utf8, enc);
+    
+    enc = a_encoding_detect;
+    a = a_(read_as(path, "\xff\xfeh\0\xe9\0\x3d\xd8\x00\xde\n\0", 12, &enc));
+    ASSERT_STR(expect, a);
+    ASSERT_EQUAL(4, a_len(a));
+    ASSERT_EQUAL(a_encoding_utf16le, enc);
+    
+    /* no BOM, guessed from the zero bytes */
+    enc = a_encoding_detect;
+    a = a_(read_as(path, "\0h\0\xe9\xd8\x3d\xde\x00\0\n", 10, &enc));
+    ASSERT_STR(expect, a);
+    ASSERT_EQUAL(a_encoding_utf16be, enc);
+    
+    enc = a_encoding_detect;
+    a = a_(read_as(path, "caf\xe9 \xb5", 6, &enc));
+    ASSERT_STR("caf\xc3\xa9 \xc2\xb5", a);
+    ASSERT_EQUAL(6, a_len(a));
+    ASSERT_EQUAL(a_encoding_latin1, enc);
+    
+    /* forced encoding, invalid input replaced */
+    enc = a_encoding_utf8;
+    a = a_(read_as(path, "a\xff" "b\xe2\x82", 5, &enc));
+    ASSERT_STR("a\xef\xbf\xbd" "b\xef\xbf\xbd\xef\xbf\xbd", a);
+    ASSERT_EQUAL(a_encoding_utf8, enc);
+    ASSERT_EQUAL(5, a_len(a));
+    
+    /* lone surrogate, odd trailing byte */
+    enc = a_encoding_utf16le;
+    a = a_(read_as(path, "\x00\xd8x\0y", 5, &enc));
+    ASSERT_STR("\xef\xbf\xbdx\xef\xbf\xbd", a);
+    
+    a = a_(read_as(path, "", 0, NULL));
+    ASSERT_STR("", a);
+    
+    unlink(path);
+    
+    a_gc_done();
+}
+
+CTEST(Encoding, check_reader_enc)
+{
+    char path[] = "/tmp/aleph_verif_XXXXXX";
+    char *raw, b[32];
+    size_t i, j, n = 0, len = 0;
+    a_reader r;
+    a_str line, a;
+    FILE *fp;
+    a_gc;
+    
+    /* UTF-16BE lines big enough to cut surrogates across blocks */
+    close(mkstemp(path));
+    raw = malloc(1 << 21);
+    raw[n++] = '\xfe', raw[n++] = '\xff';
+    for (i = 0; i < 30000; ++i)
+    {
+        sprintf(b, "%lu", (unsigned long)i);
+        for (j = 0; b[j]; ++j)
+            raw[n++] = 0, raw[n++] = b[j];
+        len += j + 2;
+        raw[n++] = '\xd8', raw[n++] = '\x3d', raw[n++] = '\xde', raw[n++] = '\x00';
+        raw[n++] = 0, raw[n++] = '\n';
+    }
+    fp = fopen(path, "wb");
+    fwrite(raw, 1, n, fp);
+    fclose(fp);
+    
+    fp = fopen(path, "rb");
+    r = a_reader_new_enc(fp, a_encoding_detect);
+    ASSERT_EQUAL(a_encoding_utf16be, a_reader_encoding(r));
+    line = NULL;
+    for (i = 0; (line = a_reader_line(r, "\n", line)); ++i)
+    {
+        sprintf(b, "%lu\xf0\x9f\x98\x80", (unsigned long)i);
+        ASSERT_STR(b, line);
+        ASSERT_EQUAL(a_len_cstr(b), a_len(line));
+    }
+    ASSERT_EQUAL(30000, i);
+    a_reader_free(r);
+    fclose(fp);
+    
+    /* and the same file read whole */
+    fp = fopen(path, "rb");
+    a = a_(a_file_read_enc(fp, NULL));
+    fclose(fp);
+    ASSERT_EQUAL(len, a_len(a));
+    ASSERT_EQUAL(len, a_len_cstr(a));
+    ASSERT_TRUE(!memcmp(a, "0\xf0\x9f\x98\x80\n1\xf0\x9f\x98\x80\n", 12));
+    
+    free(raw);
+    unlink(path);
+    
+    a_gc_done();
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (davidschor@zigwap.com), ZigWap LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "ctest.h"
+#include "aleph.h"
+
+/* mixed 1 to 4 byte characters, escapes and repeats */
+static a_str make_text(size_t count)
+{
+    static const char *const pieces[] = {
+        "a", "aa", "Ab", "\xc3\xa9", "\xc3\x89", "\xe2\x82\xac", "\xf0\x9f\x98\x80", "\n", "\"", "\\",
+        "\xc3\x9f", "\xce\xa3", "x",
+    };
+    a_str s = a_new("");
+    size_t i;
+    
+    srand(7);
+    for (i = 0; i < count && s; ++i)
+        s = a_cat_cstr(s, pieces[rand() % (sizeof pieces / sizeof *pieces)]);
+    return s;
+}
+
+/* runs with 4 threads given 4 KiB or more each, against a single thread */
+#define SPLIT() a_threads_set(4, 4096)
+#define NOSPLIT() a_threads_set(1, 0)
+
+CTEST(Parallel, check_len_valid)
+{
+    a_str s = make_text(100000);
+    size_t len, i, at;
+    char c;
+    a_gc;
+    
+    a_(s);
+    NOSPLIT();
+    len = a_len_cstr(s);
+    SPLIT();
+    ASSERT_EQUAL(len, a_len_cstr(s));
+    ASSERT_NULL(a_is_valid_utf8(s));
+    
+    /* the first error is found wherever the chunks are */
+    for (i = 1; i < 40; ++i)
+    {
+        at = a_size(s) / 40 * i;
+        /* the start of a character */
+        while (((unsigned char)s[at] & 0xC0) == 0x80)
+            ++at;
+        c = s[at];
+        s[at] = (char)0xFF;
+        NOSPLIT();
+        ASSERT_TRUE(a_is_valid_utf8(s) == s + at);
+        SPLIT();
+        ASSERT_TRUE(a_is_valid_utf8(s) == s + at);
+        s[at] = c;
+    }
+    ASSERT_NULL(a_is_valid_utf8(s));
+    a_threads_set(0, 0);
+    
+    a_gc_done();
+}
+
+CTEST(Parallel, check_count_find_all)
+{
+    static const char *const subs[] = { "a", "aa", "aaa", "\xc3\xa9", "\xe2\x82\xac" "a", "\n\"", "zz" };
+    a_str s = make_text(100000), r;
+    size_t i, j, n, *a, *b;
+    a_gc;
+    
+    a_(s);
+    for (i = 0; i < sizeof subs / sizeof *subs; ++i)
+    {
+        NOSPLIT();
+        n = a_count_substr_cstr(s, subs[i]);
+        a = malloc((n + 1) * sizeof *a);
+        b = malloc((n + 1) * sizeof *b);
+        ASSERT_EQUAL(n, a_find_all_offset_cstr(s, subs[i], a, n));
+        SPLIT();
+        ASSERT_EQUAL(n, a_count_substr_cstr(s, subs[i]));
+        ASSERT_EQUAL(n, a_find_all_offset_cstr(s, subs[i], b, n));
+        for (j = 0; j < n; ++j)
+            ASSERT_EQUAL(a[j], b[j]);
+        /* fewer offsets than there are */
+        b[n / 2] = A_EOS;
+        ASSERT_EQUAL(n, a_find_all_offset_cstr(s, subs[i], b, n / 2));
+        ASSERT_TRUE(b[n / 2] == A_EOS);
+        free(a);
+        free(b);
+    }
+    
+    /* occurrences running over the chunks */
+    r = a_new_chr("a", 100001);
+    SPLIT();
+    ASSERT_EQUAL(50000, a_count_substr_cstr(r, "aa"));
+    ASSERT_EQUAL(33333, a_count_substr_cstr(r, "aaa"));
+    ASSERT_EQUAL(100001, a_count_cp(r, 'a'));
+    a_free(r);
+    
+    ASSERT_EQUAL(2, a_count_substr_cstr_cstr("aaaa", "aa"));
+    ASSERT_EQUAL(0, a_count_substr_cstr_cstr("aaaa", ""));
+    ASSERT_EQUAL(2, a_count_cstr_cp("\xc3\xa9t\xc3\xa9", 0xE9));
+    a_threads_set(0, 0);
+    
+    a_gc_done();
+}
+
+CTEST(Parallel, check_case_escape)
+{
+    a_str s = make_text(100000), u1, u2, e1, e2;
+    a_gc;
+    
+    a_(s);
+    NOSPLIT();
+    u1 = a_(a_to_upper(a_new_dup(s)));
+    e1 = a_(a_escape(a_new_dup(s)));
+    SPLIT();
+    u2 = a_(a_to_upper(a_new_dup(s)));
+    e2 = a_(a_escape(a_new_dup(s)));
+    ASSERT_STR(u1, u2);
+    ASSERT_EQUAL(a_len(u1), a_len(u2));
+    ASSERT_STR(e1, e2);
+    ASSERT_EQUAL(a_len(e1), a_len(e2));
+    ASSERT_EQUAL(a_len_cstr(e1), a_len(e2));
+    
+    NOSPLIT();
+    u1 = a_(a_to_lower(a_new_dup(s)));
+    e1 = a_(a_escape_opts(a_new_dup(s), NULL, a_escape_json | a_escape_ascii));
+    SPLIT();
+    u2 = a_(a_to_lower(a_new_dup(s)));
+    e2 = a_(a_escape_opts(a_new_dup(s), NULL, a_escape_json | a_escape_ascii));
+    ASSERT_STR(u1, u2);
+    ASSERT_EQUAL(a_len(u1), a_len(u2));
+    ASSERT_STR(e1, e2);
+    ASSERT_EQUAL(a_len(e1), a_len(e2));
+    
+    /* ending in a cut-off sequence */
+    s = a_(a_cat_cstr(a_new_dup(s), "\xf0\x9f"));
+    NOSPLIT();
+    e1 = a_(a_escape_opts(a_new_dup(s), NULL, a_escape_ascii));
+    SPLIT();
+    e2 = a_(a_escape_opts(a_new_dup(s), NULL, a_escape_ascii));
+    ASSERT_STR(e1, e2);
+    ASSERT_EQUAL(a_len(e1), a_len(e2));
+    ASSERT_EQUAL(a_len_cstr(e1), a_len(e2));
+    a_threads_set(0, 0);
+    
+    a_gc_done();
+}
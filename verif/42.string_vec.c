@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (davidschor@zigwap.com), ZigWap LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "ctest.h"
+#include "aleph.h"
+
+#define COUNT 20000
+
+static const char *const words[] = {
+    "", "Hello", "WORLD", "  padded  ", "stra\xc3\x9f" "e", "\xce\xa3\xce\x99\xce\xa3\xce\xa5\xce\xa6\xce\x9f\xce\xa3",
+    "\xc3\x89t\xc3\xa9", "\xf0\x9f\x98\x80 Smile", "\xef\xac\x80", "MiXeD cAsE 123",
+};
+#define NWORDS (sizeof words / sizeof *words)
+
+static a_str *make_vec(void)
+{
+    a_str *v = malloc(COUNT * sizeof *v);
+    size_t i;
+    
+    for (i = 0; i < COUNT; ++i)
+        v[i] = a_new(words[i % NWORDS]);
+    return v;
+}
+static void free_vec(a_str *v)
+{
+    size_t i;
+    
+    for (i = 0; i < COUNT; ++i)
+        a_free(v[i]);
+    free(v);
+}
+
+CTEST(Vector, check_vec_case)
+{
+    a_str *v, s;
+    size_t i, t;
+    
+    for (t = 0; t < 2; ++t)
+    {
+        /* on the calling thread, then split */
+        a_threads_set(t ? 4 : 1, t ? 4096 : 0);
+        
+        v = make_vec();
+        ASSERT_EQUAL(1, a_vec_to_lower(v, COUNT));
+        for (i = 0; i < COUNT; ++i)
+        {
+            s = a_to_lower(a_new(words[i % NWORDS]));
+            ASSERT_STR(s, v[i]);
+            ASSERT_EQUAL(a_len(s), a_len(v[i]));
+            a_free(s);
+        }
+        free_vec(v);
+        
+        v = make_vec();
+        ASSERT_EQUAL(1, a_vec_to_upper(v, COUNT));
+        for (i = 0; i < COUNT; ++i)
+        {
+            s = a_to_upper(a_new(words[i % NWORDS]));
+            ASSERT_STR(s, v[i]);
+            ASSERT_EQUAL(a_size(s), a_size(v[i]));
+            ASSERT_EQUAL(a_len(s), a_len(v[i]));
+            a_free(s);
+        }
+        free_vec(v);
+        
+        v = make_vec();
+        ASSERT_EQUAL(1, a_vec_to_fold(v, COUNT));
+        for (i = 0; i < COUNT; ++i)
+        {
+            s = a_to_fold(a_new(words[i % NWORDS]));
+            ASSERT_STR(s, v[i]);
+            ASSERT_EQUAL(a_len(s), a_len(v[i]));
+            a_free(s);
+        }
+        free_vec(v);
+        
+        v = make_vec();
+        ASSERT_EQUAL(1, a_vec_trim(v, COUNT));
+        ASSERT_STR("padded", v[3]);
+        ASSERT_STR("padded", v[3 + NWORDS * 100]);
+        free_vec(v);
+    }
+    a_threads_set(0, 0);
+    
+    /* growing past the buffer: U+FB00 is 3 bytes, "ff" 2; sharp s 2 bytes, "SS" 2 */
+    v = make_vec();
+    ASSERT_EQUAL(1, a_vec_to_upper(v, NWORDS));
+    ASSERT_STR("STRASSE", v[4]);
+    ASSERT_STR("FF", v[8]);
+    ASSERT_STR("", v[0]);
+    free_vec(v);
+    
+    ASSERT_EQUAL(1, a_vec_to_lower(NULL, 0));
+}
+
+CTEST(Vector, check_vec_validate_hash)
+{
+    a_str *v = make_vec();
+    size_t *offsets = malloc(COUNT * sizeof *offsets), i;
+    unsigned long *hashes = malloc(COUNT * sizeof *hashes);
+    
+    a_threads_set(4, 4096);
+    ASSERT_EQUAL(0, a_vec_validate(v, COUNT, offsets));
+    ASSERT_TRUE(offsets[0] == A_EOS && offsets[COUNT - 1] == A_EOS);
+    v[4][5] = (char)0xC3;   /* stra\xc3\xc3e */
+    v[7 + NWORDS][1] = 'x'; /* broken emoji */
+    ASSERT_EQUAL(2, a_vec_validate(v, COUNT, offsets));
+    ASSERT_EQUAL(4, offsets[4]);
+    ASSERT_EQUAL(0, offsets[7 + NWORDS]);
+    ASSERT_TRUE(offsets[7] == A_EOS);
+    ASSERT_EQUAL(2, a_vec_validate(v, COUNT, NULL));
+    
+    a_vec_hash(v, COUNT, hashes);
+    for (i = 0; i < COUNT; ++i)
+        ASSERT_TRUE(hashes[i] == a_hash(v[i]));
+    ASSERT_TRUE(hashes[1] == hashes[1 + NWORDS]);
+    ASSERT_TRUE(hashes[1] != hashes[2]);
+    if (sizeof (unsigned long) == 8)
+        ASSERT_TRUE(hashes[0] == 0xcbf29ce484222325UL);
+    else
+        ASSERT_TRUE(hashes[0] == 0x811c9dc5UL);
+    a_threads_set(0, 0);
+    
+    free(offsets);
+    free(hashes);
+    free_vec(v);
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (davidschor@zigwap.com), ZigWap LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <pthread.h>
+#include "ctest.h"
+#include "aleph.h"
+
+#define PRODUCERS 4
+#define PER_PRODUCER 20000
+
+struct producer
+{
+    a_free_queue q;
+    a_shared_pool pool;
+    int vec;
+};
+
+static void *produce(void *arg)
+{
+    struct producer *p = arg;
+    a_str batch[16];
+    size_t i, n = 0;
+    
+    for (i = 0; i < PER_PRODUCER; ++i)
+    {
+        a_str s = a_new_chr("x", i % 100);
+        
+        if (p->pool)
+            a_gc_shared_collect(p->pool, s);
+        else if (!p->vec)
+            a_free_queue_push(p->q, s);
+        else if ((batch[n++] = s), n == sizeof batch / sizeof *batch)
+            a_free_queue_push_vec(p->q, batch, n), n = 0;
+    }
+    if (n)
+        a_free_queue_push_vec(p->q, batch, n);
+    return NULL;
+}
+
+CTEST(FreeQueue, check_free_queue)
+{
+    struct producer p[PRODUCERS];
+    pthread_t t[PRODUCERS];
+    size_t i, freed = 0;
+    a_free_queue q = a_free_queue_new();
+    
+    ASSERT_NOT_NULL(q);
+    ASSERT_EQUAL(0, a_free_queue_drain(q));
+    a_free_queue_push(q, a_new("one"));
+    a_free_queue_push(q, a_new(""));
+    ASSERT_EQUAL(2, a_free_queue_drain(q));
+    ASSERT_EQUAL(0, a_free_queue_drain(q));
+    
+    /* the owner drains while the others push */
+    for (i = 0; i < PRODUCERS; ++i)
+    {
+        p[i].q = q;
+        p[i].pool = NULL;
+        p[i].vec = i & 1;
+        ASSERT_EQUAL(0, pthread_create(&t[i], NULL, produce, &p[i]));
+    }
+    while (freed < PRODUCERS * PER_PRODUCER / 2)
+        freed += a_free_queue_drain(q);
+    for (i = 0; i < PRODUCERS; ++i)
+        pthread_join(t[i], NULL);
+    freed += a_free_queue_drain(q);
+    ASSERT_EQUAL(PRODUCERS * PER_PRODUCER, freed);
+    
+    a_free_queue_push(q, a_new("left over"));
+    a_free_queue_free(q);
+}
+
+CTEST(FreeQueue, check_shared_pool)
+{
+    struct producer p[PRODUCERS];
+    pthread_t t[PRODUCERS];
+    size_t i;
+    a_shared_pool pool = a_gc_shared_new();
+    
+    ASSERT_NOT_NULL(pool);
+    ASSERT_STR("abc", a_gc_shared_collect(pool, a_new("abc")));
+    for (i = 0; i < PRODUCERS; ++i)
+    {
+        p[i].q = NULL;
+        p[i].pool = pool;
+        ASSERT_EQUAL(0, pthread_create(&t[i], NULL, produce, &p[i]));
+    }
+    for (i = 0; i < PRODUCERS; ++i)
+        pthread_join(t[i], NULL);
+    a_gc_shared_free(pool);
+}
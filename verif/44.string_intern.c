@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (davidschor@zigwap.com), ZigWap LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <pthread.h>
+#include "ctest.h"
+#include "aleph.h"
+
+#define THREADS 8
+#define KEYS 5000
+
+static a_intern_table table;
+
+/* every thread interns all the keys twice, then releases them */
+static void *intern_keys(void *arg)
+{
+    a_cstr *got = malloc(KEYS * sizeof *got);
+    char b[32];
+    size_t i, r;
+    
+    (void)arg;
+    for (r = 0; r < 2; ++r)
+    {
+        for (i = 0; i < KEYS; ++i)
+        {
+            snprintf(b, sizeof b, "key-%lu", (unsigned long)i);
+            got[i] = a_intern_cstr(table, b);
+        }
+        for (i = 0; i < KEYS; ++i)
+            a_intern_release(table, got[i]);
+    }
+    free(got);
+    return NULL;
+}
+
+CTEST(Intern, check_intern)
+{
+    a_intern_table t = a_intern_table_new();
+    a_str s = a_new("header");
+    a_cstr a, b, c, e;
+    
+    ASSERT_NOT_NULL(t);
+    a = a_intern_cstr(t, "header");
+    b = a_intern(t, s);
+    c = a_intern_size(t, "header-x", 6);
+    ASSERT_TRUE(a == b && b == c);
+    ASSERT_STR("header", a);
+    ASSERT_EQUAL(6, a_size(a));
+    ASSERT_EQUAL(6, a_len(a));
+    ASSERT_TRUE(a_intern_hash(a) == a_hash(s));
+    ASSERT_TRUE(a != a_intern_cstr(t, "Header"));
+    e = a_intern_cstr(t, "");
+    ASSERT_EQUAL(0, a_size(e));
+    ASSERT_EQUAL(3, a_intern_table_count(t));
+    
+    /* three references to "header" */
+    a_intern_release(t, a);
+    a_intern_release(t, b);
+    ASSERT_EQUAL(3, a_intern_table_count(t));
+    ASSERT_TRUE(a_intern_ref(t, c) == c);
+    a_intern_release(t, c);
+    a_intern_release(t, c);
+    ASSERT_EQUAL(2, a_intern_table_count(t));
+    a_intern_release(t, e);
+    ASSERT_EQUAL(1, a_intern_table_count(t));
+    
+    a_free(s);
+    a_intern_table_free(t);
+}
+
+CTEST(Intern, check_intern_many)
+{
+    a_cstr *keep = malloc(KEYS * sizeof *keep);
+    pthread_t t[THREADS];
+    char b[32];
+    size_t i;
+    
+    table = a_intern_table_new();
+    for (i = 0; i < KEYS; i += 2)
+    {
+        snprintf(b, sizeof b, "key-%lu", (unsigned long)i);
+        keep[i] = a_intern_cstr(table, b);
+    }
+    for (i = 0; i < THREADS; ++i)
+        ASSERT_EQUAL(0, pthread_create(&t[i], NULL, intern_keys, NULL));
+    for (i = 0; i < THREADS; ++i)
+        pthread_join(t[i], NULL);
+    
+    /* only the ones kept here are left, at the same addresses */
+    ASSERT_EQUAL(KEYS / 2, a_intern_table_count(table));
+    for (i = 0; i < KEYS; i += 2)
+    {
+        snprintf(b, sizeof b, "key-%lu", (unsigned long)i);
+        ASSERT_TRUE(a_intern_cstr(table, b) == keep[i]);
+        a_intern_release(table, keep[i]);
+        a_intern_release(table, keep[i]);
+    }
+    ASSERT_EQUAL(0, a_intern_table_count(table));
+    a_intern_table_free(table);
+    free(keep);
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (davidschor@zigwap.com), ZigWap LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <pthread.h>
+#include "ctest.h"
+#include "aleph.h"
+
+#define APPENDERS 4
+#define PER_APPENDER 40000
+
+struct appender
+{
+    a_append a;
+    int id;
+    int failed;
+};
+
+static void *append_lines(void *arg)
+{
+    struct appender *p = arg;
+    char line[64];
+    int i;
+    
+    for (i = 0; i < PER_APPENDER; ++i)
+    {
+        /* sizes vary, so that lines run over the ends of the segments */
+        sprintf(line, "%d:%d:\xC3\xA9\xE2\x82\xAC%.*s\n", p->id, i, i % 17, "................");
+        p->failed += !a_append_put_cstr(p->a, line);
+    }
+    return NULL;
+}
+
+/* checks that every line of every appender is there once, in order */
+static int check_lines(a_cstr s)
+{
+    int next[APPENDERS] = { 0 }, id, i, k;
+    const char *at = s, *end = s + a_size(s);
+    
+    while (at < end)
+    {
+        if (sscanf(at, "%d:%d:", &id, &i) != 2 || id < 0 || id >= APPENDERS || i != next[id]++)
+            return 0;
+        at = strchr(at, '\n');
+        if (!at)
+            return 0;
+        ++at;
+    }
+    for (k = 0; k < APPENDERS; ++k)
+        if (next[k] != PER_APPENDER)
+            return 0;
+    return 1;
+}
+
+CTEST(StringAppend, check_append)
+{
+    a_append a = a_append_new();
+    a_str s = a_new("log:"), e = a_new("\xC3\xA9t\xC3\xA9 ");
+    
+    ASSERT_NOT_NULL(a);
+    ASSERT_EQUAL(1, a_append_put_cstr(a, "one "));
+    ASSERT_EQUAL(1, a_append_put(a, e));
+    ASSERT_EQUAL(1, a_append_put_size(a, "two three", 3));
+    ASSERT_EQUAL(1, a_append_put_size(a, "", 0));
+    ASSERT_EQUAL(13, a_append_size(a));
+    s = a_append_flush(a, s);
+    ASSERT_STR("log:one \xC3\xA9t\xC3\xA9 two", s);
+    ASSERT_EQUAL(15, a_len(s));
+    ASSERT_EQUAL(a_len(s), a_len_cstr(s));
+    
+    /* nothing left, more after */
+    s = a_append_flush(a, s);
+    ASSERT_EQUAL(17, a_size(s));
+    ASSERT_EQUAL(1, a_append_put_cstr(a, "!"));
+    s = a_append_flush(a, s);
+    ASSERT_STR("log:one \xC3\xA9t\xC3\xA9 two!", s);
+    ASSERT_EQUAL(16, a_len(s));
+    a_free(s);
+    a_free(e);
+    
+    a_append_put_cstr(a, "not flushed");
+    a_append_free(a);
+}
+
+CTEST(StringAppend, check_append_threads)
+{
+    struct appender p[APPENDERS];
+    pthread_t t[APPENDERS];
+    a_append a = a_append_new();
+    a_str s = a_new("");
+    size_t i;
+    
+    ASSERT_NOT_NULL(a);
+    for (i = 0; i < APPENDERS; ++i)
+    {
+        p[i].a = a;
+        p[i].id = (int)i;
+        p[i].failed = 0;
+        ASSERT_EQUAL(0, pthread_create(&t[i], NULL, append_lines, &p[i]));
+    }
+    /* flushes while the others append */
+    while (a_size(s) < a_append_size(a) / 2 || a_size(s) < A_APPEND_SEGMENT_SIZE)
+        ASSERT_NOT_NULL(s = a_append_flush(a, s));
+    for (i = 0; i < APPENDERS; ++i)
+    {
+        pthread_join(t[i], NULL);
+        ASSERT_EQUAL(0, p[i].failed);
+    }
+    s = a_append_flush(a, s);
+    ASSERT_EQUAL(a_append_size(a), a_size(s));
+    ASSERT_EQUAL(a_len_cstr(s), a_len(s));
+    ASSERT_TRUE(check_lines(s));
+    a_free(s);
+    a_append_free(a);
+}
+
+CTEST(StringAppend, check_append_fd)
+{
+    struct appender p[APPENDERS];
+    pthread_t t[APPENDERS];
+    a_append a = a_append_new();
+    FILE *fp = tmpfile();
+    a_str s;
+    size_t i;
+    
+    ASSERT_NOT_NULL(a);
+    ASSERT_NOT_NULL(fp);
+    for (i = 0; i < APPENDERS; ++i)
+    {
+        p[i].a = a;
+        p[i].id = (int)i;
+        p[i].failed = 0;
+        ASSERT_EQUAL(0, pthread_create(&t[i], NULL, append_lines, &p[i]));
+    }
+    for (i = 0; i < 100; ++i)
+        ASSERT_EQUAL(1, a_append_flush_fd(a, fileno(fp)));
+    for (i = 0; i < APPENDERS; ++i)
+        pthread_join(t[i], NULL);
+    ASSERT_EQUAL(1, a_append_flush_fd(a, fileno(fp)));
+    
+    rewind(fp);
+    s = a_file_read(fp);
+    ASSERT_NOT_NULL(s);
+    ASSERT_EQUAL(a_append_size(a), a_size(s));
+    ASSERT_TRUE(check_lines(s));
+    a_free(s);
+    fclose(fp);
+    a_append_free(a);
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (davidschor@zigwap.com), ZigWap LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "ctest.h"
+#include "aleph.h"
+
+CTEST(StringMap, check_map)
+{
+    a_map m = a_map_new();
+    a_str k = a_new("key");
+    a_cstr key;
+    void *value;
+    size_t iter = 0, seen = 0;
+    int one = 1, two = 2;
+    
+    ASSERT_NOT_NULL(m);
+    ASSERT_EQUAL(0, a_map_count(m));
+    ASSERT_NULL(a_map_get(m, k));
+    ASSERT_EQUAL(0, a_map_remove(m, k));
+    
+    ASSERT_EQUAL(1, a_map_set(m, k, &one));
+    ASSERT_EQUAL(1, a_map_set_cstr(m, "other", &two));
+    ASSERT_EQUAL(1, a_map_set_size(m, "nothing else", 7, NULL));
+    ASSERT_EQUAL(3, a_map_count(m));
+    ASSERT_TRUE(a_map_get_cstr(m, "key") == &one);
+    ASSERT_TRUE(a_map_get_size(m, "others", 5) == &two);
+    ASSERT_NULL(a_map_get_cstr(m, "Key"));
+    ASSERT_NULL(a_map_get_cstr(m, "nothing"));
+    ASSERT_STR("nothing", a_map_key_cstr(m, "nothing"));
+    ASSERT_NULL(a_map_key_cstr(m, "noth"));
+    
+    /* the map keeps a copy */
+    key = a_map_key(m, k);
+    ASSERT_TRUE(key != k);
+    ASSERT_EQUAL(3, a_size(key));
+    a_free(k);
+    
+    ASSERT_EQUAL(1, a_map_set_cstr(m, "key", &two));
+    ASSERT_EQUAL(3, a_map_count(m));
+    ASSERT_TRUE(a_map_get_cstr(m, "key") == &two);
+    ASSERT_TRUE(a_map_key_cstr(m, "key") == key);
+    
+    while (a_map_next(m, &iter, &key, &value))
+    {
+        ASSERT_TRUE(a_map_get(m, key) == value);
+        ++seen;
+    }
+    ASSERT_EQUAL(3, seen);
+    
+    ASSERT_EQUAL(1, a_map_remove_cstr(m, "key"));
+    ASSERT_EQUAL(0, a_map_remove_cstr(m, "key"));
+    ASSERT_NULL(a_map_key_cstr(m, "key"));
+    ASSERT_EQUAL(2, a_map_count(m));
+    ASSERT_EQUAL(1, a_map_set_cstr(m, "key", &one));
+    ASSERT_TRUE(a_map_get_cstr(m, "key") == &one);
+    a_map_free(m);
+}
+
+CTEST(StringMap, check_map_many)
+{
+    a_map m = a_map_new();
+    a_str big;
+    char b[64];
+    size_t i, iter = 0, seen = 0;
+    
+    ASSERT_NOT_NULL(m);
+    for (i = 0; i < 100000; ++i)
+    {
+        sprintf(b, "key %lu", (unsigned long)i);
+        ASSERT_EQUAL(1, a_map_set_cstr(m, b, (void*)(i + 1)));
+    }
+    /* a key longer than a block of keys */
+    ASSERT_NOT_NULL(big = a_new_chr("x", 100000));
+    ASSERT_EQUAL(1, a_map_set(m, big, NULL));
+    ASSERT_EQUAL(1, a_map_set_cstr(m, "after", NULL));
+    ASSERT_EQUAL(100000, a_size(a_map_key(m, big)));
+    ASSERT_STR("after", a_map_key_cstr(m, "after"));
+    a_free(big);
+    ASSERT_EQUAL(100002, a_map_count(m));
+    
+    for (i = 0; i < 100000; i += 2)
+    {
+        sprintf(b, "key %lu", (unsigned long)i);
+        ASSERT_EQUAL(1, a_map_remove_cstr(m, b));
+    }
+    for (i = 0; i < 100000; ++i)
+    {
+        sprintf(b, "key %lu", (unsigned long)i);
+        ASSERT_TRUE(a_map_get_cstr(m, b) == (i & 1 ? (void*)(i + 1) : NULL));
+    }
+    /* reuses the deleted slots */
+    for (i = 0; i < 100000; i += 2)
+    {
+        sprintf(b, "key %lu", (unsigned long)i);
+        ASSERT_EQUAL(1, a_map_set_cstr(m, b, (void*)(i + 1)));
+    }
+    while (a_map_next(m, &iter, NULL, NULL))
+        ++seen;
+    ASSERT_EQUAL(100002, seen);
+    a_map_free(m);
+}
+
+CTEST(StringMap, check_map_icase)
+{
+    a_map m = a_map_new_icase();
+    int one = 1, two = 2;
+    
+    ASSERT_NOT_NULL(m);
+    ASSERT_EQUAL(1, a_map_set_cstr(m, "Stra\xC3\x9F" "e", &one));
+    ASSERT_EQUAL(1, a_map_set_cstr(m, "\xCE\xA3\xCE\xA5\xCE\xA3", &two));
+    ASSERT_TRUE(a_map_get_cstr(m, "STRASSE") == &one);
+    ASSERT_TRUE(a_map_get_cstr(m, "strasse") == &one);
+    ASSERT_TRUE(a_map_get_cstr(m, "\xCF\x83\xCF\x85\xCF\x83") == &two);
+    ASSERT_NULL(a_map_get_cstr(m, "strass"));
+    ASSERT_NULL(a_map_get_cstr(m, "strasses"));
+    ASSERT_STR("Stra\xC3\x9F" "e", a_map_key_cstr(m, "STRASSE"));
+    
+    ASSERT_EQUAL(1, a_map_set_cstr(m, "STRASSE", &two));
+    ASSERT_EQUAL(2, a_map_count(m));
+    ASSERT_EQUAL(0, a_icmp_cstr_cstr("STRASSE", a_map_key_cstr(m, "strasse")));
+    ASSERT_EQUAL(1, a_map_remove_cstr(m, "Strasse"));
+    ASSERT_EQUAL(1, a_map_count(m));
+    a_map_free(m);
+}
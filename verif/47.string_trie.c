@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (davidschor@zigwap.com), ZigWap LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "ctest.h"
+#include "aleph.h"
+
+static int collect(a_cstr key, void *value, void *ctx)
+{
+    a_str *s = ctx;
+    
+    *s = a_cat_cstr(*s, key);
+    *s = a_cat_cstr(*s, ",");
+    return a_size(*s) < 30;
+}
+
+static int first(a_cstr key, void *value, void *ctx)
+{
+    *(a_cstr*)ctx = key;
+    return 0;
+}
+
+CTEST(StringTrie, check_trie)
+{
+    a_trie t = a_trie_new();
+    a_str s = a_new("");
+    a_cstr key = NULL;
+    void *value = NULL;
+    int one = 1, two = 2, three = 3;
+    
+    ASSERT_NOT_NULL(t);
+    ASSERT_EQUAL(A_EOS, a_trie_longest_prefix_cstr(t, "/api/users", NULL, NULL));
+    ASSERT_EQUAL(1, a_trie_set_cstr(t, "/api", &one));
+    ASSERT_EQUAL(1, a_trie_set_cstr(t, "/api/users", &two));
+    ASSERT_EQUAL(1, a_trie_set_size(t, "/api/user/x", 9, &three));
+    ASSERT_EQUAL(1, a_trie_set_cstr(t, "/b\xC3\xA9", NULL));
+    ASSERT_EQUAL(4, a_trie_count(t));
+    ASSERT_EQUAL(1, a_trie_set_cstr(t, "/api", &one));
+    ASSERT_EQUAL(4, a_trie_count(t));
+    
+    ASSERT_TRUE(a_trie_get_cstr(t, "/api/users") == &two);
+    ASSERT_TRUE(a_trie_get_size(t, "/api/users", 9) == &three);
+    ASSERT_NULL(a_trie_get_cstr(t, "/api/"));
+    ASSERT_NULL(a_trie_get_cstr(t, "/API"));
+    
+    ASSERT_EQUAL(10, a_trie_longest_prefix_cstr(t, "/api/users/12", &key, &value));
+    ASSERT_STR("/api/users", key);
+    ASSERT_TRUE(value == &two);
+    ASSERT_EQUAL(9, a_trie_longest_prefix_cstr(t, "/api/user", &key, &value));
+    ASSERT_TRUE(value == &three);
+    ASSERT_EQUAL(4, a_trie_longest_prefix_cstr(t, "/api/use", &key, NULL));
+    ASSERT_STR("/api", key);
+    ASSERT_EQUAL(4, a_trie_longest_prefix_size(t, "/api/users", 6, NULL, NULL));
+    ASSERT_EQUAL(A_EOS, a_trie_longest_prefix_cstr(t, "/ap", NULL, NULL));
+    
+    /* the empty key starts everything */
+    ASSERT_EQUAL(1, a_trie_set_cstr(t, "", &three));
+    ASSERT_EQUAL(0, a_trie_longest_prefix_cstr(t, "/ap", NULL, &value));
+    ASSERT_TRUE(value == &three);
+    
+    ASSERT_EQUAL(3, a_trie_each_prefixed_cstr(t, "/api", collect, &s));
+    ASSERT_STR("/api,/api/user,/api/users,", s);
+    a_free(s);
+    s = a_new("");
+    ASSERT_EQUAL(5, a_trie_each_prefixed_cstr(t, "", collect, &s));
+    ASSERT_STR(",/api,/api/user,/api/users,/b\xC3\xA9,", s);
+    a_free(s);
+    s = a_new("");
+    ASSERT_EQUAL(0, a_trie_each_prefixed_cstr(t, "/c", collect, &s));
+    ASSERT_EQUAL(1, a_trie_each_prefixed_cstr(t, "/api/", first, &key));
+    ASSERT_STR("/api/user", key);
+    a_free(s);
+    a_trie_free(t);
+}
+
+CTEST(StringTrie, check_trie_icase)
+{
+    a_trie t = a_trie_new_icase();
+    a_str s = a_new("");
+    a_cstr key = NULL;
+    int one = 1, two = 2;
+    
+    ASSERT_NOT_NULL(t);
+    ASSERT_EQUAL(1, a_trie_set_cstr(t, "Stra\xC3\x9F" "e", &one));
+    ASSERT_EQUAL(1, a_trie_set_cstr(t, "STR", &two));
+    ASSERT_EQUAL(1, a_trie_set_cstr(t, "str", &two));
+    ASSERT_EQUAL(2, a_trie_count(t));
+    ASSERT_TRUE(a_trie_get_cstr(t, "strasse") == &one);
+    
+    ASSERT_EQUAL(7, a_trie_longest_prefix_cstr(t, "STRASSEN", &key, NULL));
+    ASSERT_STR("Stra\xC3\x9F" "e", key);
+    ASSERT_EQUAL(3, a_trie_longest_prefix_cstr(t, "Stra", &key, NULL));
+    ASSERT_STR("STR", key);
+    
+    /* "s" ends inside the folding of U+00DF, which is taken whole */
+    ASSERT_EQUAL(1, a_trie_set_cstr(t, "s", NULL));
+    ASSERT_EQUAL(2, a_trie_longest_prefix_cstr(t, "\xC3\x9F" "x", &key, NULL));
+    ASSERT_STR("s", key);
+    
+    ASSERT_EQUAL(2, a_trie_each_prefixed_cstr(t, "st", collect, &s));
+    ASSERT_STR("STR,Stra\xC3\x9F" "e,", s);
+    a_free(s);
+    a_trie_free(t);
+}
+
+CTEST(StringTrie, check_trie_many)
+{
+    a_trie t = a_trie_new();
+    char b[64];
+    size_t i;
+    void *value;
+    
+    ASSERT_NOT_NULL(t);
+    for (i = 0; i < 20000; ++i)
+    {
+        sprintf(b, "/%lu/%lu", (unsigned long)(i % 300), (unsigned long)i);
+        ASSERT_EQUAL(1, a_trie_set_cstr(t, b, (void*)(i + 1)));
+    }
+    ASSERT_EQUAL(20000, a_trie_count(t));
+    for (i = 0; i < 20000; ++i)
+    {
+        sprintf(b, "/%lu/%lu/rest", (unsigned long)(i % 300), (unsigned long)i);
+        ASSERT_EQUAL(strlen(b) - 5, a_trie_longest_prefix_cstr(t, b, NULL, &value));
+        ASSERT_TRUE(value == (void*)(i + 1));
+    }
+    a_trie_free(t);
+}
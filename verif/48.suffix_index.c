@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (davidschor@zigwap.com), ZigWap LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "ctest.h"
+#include "aleph.h"
+
+/* counts overlapping occurrences, the way the index does */
+static size_t count_all(const char *s, size_t size, const char *sub, size_t subsize, size_t *first)
+{
+    size_t i, count = 0;
+    
+    *first = A_EOS;
+    for (i = 0; subsize && i + subsize <= size; ++i)
+    {
+        if (memcmp(s + i, sub, subsize))
+            continue;
+        if (!count++)
+            *first = i;
+    }
+    return count;
+}
+
+CTEST(SuffixIndex, check_suffix_index)
+{
+    a_str s = a_new("banana bandana");
+    a_suffix_index idx = a_suffix_index_new(s, a_suffix_index_no_options);
+    size_t offsets[8];
+    
+    ASSERT_NOT_NULL(idx);
+    ASSERT_EQUAL(1, a_suffix_index_find_cstr(idx, "anana"));
+    ASSERT_EQUAL(7, a_suffix_index_find_cstr(idx, "band"));
+    ASSERT_EQUAL(A_EOS, a_suffix_index_find_cstr(idx, "bandanas"));
+    ASSERT_EQUAL(A_EOS, a_suffix_index_find_cstr(idx, "Banana"));
+    ASSERT_EQUAL(A_EOS, a_suffix_index_find_cstr(idx, ""));
+    
+    /* occurrences overlap */
+    ASSERT_EQUAL(3, a_suffix_index_count_cstr(idx, "ana"));
+    ASSERT_EQUAL(6, a_suffix_index_count_cstr(idx, "a"));
+    ASSERT_EQUAL(0, a_suffix_index_count_cstr(idx, ""));
+    ASSERT_EQUAL(2, a_suffix_index_count_size(idx, "bandit", 3));
+    
+    ASSERT_EQUAL(3, a_suffix_index_locate_cstr(idx, "ana", offsets, 8));
+    ASSERT_EQUAL(1, offsets[0]);
+    ASSERT_EQUAL(3, offsets[1]);
+    ASSERT_EQUAL(11, offsets[2]);
+    ASSERT_EQUAL(6, a_suffix_index_locate_cstr(idx, "a", offsets, 2));
+    ASSERT_TRUE(offsets[0] < offsets[1]);
+    ASSERT_EQUAL(6, a_suffix_index_locate_cstr(idx, "a", NULL, 0));
+    
+    a_suffix_index_free(idx);
+    a_free(s);
+}
+
+CTEST(SuffixIndex, check_suffix_index_vec)
+{
+    a_str docs[3];
+    a_suffix_index idx;
+    size_t offsets[4], at = 0;
+    
+    docs[0] = a_new("one two");
+    docs[1] = a_new("");
+    docs[2] = a_new("two three");
+    idx = a_suffix_index_new_vec((const a_cstr*)docs, 3, a_suffix_index_no_options);
+    ASSERT_NOT_NULL(idx);
+    ASSERT_EQUAL(2, a_suffix_index_locate_cstr(idx, "two", offsets, 4));
+    ASSERT_EQUAL(0, a_suffix_index_doc(idx, offsets[0], &at));
+    ASSERT_EQUAL(4, at);
+    ASSERT_EQUAL(2, a_suffix_index_doc(idx, offsets[1], &at));
+    ASSERT_EQUAL(0, at);
+    ASSERT_EQUAL(1, a_suffix_index_doc(idx, 8, &at));
+    ASSERT_EQUAL(A_EOS, a_suffix_index_doc(idx, 19, NULL));
+    /* documents don't run into each other */
+    ASSERT_EQUAL(0, a_suffix_index_count_cstr(idx, "twotwo"));
+    a_suffix_index_free(idx);
+    a_free(docs[0]);
+    a_free(docs[1]);
+    a_free(docs[2]);
+    
+    idx = a_suffix_index_new_vec(NULL, 0, 0);
+    ASSERT_NOT_NULL(idx);
+    ASSERT_EQUAL(0, a_suffix_index_count_cstr(idx, "x"));
+    a_suffix_index_free(idx);
+}
+
+CTEST(SuffixIndex, check_suffix_index_icase)
+{
+    a_str s = a_new("Die Stra\xC3\x9F" "e, STRASSE und strasse: \xCE\xA3\xCE\xA5\xCE\xA3!");
+    a_suffix_index idx = a_suffix_index_new(s, a_suffix_index_icase);
+    size_t offsets[4];
+    
+    ASSERT_NOT_NULL(idx);
+    ASSERT_EQUAL(3, a_suffix_index_locate_cstr(idx, "strasse", offsets, 4));
+    ASSERT_EQUAL(4, offsets[0]);
+    ASSERT_EQUAL(13, offsets[1]);
+    ASSERT_EQUAL(25, offsets[2]);
+    ASSERT_EQUAL(4, a_suffix_index_find_cstr(idx, "STRA\xC3\x9F" "E"));
+    ASSERT_EQUAL(34, a_suffix_index_find_cstr(idx, "\xCF\x83\xCF\x85"));
+    ASSERT_EQUAL(40, a_suffix_index_find_cstr(idx, "!"));
+    ASSERT_EQUAL(3, a_suffix_index_count_cstr(idx, "SSE"));
+    ASSERT_EQUAL(A_EOS, a_suffix_index_find_cstr(idx, "strassen"));
+    a_suffix_index_free(idx);
+    a_free(s);
+}
+
+CTEST(SuffixIndex, check_suffix_index_large)
+{
+    char *b = malloc(300000);
+    a_str s;
+    a_suffix_index idx, idx_split;
+    size_t i, j, k, n, first, offsets[4];
+    char sub[8];
+    unsigned int seed = 1;
+    
+    /* few letters and runs of them, so that suffixes share long prefixes */
+    for (i = 0; i < 300000; ++i)
+    {
+        seed = seed * 1103515245u + 12345u;
+        b[i] = i > 200000 && i < 250000 ? 'a' : "abc"[(seed >> 16) % 3];
+    }
+    s = a_new_size(b, 300000);
+    free(b);
+    
+    idx = a_suffix_index_new(s, 0);
+    a_threads_set(4, 4096);
+    idx_split = a_suffix_index_new(s, 0);
+    a_threads_set(0, 0);
+    ASSERT_NOT_NULL(idx);
+    ASSERT_NOT_NULL(idx_split);
+    
+    for (k = 0; k < 200; ++k)
+    {
+        seed = seed * 1103515245u + 12345u;
+        i = (seed >> 8) % 299990;
+        j = 1 + k % 7;
+        memcpy(sub, s + i, j);
+        sub[j] = k % 5 ? sub[j-1] : 'd';
+        ++j;
+        n = count_all(s, 300000, sub, j, &first);
+        ASSERT_EQUAL(n, a_suffix_index_count_size(idx, sub, j));
+        ASSERT_EQUAL(n, a_suffix_index_count_size(idx_split, sub, j));
+        ASSERT_EQUAL(first, a_suffix_index_find_size(idx_split, sub, j));
+        if (n)
+        {
+            ASSERT_EQUAL(n, a_suffix_index_locate_size(idx, sub, j, offsets, 1));
+            ASSERT_TRUE(!memcmp(s + offsets[0], sub, j));
+        }
+    }
+    n = count_all(s, 300000, "aaaaaaaaaaaaaaaaaaaa", 20, &first);
+    ASSERT_TRUE(n > 49000);
+    ASSERT_EQUAL(n, a_suffix_index_count_cstr(idx_split, "aaaaaaaaaaaaaaaaaaaa"));
+    ASSERT_EQUAL(first, a_suffix_index_find_cstr(idx, "aaaaaaaaaaaaaaaaaaaa"));
+    /* ranges of about a third of the text */
+    for (k = 0; k < 3; ++k)
+    {
+        count_all(s, 300000, "abc" + k, 1, &first);
+        ASSERT_EQUAL(first, a_suffix_index_find_size(idx, "abc" + k, 1));
+    }
+    a_suffix_index_free(idx);
+    a_suffix_index_free(idx_split);
+    a_free(s);
+}
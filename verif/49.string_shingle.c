@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (davidschor@zigwap.com), ZigWap LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <limits.h>
+#include "ctest.h"
+#include "aleph.h"
+
+#define K 128
+
+CTEST(Shingle, check_minhash)
+{
+    unsigned long a[K], b[K], c[K], d[K];
+    const char *text = "The quick brown fox jumps over the lazy dog, and then it runs far away "
+                       "into the deep dark forest where nobody will ever find it again.";
+    
+    ASSERT_EQUAL(strlen(text) - 4, a_minhash_cstr(text, 5, a_shingle_cp, 0, a, K));
+    ASSERT_EQUAL(strlen(text) - 4, a_minhash_cstr(text, 5, a_shingle_cp, 0, b, K));
+    ASSERT_TRUE(a_minhash_similarity(a, b, K) == 1.0);
+    
+    /* one word changed: similar, but not the same */
+    a_minhash_cstr("The quick brown fox jumps over the lazy cat, and then it runs far away "
+                   "into the deep dark forest where nobody will ever find it again.", 5, a_shingle_cp, 0, b, K);
+    ASSERT_TRUE(a_minhash_similarity(a, b, K) > 0.7);
+    ASSERT_TRUE(a_minhash_similarity(a, b, K) < 1.0);
+    
+    a_minhash_cstr("Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod "
+                   "tempor incididunt ut labore et dolore magna aliqua.", 5, a_shingle_cp, 0, c, K);
+    ASSERT_TRUE(a_minhash_similarity(a, c, K) < 0.2);
+    
+    /* case and punctuation */
+    a_minhash_cstr("THE QUICK brown fox -- jumps over the lazy dog and, then, it runs far away "
+                   "into the deep dark forest where nobody will ever find it again!", 5,
+                   a_shingle_fold, a_gc_punctuation | a_gc_separator, c, K);
+    a_minhash_cstr(text, 5, a_shingle_fold, a_gc_punctuation | a_gc_separator, d, K);
+    ASSERT_TRUE(a_minhash_similarity(c, d, K) == 1.0);
+    a_minhash_cstr("THE QUICK brown fox -- jumps over the lazy dog and, then, it runs far away "
+                   "into the deep dark forest where nobody will ever find it again!", 5, a_shingle_cp, 0, c, K);
+    ASSERT_TRUE(a_minhash_similarity(a, c, K) < 0.9);
+    
+    /* fewer units than n: one shingle */
+    ASSERT_EQUAL(1, a_minhash_cstr("ab", 5, a_shingle_cp, 0, a, K));
+    ASSERT_EQUAL(0, a_minhash_cstr("", 5, a_shingle_cp, 0, a, K));
+    ASSERT_EQUAL(ULONG_MAX, a[0]);
+    ASSERT_EQUAL(0, a_minhash_cstr("...", 2, a_shingle_cp, a_gc_punctuation, a, K));
+    
+    /* long shingles keep their window off the stack */
+    ASSERT_EQUAL(strlen(text) - 39, a_minhash_cstr(text, 40, a_shingle_cp, 0, a, K));
+    a_minhash_cstr(text, 40, a_shingle_cp, 0, b, K);
+    ASSERT_TRUE(a_minhash_similarity(a, b, K) == 1.0);
+}
+
+CTEST(Shingle, check_minhash_rolling)
+{
+    unsigned long a[K], b[K];
+    
+    /* the same shingles in another order give the same signature */
+    a_minhash_cstr("abcdXabcd", 4, a_shingle_cp, 0, a, K);
+    a_minhash_cstr("bcdXabcd", 4, a_shingle_cp, 0, b, K);
+    ASSERT_TRUE(a_minhash_similarity(a, b, K) == 1.0);
+    a_minhash_cstr("abcdabcdabcd", 4, a_shingle_cp, 0, a, K);
+    a_minhash_cstr("bcdabcda", 4, a_shingle_cp, 0, b, K);
+    ASSERT_TRUE(a_minhash_similarity(a, b, K) == 1.0);
+}
+
+CTEST(Shingle, check_minhash_grapheme)
+{
+    unsigned long a[K], b[K];
+    
+    /* e + combining acute is one grapheme cluster */
+    ASSERT_EQUAL(3, a_minhash_cstr("cafe\xcc\x81", 2, a_shingle_grapheme, 0, a, K));
+    ASSERT_EQUAL(4, a_minhash_cstr("cafe\xcc\x81", 2, a_shingle_cp, 0, a, K));
+    ASSERT_EQUAL(1, a_minhash_cstr("\xf0\x9f\x87\xab\xf0\x9f\x87\xb7", 2, a_shingle_grapheme, 0, a, K));
+    
+    a_minhash_cstr("Stra\xc3\x9f" "e", 3, a_shingle_fold, 0, a, K);
+    a_minhash_cstr("STRASSE", 3, a_shingle_fold, 0, b, K);
+    ASSERT_TRUE(a_minhash_similarity(a, b, K) < 1.0);
+    /* a code point folding to several is still one unit */
+    ASSERT_EQUAL(6, a_minhash_cstr("stra\xc3\x9f" "e", 1, a_shingle_fold, 0, a, K));
+}
+
+CTEST(Shingle, check_simhash)
+{
+    const char *text = "The quick brown fox jumps over the lazy dog, and then it runs far away "
+                       "into the deep dark forest where nobody will ever find it again.";
+    unsigned long a = a_simhash_cstr(text, 4, a_shingle_cp, 0);
+    unsigned long b;
+    a_str s = a_new(text);
+    
+    ASSERT_EQUAL(a, a_simhash(s, 4, a_shingle_cp, 0));
+    ASSERT_EQUAL(0, a_simhash_distance(a, a));
+    
+    b = a_simhash_cstr("The quick brown fox jumps over the lazy cat, and then it runs far away "
+                       "into the deep dark forest where nobody will ever find it again.", 4, a_shingle_cp, 0);
+    ASSERT_TRUE(a_simhash_distance(a, b) < 12);
+    b = a_simhash_cstr("Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod "
+                       "tempor incididunt ut labore et dolore magna aliqua.", 4, a_shingle_cp, 0);
+    ASSERT_TRUE(a_simhash_distance(a, b) > 12);
+    
+    ASSERT_EQUAL(a_simhash_cstr("Hello, World", 3, a_shingle_fold, a_gc_punctuation | a_gc_separator),
+                 a_simhash_cstr("helloworld", 3, a_shingle_cp, 0));
+    ASSERT_EQUAL(3, a_simhash_distance(0x0FUL, 0x1CUL));
+    a_free(s);
+}
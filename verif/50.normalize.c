@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (davidschor@zigwap.com), ZigWap LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "ctest.h"
+#include "aleph.h"
+
+CTEST(Normalize, check_normalize)
+{
+    a_str s, n;
+    
+    /* A with ring above, Angstrom sign, A + combining ring */
+    s = a_normalize_cstr("\xc3\x85 \xe2\x84\xab A\xcc\x8a", a_norm_nfc);
+    ASSERT_STR("\xc3\x85 \xc3\x85 \xc3\x85", s);
+    ASSERT_EQUAL(5, a_len(s));
+    a_free(s);
+    s = a_normalize_cstr("\xc3\x85 \xe2\x84\xab A\xcc\x8a", a_norm_nfd);
+    ASSERT_STR("A\xcc\x8a A\xcc\x8a A\xcc\x8a", s);
+    a_free(s);
+    
+    /* canonical ordering: dot below (220) before dot above (230) */
+    s = a_normalize_cstr("q\xcc\x87\xcc\xa3", a_norm_nfd);
+    ASSERT_STR("q\xcc\xa3\xcc\x87", s);
+    a_free(s);
+    s = a_normalize_cstr("\xe1\xb8\x8b\xcc\xa3", a_norm_nfc);
+    ASSERT_STR("\xe1\xb8\x8d\xcc\x87", s);
+    a_free(s);
+    
+    /* compatibility: the fi ligature, superscript two, full width A */
+    s = a_normalize_cstr("\xef\xac\x81 x\xc2\xb2 \xef\xbc\xa1", a_norm_nfkc);
+    ASSERT_STR("fi x2 A", s);
+    a_free(s);
+    s = a_normalize_cstr("\xef\xac\x81", a_norm_nfc);
+    ASSERT_STR("\xef\xac\x81", s);
+    a_free(s);
+    
+    /* Hangul is decomposed and composed without tables */
+    s = a_normalize_cstr("\xed\x95\x9c", a_norm_nfd);
+    ASSERT_STR("\xe1\x84\x92\xe1\x85\xa1\xe1\x86\xab", s);
+    s = a_normalize(s, a_norm_nfc);
+    ASSERT_STR("\xed\x95\x9c", s);
+    a_free(s);
+    
+    /* composition exclusions stay decomposed */
+    s = a_normalize_cstr("\xe0\xa5\x98", a_norm_nfc);
+    ASSERT_STR("\xe0\xa4\x95\xe0\xa4\xbc", s);
+    a_free(s);
+    
+    s = a_new("plain ascii");
+    ASSERT_EQUAL(a_norm_yes, a_is_quick_normalized(s, a_norm_nfc));
+    a_free(s);
+    s = a_new("e\xcc\x81");
+    ASSERT_EQUAL(a_norm_no, a_is_quick_normalized(s, a_norm_nfc));
+    ASSERT_EQUAL(a_norm_yes, a_is_quick_normalized(s, a_norm_nfd));
+    a_free(s);
+    s = a_new("");
+    n = a_new_normalize(s, a_norm_nfkd);
+    ASSERT_STR("", n);
+    a_free(n);
+    a_free(s);
+}
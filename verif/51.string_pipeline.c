@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (davidschor@zigwap.com), ZigWap LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "ctest.h"
+#include "aleph.h"
+
+struct tokens
+{
+    char text[512];
+    size_t offsets[64];
+    size_t count;
+    size_t max;
+};
+
+/* joins the tokens with '|', keeps their offsets */
+static int collect(const char *token, size_t size, size_t start, size_t end, void *ctx)
+{
+    struct tokens *t = ctx;
+    
+    if (strlen(t->text) + size + 2 < sizeof t->text)
+    {
+        if (t->count)
+            strcat(t->text, "|");
+        strncat(t->text, token, size);
+    }
+    t->offsets[t->count * 2] = start;
+    t->offsets[t->count * 2 + 1] = end;
+    return ++t->count != t->max;
+}
+
+static size_t run(a_pipeline p, const char *str, struct tokens *t)
+{
+    t->text[0] = '\0';
+    t->count = 0;
+    return a_pipeline_run_cstr(p, str, collect, t);
+}
+
+CTEST(Pipeline, check_pipeline_words)
+{
+    a_pipeline p = a_pipeline_new(a_pipeline_words, 0);
+    struct tokens t = {{0}, {0}, 0, 0};
+    a_str s;
+    
+    ASSERT_NOT_NULL(p);
+    ASSERT_EQUAL(8, run(p, "Don't stop: 3.14, 1,000 and U.S.A. -- foo_bar. x", &t));
+    ASSERT_STR("Don't|stop|3.14|1,000|and|U.S.A|foo_bar|x", t.text);
+    ASSERT_EQUAL(0, t.offsets[0]);
+    ASSERT_EQUAL(5, t.offsets[1]);
+    ASSERT_EQUAL(47, t.offsets[14]);
+    
+    ASSERT_EQUAL(0, run(p, "  -- ... ", &t));
+    ASSERT_EQUAL(0, run(p, "", &t));
+    
+    /* ideographs are words of their own, marks go with what they follow */
+    ASSERT_EQUAL(4, run(p, "\xe4\xb8\xad\xe6\x96\x87 cafe\xcc\x81 \xcc\x81x", &t));
+    ASSERT_STR("\xe4\xb8\xad|\xe6\x96\x87|cafe\xcc\x81|x", t.text);
+    
+    /* stops when asked to */
+    t.max = 2;
+    ASSERT_EQUAL(2, run(p, "one two three", &t));
+    ASSERT_STR("one|two", t.text);
+    t.max = 0;
+    
+    s = a_new("a b");
+    t.text[0] = '\0';
+    t.count = 0;
+    ASSERT_EQUAL(2, a_pipeline_run(p, s, collect, &t));
+    a_free(s);
+    a_pipeline_free(p);
+}
+
+CTEST(Pipeline, check_pipeline_stages)
+{
+    a_pipeline p = a_pipeline_new(a_pipeline_nfkc | a_pipeline_fold | a_pipeline_words, 0);
+    struct tokens t = {{0}, {0}, 0, 0};
+    
+    /* the fi ligature, full width letters, sharp s, Kelvin sign */
+    ASSERT_EQUAL(4, run(p, "\xef\xac\x81nd \xef\xbc\xa1\xef\xbc\xa2 Stra\xc3\x9f" "e \xe2\x84\xaa", &t));
+    ASSERT_STR("find|ab|strasse|k", t.text);
+    /* offsets are into the original text */
+    ASSERT_EQUAL(0, t.offsets[0]);
+    ASSERT_EQUAL(5, t.offsets[1]);
+    ASSERT_EQUAL(6, t.offsets[2]);
+    ASSERT_EQUAL(12, t.offsets[3]);
+    
+    /* composed in the end: E + combining acute folds to e-acute */
+    ASSERT_EQUAL(1, run(p, "CAFE\xcc\x81", &t));
+    ASSERT_STR("caf\xc3\xa9", t.text);
+    ASSERT_EQUAL(6, t.offsets[1]);
+    a_pipeline_free(p);
+    
+    p = a_pipeline_new(a_pipeline_nfc | a_pipeline_fold | a_pipeline_strip_marks | a_pipeline_words, 0);
+    ASSERT_EQUAL(3, run(p, "Cr\xc3\xa8me BR\xc3\x9bL\xc3\x89" "E na\xc3\xafve", &t));
+    ASSERT_STR("creme|brulee|naive", t.text);
+    a_pipeline_free(p);
+    
+    /* dropped code points are not there at all: the soft hyphen */
+    p = a_pipeline_new(a_pipeline_words, a_gc_cf);
+    ASSERT_EQUAL(1, run(p, "co\xc2\xad" "operate", &t));
+    ASSERT_STR("cooperate", t.text);
+    a_pipeline_free(p);
+    
+    /* without words, the whole text */
+    p = a_pipeline_new(a_pipeline_nfc | a_pipeline_fold, a_gc_punctuation);
+    ASSERT_EQUAL(1, run(p, "Hello, A\xcc\x8a!", &t));
+    ASSERT_STR("hello \xc3\xa5", t.text);
+    ASSERT_EQUAL(0, t.offsets[0]);
+    ASSERT_EQUAL(10, t.offsets[1]);
+    ASSERT_EQUAL(0, run(p, "!?", &t));
+    a_pipeline_free(p);
+}
+
+CTEST(Pipeline, check_pipeline_long)
+{
+    a_pipeline p = a_pipeline_new(a_pipeline_fold | a_pipeline_words, 0);
+    a_str s = a_new_chr("X", 1000);
+    struct tokens t = {{0}, {0}, 0, 0};
+    
+    /* tokens larger than the small buffer */
+    s = a_cat_cstr(s, " y");
+    ASSERT_EQUAL(2, a_pipeline_run(p, s, collect, &t));
+    ASSERT_EQUAL(1000, t.offsets[1]);
+    ASSERT_EQUAL(1001, t.offsets[2]);
+    a_free(s);
+    a_pipeline_free(p);
+}
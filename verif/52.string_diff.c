@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (davidschor@zigwap.com), ZigWap LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "ctest.h"
+#include "aleph.h"
+
+struct script
+{
+    const char *str1, *str2;
+    char text[1024];
+    size_t runs;
+};
+
+/* writes the script as =same -deleted +inserted */
+static int print(int op, size_t start1, size_t end1, size_t start2, size_t end2, void *ctx)
+{
+    struct script *s = ctx;
+    size_t n = strlen(s->text);
+    
+    if (n > sizeof s->text - 64)
+        return 1;
+    if (op == a_diff_insert)
+        sprintf(s->text + n, "+%.*s", (int)(end2 - start2), s->str2 + start2);
+    else
+        sprintf(s->text + n, "%c%.*s", op == a_diff_equal ? '=' : '-', (int)(end1 - start1), s->str1 + start1);
+    ++s->runs;
+    return 1;
+}
+
+static size_t diff(struct script *s, const char *str1, const char *str2, int options)
+{
+    s->str1 = str1;
+    s->str2 = str2;
+    s->text[0] = '\0';
+    s->runs = 0;
+    return a_diff_cstr(str1, str2, options, print, s);
+}
+
+CTEST(Diff, check_diff)
+{
+    struct script s;
+    a_str a = a_new("kitten"), b = a_new("sitting");
+    
+    ASSERT_EQUAL(5, a_diff(a, b, a_diff_cp, print, (s.str1 = a, s.str2 = b, s.text[0] = '\0', &s)));
+    ASSERT_STR("-k+s=itt-e+i=n+g", s.text);
+    
+    ASSERT_EQUAL(0, diff(&s, "same", "same", a_diff_cp));
+    ASSERT_STR("=same", s.text);
+    ASSERT_EQUAL(0, diff(&s, "", "", a_diff_cp));
+    ASSERT_EQUAL(0, s.runs);
+    ASSERT_EQUAL(3, diff(&s, "", "abc", a_diff_cp));
+    ASSERT_STR("+abc", s.text);
+    ASSERT_EQUAL(3, diff(&s, "abc", "", a_diff_cp));
+    ASSERT_STR("-abc", s.text);
+    
+    /* deletes and inserts between two equal runs come as one of each */
+    ASSERT_EQUAL(6, diff(&s, "xabcx", "xdefx", a_diff_cp));
+    ASSERT_STR("=x-abc+def=x", s.text);
+    
+    /* code points, not bytes: e-acute and e-grave share their first byte */
+    ASSERT_EQUAL(2, diff(&s, "caf\xc3\xa9", "caf\xc3\xa8", a_diff_cp));
+    ASSERT_STR("=caf-\xc3\xa9+\xc3\xa8", s.text);
+    ASSERT_EQUAL(2, diff(&s, "\xe4\xb8\xad\xe6\x96\x87", "\xe4\xb8\xad\xe5\x9b\xbd", a_diff_cp));
+    ASSERT_STR("=\xe4\xb8\xad-\xe6\x96\x87+\xe5\x9b\xbd", s.text);
+    a_free(a);
+    a_free(b);
+}
+
+CTEST(Diff, check_diff_units)
+{
+    struct script s;
+    
+    /* a combining mark added: a change of one code point, or of a whole grapheme */
+    ASSERT_EQUAL(1, diff(&s, "cafe", "cafe\xcc\x81", a_diff_cp));
+    ASSERT_STR("=cafe+\xcc\x81", s.text);
+    ASSERT_EQUAL(2, diff(&s, "cafe", "cafe\xcc\x81", a_diff_grapheme));
+    ASSERT_STR("=caf-e+e\xcc\x81", s.text);
+    ASSERT_EQUAL(2, diff(&s, "cafe\xcc\x81s", "cafe\xcc\x80s", a_diff_grapheme));
+    ASSERT_STR("=caf-e\xcc\x81+e\xcc\x80=s", s.text);
+    
+    ASSERT_EQUAL(2, diff(&s, "the quick brown fox", "the quack brown fox", a_diff_words));
+    ASSERT_STR("=the -quick+quack= brown fox", s.text);
+    ASSERT_EQUAL(3, diff(&s, "one two", "one two, three", a_diff_words));
+    ASSERT_STR("=one two+, three", s.text);
+    ASSERT_EQUAL(2, diff(&s, "one two", "one twofold", a_diff_words));
+    ASSERT_STR("=one -two+twofold", s.text);
+}
+
+static int count_runs(int op, size_t start1, size_t end1, size_t start2, size_t end2, void *ctx)
+{
+    size_t *sizes = ctx;
+    
+    sizes[op] += op == a_diff_insert ? end2 - start2 : end1 - start1;
+    return 1;
+}
+
+CTEST(Diff, check_diff_large)
+{
+    a_str a = a_new(""), b = a_new("");
+    size_t i, sizes[3] = {0, 0, 0};
+    
+    /* large enough for the linear space search */
+    for (i = 0; i < 3000; ++i)
+    {
+        a = a_cat_cstr(a, i % 7 ? "\xc3\xa9" : "x");
+        b = a_cat_cstr(b, i % 11 ? "\xc3\xa9" : "x");
+    }
+    ASSERT_NOT_EQUAL(A_EOS, a_diff(a, b, a_diff_cp, count_runs, sizes));
+    ASSERT_EQUAL(a_size(a), sizes[a_diff_equal] + sizes[a_diff_delete]);
+    ASSERT_EQUAL(a_size(b), sizes[a_diff_equal] + sizes[a_diff_insert]);
+    a_free(a);
+    a_free(b);
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2006-2015 David Schor (davidschor@zigwap.com), ZigWap LLC
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+#include <unistd.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "ctest.h"
+#include "aleph.h"
+
+CTEST(Transliteration, check_to_ascii)
+{
+    a_str s, t;
+    char b[A_MAX_ASCII];
+    
+    /* ASCII comes back as is */
+    s = a_new("already ascii, all of it!");
+    t = a_to_ascii(s);
+    ASSERT_TRUE(s == t);
+    ASSERT_STR("already ascii, all of it!", t);
+    a_free(t);
+    
+    /* marks stripped, ligatures and letters spelled out */
+    s = a_to_ascii(a_new("Cr\xc3\xa8me br\xc3\xbbl\xc3\xa9" "e, \xc3\x86sir, Stra\xc3\x9f" "e, \xc5\x81\xc3\xb3" "d\xc5\xba"));
+    ASSERT_STR("Creme brulee, AEsir, Strasse, Lodz", s);
+    ASSERT_EQUAL(a_size(s), a_len(s));
+    ASSERT_EQUAL(strlen(s), a_size(s));
+    a_free(s);
+    
+    /* combining marks are dropped */
+    s = a_to_ascii_cstr("e\xcc\x81te\xcc\x81");
+    ASSERT_STR("ete", s);
+    a_free(s);
+    
+    /* Cyrillic and Greek */
+    s = a_to_ascii_cstr("\xd0\x96\xd1\x83\xd0\xba\xd0\xbe\xd0\xb2 \xd0\xa9\xd0\xb8 \xce\x91\xce\xb8\xce\xae\xce\xbd\xce\xb1");
+    ASSERT_STR("Zhukov Shchi Athena", s);
+    a_free(s);
+    
+    /* compatibility forms, digits of other scripts, punctuation */
+    s = a_to_ascii_cstr("\xef\xac\x81\xc2\xbd \xef\xbc\xa1\xd9\xa3 \xe2\x80\x9cok\xe2\x80\x9d \xe2\x80\x94 \xe2\x82\xac" "5");
+    ASSERT_STR("fi1/2 A3 \"ok\" -- EUR5", s);
+    a_free(s);
+    
+    /* no transliteration: dropped, the ASCII around it kept */
+    s = a_to_ascii_cstr("a\xe4\xb8\xad" "b");
+    ASSERT_STR("ab", s);
+    a_free(s);
+    
+    /* a sequence cut off by the end is dropped as well */
+    s = a_to_ascii(a_new_size("ab\xf0", 3));
+    ASSERT_STR("ab", s);
+    ASSERT_EQUAL(2, a_size(s));
+    a_free(s);
+    s = a_to_ascii_cstr("\xc3\xa9t\xc3\xa9\xe2\x82");
+    ASSERT_STR("ete", s);
+    a_free(s);
+    
+    /* runs longer than a vector */
+    s = a_to_ascii_cstr("0123456789abcdef0123456789abcdef\xc3\xa9" "0123456789abcdef0123456789");
+    ASSERT_STR("0123456789abcdef0123456789abcdefe0123456789abcdef0123456789", s);
+    a_free(s);
+    s = a_to_ascii_cstr("");
+    ASSERT_STR("", s);
+    ASSERT_EQUAL(0, a_size(s));
+    a_free(s);
+    
+    ASSERT_STR("ss", a_to_ascii_cp(0xDF, b));
+    ASSERT_STR("shch", a_to_ascii_cp(0x0449, b));
+    ASSERT_STR("q", a_to_ascii_cp('q', b));
+    ASSERT_STR("", a_to_ascii_cp(0x4E2D, b));
+    
+    /* digraphs follow their decomposition, both letters kept */
+    ASSERT_STR("Dz", a_to_ascii_cp(0x01C5, b));
+    ASSERT_STR("Lj", a_to_ascii_cp(0x01C8, b));
+    ASSERT_STR("Nj", a_to_ascii_cp(0x01CB, b));
+    ASSERT_STR("Dz", a_to_ascii_cp(0x01F2, b));
+    ASSERT_STR("DZ", a_to_ascii_cp(0x01C4, b));
+}
@@ -21,6 +21,9 @@
  */
 #include <unistd.h>
 #include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
 #include "ctest.h"
 #include "aleph.h"
 
@@ -218,4 +221,67 @@ CTEST(Concatenation, check_cat_cp)
     ASSERT_EQUAL(0, a_icmp_cstr(a, "ᚠᚡᚢᚣᚤᚥᚦᚧᚨᚩᚪᚫᚬᚭᚮᚯᚰᚱᚲᚳᚴᚵᚶᚷᚸᚹᚺᚻᚼᚽᚾᚿᛀᛁᛂᛃᛄᛅᛆᛇᛈᛉᛊᛋᛌᛍᛎᛏᛐᛑᛒᛓᛔᛕᛖᛗᛘᛙᛚᛛᛜᛝᛞᛟᛠᛡᛢᛣᛤᛥᛦᛧᛨᛩᛪ᛫᛬᛭ᛮᛯᛰᛱᛲᛳᛴᛵᛶᛷᛸ"));
        
     a_free(a);
-}
\ No newline at end of file
+}
+CTEST(Concatenation, check_cat_numbers)
+{ 
+    a_str a;
+    unsigned long u[] = {0, 9, 10, 99, 100, 4294967295UL, (unsigned long)-1};
+    long l[] = {-1, 0, LONG_MIN, LONG_MAX};
+    char b[256];
+    int i;
+    
+    a = a_new("");
+    for (i = 0; i < 7; ++i)
+    {
+        a_clear(a);
+        a = a_cat_ulong(a, u[i]);
+        snprintf(b, sizeof b, "%lu", u[i]);
+        ASSERT_STR(b, a);
+        ASSERT_EQUAL(strlen(b), a_len(a));
+    }
+    
+    /* forces the buffer to grow on each call */
+    a_free(a);
+    a = a_new("");
+    for (i = 0; i < 4; ++i)
+        a = a_cat_long(a, l[i]);
+    snprintf(b, sizeof b, "%ld%ld%ld%ld", l[0], l[1], l[2], l[3]);
+    ASSERT_STR(b, a);
+    ASSERT_EQUAL(strlen(b), a_size(a));
+    
+    a_clear(a);
+    a = a_cat_ulong_vec(a, u, 7, "·");
+    snprintf(b, sizeof b, "%lu·%lu·%lu·%lu·%lu·%lu·%lu", u[0], u[1], u[2], u[3], u[4], u[5], u[6]);
+    ASSERT_STR(b, a);
+    ASSERT_EQUAL(a_len_cstr(b), a_len(a));
+    
+    a_clear(a);
+    a = a_cat_long_vec(a, l, 4, NULL);
+    snprintf(b, sizeof b, "%ld%ld%ld%ld", l[0], l[1], l[2], l[3]);
+    ASSERT_STR(b, a);
+    
+    a_free(a);
+}
+
+CTEST(Concatenation, check_cat_double)
+{ 
+    a_str a;
+    double d[] = {0.1, -2.5, 1e16, 1e15, 5e-324, 1.7976931348623157e308, 1e-5, 0.0001, 100.0};
+    
+    a = a_new("");
+    a = a_cat_double(a, 0.0);
+    ASSERT_STR("0.0", a);
+    
+    a_clear(a);
+    a = a_cat_double(a, 0.1 + 0.2);
+    ASSERT_STR("0.30000000000000004", a);
+    ASSERT_EQUAL(19, a_len(a));
+    
+    a_clear(a);
+    a = a_cat_double_vec(a, d, 9, ", ");
+    ASSERT_STR("0.1, -2.5, 1e+16, 1000000000000000.0, 5e-324, 1.7976931348623157e+308, 1e-05, 0.0001, 100.0", a);
+    ASSERT_EQUAL(strlen(a), a_len(a));
+    ASSERT_EQUAL(strlen(a), a_size(a));
+    
+    a_free(a);
+}
@@ -0,0 +1,87 @@
+#include "aleph.h"
+#include <stdio.h>
+#include <time.h>
+
+/*
+ * Longest prefix lookups over a set of routes: a_startswith() and
+ * a_istartswith() over every key, against an a_trie.
+ *
+ *   cc -O2 -I../../build trie_bench.c ../../build/aleph.c -o trie_bench
+ */
+#define KEYS 2000
+#define LOOKUPS 20000
+
+static a_str keys[KEYS], paths[LOOKUPS], ipaths[LOOKUPS];
+
+static double seconds(clock_t start)
+{
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static void linear(const char *name, a_str *strs, int (*starts)(a_cstr, a_cstr))
+{
+    size_t i, j, best, found = 0;
+    clock_t start = clock();
+    
+    for (i = 0; i < LOOKUPS; ++i)
+    {
+        for (j = 0, best = A_EOS; j < KEYS; ++j)
+            if (starts(strs[i], keys[j]) && (best == A_EOS || a_size(keys[j]) > a_size(keys[best])))
+                best = j;
+        found += best != A_EOS;
+    }
+    printf("%-16s %8.4fs for %d lookups, %lu found\n", name, seconds(start), LOOKUPS, (unsigned long)found);
+}
+
+static void trie(const char *name, a_str *strs, a_trie t)
+{
+    size_t i, found = 0;
+    clock_t start = clock();
+    
+    for (i = 0; i < LOOKUPS; ++i)
+        found += a_trie_longest_prefix(t, strs[i], NULL, NULL) != A_EOS;
+    printf("%-16s %8.4fs for %d lookups, %lu found\n", name, seconds(start), LOOKUPS, (unsigned long)found);
+}
+
+int main()
+{
+    char b[64];
+    size_t i;
+    clock_t start;
+    a_trie t = a_trie_new(), ti = a_trie_new_icase();
+    
+    for (i = 0; i < KEYS; ++i)
+    {
+        sprintf(b, "/api/v%lu/r\xC3\xA9source%lu", (unsigned long)(i % 7), (unsigned long)i);
+        keys[i] = a_new(b);
+    }
+    for (i = 0; i < LOOKUPS; ++i)
+    {
+        sprintf(b, "/api/v%lu/r\xC3\xA9source%lu/item", (unsigned long)(i % 7), (unsigned long)(i % KEYS));
+        paths[i] = a_new(b);
+        sprintf(b, "/API/V%lu/R\xC3\x89SOURCE%lu/item", (unsigned long)(i % 7), (unsigned long)(i % KEYS));
+        ipaths[i] = a_new(b);
+    }
+    
+    start = clock();
+    for (i = 0; i < KEYS; ++i)
+        a_trie_set(t, keys[i], NULL);
+    printf("%-16s %8.4fs for %d keys\n", "insert", seconds(start), KEYS);
+    start = clock();
+    for (i = 0; i < KEYS; ++i)
+        a_trie_set(ti, keys[i], NULL);
+    printf("%-16s %8.4fs for %d keys\n", "insert icase", seconds(start), KEYS);
+    
+    linear("a_startswith", paths, a_startswith);
+    trie("a_trie", paths, t);
+    linear("a_istartswith", ipaths, a_istartswith);
+    trie("a_trie icase", ipaths, ti);
+    
+    a_trie_free(t);
+    a_trie_free(ti);
+    for (i = 0; i < KEYS; ++i)
+        a_free(keys[i]);
+    for (i = 0; i < LOOKUPS; ++i)
+        a_free(paths[i]), a_free(ipaths[i]);
+    return 0;
+}